@@ -0,0 +1,59 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef BASE_BENCHMARK_COMMON_HPP
+#define BASE_BENCHMARK_COMMON_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/BenchmarkRunner.hpp>
+
+#include <memory>
+#include <vector>
+
+/**
+ * Grid type, dimensionality, and level of a benchmark case.
+ */
+struct BenchmarkGridConfiguration {
+  sgpp::base::GridType type;
+  size_t dim;
+  sgpp::base::level_t level;
+};
+
+/**
+ * @return runner shared by all benchmark cases, writes the results at the end
+ */
+sgpp::base::BenchmarkRunner& getBenchmarkRunner();
+
+/**
+ * @return grid configurations used by the grid and operation benchmarks
+ *         (linear, modified linear, linear boundary, and cubic B-spline grids of
+ *         increasing dimensionality)
+ */
+std::vector<BenchmarkGridConfiguration> getBenchmarkGridConfigurations();
+
+/**
+ * @param configuration   grid configuration
+ * @return regular sparse grid for the configuration
+ */
+std::unique_ptr<sgpp::base::Grid> createBenchmarkGrid(
+    const BenchmarkGridConfiguration& configuration);
+
+/**
+ * @param configuration   grid configuration
+ * @param grid            grid created for the configuration
+ * @return parameters of the benchmark case
+ */
+sgpp::base::BenchmarkRunner::Parameters getBenchmarkParameters(
+    const BenchmarkGridConfiguration& configuration, sgpp::base::Grid& grid);
+
+/**
+ * @param numberOfPoints  number of points
+ * @param dim             dimensionality
+ * @return uniformly distributed pseudo-random points in \f$[0, 1]^d\f$ (fixed seed)
+ */
+sgpp::base::DataMatrix createBenchmarkPoints(size_t numberOfPoints, size_t dim);
+
+#endif /* BASE_BENCHMARK_COMMON_HPP */
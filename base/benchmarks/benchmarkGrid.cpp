@@ -0,0 +1,77 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "BenchmarkCommon.hpp"
+
+using sgpp::base::BenchmarkRunner;
+using sgpp::base::Grid;
+using sgpp::base::GridStorage;
+using sgpp::base::HashGridPoint;
+
+BOOST_AUTO_TEST_SUITE(benchmarkGrid)
+
+BOOST_AUTO_TEST_CASE(benchmarkRegularGridConstruction) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+
+  for (const BenchmarkGridConfiguration& configuration : getBenchmarkGridConfigurations()) {
+    std::unique_ptr<Grid> grid = createBenchmarkGrid(configuration);
+    const size_t gridSize = grid->getSize();
+
+    // grid generation is sequential
+    runner.run("RegularGridConstruction", getBenchmarkParameters(configuration, *grid), 1,
+               static_cast<double>(gridSize),
+               [&configuration, gridSize]() {
+                 std::unique_ptr<Grid> newGrid = createBenchmarkGrid(configuration);
+                 BOOST_CHECK_EQUAL(newGrid->getSize(), gridSize);
+               });
+  }
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkHashGridStorageLookup) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+
+  for (const BenchmarkGridConfiguration& configuration : getBenchmarkGridConfigurations()) {
+    std::unique_ptr<Grid> grid = createBenchmarkGrid(configuration);
+    const GridStorage& storage = grid->getStorage();
+    const size_t gridSize = storage.getSize();
+
+    // look up the grid points in random order to avoid favoring the insertion order
+    std::vector<HashGridPoint> points;
+
+    for (size_t k = 0; k < gridSize; k++) {
+      points.push_back(storage[k]);
+    }
+
+    std::shuffle(points.begin(), points.end(), std::mt19937(42));
+
+    for (size_t numberOfThreads : runner.getNumbersOfThreads()) {
+      runner.run("HashGridStorageLookup", getBenchmarkParameters(configuration, *grid),
+                 numberOfThreads, static_cast<double>(gridSize), [&storage, &points, gridSize]() {
+                   size_t numberOfFoundPoints = 0;
+
+#pragma omp parallel for schedule(static) reduction(+ : numberOfFoundPoints)
+                   for (size_t k = 0; k < gridSize; k++) {
+                     if (storage.getSequenceNumber(points[k]) < gridSize) {
+                       numberOfFoundPoints++;
+                     }
+                   }
+
+                   BOOST_CHECK_EQUAL(numberOfFoundPoints, gridSize);
+                 });
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,132 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+
+#include <cmath>
+#include <memory>
+
+#include "BenchmarkCommon.hpp"
+
+using sgpp::base::BenchmarkRunner;
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridType;
+
+namespace {
+
+/**
+ * @return values of a smooth test function at the grid points
+ */
+DataVector getFunctionValues(Grid& grid) {
+  const size_t gridSize = grid.getSize();
+  DataVector values(gridSize);
+  DataVector x(grid.getDimension());
+
+  for (size_t k = 0; k < gridSize; k++) {
+    grid.getStorage().getCoordinates(grid.getStorage()[k], x);
+    values[k] = std::exp(-x.dotProduct(x));
+  }
+
+  return values;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(benchmarkOperation)
+
+BOOST_AUTO_TEST_CASE(benchmarkHierarchisation) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+
+  for (const BenchmarkGridConfiguration& configuration : getBenchmarkGridConfigurations()) {
+    // B-spline hierarchisation requires solving a linear system
+    if (configuration.type == GridType::Bspline) {
+      continue;
+    }
+
+    std::unique_ptr<Grid> grid = createBenchmarkGrid(configuration);
+    std::unique_ptr<sgpp::base::OperationHierarchisation> op(
+        sgpp::op_factory::createOperationHierarchisation(*grid));
+    DataVector alpha = getFunctionValues(*grid);
+
+    for (size_t numberOfThreads : runner.getNumbersOfThreads()) {
+      // hierarchisation and dehierarchisation restore the values up to rounding errors
+      runner.run("Hierarchisation", getBenchmarkParameters(configuration, *grid),
+                 numberOfThreads, static_cast<double>(grid->getSize()), [&op, &alpha]() {
+                   op->doHierarchisation(alpha);
+                   op->doDehierarchisation(alpha);
+                 });
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkEvalNaive) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+  const size_t numberOfPoints = 1000;
+
+  for (const BenchmarkGridConfiguration& configuration : getBenchmarkGridConfigurations()) {
+    std::unique_ptr<Grid> grid = createBenchmarkGrid(configuration);
+    std::unique_ptr<sgpp::base::OperationEval> op(
+        sgpp::op_factory::createOperationEvalNaive(*grid));
+    const DataVector alpha = getFunctionValues(*grid);
+    const DataMatrix points = createBenchmarkPoints(numberOfPoints, configuration.dim);
+
+    // OperationEvalNaive caches 1D values and is evaluated sequentially
+    runner.run("EvalNaive", getBenchmarkParameters(configuration, *grid), 1,
+               static_cast<double>(numberOfPoints), [&op, &alpha, &points, numberOfPoints]() {
+                 DataVector point(points.getNcols());
+                 double sum = 0.0;
+
+                 for (size_t i = 0; i < numberOfPoints; i++) {
+                   points.getRow(i, point);
+                   sum += op->eval(alpha, point);
+                 }
+
+                 BOOST_CHECK(std::isfinite(sum));
+               });
+  }
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkMultipleEval) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+  const size_t numberOfPoints = 1000;
+
+  for (const BenchmarkGridConfiguration& configuration : getBenchmarkGridConfigurations()) {
+    // no default OperationMultipleEval for B-spline grids
+    if (configuration.type == GridType::Bspline) {
+      continue;
+    }
+
+    std::unique_ptr<Grid> grid = createBenchmarkGrid(configuration);
+    DataMatrix points = createBenchmarkPoints(numberOfPoints, configuration.dim);
+    std::unique_ptr<sgpp::base::OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(*grid, points));
+    DataVector alpha = getFunctionValues(*grid);
+    DataVector result(numberOfPoints);
+    DataVector transposedResult(grid->getSize());
+
+    for (size_t numberOfThreads : runner.getNumbersOfThreads()) {
+      runner.run("MultipleEval::mult", getBenchmarkParameters(configuration, *grid),
+                 numberOfThreads, static_cast<double>(numberOfPoints),
+                 [&op, &alpha, &result]() { op->mult(alpha, result); });
+      runner.run("MultipleEval::multTranspose", getBenchmarkParameters(configuration, *grid),
+                 numberOfThreads, static_cast<double>(numberOfPoints),
+                 [&op, &result, &transposedResult]() {
+                   op->multTranspose(result, transposedResult);
+                 });
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
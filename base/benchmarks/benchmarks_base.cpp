@@ -0,0 +1,112 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE SGppBaseBenchmarks
+#include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+
+#include "BenchmarkCommon.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+sgpp::base::BenchmarkRunner& getBenchmarkRunner() {
+  static sgpp::base::BenchmarkRunner runner;
+  return runner;
+}
+
+std::vector<BenchmarkGridConfiguration> getBenchmarkGridConfigurations() {
+  std::vector<BenchmarkGridConfiguration> configurations;
+
+  for (sgpp::base::GridType type :
+       {sgpp::base::GridType::Linear, sgpp::base::GridType::ModLinear,
+        sgpp::base::GridType::LinearBoundary, sgpp::base::GridType::Bspline}) {
+    // boundary grids have many more points in higher dimensions, use lower levels
+    const bool hasBoundary = (type == sgpp::base::GridType::LinearBoundary);
+    configurations.push_back(BenchmarkGridConfiguration{type, 2, 10});
+    configurations.push_back(BenchmarkGridConfiguration{type, 4, hasBoundary ? 5u : 7u});
+    configurations.push_back(BenchmarkGridConfiguration{type, 8, hasBoundary ? 1u : 5u});
+  }
+
+  return configurations;
+}
+
+std::unique_ptr<sgpp::base::Grid> createBenchmarkGrid(
+    const BenchmarkGridConfiguration& configuration) {
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.type_ = configuration.type;
+  gridConfig.dim_ = configuration.dim;
+  gridConfig.level_ = static_cast<int>(configuration.level);
+  gridConfig.maxDegree_ = 3;
+  gridConfig.boundaryLevel_ = 1;
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createGrid(gridConfig));
+  grid->getGenerator().regular(configuration.level);
+  return grid;
+}
+
+sgpp::base::BenchmarkRunner::Parameters getBenchmarkParameters(
+    const BenchmarkGridConfiguration& configuration, sgpp::base::Grid& grid) {
+  return sgpp::base::BenchmarkRunner::Parameters{
+      {"gridType", grid.getTypeAsString()},
+      {"dim", std::to_string(configuration.dim)},
+      {"level", std::to_string(configuration.level)},
+      {"gridSize", std::to_string(grid.getSize())}};
+}
+
+sgpp::base::DataMatrix createBenchmarkPoints(size_t numberOfPoints, size_t dim) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  sgpp::base::DataMatrix points(numberOfPoints, dim);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t t = 0; t < dim; t++) {
+      points(i, t) = distribution(generator);
+    }
+  }
+
+  return points;
+}
+
+/**
+ * Reads the settings from the environment at the start and writes the results to
+ * benchmarks_base.json in the directory given by SGPP_BENCHMARK_OUTPUT_DIR
+ * (default: working directory) at the end.
+ */
+struct BenchmarkFixture {
+  BenchmarkFixture() { getBenchmarkRunner().configureFromEnvironment(); }
+
+  ~BenchmarkFixture() {
+    const char* outputDirectory = std::getenv("SGPP_BENCHMARK_OUTPUT_DIR");
+    getBenchmarkRunner().writeJSON(
+        ((outputDirectory != nullptr) ? std::string(outputDirectory) + "/" : std::string()) +
+        "benchmarks_base.json");
+  }
+};
+
+#if BOOST_VERSION >= 105900
+BOOST_GLOBAL_FIXTURE(BenchmarkFixture);
+#else
+BOOST_GLOBAL_FIXTURE(BenchmarkFixture)
+#endif /* BOOST_VERSION >= 105900 */
+
+// fix for clang (from https://stackoverflow.com/a/33755176)
+#ifdef __clang__
+namespace boost {
+namespace unit_test {
+namespace ut_detail {
+
+std::string normalize_test_case_name(const_string name) {
+    return ((name[0] == '&') ? std::string(name.begin() + 1, name.size() - 1) :
+                               std::string(name.begin(), name.size()));
+}
+
+}  // namespace ut_detail
+}  // namespace unit_test
+}  // namespace boost
+#endif
@@ -0,0 +1,88 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// arg 1: number of data points (default 100000)
+// arg 2: dimension (default 5)
+// arg 3: level of the regular grid (default 6)
+// arg 4: maximum number of threads (default: all)
+//
+// Compares the runtime of the transposed product B^T v on a modified linear grid for both
+// accumulation strategies of AlgorithmDGEMV and an increasing number of threads. The private
+// copies need (number of threads) * (grid points) scratch and become slow if they do not fit into
+// the caches, the owner computes strategy only needs scratch proportional to the grid size.
+int main(int argc, char* argv[]) {
+  size_t numDataPoints = (argc > 1) ? std::atoi(argv[1]) : 100000;
+  size_t dim = (argc > 2) ? std::atoi(argv[2]) : 5;
+  size_t level = (argc > 3) ? std::atoi(argv[3]) : 6;
+  int maxThreads = 1;
+#ifdef _OPENMP
+  maxThreads = omp_get_max_threads();
+#endif
+  maxThreads = (argc > 4) ? std::atoi(argv[4]) : maxThreads;
+
+  std::mt19937 mt(42);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  sgpp::base::DataMatrix data(numDataPoints, dim);
+  sgpp::base::DataVector source(numDataPoints);
+
+  for (size_t i = 0; i < numDataPoints; i++) {
+    source[i] = uniform(mt);
+
+    for (size_t d = 0; d < dim; d++) {
+      data.set(i, d, uniform(mt));
+    }
+  }
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModLinearGrid(dim));
+  grid->getGenerator().regular(level);
+  sgpp::base::LinearModifiedBasis<unsigned int, unsigned int> basis;
+  sgpp::base::DataVector result(grid->getSize());
+
+  std::cout << "data points: " << numDataPoints << ", grid points: " << grid->getSize()
+            << std::endl;
+  std::cout << "threads, private copies [s], owner computes [s]" << std::endl;
+
+  const std::vector<sgpp::base::DGEMVAccumulation> strategies = {
+      sgpp::base::DGEMVAccumulation::PrivateCopies,
+      sgpp::base::DGEMVAccumulation::OwnerComputes};
+
+  for (int numThreads = 1; numThreads <= maxThreads; numThreads *= 2) {
+#ifdef _OPENMP
+    omp_set_num_threads(numThreads);
+#endif
+    std::cout << numThreads;
+
+    for (auto strategy : strategies) {
+      sgpp::base::AlgorithmDGEMV<sgpp::base::SLinearModifiedBase> op(strategy);
+      sgpp::base::SGppStopwatch stopwatch;
+      stopwatch.start();
+      op.mult_transposed(grid->getStorage(), basis, source, data, result);
+      std::cout << ", " << stopwatch.stop();
+    }
+
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
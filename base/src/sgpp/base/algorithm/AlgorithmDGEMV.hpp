@@ -11,17 +11,37 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 
 #include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
+#include <sgpp/base/tools/ExecutionContext.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <vector>
 #include <utility>
 #include <iostream>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 namespace sgpp {
 namespace base {
 
+/**
+ * Strategy for accumulating the result of AlgorithmDGEMV::mult_transposed in parallel.
+ */
+enum class DGEMVAccumulation {
+  /// every thread accumulates into a private copy of the result, the copies are summed up in
+  /// parallel afterwards, needs (number of threads) * N scratch
+  PrivateCopies,
+  /// the grid points are partitioned into contiguous index ranges owned by one thread each, the
+  /// contributions of blocks of data points are sent to the owners, needs O(N) scratch
+  OwnerComputes,
+  /// private copies as long as they are small, owner computes otherwise
+  Automatic
+};
+
 /**
  * Basic multiplaction with B and B^T on grids with no boundaries.
  * If there are @f$N@f$ basis functions @f$\varphi(\vec{x})@f$ and @f$m@f$ data points, then B is a (Nxm) matrix, with
@@ -32,6 +52,14 @@ namespace base {
 template<class BASIS>
 class AlgorithmDGEMV {
  public:
+  /**
+   * Constructor
+   *
+   * @param accumulation how the threads accumulate the result of mult_transposed
+   */
+  explicit AlgorithmDGEMV(DGEMVAccumulation accumulation = DGEMVAccumulation::Automatic)
+    : accumulation(accumulation) {}
+
   /**
    * Performs the DGEMV Operation on the grid
    *
@@ -45,36 +73,21 @@ class AlgorithmDGEMV {
    */
   void mult_transposed(GridStorage& storage, BASIS& basis,
                        const DataVector& source, DataMatrix& x, DataVector& result) {
-    typedef std::vector<std::pair<size_t, double> > IndexValVector;
-
-    result.setAll(0.0);
-
-    #pragma omp parallel
-    {
-      size_t source_size = source.getSize();
-      DataVector privateResult(result);
-      DataVector line(x.getNcols());
-      IndexValVector vec;
-      GetAffectedBasisFunctions<BASIS> ga(storage);
-
-      #pragma omp for schedule(static)
-
-      for (size_t i = 0; i < source_size; i++) {
-        vec.clear();
-
-        x.getRow(i, line);
+    const int numThreads = static_cast<int>(
+        ExecutionContext::getInstance().getNumberOfThreadsForRegion(x.getNrows()));
 
-        ga(basis, line, vec);
+    DGEMVAccumulation strategy = accumulation;
 
-        for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
-          privateResult[iter->first] += iter->second * source[i];
-        }
-      }
+    if (strategy == DGEMVAccumulation::Automatic) {
+      strategy = (numThreads == 1 ||
+                  static_cast<size_t>(numThreads) * result.getSize() <= MAX_PRIVATE_COPIES_SIZE)
+                 ? DGEMVAccumulation::PrivateCopies : DGEMVAccumulation::OwnerComputes;
+    }
 
-      #pragma omp critical
-      {
-        result.add(privateResult);
-      }
+    if (strategy == DGEMVAccumulation::PrivateCopies) {
+      multTransposedPrivateCopies(storage, basis, source, x, result, numThreads);
+    } else {
+      multTransposedOwnerComputes(storage, basis, source, x, result, numThreads);
     }
   }
   // implementation requires OpenMP 4.0 support
@@ -130,8 +143,10 @@ class AlgorithmDGEMV {
     typedef std::vector<std::pair<size_t, double> > IndexValVector;
 
     result.setAll(0.0);
+    const size_t numThreads =
+        ExecutionContext::getInstance().getNumberOfThreadsForRegion(result.getSize());
 
-    #pragma omp parallel
+    #pragma omp parallel num_threads(numThreads)
     {
       size_t result_size = result.getSize();
 
@@ -155,6 +170,140 @@ class AlgorithmDGEMV {
       }
     }
   }
+
+ private:
+  typedef std::vector<std::pair<size_t, double> > IndexValVector;
+
+  /// number of doubles of all private copies up to which Automatic chooses PrivateCopies
+  static const size_t MAX_PRIVATE_COPIES_SIZE = size_t(1) << 22;
+  /// number of data points a thread handles between two exchanges with the owners
+  static const size_t OWNER_COMPUTES_BLOCK_SIZE = 256;
+
+  /// the strategy of mult_transposed
+  DGEMVAccumulation accumulation;
+
+  /**
+   * mult_transposed with one private result per thread, which are summed up in parallel
+   */
+  void multTransposedPrivateCopies(GridStorage& storage, BASIS& basis, const DataVector& source,
+                                   DataMatrix& x, DataVector& result, int numThreads) {
+    const size_t source_size = source.getSize();
+    const size_t result_size = result.getSize();
+    std::vector<DataVector> privateResults(numThreads);
+
+    #pragma omp parallel num_threads(numThreads)
+    {
+      int thread = 0;
+      int usedThreads = 1;
+#ifdef _OPENMP
+      thread = omp_get_thread_num();
+      usedThreads = omp_get_num_threads();
+#endif
+      DataVector& privateResult = privateResults[thread];
+      privateResult.resizeZero(result_size);
+      DataVector line(x.getNcols());
+      IndexValVector vec;
+      GetAffectedBasisFunctions<BASIS> ga(storage);
+
+      #pragma omp for schedule(static)
+
+      for (size_t i = 0; i < source_size; i++) {
+        vec.clear();
+
+        x.getRow(i, line);
+
+        ga(basis, line, vec);
+
+        for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
+          privateResult[iter->first] += iter->second * source[i];
+        }
+      }
+
+      // the implicit barrier of the loop guarantees that all copies are complete
+      #pragma omp for schedule(static)
+
+      for (size_t j = 0; j < result_size; j++) {
+        double sum = 0.0;
+
+        for (int t = 0; t < usedThreads; t++) {
+          sum += privateResults[t][j];
+        }
+
+        result[j] = sum;
+      }
+    }
+  }
+
+  /**
+   * mult_transposed with the grid points partitioned among the threads, the contributions are
+   * exchanged in rounds of OWNER_COMPUTES_BLOCK_SIZE data points per thread
+   */
+  void multTransposedOwnerComputes(GridStorage& storage, BASIS& basis, const DataVector& source,
+                                   DataMatrix& x, DataVector& result, int numThreads) {
+    const size_t source_size = source.getSize();
+    const size_t result_size = result.getSize();
+
+    result.setAll(0.0);
+
+    // buckets[t][o] holds the contributions of thread t to the grid points owned by thread o
+    std::vector<std::vector<IndexValVector> > buckets(
+      numThreads, std::vector<IndexValVector>(numThreads));
+
+    #pragma omp parallel num_threads(numThreads)
+    {
+      int thread = 0;
+      int usedThreads = 1;
+#ifdef _OPENMP
+      thread = omp_get_thread_num();
+      usedThreads = omp_get_num_threads();
+#endif
+      const size_t dataChunk = (source_size + usedThreads - 1) / usedThreads;
+      const size_t dataBegin = std::min(source_size, thread * dataChunk);
+      const size_t dataEnd = std::min(source_size, dataBegin + dataChunk);
+      const size_t ownerChunk = std::max(size_t(1), (result_size + usedThreads - 1) / usedThreads);
+      // all threads take part in the same number of exchanges
+      const size_t numRounds = (dataChunk + OWNER_COMPUTES_BLOCK_SIZE - 1) /
+                               OWNER_COMPUTES_BLOCK_SIZE;
+
+      DataVector line(x.getNcols());
+      IndexValVector vec;
+      GetAffectedBasisFunctions<BASIS> ga(storage);
+      std::vector<IndexValVector>& ownBuckets = buckets[thread];
+
+      for (size_t round = 0; round < numRounds; round++) {
+        const size_t blockBegin = std::min(dataEnd, dataBegin + round * OWNER_COMPUTES_BLOCK_SIZE);
+        const size_t blockEnd = std::min(dataEnd, blockBegin + OWNER_COMPUTES_BLOCK_SIZE);
+
+        for (size_t i = blockBegin; i < blockEnd; i++) {
+          vec.clear();
+
+          x.getRow(i, line);
+
+          ga(basis, line, vec);
+
+          for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
+            ownBuckets[iter->first / ownerChunk].push_back(
+              std::make_pair(iter->first, iter->second * source[i]));
+          }
+        }
+
+        #pragma omp barrier
+
+        // every thread writes only to the grid points it owns, in a fixed order of the senders
+        for (int sender = 0; sender < usedThreads; sender++) {
+          IndexValVector& bucket = buckets[sender][thread];
+
+          for (IndexValVector::iterator iter = bucket.begin(); iter != bucket.end(); iter++) {
+            result[iter->first] += iter->second;
+          }
+
+          bucket.clear();
+        }
+
+        #pragma omp barrier
+      }
+    }
+  }
 };
 
 }  // namespace base
@@ -9,6 +9,7 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/tools/ExecutionContext.hpp>
 
 #include <sgpp/base/algorithm/AlgorithmEvaluation.hpp>
 #include <sgpp/base/algorithm/AlgorithmEvaluationTransposed.hpp>
@@ -49,7 +50,10 @@ class AlgorithmMultipleEvaluation {
     result.setAll(0.0);
     size_t source_size = source.getSize();
 
-#pragma omp parallel
+    const size_t numberOfThreads =
+        ExecutionContext::getInstance().getNumberOfThreadsForRegion(source_size);
+
+#pragma omp parallel num_threads(numberOfThreads)
     {
       DataVector privateResult(result.getSize());
 
@@ -107,7 +111,10 @@ class AlgorithmMultipleEvaluation {
     result.setAll(0.0);
     size_t result_size = result.getSize();
 
-#pragma omp parallel
+    const size_t numberOfThreads =
+        ExecutionContext::getInstance().getNumberOfThreadsForRegion(result_size);
+
+#pragma omp parallel num_threads(numberOfThreads)
     {
       DataVector line(x.getNcols());
       AlgorithmEvaluation<BASIS> AlgoEval(storage);
@@ -0,0 +1,350 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef CACHEDDESIGNMATRIX_HPP
+#define CACHEDDESIGNMATRIX_HPP
+
+#include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/tools/ExecutionContext.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Sparse representation of the matrix B of a multiple evaluation with
+ * @f[ (B)_{j,i} = \varphi_i(x_j), @f]
+ * which is recorded once by traversing the hierarchy with GetAffectedBasisFunctions and then
+ * serves repeated products with B and B^T, e.g. in every CG iteration on a fixed grid and dataset.
+ *
+ * The matrix is stored twice, row-wise (CSR) for B alpha and column-wise (CSC) for B^T v, so that
+ * both products are parallelized over their result entries without write conflicts. If the matrix
+ * does not fit into the memory budget, nothing is stored and the caller has to fall back to
+ * recomputing the basis functions.
+ *
+ * The cached matrix is only recorded again after clear(), so the owning operation has to call it
+ * from prepare() and prepare() has to be called whenever the grid (e.g., after refinement or
+ * coarsening) or the data points (also in place) change. As a cheap safety net, a changed number of
+ * grid points or a changed shape of the dataset is detected and the matrix is recorded again.
+ */
+class CachedDesignMatrix {
+ public:
+  /**
+   * Constructor
+   *
+   * @param memoryBudget maximum number of bytes the cached matrix may occupy, 0 disables caching
+   */
+  explicit CachedDesignMatrix(size_t memoryBudget = 0)
+      : memoryBudget(memoryBudget), valid(false), exceeded(false) {}
+
+  /**
+   * Records the matrix if there is none for the current grid and dataset, see the class description
+   * for when this happens.
+   *
+   * @param storage the storage of the grid
+   * @param basis the basis of the grid
+   * @param x the data points, one per row
+   * @return true if the cached matrix can be used, false if caching is disabled or the matrix does
+   * not fit into the memory budget
+   */
+  template <class BASIS>
+  bool update(GridStorage& storage, BASIS& basis, DataMatrix& x) {
+    if (memoryBudget == 0) {
+      return false;
+    }
+
+    Key key;
+    key.gridSize = storage.getSize();
+    key.numRows = x.getNrows();
+    key.numColumns = x.getNcols();
+
+    if (key == currentKey && (valid || exceeded)) {
+      return valid;
+    }
+
+    clear();
+    currentKey = key;
+
+    // the indices are stored with 32 bit
+    if (storage.getSize() > std::numeric_limits<uint32_t>::max() ||
+        x.getNrows() > std::numeric_limits<uint32_t>::max() || !record(storage, basis, x)) {
+      clear();
+      currentKey = key;
+      exceeded = true;
+      return false;
+    }
+
+    transpose(storage.getSize());
+    valid = true;
+    return true;
+  }
+
+  /**
+   * Computes result = B alpha, i.e. evaluates the sparse grid function at all data points.
+   *
+   * @param alpha the coefficients of the grid points
+   * @param result the values at the data points
+   */
+  void mult(const DataVector& alpha, DataVector& result) const {
+    checkValid();
+    const size_t numRows = rowStart.size() - 1;
+    const size_t numThreads = ExecutionContext::getInstance().getNumberOfThreadsForRegion(numRows);
+
+#pragma omp parallel for schedule(static) num_threads(numThreads)
+    for (size_t i = 0; i < numRows; i++) {
+      double sum = 0.0;
+
+      for (size_t k = rowStart[i]; k < rowStart[i + 1]; k++) {
+        sum += rowValues[k] * alpha[rowColumns[k]];
+      }
+
+      result[i] = sum;
+    }
+  }
+
+  /**
+   * Computes result = B^T source.
+   *
+   * @param source one value per data point
+   * @param result one value per grid point
+   */
+  void multTranspose(const DataVector& source, DataVector& result) const {
+    checkValid();
+    const size_t numColumns = columnStart.size() - 1;
+    const size_t numThreads =
+        ExecutionContext::getInstance().getNumberOfThreadsForRegion(numColumns);
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(numThreads)
+    for (size_t j = 0; j < numColumns; j++) {
+      double sum = 0.0;
+
+      for (size_t k = columnStart[j]; k < columnStart[j + 1]; k++) {
+        sum += columnValues[k] * source[columnRows[k]];
+      }
+
+      result[j] = sum;
+    }
+  }
+
+  /**
+   * Drops the cached matrix, it is recorded again by the next call of update().
+   */
+  void clear() {
+    std::vector<size_t>().swap(rowStart);
+    std::vector<uint32_t>().swap(rowColumns);
+    std::vector<double>().swap(rowValues);
+    std::vector<size_t>().swap(columnStart);
+    std::vector<uint32_t>().swap(columnRows);
+    std::vector<double>().swap(columnValues);
+    currentKey = Key();
+    valid = false;
+    exceeded = false;
+  }
+
+  /**
+   * @return whether a matrix is cached
+   */
+  bool isValid() const { return valid; }
+
+  /**
+   * @return the number of non-zero entries of the cached matrix
+   */
+  size_t getNumberNonZeros() const { return valid ? rowValues.size() : 0; }
+
+  /**
+   * @return the number of bytes occupied by the cached matrix
+   */
+  size_t getMemoryFootprint() const {
+    return (rowStart.size() + columnStart.size()) * sizeof(size_t) +
+           (rowColumns.size() + columnRows.size()) * sizeof(uint32_t) +
+           (rowValues.size() + columnValues.size()) * sizeof(double);
+  }
+
+  /**
+   * @return the memory budget in bytes
+   */
+  size_t getMemoryBudget() const { return memoryBudget; }
+
+ private:
+  /// Sizes of the grid and dataset the matrix has been recorded for
+  struct Key {
+    size_t gridSize = 0;
+    size_t numRows = 0;
+    size_t numColumns = 0;
+
+    bool operator==(const Key& other) const {
+      return gridSize == other.gridSize && numRows == other.numRows &&
+             numColumns == other.numColumns;
+    }
+  };
+
+  /// bytes per non-zero entry, stored in both formats
+  static const size_t BYTES_PER_ENTRY = 2 * (sizeof(uint32_t) + sizeof(double));
+
+  void checkValid() const {
+    if (!valid) {
+      throw operation_exception("CachedDesignMatrix: no matrix has been recorded");
+    }
+  }
+
+  /**
+   * Records the matrix row by row in CSR format, the rows are distributed statically among the
+   * threads and concatenated afterwards.
+   *
+   * @return false if the budget has been exceeded
+   */
+  template <class BASIS>
+  bool record(GridStorage& storage, BASIS& basis, DataMatrix& x) {
+    typedef std::vector<std::pair<size_t, double>> IndexValVector;
+
+    const size_t numRows = x.getNrows();
+    const size_t maxEntries =
+        (memoryBudget > 2 * (numRows + storage.getSize() + 2) * sizeof(size_t))
+            ? (memoryBudget - 2 * (numRows + storage.getSize() + 2) * sizeof(size_t)) /
+                  BYTES_PER_ENTRY
+            : 0;
+
+    std::atomic<size_t> numEntries(0);
+    std::atomic<bool> abort(false);
+    std::vector<size_t> rowLength(numRows);
+
+    const int numThreads =
+        static_cast<int>(ExecutionContext::getInstance().getNumberOfThreadsForRegion(numRows));
+    std::vector<std::vector<uint32_t>> threadColumns(numThreads);
+    std::vector<std::vector<double>> threadValues(numThreads);
+    std::vector<std::pair<size_t, size_t>> threadRows(numThreads, std::make_pair(0, 0));
+
+#pragma omp parallel num_threads(numThreads)
+    {
+      int thread = 0;
+      int usedThreads = 1;
+#ifdef _OPENMP
+      thread = omp_get_thread_num();
+      usedThreads = omp_get_num_threads();
+#endif
+      // the same static partition as the CSR rows, so the thread buffers can be concatenated
+      size_t chunk = (numRows + usedThreads - 1) / usedThreads;
+      size_t begin = std::min(numRows, thread * chunk);
+      size_t end = std::min(numRows, begin + chunk);
+      threadRows[thread] = std::make_pair(begin, end);
+
+      DataVector line(x.getNcols());
+      IndexValVector vec;
+      GetAffectedBasisFunctions<BASIS> ga(storage);
+
+      for (size_t i = begin; i < end && !abort; i++) {
+        vec.clear();
+        x.getRow(i, line);
+        ga(basis, line, vec);
+
+        rowLength[i] = vec.size();
+
+        if (numEntries.fetch_add(vec.size()) + vec.size() > maxEntries) {
+          abort = true;
+          break;
+        }
+
+        for (auto& entry : vec) {
+          threadColumns[thread].push_back(static_cast<uint32_t>(entry.first));
+          threadValues[thread].push_back(entry.second);
+        }
+      }
+    }
+
+    if (abort) {
+      return false;
+    }
+
+    rowStart.resize(numRows + 1);
+    rowStart[0] = 0;
+
+    for (size_t i = 0; i < numRows; i++) {
+      rowStart[i + 1] = rowStart[i] + rowLength[i];
+    }
+
+    rowColumns.resize(rowStart[numRows]);
+    rowValues.resize(rowStart[numRows]);
+
+#pragma omp parallel for schedule(static, 1) num_threads(numThreads)
+    for (int thread = 0; thread < numThreads; thread++) {
+      if (threadRows[thread].first < threadRows[thread].second) {
+        std::copy(threadColumns[thread].begin(), threadColumns[thread].end(),
+                  rowColumns.begin() + rowStart[threadRows[thread].first]);
+        std::copy(threadValues[thread].begin(), threadValues[thread].end(),
+                  rowValues.begin() + rowStart[threadRows[thread].first]);
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * Derives the CSC format from the CSR format by a counting sort of the entries, the rows within
+   * a column stay in ascending order.
+   */
+  void transpose(size_t numColumns) {
+    const size_t numRows = rowStart.size() - 1;
+
+    columnStart.assign(numColumns + 1, 0);
+
+    for (size_t k = 0; k < rowColumns.size(); k++) {
+      columnStart[rowColumns[k] + 1]++;
+    }
+
+    for (size_t j = 0; j < numColumns; j++) {
+      columnStart[j + 1] += columnStart[j];
+    }
+
+    columnRows.resize(rowColumns.size());
+    columnValues.resize(rowValues.size());
+    std::vector<size_t> position(columnStart.begin(), columnStart.end() - 1);
+
+    for (size_t i = 0; i < numRows; i++) {
+      for (size_t k = rowStart[i]; k < rowStart[i + 1]; k++) {
+        size_t p = position[rowColumns[k]]++;
+        columnRows[p] = static_cast<uint32_t>(i);
+        columnValues[p] = rowValues[k];
+      }
+    }
+  }
+
+  /// maximum number of bytes of the cached matrix, 0 disables caching
+  size_t memoryBudget;
+  /// whether the matrix for currentKey is cached
+  bool valid;
+  /// whether the matrix for currentKey did not fit into the budget
+  bool exceeded;
+  /// the sizes of the grid and dataset of the cached matrix
+  Key currentKey;
+
+  std::vector<size_t> rowStart;
+  std::vector<uint32_t> rowColumns;
+  std::vector<double> rowValues;
+  std::vector<size_t> columnStart;
+  std::vector<uint32_t> columnRows;
+  std::vector<double> columnValues;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* CACHEDDESIGNMATRIX_HPP */
@@ -0,0 +1,487 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef TENSORPRODUCTEVALUATIONCACHE_HPP
+#define TENSORPRODUCTEVALUATIONCACHE_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <stdint.h>
+
+#include <unordered_map>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Evaluation of linear combinations of tensor product basis functions, in which every distinct
+ * 1D basis function (level, index, dimension) is evaluated only once per evaluation point.
+ *
+ * Spline bases (B-splines, not-a-knot B-splines, fundamental splines, ...) have wide or even
+ * global supports and an expensive 1D evaluation, so the evaluation cannot descend the hierarchy
+ * like GetAffectedBasisFunctions does for piecewise linear functions. However, the grid points
+ * of a sparse grid share few distinct 1D functions per dimension. This class records the
+ * distinct 1D functions of every dimension and, for every grid point, the indices of its 1D
+ * functions. The 1D values (and derivatives) are then computed once per evaluation point and
+ * combined for all grid points by table lookups, in the same order of operations as the naive
+ * evaluation.
+ *
+ * The table is only rebuilt after clear(), which the owning operation calls from its prepare()
+ * method, so prepare() has to be called whenever the grid points have changed (e.g., after
+ * refinement or coarsening). As a cheap safety net, a changed number of grid points is detected
+ * and the table is rebuilt.
+ */
+class TensorProductEvaluationCache {
+ public:
+  /**
+   * Constructor, the table is built with the first evaluation.
+   *
+   * @param storage   storage of the sparse grid
+   */
+  explicit TensorProductEvaluationCache(GridStorage& storage)
+      : storage(storage), gridSize(0), valid(false) {}
+
+  /**
+   * Evaluates the distinct 1D basis functions at a point.
+   *
+   * @param point     evaluation point in the unit cube
+   * @param evalValue callable (level, index, x) returning the value of a 1D basis function
+   */
+  template <class EvalValue>
+  void evaluate(const DataVector& point, EvalValue evalValue) {
+    update();
+
+    for (size_t t = 0; t < functions.size(); t++) {
+      for (size_t k = 0; k < functions[t].size(); k++) {
+        values[t][k] = evalValue(functions[t][k].first, functions[t][k].second, point[t]);
+      }
+    }
+  }
+
+  /**
+   * Evaluates the distinct 1D basis functions and their first derivatives at a point.
+   *
+   * @param point           evaluation point in the unit cube
+   * @param evalValue       callable (level, index, x) returning the value of a 1D basis function
+   * @param evalDx          callable (level, index, x) returning the first derivative
+   * @param innerDerivative inner derivative of the transformation to the unit cube
+   *                        per dimension
+   */
+  template <class EvalValue, class EvalDx>
+  void evaluate(const DataVector& point, EvalValue evalValue, EvalDx evalDx,
+                const DataVector& innerDerivative) {
+    evaluate(point, evalValue);
+
+    for (size_t t = 0; t < functions.size(); t++) {
+      for (size_t k = 0; k < functions[t].size(); k++) {
+        dxValues[t][k] = evalDx(functions[t][k].first, functions[t][k].second, point[t]) *
+                         innerDerivative[t];
+      }
+    }
+  }
+
+  /**
+   * Evaluates the distinct 1D basis functions and their first and second derivatives at a point.
+   *
+   * @param point           evaluation point in the unit cube
+   * @param evalValue       callable (level, index, x) returning the value of a 1D basis function
+   * @param evalDx          callable (level, index, x) returning the first derivative
+   * @param evalDxDx        callable (level, index, x) returning the second derivative
+   * @param innerDerivative inner derivative of the transformation to the unit cube
+   *                        per dimension
+   */
+  template <class EvalValue, class EvalDx, class EvalDxDx>
+  void evaluate(const DataVector& point, EvalValue evalValue, EvalDx evalDx, EvalDxDx evalDxDx,
+                const DataVector& innerDerivative) {
+    evaluate(point, evalValue, evalDx, innerDerivative);
+
+    for (size_t t = 0; t < functions.size(); t++) {
+      for (size_t k = 0; k < functions[t].size(); k++) {
+        dxdxValues[t][k] = evalDxDx(functions[t][k].first, functions[t][k].second, point[t]) *
+                           innerDerivative[t] * innerDerivative[t];
+      }
+    }
+  }
+
+  /**
+   * @param alpha     coefficient vector
+   * @return          value of the linear combination at the last evaluated point
+   */
+  double evalValue(const DataVector& alpha) const {
+    const size_t n = gridSize;
+    const size_t d = functions.size();
+    const uint32_t* ids = functionIds.data();
+    double result = 0.0;
+
+    for (size_t i = 0; i < n; i++, ids += d) {
+      double curValue = 1.0;
+
+      for (size_t t = 0; t < d; t++) {
+        const double val1d = values[t][ids[t]];
+
+        if (val1d == 0.0) {
+          curValue = 0.0;
+          break;
+        }
+
+        curValue *= val1d;
+      }
+
+      result += alpha[i] * curValue;
+    }
+
+    return result;
+  }
+
+  /**
+   * @param      alpha  coefficient matrix (each column is a coefficient vector)
+   * @param[out] value  values of the linear combinations at the last evaluated point
+   */
+  void evalValue(const DataMatrix& alpha, DataVector& value) const {
+    const size_t n = gridSize;
+    const size_t d = functions.size();
+    const size_t m = alpha.getNcols();
+    const uint32_t* ids = functionIds.data();
+
+    value.resize(m);
+    value.setAll(0.0);
+
+    for (size_t i = 0; i < n; i++, ids += d) {
+      double curValue = 1.0;
+
+      for (size_t t = 0; t < d; t++) {
+        const double val1d = values[t][ids[t]];
+
+        if (val1d == 0.0) {
+          curValue = 0.0;
+          break;
+        }
+
+        curValue *= val1d;
+      }
+
+      for (size_t j = 0; j < m; j++) {
+        value[j] += alpha(i, j) * curValue;
+      }
+    }
+  }
+
+  /**
+   * Requires the first derivatives to be evaluated.
+   *
+   * @param      alpha    coefficient vector
+   * @param[out] gradient gradient of the linear combination at the last evaluated point
+   * @return              value of the linear combination at the last evaluated point
+   */
+  double evalGradient(const DataVector& alpha, DataVector& gradient) const {
+    const size_t n = gridSize;
+    const size_t d = functions.size();
+    const uint32_t* ids = functionIds.data();
+    double result = 0.0;
+
+    gradient.resize(d);
+    gradient.setAll(0.0);
+
+    DataVector curGradient(d);
+
+    for (size_t i = 0; i < n; i++, ids += d) {
+      double curValue = 1.0;
+      curGradient.setAll(alpha[i]);
+
+      for (size_t t = 0; t < d; t++) {
+        const double val1d = values[t][ids[t]];
+        const double dx1d = dxValues[t][ids[t]];
+
+        curValue *= val1d;
+
+        for (size_t t2 = 0; t2 < d; t2++) {
+          if (t2 == t) {
+            curGradient[t2] *= dx1d;
+          } else {
+            curGradient[t2] *= val1d;
+          }
+        }
+      }
+
+      result += alpha[i] * curValue;
+      gradient.add(curGradient);
+    }
+
+    return result;
+  }
+
+  /**
+   * Requires the first derivatives to be evaluated.
+   *
+   * @param      alpha    coefficient matrix (each column is a coefficient vector)
+   * @param[out] value    values of the linear combinations at the last evaluated point
+   * @param[out] gradient gradients of the linear combinations at the last evaluated point
+   *                      (each row is a gradient vector)
+   */
+  void evalGradient(const DataMatrix& alpha, DataVector& value, DataMatrix& gradient) const {
+    const size_t n = gridSize;
+    const size_t d = functions.size();
+    const size_t m = alpha.getNcols();
+    const uint32_t* ids = functionIds.data();
+
+    value.resize(m);
+    value.setAll(0.0);
+
+    gradient.resize(m, d);
+    gradient.setAll(0.0);
+
+    DataVector curGradient(d);
+
+    for (size_t i = 0; i < n; i++, ids += d) {
+      double curValue = 1.0;
+      curGradient.setAll(1.0);
+
+      for (size_t t = 0; t < d; t++) {
+        const double val1d = values[t][ids[t]];
+        const double dx1d = dxValues[t][ids[t]];
+
+        curValue *= val1d;
+
+        for (size_t t2 = 0; t2 < d; t2++) {
+          if (t2 == t) {
+            curGradient[t2] *= dx1d;
+          } else {
+            curGradient[t2] *= val1d;
+          }
+        }
+      }
+
+      for (size_t j = 0; j < m; j++) {
+        value[j] += alpha(i, j) * curValue;
+
+        for (size_t t = 0; t < d; t++) {
+          gradient(j, t) += alpha(i, j) * curGradient[t];
+        }
+      }
+    }
+  }
+
+  /**
+   * Requires the first and second derivatives to be evaluated.
+   *
+   * @param      alpha    coefficient vector
+   * @param[out] gradient gradient of the linear combination at the last evaluated point
+   * @param[out] hessian  Hessian matrix of the linear combination at the last evaluated point
+   * @return              value of the linear combination at the last evaluated point
+   */
+  double evalHessian(const DataVector& alpha, DataVector& gradient, DataMatrix& hessian) const {
+    const size_t n = gridSize;
+    const size_t d = functions.size();
+    const uint32_t* ids = functionIds.data();
+    double result = 0.0;
+
+    gradient.resize(d);
+    gradient.setAll(0.0);
+
+    hessian = DataMatrix(d, d);
+
+    DataVector curGradient(d);
+    DataMatrix curHessian(d, d);
+
+    for (size_t i = 0; i < n; i++, ids += d) {
+      double curValue = 1.0;
+      curGradient.setAll(alpha[i]);
+      curHessian.setAll(alpha[i]);
+      multiplyHessian(ids, curValue, curGradient, curHessian);
+
+      result += alpha[i] * curValue;
+      gradient.add(curGradient);
+      hessian.add(curHessian);
+    }
+
+    return result;
+  }
+
+  /**
+   * Requires the first and second derivatives to be evaluated.
+   *
+   * @param      alpha    coefficient matrix (each column is a coefficient vector)
+   * @param[out] value    values of the linear combinations at the last evaluated point
+   * @param[out] gradient gradients of the linear combinations at the last evaluated point
+   *                      (each row is a gradient vector)
+   * @param[out] hessian  Hessian matrices of the linear combinations at the last evaluated point
+   */
+  void evalHessian(const DataMatrix& alpha, DataVector& value, DataMatrix& gradient,
+                   std::vector<DataMatrix>& hessian) const {
+    const size_t n = gridSize;
+    const size_t d = functions.size();
+    const size_t m = alpha.getNcols();
+    const uint32_t* ids = functionIds.data();
+
+    value.resize(m);
+    value.setAll(0.0);
+
+    gradient.resize(m, d);
+    gradient.setAll(0.0);
+
+    if (hessian.size() != m) {
+      hessian.resize(m);
+    }
+
+    for (size_t j = 0; j < m; j++) {
+      hessian[j].resize(d, d);
+      hessian[j].setAll(0.0);
+    }
+
+    DataVector curGradient(d);
+    DataMatrix curHessian(d, d);
+
+    for (size_t i = 0; i < n; i++, ids += d) {
+      double curValue = 1.0;
+      curGradient.setAll(1.0);
+      curHessian.setAll(1.0);
+      multiplyHessian(ids, curValue, curGradient, curHessian);
+
+      for (size_t j = 0; j < m; j++) {
+        value[j] += alpha(i, j) * curValue;
+
+        for (size_t t = 0; t < d; t++) {
+          gradient(j, t) += alpha(i, j) * curGradient[t];
+
+          for (size_t t2 = 0; t2 < d; t2++) {
+            hessian[j](t, t2) += alpha(i, j) * curHessian(t, t2);
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Discards the table, it is rebuilt with the next evaluation.
+   */
+  void clear() { valid = false; }
+
+  /**
+   * @param t   dimension
+   * @return    number of distinct 1D basis functions in dimension t
+   */
+  size_t getNumberOf1DFunctions(size_t t) {
+    update();
+    return functions[t].size();
+  }
+
+ protected:
+  typedef GridPoint::level_type level_type;
+  typedef GridPoint::index_type index_type;
+
+  /**
+   * Multiplies value, gradient, and Hessian matrix of a grid point with its 1D factors.
+   */
+  void multiplyHessian(const uint32_t* ids, double& curValue, DataVector& curGradient,
+                       DataMatrix& curHessian) const {
+    const size_t d = functions.size();
+
+    for (size_t t = 0; t < d; t++) {
+      const double val1d = values[t][ids[t]];
+      const double dx1d = dxValues[t][ids[t]];
+      const double dxdx1d = dxdxValues[t][ids[t]];
+
+      curValue *= val1d;
+
+      for (size_t t2 = 0; t2 < d; t2++) {
+        if (t2 == t) {
+          curGradient[t2] *= dx1d;
+
+          for (size_t t3 = 0; t3 < d; t3++) {
+            if (t3 == t) {
+              curHessian(t2, t3) *= dxdx1d;
+            } else {
+              curHessian(t2, t3) *= dx1d;
+            }
+          }
+        } else {
+          curGradient[t2] *= val1d;
+
+          for (size_t t3 = 0; t3 < d; t3++) {
+            if (t3 == t) {
+              curHessian(t2, t3) *= dx1d;
+            } else {
+              curHessian(t2, t3) *= val1d;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /**
+   * Rebuilds the table of 1D functions after clear() or if the number of grid points has changed.
+   */
+  void update() {
+    const size_t n = storage.getSize();
+    const size_t d = storage.getDimension();
+
+    if (valid && (n == gridSize)) {
+      return;
+    }
+
+    functions.assign(d, std::vector<std::pair<level_type, index_type>>());
+    functionIds.resize(n * d);
+    std::vector<std::unordered_map<uint64_t, uint32_t>> functionIdMaps(d);
+
+    for (size_t i = 0; i < n; i++) {
+      const GridPoint& gp = storage.getPoint(i);
+
+      for (size_t t = 0; t < d; t++) {
+        const level_type l = gp.getLevel(t);
+        const index_type idx = gp.getIndex(t);
+        const uint64_t key = (static_cast<uint64_t>(l) << 32) | idx;
+        auto it = functionIdMaps[t].find(key);
+
+        if (it == functionIdMaps[t].end()) {
+          it = functionIdMaps[t].emplace(key, static_cast<uint32_t>(functions[t].size())).first;
+          functions[t].emplace_back(l, idx);
+        }
+
+        functionIds[i * d + t] = it->second;
+      }
+    }
+
+    values.resize(d);
+    dxValues.resize(d);
+    dxdxValues.resize(d);
+
+    for (size_t t = 0; t < d; t++) {
+      values[t].resize(functions[t].size());
+      dxValues[t].resize(functions[t].size());
+      dxdxValues[t].resize(functions[t].size());
+    }
+
+    gridSize = n;
+    valid = true;
+  }
+
+  /// storage of the sparse grid
+  GridStorage& storage;
+  /// number of grid points of the table
+  size_t gridSize;
+  /// whether the table has been built (and not been cleared since)
+  bool valid;
+  /// distinct 1D functions (level, index) per dimension
+  std::vector<std::vector<std::pair<level_type, index_type>>> functions;
+  /// indices of the 1D functions of the grid points (row-major, one row per grid point)
+  std::vector<uint32_t> functionIds;
+  /// values of the 1D functions at the last evaluated point
+  std::vector<std::vector<double>> values;
+  /// first derivatives of the 1D functions at the last evaluated point
+  std::vector<std::vector<double>> dxValues;
+  /// second derivatives of the 1D functions at the last evaluated point
+  std::vector<std::vector<double>> dxdxValues;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* TENSORPRODUCTEVALUATIONCACHE_HPP */
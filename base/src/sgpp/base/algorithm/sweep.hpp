@@ -11,10 +11,17 @@
 
 #include <sgpp/globaldef.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <vector>
 #include <utility>
 #include <iostream>
 
+#ifndef TASKS_PARALLEL_SWEEP
+#define TASKS_PARALLEL_SWEEP 2
+#endif
 
 namespace sgpp {
 namespace base {
@@ -38,6 +45,10 @@ class sweep {
   const std::vector<size_t> algoDims;
   /// number of algorithmic dimensions
   const size_t numAlgoDims_;
+  /// max recursion depth up to which subtrees of poles are processed in separate tasks
+  static const size_t maxTaskDepth_ = TASKS_PARALLEL_SWEEP;
+  /// min number of grid points for which the poles are processed in parallel
+  static const size_t minTaskGridSize_ = 4096;
 
  public:
   /**
@@ -92,6 +103,37 @@ class sweep {
     sweep_rec(source, result, index, dim_list, storage.getDimension() - 1, dim_sweep);
   }
 
+  /**
+   * Same as sweep1D, but if called within an OpenMP parallel region (e.g., from a
+   * task of the up/down recursion), the poles are distributed to OpenMP tasks:
+   * the subtrees of the first levels of the recursion are processed by separate
+   * tasks, each of them on its own copy of the functor. As the poles are disjoint,
+   * no synchronization of the result is needed.
+   *
+   * @param source a DataVector containing the source coefficients of the grid points
+   * @param result a DataVector containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1DParallel(DataVector& source, DataVector& result, size_t dim_sweep) {
+    if (!isTaskParallel()) {
+      sweep1D(source, result, dim_sweep);
+      return;
+    }
+
+    std::vector<size_t> dim_list;
+
+    for (size_t i = 0; i < storage.getDimension(); i++) {
+      if (i != dim_sweep) {
+        dim_list.push_back(i);
+      }
+    }
+
+    grid_iterator index(storage);
+
+    sweep_rec_parallel(source, result, index, dim_list, storage.getDimension() - 1, dim_sweep,
+                       0);
+  }
+
   /**
    * Descends on all dimensions beside dim_sweep. Class functor for dim_sweep
    * Boundaries are not regarded
@@ -145,6 +187,35 @@ class sweep {
   }
 
 
+  /**
+   * Same as sweep1D_Boundary, but if called within an OpenMP parallel region,
+   * the poles are distributed to OpenMP tasks (see sweep1DParallel).
+   *
+   * @param source a DataVector containing the source coefficients of the grid points
+   * @param result a DataVector containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functor is executed
+   */
+  void sweep1D_BoundaryParallel(DataVector& source, DataVector& result, size_t dim_sweep) {
+    if (!isTaskParallel()) {
+      sweep1D_Boundary(source, result, dim_sweep);
+      return;
+    }
+
+    std::vector<size_t> dim_list;
+
+    for (size_t i = 0; i < storage.getDimension(); i++) {
+      if (i != dim_sweep) {
+        dim_list.push_back(i);
+      }
+    }
+
+    grid_iterator index(storage);
+    index.resetToLevelZero();
+
+    sweep_Boundary_rec_parallel(source, result, index, dim_list, storage.getDimension() - 1,
+                                dim_sweep, 0);
+  }
+
   /**
    * Descends on all dimensions beside dim_sweep. Class functor for dim_sweep
    * Boundaries are regarded
@@ -394,6 +465,165 @@ class sweep {
       }
     }
   }
+
+  /**
+   * @return whether the sweep is called within an active OpenMP parallel region
+   *         and the grid is large enough to distribute the poles to tasks
+   */
+  bool isTaskParallel() const {
+#ifdef _OPENMP
+    return (omp_in_parallel() != 0) && (storage.getSize() >= minTaskGridSize_);
+#else
+    return false;
+#endif
+  }
+
+  /**
+   * Task parallel version of sweep_rec (see sweep1DParallel).
+   *
+   * @param source coefficients of the sparse grid
+   * @param result coefficients of the function computed by sweep
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param dim_sweep static dimension, in this dimension the functor is executed
+   * @param depth current depth of the task recursion
+   */
+  void sweep_rec_parallel(DataVector& source, DataVector& result, grid_iterator& index,
+                          std::vector<size_t>& dim_list, size_t dim_rem, size_t dim_sweep,
+                          size_t depth) {
+    if (depth >= maxTaskDepth_) {
+      sweep_rec(source, result, index, dim_list, dim_rem, dim_sweep);
+      return;
+    }
+
+    functor(source, result, index, dim_sweep);
+
+    for (size_t d = 0; d < dim_rem; d++) {
+      size_t current_dim = dim_list[d];
+
+      if (index.hint()) {
+        continue;
+      }
+
+      index.leftChild(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        spawnTask(source, result, index, dim_list, d + 1, dim_sweep, depth, false);
+      }
+
+      index.stepRight(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        spawnTask(source, result, index, dim_list, d + 1, dim_sweep, depth, false);
+      }
+
+      index.up(current_dim);
+    }
+
+#pragma omp taskwait
+  }
+
+  /**
+   * Task parallel version of sweep_Boundary_rec (see sweep1D_BoundaryParallel).
+   * As this recursion descends only one dimension per call, twice the task depth
+   * of sweep_rec_parallel is used.
+   *
+   * @param source coefficients of the sparse grid
+   * @param result coefficients of the function computed by sweep
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param dim_sweep static dimension, in this dimension the functor is executed
+   * @param depth current depth of the task recursion
+   */
+  void sweep_Boundary_rec_parallel(DataVector& source, DataVector& result, grid_iterator& index,
+                                   std::vector<size_t>& dim_list, size_t dim_rem,
+                                   size_t dim_sweep, size_t depth) {
+    if ((dim_rem == 0) || (depth >= 2 * maxTaskDepth_)) {
+      sweep_Boundary_rec(source, result, index, dim_list, dim_rem, dim_sweep);
+      return;
+    }
+
+    level_t current_level;
+    index_t current_index;
+
+    index.get(dim_list[dim_rem - 1], current_level, current_index);
+
+    // handle level greater zero
+    if (current_level > 0) {
+      // given current point to next dim
+      spawnTask(source, result, index, dim_list, dim_rem - 1, dim_sweep, depth, true);
+
+      if (!index.hint()) {
+        index.leftChild(dim_list[dim_rem - 1]);
+
+        if (!storage.isInvalidSequenceNumber(index.seq())) {
+          spawnTask(source, result, index, dim_list, dim_rem, dim_sweep, depth, true);
+        }
+
+        index.stepRight(dim_list[dim_rem - 1]);
+
+        if (!storage.isInvalidSequenceNumber(index.seq())) {
+          spawnTask(source, result, index, dim_list, dim_rem, dim_sweep, depth, true);
+        }
+
+        index.up(dim_list[dim_rem - 1]);
+      }
+    } else {  // handle level zero
+      spawnTask(source, result, index, dim_list, dim_rem - 1, dim_sweep, depth, true);
+
+      index.resetToRightLevelZero(dim_list[dim_rem - 1]);
+      spawnTask(source, result, index, dim_list, dim_rem - 1, dim_sweep, depth, true);
+
+      if (!index.hint()) {
+        index.resetToLevelOne(dim_list[dim_rem - 1]);
+
+        if (!storage.isInvalidSequenceNumber(index.seq())) {
+          spawnTask(source, result, index, dim_list, dim_rem, dim_sweep, depth, true);
+        }
+      }
+
+      index.resetToLeftLevelZero(dim_list[dim_rem - 1]);
+    }
+
+#pragma omp taskwait
+  }
+
+  /**
+   * Processes the subtree at the current grid position in a new task, which works
+   * on copies of the grid iterator and of the functor.
+   *
+   * @param source coefficients of the sparse grid
+   * @param result coefficients of the function computed by sweep
+   * @param index current grid position (is copied)
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param dim_sweep static dimension, in this dimension the functor is executed
+   * @param depth current depth of the task recursion
+   * @param boundary whether to call sweep_Boundary_rec_parallel or sweep_rec_parallel
+   */
+  void spawnTask(DataVector& source, DataVector& result, grid_iterator& index,
+                 std::vector<size_t>& dim_list, size_t dim_rem, size_t dim_sweep, size_t depth,
+                 bool boundary) {
+    grid_iterator* taskIndex = new grid_iterator(index);
+
+#pragma omp task firstprivate(taskIndex, dim_rem, dim_sweep, depth, boundary) \
+    shared(source, result, dim_list)
+    {
+      sweep<FUNC> taskSweep(functor, storage);
+
+      if (boundary) {
+        taskSweep.sweep_Boundary_rec_parallel(source, result, *taskIndex, dim_list, dim_rem,
+                                              dim_sweep, depth + 1);
+      } else {
+        taskSweep.sweep_rec_parallel(source, result, *taskIndex, dim_list, dim_rem, dim_sweep,
+                                     depth + 1);
+      }
+
+      delete taskIndex;
+    }
+  }
 };
 
 }  // namespace base
@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/grid/generation/hashmap/HashCoarsening.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
@@ -115,6 +116,7 @@ void HashCoarsening::free_coarsen(GridStorage& storage,
                                   CoarseningFunctor& functor,
                                   std::vector<HashGridPoint>* removedPoints,
                                   std::vector<size_t>* removedSeq) {
+  SGPP_INSTRUMENT_SCOPE("HashCoarsening::free_coarsen");
   free_coarsen_NFirstOnly(storage, functor, storage.getSize(), 0, removedPoints,
                           removedSeq);
 }
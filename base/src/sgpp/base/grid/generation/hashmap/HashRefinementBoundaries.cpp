@@ -7,6 +7,7 @@
 #include <sgpp/base/exception/generation_exception.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 #include <cmath>
 #include <vector>
@@ -134,6 +135,7 @@ void HashRefinementBoundaries::refineGridpointsCollection(GridStorage& storage,
 void HashRefinementBoundaries::free_refine(GridStorage& storage,
                                            RefinementFunctor& functor,
                                            std::vector<size_t>* addedPoints) {
+  SGPP_INSTRUMENT_SCOPE("HashRefinement::free_refine");
   if (storage.getSize() == 0) {
     throw generation_exception("storage empty");
   }
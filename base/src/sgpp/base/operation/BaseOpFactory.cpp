@@ -537,6 +537,21 @@ base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
   }
 }
 
+base::OperationMultipleEval* createOperationMultipleEvalCached(base::Grid& grid,
+                                                               base::DataMatrix& dataset,
+                                                               size_t memoryBudget) {
+  if (grid.getType() == base::GridType::Linear) {
+    return new base::OperationMultipleEvalLinear(grid, dataset, memoryBudget);
+  } else if (grid.getType() == base::GridType::LinearL0Boundary ||
+             grid.getType() == base::GridType::LinearBoundary) {
+    return new base::OperationMultipleEvalLinearBoundary(grid, dataset, memoryBudget);
+  } else if (grid.getType() == base::GridType::ModLinear) {
+    return new base::OperationMultipleEvalModLinear(grid, dataset, memoryBudget);
+  } else {
+    return createOperationMultipleEval(grid, dataset);
+  }
+}
+
 base::OperationMultipleEval* createOperationMultipleEvalInter(
     base::Grid& grid, base::DataMatrix& dataset, std::set<std::set<size_t>> interactions) {
   if (grid.getType() == base::GridType::ModLinear) {
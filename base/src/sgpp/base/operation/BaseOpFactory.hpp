@@ -123,6 +123,27 @@ base::OperationEval* createOperationEval(base::Grid& grid);
 
 base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
     base::DataMatrix& dataset);
+/**
+ * Factory method, returning an OperationMultipleEval for the grid at hand that records the
+ * evaluations of the basis functions at the data points once in a sparse matrix and reuses it in
+ * all further calls of mult and multTranspose. After changes of the grid or the dataset, prepare()
+ * has to be called on the operation.
+ * This is supported for linear, linear boundary and modified linear grids, for all other grids
+ * the result of createOperationMultipleEval is returned.
+ * If the matrix does not fit into the memory budget, the basis functions are evaluated in every
+ * call as usual.
+ * Note: object has to be freed after use.
+ *
+ * @param grid Grid which is to be used
+ * @param dataset The dataset (DataMatrix, one datapoint per row) that is to be evaluated for
+ * the sparse grid function
+ * @param memoryBudget maximum number of bytes of the cached matrix
+ * @return Pointer to the new OperationMultipleEval object for the Grid grid
+ */
+base::OperationMultipleEval* createOperationMultipleEvalCached(base::Grid& grid,
+                                                               base::DataMatrix& dataset,
+                                                               size_t memoryBudget);
+
 /**
  * Similar to createOperationMultipleEval, but makes use of interaction terms during evaluation
  * 
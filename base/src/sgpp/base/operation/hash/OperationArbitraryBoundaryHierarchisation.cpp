@@ -9,6 +9,7 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/exception/factory_exception.hpp>
 #include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
@@ -78,6 +79,7 @@ OperationMultipleEval* OperationArbitraryBoundaryHierarchisation::createOperatio
 }
 
 void OperationArbitraryBoundaryHierarchisation::doHierarchisation(DataVector& nodal_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   // collect nodal values for boundary grids and inner grids
   DataVector boundaryNodalValues(boundaryGrid->getSize());
   DataVector innerNodalValues(innerGrid->getSize());
@@ -132,6 +134,7 @@ void OperationArbitraryBoundaryHierarchisation::doHierarchisation(DataVector& no
 }
 
 void OperationArbitraryBoundaryHierarchisation::doDehierarchisation(DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   // split coefficients for inner and boundary grid
   HashGridStorage& gs = grid.getStorage();
   HashGridStorage& innerGs = innerGrid->getStorage();
@@ -32,6 +32,12 @@ class OperationEval {
    */
   virtual ~OperationEval() {}
 
+  /**
+   * Has to be called after the grid has been changed (e.g., refined or coarsened) before the
+   * operation is used again. Operations that store data derived from the grid points discard it.
+   */
+  virtual void prepare() {}
+
   /**
    * Evaluates the sparse grid function at a given point.
    *
@@ -9,68 +9,25 @@
 namespace sgpp {
 namespace base {
 
-double OperationEvalBsplineClenshawCurtisNaive::eval(
-  const DataVector& alpha, const DataVector& point) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  double result = 0.0;
-
+double OperationEvalBsplineClenshawCurtisNaive::eval(const DataVector& alpha,
+                                                     const DataVector& point) {
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
-
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-
-      if (val1d == 0.0) {
-        curValue = 0.0;
-        break;
-      }
-
-      curValue *= val1d;
-    }
-
-    result += alpha[i] * curValue;
-  }
-
-  return result;
+  evaluationCache.evaluate(pointInUnitCube,
+                           [this](level_t l, index_t i, double x) { return base.eval(l, i, x); });
+  return evaluationCache.evalValue(alpha);
 }
 
 void OperationEvalBsplineClenshawCurtisNaive::eval(const DataMatrix& alpha,
                                                    const DataVector& point,
                                                    DataVector& value) {
-  const size_t n = storage.getSize();
-  const size_t d = storage.getDimension();
-  const size_t m = alpha.getNcols();
-
   pointInUnitCube = point;
   storage.getBoundingBox()->transformPointToUnitCube(pointInUnitCube);
 
-  value.resize(m);
-  value.setAll(0.0);
-
-  for (size_t i = 0; i < n; i++) {
-    const GridPoint& gp = storage[i];
-    double curValue = 1.0;
-
-    for (size_t t = 0; t < d; t++) {
-      const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointInUnitCube[t]);
-
-      if (val1d == 0.0) {
-        curValue = 0.0;
-        break;
-      }
-
-      curValue *= val1d;
-    }
-
-    for (size_t j = 0; j < m; j++) {
-      value[j] += alpha(i, j) * curValue;
-    }
-  }
+  evaluationCache.evaluate(pointInUnitCube,
+                           [this](level_t l, index_t i, double x) { return base.eval(l, i, x); });
+  evaluationCache.evalValue(alpha, value);
 }
 
 }  // namespace base
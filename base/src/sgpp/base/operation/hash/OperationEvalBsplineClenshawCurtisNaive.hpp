@@ -7,6 +7,7 @@
 #define OPERATIONEVALBSPLINECLENSHAWCURTISNAIVE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/TensorProductEvaluationCache.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineClenshawCurtisBasis.hpp>
@@ -27,7 +28,8 @@ class OperationEvalBsplineClenshawCurtisNaive : public OperationEval {
    * @param degree        B-spline degree
    */
   OperationEvalBsplineClenshawCurtisNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    evaluationCache(storage) {
   }
 
   /**
@@ -51,6 +53,11 @@ class OperationEvalBsplineClenshawCurtisNaive : public OperationEval {
   void eval(const DataMatrix& alpha, const DataVector& point,
             DataVector& value) override;
 
+  /**
+   * Discards the cached 1D basis functions of the grid points.
+   */
+  void prepare() override { evaluationCache.clear(); }
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -58,6 +65,8 @@ class OperationEvalBsplineClenshawCurtisNaive : public OperationEval {
   SBsplineClenshawCurtisBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// 1D basis function values at the evaluation point, shared by the grid points
+  TensorProductEvaluationCache evaluationCache;
 };
 
 }  // namespace base
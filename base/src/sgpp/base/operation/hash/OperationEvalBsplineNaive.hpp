@@ -7,6 +7,7 @@
 #define OPERATIONEVALBSPLINENAIVE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/TensorProductEvaluationCache.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
@@ -28,7 +29,8 @@ class OperationEvalBsplineNaive : public OperationEval {
    * @param degree    B-spline degree
    */
   OperationEvalBsplineNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    evaluationCache(storage) {
   }
 
   /**
@@ -52,6 +54,11 @@ class OperationEvalBsplineNaive : public OperationEval {
   void eval(const DataMatrix& alpha, const DataVector& point,
             DataVector& value) override;
 
+  /**
+   * Discards the cached 1D basis functions of the grid points.
+   */
+  void prepare() override { evaluationCache.clear(); }
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -59,6 +66,8 @@ class OperationEvalBsplineNaive : public OperationEval {
   SBsplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// 1D basis function values at the evaluation point, shared by the grid points
+  TensorProductEvaluationCache evaluationCache;
 };
 
 }  // namespace base
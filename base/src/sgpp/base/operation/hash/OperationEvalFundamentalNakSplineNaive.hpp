@@ -7,6 +7,7 @@
 #define OPERATIONEVALFUNDAMENTALNAKSPLINENAIVE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/TensorProductEvaluationCache.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/FundamentalNakSplineBasis.hpp>
@@ -27,7 +28,8 @@ class OperationEvalFundamentalNakSplineNaive : public OperationEval {
    * @param degree    fundamental not-a-knot spline degree
    */
   OperationEvalFundamentalNakSplineNaive(GridStorage& storage, size_t degree) :
-    storage(storage), base(degree), pointInUnitCube(storage.getDimension()) {
+    storage(storage), base(degree), pointInUnitCube(storage.getDimension()),
+    evaluationCache(storage) {
   }
 
   /**
@@ -51,6 +53,11 @@ class OperationEvalFundamentalNakSplineNaive : public OperationEval {
   void eval(const DataMatrix& alpha, const DataVector& point,
             DataVector& value) override;
 
+  /**
+   * Discards the cached 1D basis functions of the grid points.
+   */
+  void prepare() override { evaluationCache.clear(); }
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -58,6 +65,8 @@ class OperationEvalFundamentalNakSplineNaive : public OperationEval {
   SFundamentalNakSplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataVector pointInUnitCube;
+  /// 1D basis function values at the evaluation point, shared by the grid points
+  TensorProductEvaluationCache evaluationCache;
 };
 
 }  // namespace base
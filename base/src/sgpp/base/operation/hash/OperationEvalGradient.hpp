@@ -31,6 +31,13 @@ class OperationEvalGradient {
   virtual ~OperationEvalGradient() {
   }
 
+  /**
+   * Has to be called after the grid has been changed (e.g., refined or coarsened) before the
+   * operation is used again. Operations that store data derived from the grid points discard it.
+   */
+  virtual void prepare() {
+  }
+
   /**
    * @param       alpha     coefficient vector
    * @param       point     evaluation point
@@ -7,6 +7,7 @@
 #define OPERATIONEVALGRADIENTFUNDAMENTALNAKSPLINE_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/TensorProductEvaluationCache.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/FundamentalNakSplineBasis.hpp>
@@ -32,7 +33,8 @@ class OperationEvalGradientFundamentalNakSplineNaive : public
     storage(storage),
     base(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    evaluationCache(storage) {
   }
 
   /**
@@ -62,6 +64,11 @@ class OperationEvalGradientFundamentalNakSplineNaive : public
                     DataVector& value,
                     DataMatrix& gradient) override;
 
+  /**
+   * Discards the cached 1D basis functions of the grid points.
+   */
+  void prepare() override { evaluationCache.clear(); }
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -71,6 +78,8 @@ class OperationEvalGradientFundamentalNakSplineNaive : public
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// 1D basis function values at the evaluation point, shared by the grid points
+  TensorProductEvaluationCache evaluationCache;
 };
 
 }  // namespace base
@@ -7,6 +7,7 @@
 #define OPERATIONEVALGRADIENTWEAKLYFUNDAMENTALNAKSPLINEBOUNDARY_HPP
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/algorithm/TensorProductEvaluationCache.hpp>
 #include <sgpp/base/operation/hash/OperationEvalGradient.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/common/basis/WeaklyFundamentalNakSplineBasis.hpp>
@@ -35,7 +36,8 @@ class OperationEvalGradientWeaklyFundamentalNakSplineBoundaryNaive : public
     base(degree),
     baseDeriv1(degree),
     pointInUnitCube(storage.getDimension()),
-    innerDerivative(storage.getDimension()) {
+    innerDerivative(storage.getDimension()),
+    evaluationCache(storage) {
   }
 
   /**
@@ -65,6 +67,11 @@ class OperationEvalGradientWeaklyFundamentalNakSplineBoundaryNaive : public
                     DataVector& value,
                     DataMatrix& gradient) override;
 
+  /**
+   * Discards the cached 1D basis functions of the grid points.
+   */
+  void prepare() override { evaluationCache.clear(); }
+
  protected:
   /// storage of the sparse grid
   GridStorage& storage;
@@ -76,6 +83,8 @@ class OperationEvalGradientWeaklyFundamentalNakSplineBoundaryNaive : public
   DataVector pointInUnitCube;
   /// inner derivative (temporary vector)
   DataVector innerDerivative;
+  /// 1D basis function values at the evaluation point, shared by the grid points
+  TensorProductEvaluationCache evaluationCache;
 };
 
 }  // namespace base
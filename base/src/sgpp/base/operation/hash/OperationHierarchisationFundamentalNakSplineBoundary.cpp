@@ -8,6 +8,7 @@
 #include <sgpp/base/operation/hash/common/algorithm_bfs/HierarchisationFundamentalNakSplineBoundary.hpp>
 #include <sgpp/base/operation/hash/common/algorithm_bfs/DehierarchisationFundamentalNakSplineBoundary.hpp>
 #include <sgpp/base/algorithm/BreadthFirstSearch.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
@@ -24,6 +25,7 @@ OperationHierarchisationFundamentalNakSplineBoundary::
 
 void OperationHierarchisationFundamentalNakSplineBoundary::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationFundamentalNakSplineBoundary func(grid);
   BreadthFirstSearch<HierarchisationFundamentalNakSplineBoundary>
   bfs(func, grid->getStorage());
@@ -32,6 +34,7 @@ void OperationHierarchisationFundamentalNakSplineBoundary::doHierarchisation(
 
 void OperationHierarchisationFundamentalNakSplineBoundary::doDehierarchisation(
   DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationFundamentalNakSplineBoundary func(grid);
   BreadthFirstSearch<DehierarchisationFundamentalNakSplineBoundary>
   bfs(func, grid->getStorage());
@@ -41,6 +44,7 @@ void OperationHierarchisationFundamentalNakSplineBoundary::doDehierarchisation(
 
 void OperationHierarchisationFundamentalNakSplineBoundary::doHierarchisation(
   DataMatrix& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationFundamentalNakSplineBoundary func(grid);
   BreadthFirstSearch<HierarchisationFundamentalNakSplineBoundary>
   bfs(func, grid->getStorage());
@@ -49,6 +53,7 @@ void OperationHierarchisationFundamentalNakSplineBoundary::doHierarchisation(
 
 void OperationHierarchisationFundamentalNakSplineBoundary::doDehierarchisation(
   DataMatrix& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationFundamentalNakSplineBoundary func(grid);
   BreadthFirstSearch<DehierarchisationFundamentalNakSplineBoundary>
   bfs(func, grid->getStorage());
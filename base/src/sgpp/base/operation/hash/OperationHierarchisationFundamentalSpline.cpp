@@ -8,6 +8,7 @@
 #include <sgpp/base/operation/hash/common/algorithm_bfs/HierarchisationFundamentalSpline.hpp>
 #include <sgpp/base/operation/hash/common/algorithm_bfs/DehierarchisationFundamentalSpline.hpp>
 #include <sgpp/base/algorithm/BreadthFirstSearch.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
@@ -23,6 +24,7 @@ OperationHierarchisationFundamentalSpline::
 
 void OperationHierarchisationFundamentalSpline::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationFundamentalSpline func(grid);
   BreadthFirstSearch<HierarchisationFundamentalSpline>
   bfs(func, grid->getStorage());
@@ -31,6 +33,7 @@ void OperationHierarchisationFundamentalSpline::doHierarchisation(
 
 void OperationHierarchisationFundamentalSpline::doDehierarchisation(
   DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationFundamentalSpline func(grid);
   BreadthFirstSearch<DehierarchisationFundamentalSpline>
   bfs(func, grid->getStorage());
@@ -40,6 +43,7 @@ void OperationHierarchisationFundamentalSpline::doDehierarchisation(
 
 void OperationHierarchisationFundamentalSpline::doHierarchisation(
   DataMatrix& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationFundamentalSpline func(grid);
   BreadthFirstSearch<HierarchisationFundamentalSpline>
   bfs(func, grid->getStorage());
@@ -48,6 +52,7 @@ void OperationHierarchisationFundamentalSpline::doHierarchisation(
 
 void OperationHierarchisationFundamentalSpline::doDehierarchisation(
   DataMatrix& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationFundamentalSpline func(grid);
   BreadthFirstSearch<DehierarchisationFundamentalSpline>
   bfs(func, grid->getStorage());
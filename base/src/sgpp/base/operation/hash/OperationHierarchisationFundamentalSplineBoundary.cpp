@@ -8,6 +8,7 @@
 #include <sgpp/base/operation/hash/common/algorithm_bfs/HierarchisationFundamentalSplineBoundary.hpp>
 #include <sgpp/base/operation/hash/common/algorithm_bfs/DehierarchisationFundamentalSplineBoundary.hpp>
 #include <sgpp/base/algorithm/BreadthFirstSearch.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
@@ -23,6 +24,7 @@ OperationHierarchisationFundamentalSplineBoundary::
 
 void OperationHierarchisationFundamentalSplineBoundary::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationFundamentalSplineBoundary func(grid);
   BreadthFirstSearch<HierarchisationFundamentalSplineBoundary>
   bfs(func, grid->getStorage());
@@ -31,6 +33,7 @@ void OperationHierarchisationFundamentalSplineBoundary::doHierarchisation(
 
 void OperationHierarchisationFundamentalSplineBoundary::doDehierarchisation(
   DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationFundamentalSplineBoundary func(grid);
   BreadthFirstSearch<DehierarchisationFundamentalSplineBoundary>
   bfs(func, grid->getStorage());
@@ -40,6 +43,7 @@ void OperationHierarchisationFundamentalSplineBoundary::doDehierarchisation(
 
 void OperationHierarchisationFundamentalSplineBoundary::doHierarchisation(
   DataMatrix& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationFundamentalSplineBoundary func(grid);
   BreadthFirstSearch<HierarchisationFundamentalSplineBoundary>
   bfs(func, grid->getStorage());
@@ -48,6 +52,7 @@ void OperationHierarchisationFundamentalSplineBoundary::doHierarchisation(
 
 void OperationHierarchisationFundamentalSplineBoundary::doDehierarchisation(
   DataMatrix& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationFundamentalSplineBoundary func(grid);
   BreadthFirstSearch<DehierarchisationFundamentalSplineBoundary>
   bfs(func, grid->getStorage());
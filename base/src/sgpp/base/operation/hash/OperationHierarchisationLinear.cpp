@@ -11,6 +11,7 @@
 
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 
 namespace sgpp {
@@ -18,6 +19,7 @@ namespace base {
 
 void OperationHierarchisationLinear::doHierarchisation(DataVector&
     node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationLinear func(storage);
   sweep<HierarchisationLinear> s(func, storage);
 
@@ -28,6 +30,7 @@ void OperationHierarchisationLinear::doHierarchisation(DataVector&
 }
 
 void OperationHierarchisationLinear::doDehierarchisation(DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationLinear func(storage);
   sweep<DehierarchisationLinear> s(func, storage);
 
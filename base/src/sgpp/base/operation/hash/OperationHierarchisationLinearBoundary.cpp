@@ -11,6 +11,7 @@
 
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 
 namespace sgpp {
@@ -18,6 +19,7 @@ namespace base {
 
 void OperationHierarchisationLinearBoundary::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationLinearBoundary func(storage);
   sweep<HierarchisationLinearBoundary> s(func, storage);
 
@@ -33,6 +35,7 @@ void OperationHierarchisationLinearBoundary::doHierarchisation(
 
 void OperationHierarchisationLinearBoundary::doDehierarchisation(
   DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationLinearBoundary func(storage);
   sweep<DehierarchisationLinearBoundary> s(func, storage);
 
@@ -11,11 +11,13 @@
 #include <sgpp/base/algorithm/sweep.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationHierarchisationLinearClenshawCurtis::doHierarchisation(DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationLinearClenshawCurtis func(storage);
   sweep<HierarchisationLinearClenshawCurtis> s(func, storage);
 
@@ -26,6 +28,7 @@ void OperationHierarchisationLinearClenshawCurtis::doHierarchisation(DataVector&
 }
 
 void OperationHierarchisationLinearClenshawCurtis::doDehierarchisation(DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationLinearClenshawCurtis func(storage);
   sweep<DehierarchisationLinearClenshawCurtis> s(func, storage);
 
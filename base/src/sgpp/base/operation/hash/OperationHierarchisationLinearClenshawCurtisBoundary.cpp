@@ -10,12 +10,14 @@
 #include <sgpp/globaldef.hpp>
 #include <sgpp/base/operation/hash/common/algorithm_sweep/DehierarchisationLinearClenshawCurtisBoundary.hpp>
 #include <sgpp/base/operation/hash/common/algorithm_sweep/HierarchisationLinearClenshawCurtisBoundary.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationHierarchisationLinearClenshawCurtisBoundary::doHierarchisation(
     DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationLinearClenshawCurtisBoundary func(storage);
   sweep<HierarchisationLinearClenshawCurtisBoundary> s(func, storage);
 
@@ -26,6 +28,7 @@ void OperationHierarchisationLinearClenshawCurtisBoundary::doHierarchisation(
 }
 
 void OperationHierarchisationLinearClenshawCurtisBoundary::doDehierarchisation(DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationLinearClenshawCurtisBoundary func(storage);
   sweep<DehierarchisationLinearClenshawCurtisBoundary> s(func, storage);
 
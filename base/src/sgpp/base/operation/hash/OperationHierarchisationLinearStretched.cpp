@@ -11,6 +11,7 @@
 
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 
 namespace sgpp {
@@ -18,6 +19,7 @@ namespace base {
 
 void OperationHierarchisationLinearStretched::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationLinearStretched func(storage);
   sweep<HierarchisationLinearStretched> s(func, storage);
 
@@ -29,6 +31,7 @@ void OperationHierarchisationLinearStretched::doHierarchisation(
 
 void OperationHierarchisationLinearStretched::doDehierarchisation(
   DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationLinearStretched func(storage);
   sweep<DehierarchisationLinearStretched> s(func, storage);
 
@@ -11,6 +11,7 @@
 
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 
 namespace sgpp {
@@ -18,6 +19,7 @@ namespace base {
 
 void OperationHierarchisationLinearStretchedBoundary::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationLinearStretchedBoundary func(storage);
   sweep<HierarchisationLinearStretchedBoundary> s(func, storage);
 
@@ -33,6 +35,7 @@ void OperationHierarchisationLinearStretchedBoundary::doHierarchisation(
 
 void OperationHierarchisationLinearStretchedBoundary::doDehierarchisation(
   DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationLinearStretchedBoundary func(storage);
   sweep<DehierarchisationLinearStretchedBoundary> s(func, storage);
 
@@ -8,6 +8,7 @@
 #include <sgpp/base/exception/operation_exception.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 
 namespace sgpp {
@@ -15,12 +16,14 @@ namespace base {
 
 void OperationHierarchisationModBspline::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   throw operation_exception(
     "This operation is not implemented, yet! Sorry ;-)");
 }
 
 void OperationHierarchisationModBspline::doDehierarchisation(
   DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   throw operation_exception(
     "This operation is not implemented, yet! Sorry ;-)");
 }
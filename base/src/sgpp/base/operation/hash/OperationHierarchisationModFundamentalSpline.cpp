@@ -8,6 +8,7 @@
 #include <sgpp/base/operation/hash/common/algorithm_bfs/HierarchisationModFundamentalSpline.hpp>
 #include <sgpp/base/operation/hash/common/algorithm_bfs/DehierarchisationModFundamentalSpline.hpp>
 #include <sgpp/base/algorithm/BreadthFirstSearch.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
@@ -24,6 +25,7 @@ OperationHierarchisationModFundamentalSpline::
 
 void OperationHierarchisationModFundamentalSpline::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationModFundamentalSpline func(grid);
   BreadthFirstSearch<HierarchisationModFundamentalSpline>
   bfs(func, grid->getStorage());
@@ -32,6 +34,7 @@ void OperationHierarchisationModFundamentalSpline::doHierarchisation(
 
 void OperationHierarchisationModFundamentalSpline::doDehierarchisation(
   DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationModFundamentalSpline func(grid);
   BreadthFirstSearch<DehierarchisationModFundamentalSpline>
   bfs(func, grid->getStorage());
@@ -41,6 +44,7 @@ void OperationHierarchisationModFundamentalSpline::doDehierarchisation(
 
 void OperationHierarchisationModFundamentalSpline::doHierarchisation(
   DataMatrix& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationModFundamentalSpline func(grid);
   BreadthFirstSearch<HierarchisationModFundamentalSpline>
   bfs(func, grid->getStorage());
@@ -49,6 +53,7 @@ void OperationHierarchisationModFundamentalSpline::doHierarchisation(
 
 void OperationHierarchisationModFundamentalSpline::doDehierarchisation(
   DataMatrix& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationModFundamentalSpline func(grid);
   BreadthFirstSearch<DehierarchisationModFundamentalSpline>
   bfs(func, grid->getStorage());
@@ -12,6 +12,7 @@
 
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 
 namespace sgpp {
@@ -24,6 +25,7 @@ namespace base {
  */
 void OperationHierarchisationModLinear::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationModLinear func(storage);
   sweep<HierarchisationModLinear> s(func, storage);
 
@@ -40,6 +42,7 @@ void OperationHierarchisationModLinear::doHierarchisation(
  *
  */
 void OperationHierarchisationModLinear::doDehierarchisation(DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationModLinear func(storage);
   sweep<DehierarchisationModLinear> s(func, storage);
 
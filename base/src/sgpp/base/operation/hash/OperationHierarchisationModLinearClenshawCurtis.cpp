@@ -11,11 +11,13 @@
 #include <sgpp/base/algorithm/sweep.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationHierarchisationModLinearClenshawCurtis::doHierarchisation(DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationModLinearClenshawCurtis func(storage);
   sweep<HierarchisationModLinearClenshawCurtis> s(func, storage);
 
@@ -26,6 +28,7 @@ void OperationHierarchisationModLinearClenshawCurtis::doHierarchisation(DataVect
 }
 
 void OperationHierarchisationModLinearClenshawCurtis::doDehierarchisation(DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationModLinearClenshawCurtis func(storage);
   sweep<DehierarchisationModLinearClenshawCurtis> s(func, storage);
 
@@ -10,11 +10,13 @@
 #include <sgpp/base/algorithm/sweep.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationHierarchisationModPoly::doHierarchisation(DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationModPoly func(storage, &base);
   sweep<HierarchisationModPoly> s(func, storage);
 
@@ -25,6 +27,7 @@ void OperationHierarchisationModPoly::doHierarchisation(DataVector& node_values)
 }
 
 void OperationHierarchisationModPoly::doDehierarchisation(DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationModPoly func(storage, &base);
   sweep<DehierarchisationModPoly> s(func, storage);
 
@@ -11,11 +11,13 @@
 #include <sgpp/base/algorithm/sweep.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationHierarchisationModPolyClenshawCurtis::doHierarchisation(DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationModPolyClenshawCurtis func(storage, &base);
   sweep<HierarchisationModPolyClenshawCurtis> s(func, storage);
 
@@ -26,6 +28,7 @@ void OperationHierarchisationModPolyClenshawCurtis::doHierarchisation(DataVector
 }
 
 void OperationHierarchisationModPolyClenshawCurtis::doDehierarchisation(DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationModPolyClenshawCurtis func(storage, &base);
   sweep<DehierarchisationModPolyClenshawCurtis> s(func, storage);
 
@@ -11,11 +11,13 @@
 #include <sgpp/base/algorithm/sweep.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationHierarchisationPoly::doHierarchisation(DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationPoly func(storage, &base);
   sweep<HierarchisationPoly> s(func, storage);
 
@@ -26,6 +28,7 @@ void OperationHierarchisationPoly::doHierarchisation(DataVector& node_values) {
 }
 
 void OperationHierarchisationPoly::doDehierarchisation(DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationPoly func(storage, &base);
   sweep<DehierarchisationPoly> s(func, storage);
 
@@ -11,12 +11,14 @@
 #include <sgpp/base/algorithm/sweep.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationHierarchisationPolyBoundary::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationPolyBoundary func(storage, &base);
   sweep<HierarchisationPolyBoundary> s(func, storage);
 
@@ -28,6 +30,7 @@ void OperationHierarchisationPolyBoundary::doHierarchisation(
 
 void OperationHierarchisationPolyBoundary::doDehierarchisation(
   DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationPolyBoundary func(storage, &base);
   sweep<DehierarchisationPolyBoundary> s(func, storage);
 
@@ -11,11 +11,13 @@
 #include <sgpp/base/algorithm/sweep.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationHierarchisationPolyClenshawCurtis::doHierarchisation(DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationPolyClenshawCurtis func(storage, &base);
   sweep<HierarchisationPolyClenshawCurtis> s(func, storage);
 
@@ -26,6 +28,7 @@ void OperationHierarchisationPolyClenshawCurtis::doHierarchisation(DataVector& n
 }
 
 void OperationHierarchisationPolyClenshawCurtis::doDehierarchisation(DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationPolyClenshawCurtis func(storage, &base);
   sweep<DehierarchisationPolyClenshawCurtis> s(func, storage);
 
@@ -11,12 +11,14 @@
 #include <sgpp/base/algorithm/sweep.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationHierarchisationPolyClenshawCurtisBoundary::doHierarchisation(
     DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   HierarchisationPolyClenshawCurtisBoundary func(storage, &base);
   sweep<HierarchisationPolyClenshawCurtisBoundary> s(func, storage);
 
@@ -27,6 +29,7 @@ void OperationHierarchisationPolyClenshawCurtisBoundary::doHierarchisation(
 }
 
 void OperationHierarchisationPolyClenshawCurtisBoundary::doDehierarchisation(DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   DehierarchisationPolyClenshawCurtisBoundary func(storage, &base);
   sweep<DehierarchisationPolyClenshawCurtisBoundary> s(func, storage);
 
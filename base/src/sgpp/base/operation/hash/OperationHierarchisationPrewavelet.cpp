@@ -15,6 +15,7 @@
 
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 
 namespace sgpp {
@@ -22,6 +23,7 @@ namespace base {
 
 void OperationHierarchisationPrewavelet::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   /*
    * Hierarchisation on prewavelets require a hierarchisation on a normal
    * linear grid, afterwards they are converted into a prewavelet basis
@@ -44,6 +46,7 @@ void OperationHierarchisationPrewavelet::doHierarchisation(
 
 void OperationHierarchisationPrewavelet::doDehierarchisation(
   DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   ConvertPrewaveletToLinear func(storage);
   sweep<ConvertPrewaveletToLinear> s(func, storage);
 
@@ -5,12 +5,14 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalBsplineBoundaryNaive.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalBsplineBoundaryNaive::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = dataset.getNrows();
@@ -43,6 +45,7 @@ void OperationMultipleEvalBsplineBoundaryNaive::mult(DataVector& alpha, DataVect
 
 void OperationMultipleEvalBsplineBoundaryNaive::multTranspose(DataVector& alpha,
                                                               DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = dataset.getNrows();
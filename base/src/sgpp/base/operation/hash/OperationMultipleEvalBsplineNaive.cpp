@@ -5,12 +5,21 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalBsplineNaive.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+
 namespace sgpp {
 namespace base {
 
+namespace {
+/// number of consecutive data points sharing a bounding box
+const size_t BLOCK_SIZE = 64;
+}  // namespace
+
 void OperationMultipleEvalBsplineNaive::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = dataset.getNrows();
@@ -20,28 +29,40 @@ void OperationMultipleEvalBsplineNaive::mult(DataVector& alpha, DataVector& resu
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
-  for (size_t j = 0; j < m; j++) {
+  const size_t blockCount = calculateBlockBoundingBoxes();
+
+  for (size_t block = 0; block < blockCount; block++) {
+    const size_t blockEnd = std::min(m, (block + 1) * BLOCK_SIZE);
+
     for (size_t i = 0; i < n; i++) {
       const GridPoint& gp = storage[i];
-      double curValue = 1.0;
 
-      for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+      if (!isBlockInSupport(gp, block)) {
+        continue;
+      }
+
+      for (size_t j = block * BLOCK_SIZE; j < blockEnd; j++) {
+        double curValue = 1.0;
+
+        for (size_t t = 0; t < d; t++) {
+          const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+
+          if (val1d == 0.0) {
+            curValue = 0.0;
+            break;
+          }
 
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
+          curValue *= val1d;
         }
 
-        curValue *= val1d;
+        result[j] += alpha[i] * curValue;
       }
-
-      result[j] += alpha[i] * curValue;
     }
   }
 }
 
 void OperationMultipleEvalBsplineNaive::multTranspose(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = dataset.getNrows();
@@ -51,26 +72,84 @@ void OperationMultipleEvalBsplineNaive::multTranspose(DataVector& alpha, DataVec
   pointsInUnitCube = dataset;
   storage.getBoundingBox()->transformPointsToUnitCube(pointsInUnitCube);
 
+  const size_t blockCount = calculateBlockBoundingBoxes();
+
   for (size_t i = 0; i < n; i++) {
     const GridPoint& gp = storage[i];
 
-    for (size_t j = 0; j < m; j++) {
-      double curValue = 1.0;
+    for (size_t block = 0; block < blockCount; block++) {
+      if (!isBlockInSupport(gp, block)) {
+        continue;
+      }
+
+      const size_t blockEnd = std::min(m, (block + 1) * BLOCK_SIZE);
 
-      for (size_t t = 0; t < d; t++) {
-        const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+      for (size_t j = block * BLOCK_SIZE; j < blockEnd; j++) {
+        double curValue = 1.0;
 
-        if (val1d == 0.0) {
-          curValue = 0.0;
-          break;
+        for (size_t t = 0; t < d; t++) {
+          const double val1d = base.eval(gp.getLevel(t), gp.getIndex(t), pointsInUnitCube(j, t));
+
+          if (val1d == 0.0) {
+            curValue = 0.0;
+            break;
+          }
+
+          curValue *= val1d;
         }
 
-        curValue *= val1d;
+        result[i] += alpha[j] * curValue;
+      }
+    }
+  }
+}
+
+size_t OperationMultipleEvalBsplineNaive::calculateBlockBoundingBoxes() {
+  const size_t d = pointsInUnitCube.getNcols();
+  const size_t m = pointsInUnitCube.getNrows();
+  const size_t blockCount = (m + BLOCK_SIZE - 1) / BLOCK_SIZE;
+
+  blockLower.assign(blockCount * d, 0.0);
+  blockUpper.assign(blockCount * d, 0.0);
+
+  for (size_t block = 0; block < blockCount; block++) {
+    const size_t blockEnd = std::min(m, (block + 1) * BLOCK_SIZE);
+
+    for (size_t t = 0; t < d; t++) {
+      double lower = pointsInUnitCube(block * BLOCK_SIZE, t);
+      double upper = lower;
+
+      for (size_t j = block * BLOCK_SIZE + 1; j < blockEnd; j++) {
+        lower = std::min(lower, pointsInUnitCube(j, t));
+        upper = std::max(upper, pointsInUnitCube(j, t));
       }
 
-      result[i] += alpha[j] * curValue;
+      blockLower[block * d + t] = lower;
+      blockUpper[block * d + t] = upper;
+    }
+  }
+
+  return blockCount;
+}
+
+bool OperationMultipleEvalBsplineNaive::isBlockInSupport(const GridPoint& gp,
+                                                         size_t block) const {
+  const size_t d = storage.getDimension();
+  // the support of the B-spline is [i - (p+1)/2, i + (p+1)/2] after scaling by 2^l, the same
+  // differences as in SBsplineBase::eval are compared so that rounding cannot skip a point
+  const double halfSupport = static_cast<double>(base.getDegree() + 1) / 2.0;
+
+  for (size_t t = 0; t < d; t++) {
+    const double hInv = static_cast<double>(static_cast<index_t>(1) << gp.getLevel(t));
+    const double index = static_cast<double>(gp.getIndex(t));
+
+    if (hInv * blockUpper[block * d + t] - index < -halfSupport ||
+        hInv * blockLower[block * d + t] - index > halfSupport) {
+      return false;
     }
   }
+
+  return true;
 }
 
 double OperationMultipleEvalBsplineNaive::getDuration() { return 0.0; }
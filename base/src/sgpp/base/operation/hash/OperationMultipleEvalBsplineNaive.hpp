@@ -12,6 +12,8 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace base {
 
@@ -34,6 +36,27 @@ class OperationMultipleEvalBsplineNaive : public OperationMultipleEval {
   SBsplineBase base;
   /// untransformed evaluation point (temporary vector)
   DataMatrix pointsInUnitCube;
+  /// lower corners of the bounding boxes of all blocks of data points
+  std::vector<double> blockLower;
+  /// upper corners of the bounding boxes of all blocks of data points
+  std::vector<double> blockUpper;
+
+  /**
+   * Calculates the bounding boxes of blocks of consecutive points in pointsInUnitCube. The
+   * smaller the boxes, e.g. for data ordered along a space filling curve, the more pairs of
+   * blocks and basis functions are skipped.
+   *
+   * @return number of blocks
+   */
+  size_t calculateBlockBoundingBoxes();
+
+  /**
+   * @param gp      grid point
+   * @param block   block of data points
+   * @return        whether the support of the basis function intersects the bounding box of
+   *                the block
+   */
+  bool isBlockInSupport(const GridPoint& gp, size_t block) const;
 };
 
 }  // namespace base
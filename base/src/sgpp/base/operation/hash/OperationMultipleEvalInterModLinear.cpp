@@ -8,6 +8,7 @@
 #include <sgpp/base/operation/hash/OperationMultipleEvalInterModLinear.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
@@ -18,6 +19,7 @@ namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalInterModLinear::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   /*
   AlgorithmDGEMV<SLinearModifiedBase> op;
   LinearModifiedBasis<unsigned int, unsigned int> base;
@@ -126,6 +128,7 @@ void OperationMultipleEvalInterModLinear::mult(DataVector& alpha, DataVector& re
 }
 
 void OperationMultipleEvalInterModLinear::multTranspose(DataVector& source, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   result.setAll(0.0);
 
   #pragma omp parallel
@@ -7,26 +7,41 @@
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinear.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalLinear::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   AlgorithmMultipleEvaluation<SLinearBase> op;
   LinearBasis<unsigned int, unsigned int> base;
 
+  if (designMatrix.update(storage, base, this->dataset)) {
+    designMatrix.mult(alpha, result);
+    return;
+  }
+
   op.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalLinear::multTranspose(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   AlgorithmMultipleEvaluation<SLinearBase> op;
   LinearBasis<unsigned int, unsigned int> base;
 
+  if (designMatrix.update(storage, base, this->dataset)) {
+    designMatrix.multTranspose(alpha, result);
+    return;
+  }
+
   op.mult_transpose(storage, base, alpha, this->dataset, result);
 }
 
 double OperationMultipleEvalLinear::getDuration() { return 0.0; }
 
+void OperationMultipleEvalLinear::prepare() { designMatrix.clear(); }
+
 }  // namespace base
 }  // namespace sgpp
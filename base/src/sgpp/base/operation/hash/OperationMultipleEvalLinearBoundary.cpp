@@ -7,26 +7,41 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearBoundary.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalLinearBoundary::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   AlgorithmDGEMV<SLinearBoundaryBase> op;
   LinearBoundaryBasis<unsigned int, unsigned int> base;
 
+  if (designMatrix.update(storage, base, this->dataset)) {
+    designMatrix.mult(alpha, result);
+    return;
+  }
+
   op.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalLinearBoundary::multTranspose(DataVector& source, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   AlgorithmDGEMV<SLinearBoundaryBase> op;
   LinearBoundaryBasis<unsigned int, unsigned int> base;
 
+  if (designMatrix.update(storage, base, this->dataset)) {
+    designMatrix.multTranspose(source, result);
+    return;
+  }
+
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
 double OperationMultipleEvalLinearBoundary::getDuration() { return 0.0; }
 
+void OperationMultipleEvalLinearBoundary::prepare() { designMatrix.clear(); }
+
 }  // namespace base
 }  // namespace sgpp
@@ -6,6 +6,7 @@
 #ifndef OPERATIONMULTIPLEEVALLINEARBOUNDARY_HPP
 #define OPERATIONMULTIPLEEVALLINEARBOUNDARY_HPP
 
+#include <sgpp/base/algorithm/CachedDesignMatrix.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 
@@ -26,9 +27,14 @@ class OperationMultipleEvalLinearBoundary : public OperationMultipleEval {
    *
    * @param grid grid
    * @param dataset the dataset the should be evaluated
+   * @param cacheMemoryBudget if not 0, the evaluations of the basis functions at the data points
+   * are recorded once in a sparse matrix of at most this many bytes, which serves all further
+   * calls of mult and multTranspose until prepare() is called
    */
-  OperationMultipleEvalLinearBoundary(Grid& grid, DataMatrix& dataset)
-      : OperationMultipleEval(grid, dataset), storage(grid.getStorage()) {}
+  OperationMultipleEvalLinearBoundary(Grid& grid, DataMatrix& dataset, size_t cacheMemoryBudget = 0)
+      : OperationMultipleEval(grid, dataset),
+        storage(grid.getStorage()),
+        designMatrix(cacheMemoryBudget) {}
 
   /**
    * Destructor
@@ -40,9 +46,22 @@ class OperationMultipleEvalLinearBoundary : public OperationMultipleEval {
 
   double getDuration() override;
 
+  /**
+   * Drops the cached design matrix, needed after the grid or the data points (also in place) have
+   * been changed.
+   */
+  void prepare() override;
+
+  /**
+   * @return the cached design matrix
+   */
+  const CachedDesignMatrix& getDesignMatrix() const { return designMatrix; }
+
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
+  /// cached evaluations of the basis functions at the data points
+  CachedDesignMatrix designMatrix;
 };
 
 }  // namespace base
@@ -4,12 +4,14 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearBoundaryNaive.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalLinearBoundaryNaive::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = dataset.getNrows();
@@ -42,6 +44,7 @@ void OperationMultipleEvalLinearBoundaryNaive::mult(DataVector& alpha, DataVecto
 
 void OperationMultipleEvalLinearBoundaryNaive::multTranspose(DataVector& alpha,
                                                              DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = dataset.getNrows();
@@ -7,12 +7,14 @@
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearStretched.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearStretchedBasis.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalLinearStretched::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   AlgorithmDGEMV<SLinearStretchedBase> op;
   LinearStretchedBasis<unsigned int, unsigned int> base;
 
@@ -20,6 +22,7 @@ void OperationMultipleEvalLinearStretched::mult(DataVector& alpha, DataVector& r
 }
 
 void OperationMultipleEvalLinearStretched::multTranspose(DataVector& source, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   AlgorithmDGEMV<SLinearStretchedBase> op;
   LinearStretchedBasis<unsigned int, unsigned int> base;
 
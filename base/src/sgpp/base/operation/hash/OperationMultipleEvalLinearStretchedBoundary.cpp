@@ -7,12 +7,14 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearStretchedBoundary.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalLinearStretchedBoundary::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   AlgorithmDGEMV<SLinearStretchedBoundaryBase> op;
   LinearStretchedBoundaryBasis<unsigned int, unsigned int> base;
 
@@ -21,6 +23,7 @@ void OperationMultipleEvalLinearStretchedBoundary::mult(DataVector& alpha, DataV
 
 void OperationMultipleEvalLinearStretchedBoundary::multTranspose(DataVector& source,
                                                                  DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   AlgorithmDGEMV<SLinearStretchedBoundaryBase> op;
   LinearStretchedBoundaryBasis<unsigned int, unsigned int> base;
 
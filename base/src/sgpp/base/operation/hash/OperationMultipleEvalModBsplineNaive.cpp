@@ -5,12 +5,14 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalModBsplineNaive.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalModBsplineNaive::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = dataset.getNrows();
@@ -42,6 +44,7 @@ void OperationMultipleEvalModBsplineNaive::mult(DataVector& alpha, DataVector& r
 }
 
 void OperationMultipleEvalModBsplineNaive::multTranspose(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = dataset.getNrows();
@@ -8,26 +8,41 @@
 #include <sgpp/base/operation/hash/OperationMultipleEvalModLinear.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalModLinear::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   AlgorithmDGEMV<SLinearModifiedBase> op;
   LinearModifiedBasis<unsigned int, unsigned int> base;
 
+  if (designMatrix.update(storage, base, this->dataset)) {
+    designMatrix.mult(alpha, result);
+    return;
+  }
+
   op.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalModLinear::multTranspose(DataVector& source, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   AlgorithmDGEMV<SLinearModifiedBase> op;
   LinearModifiedBasis<unsigned int, unsigned int> base;
 
+  if (designMatrix.update(storage, base, this->dataset)) {
+    designMatrix.multTranspose(source, result);
+    return;
+  }
+
   op.mult_transposed(storage, base, source, this->dataset, result);
 }
 
 double OperationMultipleEvalModLinear::getDuration() { return 0.0; }
 
+void OperationMultipleEvalModLinear::prepare() { designMatrix.clear(); }
+
 }  // namespace base
 }  // namespace sgpp
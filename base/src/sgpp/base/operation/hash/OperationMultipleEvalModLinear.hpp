@@ -6,6 +6,7 @@
 #ifndef OPERATIONMULTIPLEEVALMODLINEAR_HPP
 #define OPERATIONMULTIPLEEVALMODLINEAR_HPP
 
+#include <sgpp/base/algorithm/CachedDesignMatrix.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 
@@ -25,9 +26,14 @@ class OperationMultipleEvalModLinear : public OperationMultipleEval {
    *
    * @param grid grid
    * @param dataset the dataset that should be evaluated
+   * @param cacheMemoryBudget if not 0, the evaluations of the basis functions at the data points
+   * are recorded once in a sparse matrix of at most this many bytes, which serves all further
+   * calls of mult and multTranspose until prepare() is called
    */
-  OperationMultipleEvalModLinear(Grid& grid, DataMatrix& dataset)
-      : OperationMultipleEval(grid, dataset), storage(grid.getStorage()) {}
+  OperationMultipleEvalModLinear(Grid& grid, DataMatrix& dataset, size_t cacheMemoryBudget = 0)
+      : OperationMultipleEval(grid, dataset),
+        storage(grid.getStorage()),
+        designMatrix(cacheMemoryBudget) {}
 
   /**
    * Destructor
@@ -39,9 +45,22 @@ class OperationMultipleEvalModLinear : public OperationMultipleEval {
 
   double getDuration() override;
 
+  /**
+   * Drops the cached design matrix, needed after the grid or the data points (also in place) have
+   * been changed.
+   */
+  void prepare() override;
+
+  /**
+   * @return the cached design matrix
+   */
+  const CachedDesignMatrix& getDesignMatrix() const { return designMatrix; }
+
  protected:
   /// Pointer to GridStorage object
   GridStorage& storage;
+  /// cached evaluations of the basis functions at the data points
+  CachedDesignMatrix designMatrix;
 };
 
 }  // namespace base
@@ -7,18 +7,21 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalModPoly.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalModPoly::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   AlgorithmDGEMV<SPolyModifiedBase> op;
 
   op.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalModPoly::multTranspose(DataVector& source, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   AlgorithmDGEMV<SPolyModifiedBase> op;
 
   op.mult_transposed(storage, base, source, this->dataset, result);
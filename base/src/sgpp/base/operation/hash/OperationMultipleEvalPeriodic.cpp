@@ -8,12 +8,14 @@
 #include <sgpp/base/operation/hash/OperationMultipleEvalPeriodic.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearPeriodicBasis.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalPeriodic::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   AlgorithmDGEMV<SLinearPeriodicBasis> op;
   LinearPeriodicBasis<unsigned int, unsigned int> base;
 
@@ -21,6 +23,7 @@ void OperationMultipleEvalPeriodic::mult(DataVector& alpha, DataVector& result)
 }
 
 void OperationMultipleEvalPeriodic::multTranspose(DataVector& source, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   AlgorithmDGEMV<SLinearPeriodicBasis> op;
   LinearPeriodicBasis<unsigned int, unsigned int> base;
 
@@ -6,17 +6,20 @@
 #include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalPolyBoundary.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalPolyBoundary::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   AlgorithmDGEMV<SPolyBoundaryBase> op;
 
   op.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalPolyBoundary::multTranspose(DataVector& source, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   AlgorithmDGEMV<SPolyBoundaryBase> op;
 
   op.mult_transposed(storage, base, source, this->dataset, result);
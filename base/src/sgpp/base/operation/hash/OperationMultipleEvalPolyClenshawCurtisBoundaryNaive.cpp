@@ -5,6 +5,7 @@
 
 #include <sgpp/base/operation/hash/OperationMultipleEvalPolyClenshawCurtisBoundaryNaive.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
@@ -12,6 +13,7 @@ namespace base {
 
 void OperationMultipleEvalPolyClenshawCurtisBoundaryNaive::mult(DataVector& alpha,
                                                                 DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = dataset.getNrows();
@@ -44,6 +46,7 @@ void OperationMultipleEvalPolyClenshawCurtisBoundaryNaive::mult(DataVector& alph
 
 void OperationMultipleEvalPolyClenshawCurtisBoundaryNaive::multTranspose(DataVector& alpha,
                                                                          DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   const size_t n = storage.getSize();
   const size_t d = storage.getDimension();
   const size_t m = dataset.getNrows();
@@ -10,11 +10,13 @@
 #include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalPrewavelet::mult(DataVector& alpha, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   AlgorithmDGEMV<SPrewaveletBase> op;
   PrewaveletBasis<unsigned int, unsigned int> base;
 
@@ -22,6 +24,7 @@ void OperationMultipleEvalPrewavelet::mult(DataVector& alpha, DataVector& result
 }
 
 void OperationMultipleEvalPrewavelet::multTranspose(DataVector& source, DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   AlgorithmDGEMV<SPrewaveletBase> op;
   PrewaveletBasis<unsigned int, unsigned int> base;
 
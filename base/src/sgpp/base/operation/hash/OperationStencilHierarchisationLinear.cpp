@@ -11,6 +11,7 @@
 
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 
 namespace sgpp {
@@ -18,6 +19,7 @@ namespace base {
 
 void OperationStencilHierarchisationLinear::doHierarchisation(
   DataVector& node_values) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doHierarchisation");
   surplusStencil.clear();
   neighborStencil.clear();
   weightStencil.clear();
@@ -33,6 +35,7 @@ void OperationStencilHierarchisationLinear::doHierarchisation(
 
 void OperationStencilHierarchisationLinear::doDehierarchisation(
   DataVector& alpha) {
+  SGPP_INSTRUMENT_SCOPE("OperationHierarchisation::doDehierarchisation");
   surplusStencil.clear();
   neighborStencil.clear();
   weightStencil.clear();
@@ -0,0 +1,271 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/tool_exception.hpp>
+#include <sgpp/base/tools/BenchmarkRunner.hpp>
+#include <sgpp/base/tools/ExecutionContext.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/base/tools/json/JSON.hpp>
+#include <sgpp/globaldef.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+const size_t BenchmarkRunner::DEFAULT_MIN_NUMBER_OF_REPETITIONS;
+const size_t BenchmarkRunner::DEFAULT_MAX_NUMBER_OF_REPETITIONS;
+constexpr double BenchmarkRunner::DEFAULT_MIN_SECONDS;
+
+BenchmarkRunner::BenchmarkRunner()
+    : numbersOfThreads(),
+      minNumberOfRepetitions(DEFAULT_MIN_NUMBER_OF_REPETITIONS),
+      maxNumberOfRepetitions(DEFAULT_MAX_NUMBER_OF_REPETITIONS),
+      minSeconds(DEFAULT_MIN_SECONDS),
+      verbose(true),
+      results() {
+  numbersOfThreads.push_back(1);
+
+  const size_t maxNumberOfThreads = ExecutionContext::getInstance().getNumberOfThreads();
+
+  if (maxNumberOfThreads > 1) {
+    numbersOfThreads.push_back(maxNumberOfThreads);
+  }
+}
+
+void BenchmarkRunner::configureFromEnvironment() {
+  const char* value = std::getenv("SGPP_BENCHMARK_THREADS");
+
+  if (value != nullptr) {
+    std::vector<size_t> newNumbersOfThreads;
+    std::stringstream stream(value);
+    std::string token;
+
+    while (std::getline(stream, token, ',')) {
+      const int64_t numberOfThreads = std::atoll(token.c_str());
+
+      if (numberOfThreads < 1) {
+        throw tool_exception(
+            "BenchmarkRunner::configureFromEnvironment: Invalid SGPP_BENCHMARK_THREADS.");
+      }
+
+      newNumbersOfThreads.push_back(static_cast<size_t>(numberOfThreads));
+    }
+
+    setNumbersOfThreads(newNumbersOfThreads);
+  }
+
+  value = std::getenv("SGPP_BENCHMARK_MIN_SECONDS");
+
+  if (value != nullptr) {
+    setMinSeconds(std::atof(value));
+  }
+
+  value = std::getenv("SGPP_BENCHMARK_MIN_REPETITIONS");
+
+  if (value != nullptr) {
+    setMinNumberOfRepetitions(static_cast<size_t>(std::max(std::atoll(value), 1LL)));
+  }
+
+  value = std::getenv("SGPP_BENCHMARK_MAX_REPETITIONS");
+
+  if (value != nullptr) {
+    setMaxNumberOfRepetitions(static_cast<size_t>(std::max(std::atoll(value), 1LL)));
+  }
+}
+
+const BenchmarkRunner::Result& BenchmarkRunner::run(const std::string& name,
+                                                    const Parameters& parameters,
+                                                    size_t numberOfThreads, double numberOfItems,
+                                                    const std::function<void()>& function) {
+  ExecutionContext& executionContext = ExecutionContext::getInstance();
+  const size_t oldNumberOfThreads = executionContext.getNumberOfThreads();
+  executionContext.setNumberOfThreads(numberOfThreads);
+
+  const size_t peakMemoryBefore = getPeakResidentMemory();
+  SGppStopwatch stopwatch;
+  std::vector<double> durations;
+  double totalSeconds = 0.0;
+
+  // warm-up (caches, lazily initialized data structures, thread pool)
+  function();
+
+  while ((durations.size() < maxNumberOfRepetitions) &&
+         ((durations.size() < minNumberOfRepetitions) || (totalSeconds < minSeconds))) {
+    stopwatch.start();
+    function();
+    durations.push_back(stopwatch.stop());
+    totalSeconds += durations.back();
+  }
+
+  executionContext.setNumberOfThreads(oldNumberOfThreads);
+
+  const size_t peakMemoryAfter = getPeakResidentMemory();
+  const size_t numberOfRepetitions = durations.size();
+  std::sort(durations.begin(), durations.end());
+
+  Result result;
+  result.name = name;
+  result.parameters = parameters;
+  result.numberOfThreads = numberOfThreads;
+  result.numberOfRepetitions = numberOfRepetitions;
+  result.minSeconds = durations.front();
+  result.maxSeconds = durations.back();
+  result.meanSeconds = totalSeconds / static_cast<double>(numberOfRepetitions);
+  result.medianSeconds =
+      ((numberOfRepetitions % 2 == 1)
+           ? durations[numberOfRepetitions / 2]
+           : (durations[numberOfRepetitions / 2 - 1] + durations[numberOfRepetitions / 2]) / 2.0);
+  result.numberOfItems = numberOfItems;
+  result.throughput = ((result.medianSeconds > 0.0) ? numberOfItems / result.medianSeconds : 0.0);
+  result.residentMemoryBytes = getResidentMemory();
+  result.peakMemoryIncreaseBytes =
+      ((peakMemoryAfter > peakMemoryBefore) ? peakMemoryAfter - peakMemoryBefore : 0);
+  results.push_back(result);
+
+  if (verbose) {
+    std::cout << name;
+
+    for (const auto& parameter : parameters) {
+      std::cout << " " << parameter.first << "=" << parameter.second;
+    }
+
+    std::cout << " threads=" << numberOfThreads << ": median " << result.medianSeconds * 1e3
+              << " ms, " << result.throughput << " items/s, " << numberOfRepetitions
+              << " repetitions" << std::endl;
+  }
+
+  return results.back();
+}
+
+const std::vector<size_t>& BenchmarkRunner::getNumbersOfThreads() const {
+  return numbersOfThreads;
+}
+
+void BenchmarkRunner::setNumbersOfThreads(const std::vector<size_t>& numbersOfThreads) {
+  if (numbersOfThreads.empty()) {
+    throw tool_exception(
+        "BenchmarkRunner::setNumbersOfThreads: List of numbers of threads is empty.");
+  }
+
+  this->numbersOfThreads = numbersOfThreads;
+}
+
+void BenchmarkRunner::setMinNumberOfRepetitions(size_t minNumberOfRepetitions) {
+  this->minNumberOfRepetitions = std::max(minNumberOfRepetitions, static_cast<size_t>(1));
+}
+
+void BenchmarkRunner::setMaxNumberOfRepetitions(size_t maxNumberOfRepetitions) {
+  this->maxNumberOfRepetitions = std::max(maxNumberOfRepetitions, static_cast<size_t>(1));
+}
+
+void BenchmarkRunner::setMinSeconds(double minSeconds) { this->minSeconds = minSeconds; }
+
+void BenchmarkRunner::setVerbose(bool verbose) { this->verbose = verbose; }
+
+const std::vector<BenchmarkRunner::Result>& BenchmarkRunner::getResults() const {
+  return results;
+}
+
+void BenchmarkRunner::clearResults() { results.clear(); }
+
+void BenchmarkRunner::writeJSON(const std::string& fileName) const {
+  json::JSON output;
+  json::Node& benchmarks = output.addListAttr("benchmarks");
+
+  for (const Result& result : results) {
+    json::Node& node = benchmarks.addDictValue();
+    node.addTextAttr("name", result.name);
+    json::Node& parametersNode = node.addDictAttr("parameters");
+
+    for (const auto& parameter : result.parameters) {
+      parametersNode.addTextAttr(parameter.first, parameter.second);
+    }
+
+    node.addIDAttr("numberOfThreads", static_cast<uint64_t>(result.numberOfThreads));
+    node.addIDAttr("numberOfRepetitions", static_cast<uint64_t>(result.numberOfRepetitions));
+    node.addIDAttr("minSeconds", result.minSeconds);
+    node.addIDAttr("medianSeconds", result.medianSeconds);
+    node.addIDAttr("meanSeconds", result.meanSeconds);
+    node.addIDAttr("maxSeconds", result.maxSeconds);
+    node.addIDAttr("numberOfItems", result.numberOfItems);
+    node.addIDAttr("throughput", result.throughput);
+    node.addIDAttr("residentMemoryBytes", static_cast<uint64_t>(result.residentMemoryBytes));
+    node.addIDAttr("peakMemoryIncreaseBytes",
+                   static_cast<uint64_t>(result.peakMemoryIncreaseBytes));
+  }
+
+  output.serialize(fileName);
+}
+
+void BenchmarkRunner::writeCSV(std::ostream& stream) const {
+  stream << "name,parameters,numberOfThreads,numberOfRepetitions,minSeconds,medianSeconds,"
+            "meanSeconds,maxSeconds,numberOfItems,throughput,residentMemoryBytes,"
+            "peakMemoryIncreaseBytes\n";
+
+  for (const Result& result : results) {
+    stream << result.name << ",";
+    bool first = true;
+
+    for (const auto& parameter : result.parameters) {
+      stream << (first ? "" : ";") << parameter.first << "=" << parameter.second;
+      first = false;
+    }
+
+    stream << "," << result.numberOfThreads << "," << result.numberOfRepetitions << ","
+           << result.minSeconds << "," << result.medianSeconds << "," << result.meanSeconds
+           << "," << result.maxSeconds << "," << result.numberOfItems << ","
+           << result.throughput << "," << result.residentMemoryBytes << ","
+           << result.peakMemoryIncreaseBytes << "\n";
+  }
+}
+
+size_t BenchmarkRunner::getResidentMemory() {
+#ifdef __linux__
+  // second entry of statm is the number of resident pages
+  std::ifstream statm("/proc/self/statm");
+  size_t totalPages = 0;
+  size_t residentPages = 0;
+
+  if (statm >> totalPages >> residentPages) {
+    return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  }
+#endif
+
+  return 0;
+}
+
+size_t BenchmarkRunner::getPeakResidentMemory() {
+#if defined(__unix__) || defined(__APPLE__)
+  struct rusage usage;
+
+  if (getrusage(RUSAGE_SELF, &usage) == 0) {
+#ifdef __APPLE__
+    // bytes on macOS
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    // kilobytes on Linux and BSD
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+  }
+#endif
+
+  return 0;
+}
+
+}  // namespace base
+}  // namespace sgpp
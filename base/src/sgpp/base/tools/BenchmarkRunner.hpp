@@ -0,0 +1,192 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Runner for micro and macro benchmarks of the hot paths of SG++ (grid construction,
+ * hash lookups, hierarchisation, evaluation, solvers, ...).
+ *
+ * Each benchmark case is identified by a name and a set of parameters (e.g., dimension, level,
+ * grid type) and is run with a given number of OpenMP threads. The case is repeated until
+ * both a minimum number of repetitions and a minimum total run time are reached.
+ * The runner records the run time statistics, the throughput (processed items per second,
+ * based on the median run time), and the memory usage of the process (if supported by the
+ * operating system). The results can be exported as JSON or CSV to track performance
+ * regressions between releases.
+ *
+ * The settings can be overridden at run time via the environment variables
+ * \c SGPP_BENCHMARK_THREADS (comma-separated list of numbers of threads),
+ * \c SGPP_BENCHMARK_MIN_SECONDS, \c SGPP_BENCHMARK_MIN_REPETITIONS, and
+ * \c SGPP_BENCHMARK_MAX_REPETITIONS, see configureFromEnvironment.
+ */
+class BenchmarkRunner {
+ public:
+  /// parameters of a benchmark case as pairs of names and values
+  typedef std::map<std::string, std::string> Parameters;
+
+  /// default minimum number of timed repetitions per case
+  static const size_t DEFAULT_MIN_NUMBER_OF_REPETITIONS = 3;
+  /// default maximum number of timed repetitions per case
+  static const size_t DEFAULT_MAX_NUMBER_OF_REPETITIONS = 1000;
+  /// default minimum total run time per case in seconds
+  static constexpr double DEFAULT_MIN_SECONDS = 0.2;
+
+  /**
+   * Result of a benchmark case.
+   */
+  struct Result {
+    /// name of the case
+    std::string name;
+    /// parameters of the case
+    Parameters parameters;
+    /// number of OpenMP threads
+    size_t numberOfThreads;
+    /// number of timed repetitions
+    size_t numberOfRepetitions;
+    /// shortest run time in seconds
+    double minSeconds;
+    /// median run time in seconds
+    double medianSeconds;
+    /// mean run time in seconds
+    double meanSeconds;
+    /// longest run time in seconds
+    double maxSeconds;
+    /// number of items processed per repetition (grid points, evaluation points, ...)
+    double numberOfItems;
+    /// processed items per second (based on the median run time)
+    double throughput;
+    /// resident memory of the process after the case in bytes (0 if not supported)
+    size_t residentMemoryBytes;
+    /// increase of the peak resident memory of the process during the case in bytes
+    /// (0 if not supported or if the previous peak has not been exceeded)
+    size_t peakMemoryIncreaseBytes;
+  };
+
+  /**
+   * Constructor, uses the default settings and all available threads.
+   */
+  BenchmarkRunner();
+
+  /**
+   * Override the settings with the values of the environment variables
+   * \c SGPP_BENCHMARK_THREADS, \c SGPP_BENCHMARK_MIN_SECONDS,
+   * \c SGPP_BENCHMARK_MIN_REPETITIONS, and \c SGPP_BENCHMARK_MAX_REPETITIONS (if set).
+   */
+  void configureFromEnvironment();
+
+  /**
+   * Run a benchmark case. The function is called once without timing (warm-up) and then
+   * repeatedly with timing.
+   *
+   * @param name              name of the case
+   * @param parameters        parameters of the case
+   * @param numberOfThreads   number of OpenMP threads to use (thread budget of the
+   *                          ExecutionContext during the run)
+   * @param numberOfItems     number of items processed by one call of the function
+   *                          (used for the throughput)
+   * @param function          function to benchmark
+   * @return result of the case (also appended to the list of results)
+   */
+  const Result& run(const std::string& name, const Parameters& parameters,
+                    size_t numberOfThreads, double numberOfItems,
+                    const std::function<void()>& function);
+
+  /**
+   * @return numbers of threads with which the cases should be run
+   *         (default: 1 and the maximum number of OpenMP threads)
+   */
+  const std::vector<size_t>& getNumbersOfThreads() const;
+
+  /**
+   * @param numbersOfThreads  numbers of threads with which the cases should be run
+   */
+  void setNumbersOfThreads(const std::vector<size_t>& numbersOfThreads);
+
+  /**
+   * @param minNumberOfRepetitions  minimum number of timed repetitions per case
+   */
+  void setMinNumberOfRepetitions(size_t minNumberOfRepetitions);
+
+  /**
+   * @param maxNumberOfRepetitions  maximum number of timed repetitions per case
+   *                                (takes precedence over the minimum run time)
+   */
+  void setMaxNumberOfRepetitions(size_t maxNumberOfRepetitions);
+
+  /**
+   * @param minSeconds  minimum total run time per case in seconds
+   */
+  void setMinSeconds(double minSeconds);
+
+  /**
+   * @param verbose   whether to print a summary line for every case to \c std::cout
+   */
+  void setVerbose(bool verbose);
+
+  /**
+   * @return results of all cases run so far
+   */
+  const std::vector<Result>& getResults() const;
+
+  /**
+   * Delete all results.
+   */
+  void clearResults();
+
+  /**
+   * Write the results as a JSON object with the list "benchmarks".
+   *
+   * @param fileName  name of the file
+   */
+  void writeJSON(const std::string& fileName) const;
+
+  /**
+   * Write the results as CSV (one line per case, parameters as "name=value" pairs
+   * separated by semicolons).
+   *
+   * @param stream    output stream
+   */
+  void writeCSV(std::ostream& stream) const;
+
+  /**
+   * @return current resident memory of the process in bytes (0 if not supported)
+   */
+  static size_t getResidentMemory();
+
+  /**
+   * @return peak resident memory of the process in bytes (0 if not supported)
+   */
+  static size_t getPeakResidentMemory();
+
+ protected:
+  /// numbers of threads with which the cases should be run
+  std::vector<size_t> numbersOfThreads;
+  /// minimum number of timed repetitions per case
+  size_t minNumberOfRepetitions;
+  /// maximum number of timed repetitions per case
+  size_t maxNumberOfRepetitions;
+  /// minimum total run time per case in seconds
+  double minSeconds;
+  /// whether to print a summary line for every case
+  bool verbose;
+  /// results of all cases run so far
+  std::vector<Result> results;
+};
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,129 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/tool_exception.hpp>
+#include <sgpp/base/tools/ExecutionContext.hpp>
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+ExecutionContext::ExecutionContext()
+    : numberOfThreads(0), nestingPolicy(NestingPolicy::Serialize) {
+  configureFromEnvironment();
+}
+
+ExecutionContext& ExecutionContext::getInstance() {
+  static ExecutionContext context;
+  return context;
+}
+
+size_t ExecutionContext::getNumberOfThreads() const {
+  if (numberOfThreads > 0) {
+    return numberOfThreads;
+  }
+
+#ifdef _OPENMP
+  return static_cast<size_t>(omp_get_max_threads());
+#else
+  return 1;
+#endif
+}
+
+void ExecutionContext::setNumberOfThreads(size_t numberOfThreads) {
+  this->numberOfThreads = numberOfThreads;
+
+#ifdef _OPENMP
+  if (numberOfThreads > 0) {
+    omp_set_num_threads(static_cast<int>(numberOfThreads));
+  }
+#endif
+}
+
+ExecutionContext::NestingPolicy ExecutionContext::getNestingPolicy() const {
+  return nestingPolicy;
+}
+
+void ExecutionContext::setNestingPolicy(NestingPolicy nestingPolicy) {
+  this->nestingPolicy = nestingPolicy;
+
+#ifdef _OPENMP
+  // the runtime clamps the value to the number of supported levels
+  omp_set_max_active_levels((nestingPolicy == NestingPolicy::Nested)
+                                ? std::numeric_limits<int>::max()
+                                : 1);
+#endif
+}
+
+void ExecutionContext::configureFromEnvironment() {
+  const char* value = std::getenv("SGPP_NUM_THREADS");
+
+  if (value != nullptr) {
+    const long newNumberOfThreads = std::strtol(value, nullptr, 10);  // NOLINT(runtime/int)
+
+    if (newNumberOfThreads <= 0) {
+      throw tool_exception(
+          "ExecutionContext::configureFromEnvironment: "
+          "SGPP_NUM_THREADS has to be a positive integer");
+    }
+
+    setNumberOfThreads(static_cast<size_t>(newNumberOfThreads));
+  }
+
+  value = std::getenv("SGPP_NESTED_PARALLELISM");
+
+  if (value != nullptr) {
+    const std::string policy(value);
+
+    if (policy == "serialize") {
+      setNestingPolicy(NestingPolicy::Serialize);
+    } else if (policy == "nested") {
+      setNestingPolicy(NestingPolicy::Nested);
+    } else {
+      throw tool_exception(
+          "ExecutionContext::configureFromEnvironment: "
+          "SGPP_NESTED_PARALLELISM has to be \"serialize\" or \"nested\"");
+    }
+  }
+}
+
+size_t ExecutionContext::getNumberOfThreadsForRegion(size_t numberOfWorkItems) const {
+  size_t result = getNumberOfThreads();
+
+#ifdef _OPENMP
+  const int level = omp_get_level();
+
+  if (omp_get_active_level() > 0) {
+    if ((nestingPolicy == NestingPolicy::Serialize) ||
+        (omp_get_active_level() >= omp_get_max_active_levels())) {
+      result = 1;
+    } else {
+      // divide the budget among the threads of the enclosing teams
+      for (int l = 1; l <= level; l++) {
+        result /= std::max(static_cast<size_t>(omp_get_team_size(l)), static_cast<size_t>(1));
+      }
+    }
+  }
+#endif
+
+  return std::max(std::min(result, numberOfWorkItems), static_cast<size_t>(1));
+}
+
+std::string ExecutionContext::toString() const {
+  return "numberOfThreads = " + std::to_string(getNumberOfThreads()) + ", nestingPolicy = " +
+         ((nestingPolicy == NestingPolicy::Nested) ? "nested" : "serialize");
+}
+
+}  // namespace base
+}  // namespace sgpp
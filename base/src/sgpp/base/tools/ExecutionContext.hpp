@@ -0,0 +1,130 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Singleton class holding the library-wide settings for the OpenMP parallel regions of SG++.
+ *
+ * The parallel regions of the library ask the context for the number of threads to use
+ * (getNumberOfThreadsForRegion()) instead of starting a team with the OpenMP default.
+ * This has two effects:
+ * - All regions use the same thread budget, such that the OpenMP runtime can keep reusing
+ *   its pool of worker threads instead of resizing the team from region to region.
+ * - Regions that are encountered inside other parallel regions (e.g., the evaluation of an
+ *   objective function inside MultiStart) are either run sequentially or get their share of
+ *   the budget, depending on the nesting policy. This prevents oversubscription.
+ *
+ * The thread budget and the nesting policy can be installed via the setters or via the
+ * environment variables SGPP_NUM_THREADS (positive integer) and SGPP_NESTED_PARALLELISM
+ * ("serialize" or "nested"), which are read when the context is created.
+ * Thread affinity is not handled by the context, as the OpenMP runtime fixes the binding of
+ * its threads at startup; use OMP_PROC_BIND and OMP_PLACES instead.
+ */
+class ExecutionContext {
+ public:
+  /**
+   * Policy for parallel regions that are encountered inside active parallel regions.
+   */
+  enum class NestingPolicy {
+    /// inner regions are run by the encountering thread only (default)
+    Serialize,
+    /// inner regions get the thread budget divided by the number of threads
+    /// of the enclosing teams
+    Nested
+  };
+
+  /**
+   * @return singleton instance
+   */
+  static ExecutionContext& getInstance();
+
+  /**
+   * @return thread budget of the library, i.e., the maximal number of threads that are
+   *         active at the same time (if not set explicitly, the OpenMP default)
+   */
+  size_t getNumberOfThreads() const;
+
+  /**
+   * Sets the thread budget of the library. This also sets the OpenMP default number of threads
+   * of the calling thread, such that code that queries omp_get_max_threads() is consistent
+   * with the budget. Should not be called inside parallel regions.
+   *
+   * @param numberOfThreads   thread budget (0 to use the OpenMP default)
+   */
+  void setNumberOfThreads(size_t numberOfThreads);
+
+  /**
+   * @return policy for nested parallel regions
+   */
+  NestingPolicy getNestingPolicy() const;
+
+  /**
+   * Sets the policy for nested parallel regions. This also sets the maximal number of active
+   * nested OpenMP levels accordingly. Should not be called inside parallel regions.
+   *
+   * @param nestingPolicy     policy for nested parallel regions
+   */
+  void setNestingPolicy(NestingPolicy nestingPolicy);
+
+  /**
+   * Reads SGPP_NUM_THREADS and SGPP_NESTED_PARALLELISM from the environment (if set).
+   * This is done automatically when the context is created.
+   */
+  void configureFromEnvironment();
+
+  /**
+   * Determines the number of threads for a parallel region that is about to start.
+   * Outside of parallel regions, this is the thread budget. Inside of parallel regions, this
+   * is one (NestingPolicy::Serialize) or the budget divided by the number of threads of the
+   * enclosing teams (NestingPolicy::Nested). The result is limited by the number of work
+   * items, such that short regions do not wake up threads that would not get any work.
+   *
+   * @param numberOfWorkItems     number of independent work items of the region
+   *                              (e.g., loop iterations or tasks)
+   * @return                      number of threads for the num_threads clause (at least one)
+   */
+  size_t getNumberOfThreadsForRegion(
+      size_t numberOfWorkItems = std::numeric_limits<size_t>::max()) const;
+
+  /**
+   * @return    human-readable description of the settings
+   */
+  std::string toString() const;
+
+ protected:
+  /// thread budget (0 if the OpenMP default is used)
+  size_t numberOfThreads;
+  /// policy for nested parallel regions
+  NestingPolicy nestingPolicy;
+
+ private:
+  /**
+   * Constructor, reads the settings from the environment.
+   */
+  ExecutionContext();
+
+  /**
+   * Deleted copy constructor.
+   */
+  ExecutionContext(const ExecutionContext&) = delete;
+
+  /**
+   * Deleted assignment operator.
+   */
+  void operator=(const ExecutionContext&) = delete;
+};
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,237 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+/**
+ * Write a string as a JSON string literal.
+ */
+void writeJSONString(std::ostream& stream, const std::string& str) {
+  stream << '"';
+
+  for (char c : str) {
+    switch (c) {
+      case '"':
+        stream << "\\\"";
+        break;
+      case '\\':
+        stream << "\\\\";
+        break;
+      case '\n':
+        stream << "\\n";
+        break;
+      case '\t':
+        stream << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          stream << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+                 << static_cast<int>(c) << std::dec << std::setfill(' ');
+        } else {
+          stream << c;
+        }
+    }
+  }
+
+  stream << '"';
+}
+
+}  // namespace
+
+std::atomic<bool> Instrumentation::enabled(false);
+
+Instrumentation::Instrumentation()
+    : origin(Clock::now()),
+      maxNumberOfEvents(DEFAULT_MAX_NUMBER_OF_EVENTS),
+      numberOfDroppedEvents(0) {}
+
+Instrumentation& Instrumentation::getInstance() {
+  static Instrumentation instrumentation;
+  return instrumentation;
+}
+
+void Instrumentation::enable() { enabled.store(true, std::memory_order_relaxed); }
+
+void Instrumentation::disable() { enabled.store(false, std::memory_order_relaxed); }
+
+void Instrumentation::reset() {
+  std::lock_guard<std::mutex> lock(mutex);
+  origin = Clock::now();
+  timers.clear();
+  counters.clear();
+  events.clear();
+  threadIndices.clear();
+  numberOfDroppedEvents = 0;
+}
+
+void Instrumentation::recordTimer(const char* name, Clock::time_point start,
+                                  Clock::time_point end) {
+  const double seconds = std::chrono::duration<double>(end - start).count();
+  std::lock_guard<std::mutex> lock(mutex);
+  auto it = timers.find(name);
+
+  if (it == timers.end()) {
+    timers.emplace(name, TimerStatistics{1, seconds, seconds, seconds});
+  } else {
+    TimerStatistics& statistics = it->second;
+    statistics.count++;
+    statistics.totalSeconds += seconds;
+    statistics.minSeconds = std::min(statistics.minSeconds, seconds);
+    statistics.maxSeconds = std::max(statistics.maxSeconds, seconds);
+  }
+
+  storeEvent(name, true, start, seconds * 1e6);
+}
+
+void Instrumentation::addToCounter(const char* name, double value) {
+  const Clock::time_point now = Clock::now();
+  std::lock_guard<std::mutex> lock(mutex);
+  CounterStatistics& statistics = counters[name];
+  statistics.count++;
+  statistics.sum += value;
+  storeEvent(name, false, now, statistics.sum);
+}
+
+void Instrumentation::storeEvent(const char* name, bool isTimer, Clock::time_point start,
+                                 double value) {
+  if (events.size() >= maxNumberOfEvents) {
+    numberOfDroppedEvents++;
+    return;
+  }
+
+  const size_t threadIndex =
+      threadIndices.emplace(std::this_thread::get_id(), threadIndices.size()).first->second;
+  const double startMicroseconds =
+      std::chrono::duration<double, std::micro>(start - origin).count();
+  events.push_back(Event{name, isTimer, threadIndex, startMicroseconds, value});
+}
+
+std::map<std::string, Instrumentation::TimerStatistics> Instrumentation::getTimerStatistics()
+    const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return timers;
+}
+
+std::map<std::string, Instrumentation::CounterStatistics>
+Instrumentation::getCounterStatistics() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return counters;
+}
+
+std::vector<Instrumentation::Event> Instrumentation::getEvents() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return events;
+}
+
+void Instrumentation::setMaxNumberOfEvents(size_t maxNumberOfEvents) {
+  std::lock_guard<std::mutex> lock(mutex);
+  this->maxNumberOfEvents = maxNumberOfEvents;
+}
+
+size_t Instrumentation::getNumberOfDroppedEvents() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return numberOfDroppedEvents;
+}
+
+void Instrumentation::writeJSON(std::ostream& stream) const {
+  std::lock_guard<std::mutex> lock(mutex);
+  const std::streamsize oldPrecision = stream.precision(17);
+  bool first = true;
+
+  stream << "{\n  \"timers\": {";
+
+  for (const auto& timer : timers) {
+    const TimerStatistics& statistics = timer.second;
+    const double meanSeconds = statistics.totalSeconds / static_cast<double>(statistics.count);
+    stream << (first ? "\n    " : ",\n    ");
+    writeJSONString(stream, timer.first);
+    stream << ": {\"count\": " << statistics.count
+           << ", \"totalSeconds\": " << statistics.totalSeconds
+           << ", \"meanSeconds\": " << meanSeconds
+           << ", \"minSeconds\": " << statistics.minSeconds
+           << ", \"maxSeconds\": " << statistics.maxSeconds << "}";
+    first = false;
+  }
+
+  stream << (first ? "},\n" : "\n  },\n") << "  \"counters\": {";
+  first = true;
+
+  for (const auto& counter : counters) {
+    stream << (first ? "\n    " : ",\n    ");
+    writeJSONString(stream, counter.first);
+    stream << ": {\"count\": " << counter.second.count << ", \"sum\": " << counter.second.sum
+           << "}";
+    first = false;
+  }
+
+  stream << (first ? "},\n" : "\n  },\n") << "  \"droppedEvents\": " << numberOfDroppedEvents
+         << "\n}\n";
+  stream.precision(oldPrecision);
+}
+
+void Instrumentation::writeJSON(const std::string& fileName) const {
+  std::ofstream file(fileName);
+
+  if (!file) {
+    throw file_exception("Instrumentation::writeJSON: Could not open file.");
+  }
+
+  writeJSON(file);
+}
+
+void Instrumentation::writeChromeTrace(std::ostream& stream) const {
+  std::lock_guard<std::mutex> lock(mutex);
+  const std::streamsize oldPrecision = stream.precision(17);
+
+  // complete events ("X") for timers and counter events ("C") for counters,
+  // timestamps and durations in microseconds
+  stream << "{\"traceEvents\": [";
+
+  for (size_t i = 0; i < events.size(); i++) {
+    const Event& event = events[i];
+    stream << ((i == 0) ? "\n" : ",\n") << "  {\"name\": ";
+    writeJSONString(stream, event.name);
+
+    if (event.isTimer) {
+      stream << ", \"cat\": \"sgpp\", \"ph\": \"X\", \"ts\": " << event.startMicroseconds
+             << ", \"dur\": " << event.value;
+    } else {
+      stream << ", \"cat\": \"sgpp\", \"ph\": \"C\", \"ts\": " << event.startMicroseconds
+             << ", \"args\": {\"value\": " << event.value << "}";
+    }
+
+    stream << ", \"pid\": 0, \"tid\": " << event.threadIndex << "}";
+  }
+
+  stream << "\n], \"displayTimeUnit\": \"ms\"}\n";
+  stream.precision(oldPrecision);
+}
+
+void Instrumentation::writeChromeTrace(const std::string& fileName) const {
+  std::ofstream file(fileName);
+
+  if (!file) {
+    throw file_exception("Instrumentation::writeChromeTrace: Could not open file.");
+  }
+
+  writeChromeTrace(file);
+}
+
+}  // namespace base
+}  // namespace sgpp
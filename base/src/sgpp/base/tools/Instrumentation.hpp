@@ -0,0 +1,271 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Singleton class collecting timings and counters of time-consuming operations
+ * (matrix-vector products, hierarchisation, refinement, solvers, data mining phases, ...).
+ *
+ * Instrumentation is disabled by default. When disabled, scoped timers and counters only cost
+ * a relaxed atomic load. When enabled, every timer and counter event is recorded thread-safely,
+ * aggregated per name, and stored for the trace export (up to a maximum number of events).
+ * The results can be exported to JSON or to the Chrome trace event format
+ * (viewable with chrome://tracing or Perfetto).
+ *
+ * Use the macros SGPP_INSTRUMENT_SCOPE and SGPP_INSTRUMENT_COUNT to instrument code.
+ * Defining SGPP_NO_INSTRUMENTATION at compile time removes them completely.
+ */
+class Instrumentation {
+ public:
+  /// clock used for timers
+  typedef std::chrono::steady_clock Clock;
+
+  /// default maximum number of stored events
+  static const size_t DEFAULT_MAX_NUMBER_OF_EVENTS = 1000000;
+
+  /**
+   * Aggregated statistics of a timer.
+   */
+  struct TimerStatistics {
+    /// number of measurements
+    size_t count;
+    /// sum of the durations in seconds
+    double totalSeconds;
+    /// shortest duration in seconds
+    double minSeconds;
+    /// longest duration in seconds
+    double maxSeconds;
+  };
+
+  /**
+   * Aggregated statistics of a counter.
+   */
+  struct CounterStatistics {
+    /// number of increments
+    size_t count;
+    /// sum of the increments
+    double sum;
+  };
+
+  /**
+   * Single timer or counter event.
+   */
+  struct Event {
+    /// name of the timer or counter (string literal)
+    const char* name;
+    /// true for timer events, false for counter events
+    bool isTimer;
+    /// index of the recording thread (in order of the first event of each thread)
+    size_t threadIndex;
+    /// start time in microseconds since the construction or the last reset
+    double startMicroseconds;
+    /// duration in microseconds (timers) or cumulative value (counters)
+    double value;
+  };
+
+  /**
+   * @return singleton instance
+   */
+  static Instrumentation& getInstance();
+
+  /**
+   * @return whether instrumentation is enabled
+   */
+  static bool isEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+  /**
+   * Enable the recording of timers and counters.
+   */
+  static void enable();
+
+  /**
+   * Disable the recording of timers and counters (already recorded data is kept).
+   */
+  static void disable();
+
+  /**
+   * Delete all recorded data and restart the time origin of the events.
+   */
+  void reset();
+
+  /**
+   * Record the measurement of a timer. Usually called by ScopedTimer.
+   *
+   * @param name  name of the timer, has to be a string literal
+   *              (or live as long as the recorded data)
+   * @param start start time
+   * @param end   end time
+   */
+  void recordTimer(const char* name, Clock::time_point start, Clock::time_point end);
+
+  /**
+   * Increment a counter.
+   *
+   * @param name  name of the counter, has to be a string literal
+   *              (or live as long as the recorded data)
+   * @param value increment
+   */
+  void addToCounter(const char* name, double value);
+
+  /**
+   * @return aggregated statistics of all timers
+   */
+  std::map<std::string, TimerStatistics> getTimerStatistics() const;
+
+  /**
+   * @return aggregated statistics of all counters
+   */
+  std::map<std::string, CounterStatistics> getCounterStatistics() const;
+
+  /**
+   * @return all stored events in order of recording
+   */
+  std::vector<Event> getEvents() const;
+
+  /**
+   * @param maxNumberOfEvents maximum number of stored events, further events are only aggregated
+   */
+  void setMaxNumberOfEvents(size_t maxNumberOfEvents);
+
+  /**
+   * @return number of events that were not stored due to the maximum number of events
+   */
+  size_t getNumberOfDroppedEvents() const;
+
+  /**
+   * Write the aggregated statistics as a JSON object.
+   *
+   * @param stream    output stream
+   */
+  void writeJSON(std::ostream& stream) const;
+
+  /**
+   * Write the aggregated statistics as a JSON object to a file.
+   *
+   * @param fileName  name of the file
+   */
+  void writeJSON(const std::string& fileName) const;
+
+  /**
+   * Write the stored events in the Chrome trace event format.
+   *
+   * @param stream    output stream
+   */
+  void writeChromeTrace(std::ostream& stream) const;
+
+  /**
+   * Write the stored events in the Chrome trace event format to a file.
+   *
+   * @param fileName  name of the file
+   */
+  void writeChromeTrace(const std::string& fileName) const;
+
+ protected:
+  /**
+   * Constructor.
+   */
+  Instrumentation();
+
+  /**
+   * Store an event, the mutex has to be locked.
+   */
+  void storeEvent(const char* name, bool isTimer, Clock::time_point start, double value);
+
+  /// whether instrumentation is enabled
+  static std::atomic<bool> enabled;
+  /// mutex protecting the recorded data
+  mutable std::mutex mutex;
+  /// time origin of the events
+  Clock::time_point origin;
+  /// aggregated statistics of the timers
+  std::map<std::string, TimerStatistics> timers;
+  /// aggregated statistics of the counters
+  std::map<std::string, CounterStatistics> counters;
+  /// stored events
+  std::vector<Event> events;
+  /// indices of the threads that recorded events
+  std::map<std::thread::id, size_t> threadIndices;
+  /// maximum number of stored events
+  size_t maxNumberOfEvents;
+  /// number of events that were not stored
+  size_t numberOfDroppedEvents;
+};
+
+/**
+ * Timer measuring the time between its construction and destruction, if instrumentation is
+ * enabled at construction.
+ */
+class ScopedTimer {
+ public:
+  /**
+   * Constructor, starts the timer.
+   *
+   * @param name  name of the timer, has to be a string literal
+   */
+  explicit ScopedTimer(const char* name)
+      : name(Instrumentation::isEnabled() ? name : nullptr) {
+    if (this->name != nullptr) {
+      start = Instrumentation::Clock::now();
+    }
+  }
+
+  /**
+   * Destructor, records the measurement.
+   */
+  ~ScopedTimer() {
+    if (name != nullptr) {
+      Instrumentation::getInstance().recordTimer(name, start, Instrumentation::Clock::now());
+    }
+  }
+
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+ protected:
+  /// name of the timer, nullptr if instrumentation was disabled at construction
+  const char* name;
+  /// start time
+  Instrumentation::Clock::time_point start;
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#define SGPP_INSTRUMENT_CONCAT_INNER(a, b) a##b
+#define SGPP_INSTRUMENT_CONCAT(a, b) SGPP_INSTRUMENT_CONCAT_INNER(a, b)
+
+#ifndef SGPP_NO_INSTRUMENTATION
+/// time the enclosing scope under the given name (string literal)
+#define SGPP_INSTRUMENT_SCOPE(name) \
+  ::sgpp::base::ScopedTimer SGPP_INSTRUMENT_CONCAT(sgppScopedTimer, __LINE__)(name)
+/// increment the counter with the given name (string literal)
+#define SGPP_INSTRUMENT_COUNT(name, value)                                    \
+  do {                                                                        \
+    if (::sgpp::base::Instrumentation::isEnabled()) {                         \
+      ::sgpp::base::Instrumentation::getInstance().addToCounter(name, value); \
+    }                                                                         \
+  } while (false)
+#else
+#define SGPP_INSTRUMENT_SCOPE(name)
+#define SGPP_INSTRUMENT_COUNT(name, value) \
+  do {                                     \
+  } while (false)
+#endif /* SGPP_NO_INSTRUMENTATION */
@@ -0,0 +1,95 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Per-thread clones of an object that is not thread-safe (e.g., a ScalarFunction), which
+ * can be kept over multiple parallel regions.
+ * Previously, every parallel region cloned the object once per thread; with this class, the
+ * clones are created on first use and reused in subsequent regions.
+ * The original object must not be changed while the clones are in use.
+ *
+ * @tparam T    type of the object, has to provide
+ *              <tt>void clone(std::unique_ptr<T>& clone) const</tt>
+ */
+template <class T>
+class ThreadLocalClones {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param original  object to be cloned (is used directly if a region has only one thread)
+   */
+  explicit ThreadLocalClones(T& original) : original(original), clones() {}
+
+  /**
+   * Copy constructor, the clones are not copied (they are created again on first use).
+   *
+   * @param other     object to be copied
+   */
+  ThreadLocalClones(const ThreadLocalClones& other) : original(other.original), clones() {}
+
+  /**
+   * Makes room for the clones of the given number of threads.
+   * Must be called before the parallel region.
+   *
+   * @param numberOfThreads   number of threads of the next parallel region
+   */
+  void reserve(size_t numberOfThreads) {
+    if (clones.size() < numberOfThreads) {
+      clones.resize(numberOfThreads);
+    }
+  }
+
+  /**
+   * Must be called inside the parallel region.
+   *
+   * @return  clone of the calling thread, or the original object if the region has only
+   *          one thread
+   */
+  T& get() {
+#ifdef _OPENMP
+    if (omp_get_num_threads() > 1) {
+      std::unique_ptr<T>& clone = clones[static_cast<size_t>(omp_get_thread_num())];
+
+      if (clone == nullptr) {
+        original.clone(clone);
+      }
+
+      return *clone;
+    }
+#endif /* _OPENMP */
+
+    return original;
+  }
+
+  /**
+   * Deletes all clones, e.g., after the original object has changed.
+   */
+  void clear() { clones.clear(); }
+
+ protected:
+  /// original object
+  T& original;
+  /// clones, one for each thread
+  std::vector<std::unique_ptr<T>> clones;
+};
+
+}  // namespace base
+}  // namespace sgpp
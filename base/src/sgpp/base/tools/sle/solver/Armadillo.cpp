@@ -3,6 +3,8 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/solver/Armadillo.hpp>
 #include <sgpp/base/tools/sle/system/CloneableSLE.hpp>
@@ -40,6 +42,7 @@ bool Armadillo::solve(SLE& system, DataVector& b, DataVector& x) const {
 }
 
 bool Armadillo::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
+  SGPP_INSTRUMENT_SCOPE("sle_solver::Armadillo::solve");
 #ifdef USE_ARMADILLO
   Printer::getInstance().printStatusBegin("Solving linear system (Armadillo)...");
 
@@ -50,14 +53,19 @@ bool Armadillo::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
 
   A.zeros();
 
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, A, nnz, rowsDone) default(none)
+  // parallelize only if the system is cloneable
+  const size_t numberOfThreads =
+      system.isCloneable()
+          ? ExecutionContext::getInstance().getNumberOfThreadsForRegion(system.getDimension())
+          : 1;
+
+#pragma omp parallel num_threads(numberOfThreads) shared(system, A, nnz, rowsDone) default(none)
   {
     SLE* system2 = &system;
 #ifdef _OPENMP
     std::unique_ptr<CloneableSLE> clonedSLE;
 
-    if (system.isCloneable() && (omp_get_max_threads() > 1)) {
+    if (system.isCloneable() && (omp_get_num_threads() > 1)) {
       dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
       system2 = clonedSLE.get();
     }
@@ -3,6 +3,7 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/solver/BiCGStab.hpp>
 #include <sgpp/globaldef.hpp>
@@ -22,6 +23,7 @@ BiCGStab::BiCGStab(size_t maxItCount, double tolerance, const DataVector& x0)
 BiCGStab::~BiCGStab() {}
 
 bool BiCGStab::solve(SLE& system, DataVector& b, DataVector& x) const {
+  SGPP_INSTRUMENT_SCOPE("sle_solver::BiCGStab::solve");
   Printer::getInstance().printStatusBegin("Solving linear system (BiCGStab)...");
 
   const size_t n = b.getSize();
@@ -3,6 +3,8 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/solver/Eigen.hpp>
 #include <sgpp/base/tools/sle/system/CloneableSLE.hpp>
@@ -67,6 +69,7 @@ bool Eigen::solve(SLE& system, DataVector& b, DataVector& x) const {
 }
 
 bool Eigen::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
+  SGPP_INSTRUMENT_SCOPE("sle_solver::Eigen::solve");
 #ifdef USE_EIGEN
   Printer::getInstance().printStatusBegin("Solving linear system (Eigen)...");
 
@@ -75,14 +78,19 @@ bool Eigen::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
   size_t nnz = 0;
   size_t rowsDone = 0;
 
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, A, nnz, rowsDone) default(none)
+  // parallelize only if the system is cloneable
+  const size_t numberOfThreads =
+      system.isCloneable()
+          ? ExecutionContext::getInstance().getNumberOfThreadsForRegion(system.getDimension())
+          : 1;
+
+#pragma omp parallel num_threads(numberOfThreads) shared(system, A, nnz, rowsDone) default(none)
   {
     SLE* system2 = &system;
 #ifdef _OPENMP
     std::unique_ptr<CloneableSLE> clonedSLE;
 
-    if (system.isCloneable() && (omp_get_max_threads() > 1)) {
+    if (system.isCloneable() && (omp_get_num_threads() > 1)) {
       dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
       system2 = clonedSLE.get();
     }
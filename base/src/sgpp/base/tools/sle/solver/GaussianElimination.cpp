@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/solver/GaussianElimination.hpp>
 #include <sgpp/globaldef.hpp>
@@ -18,6 +19,7 @@ namespace sle_solver {
 GaussianElimination::~GaussianElimination() {}
 
 bool GaussianElimination::solve(SLE& system, DataVector& b, DataVector& x) const {
+  SGPP_INSTRUMENT_SCOPE("sle_solver::GaussianElimination::solve");
   Printer::getInstance().printStatusBegin("Solving linear system (Gaussian elimination)...");
 
   // size of the system
@@ -3,6 +3,8 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/solver/Gmmpp.hpp>
 #include <sgpp/base/tools/sle/system/CloneableSLE.hpp>
@@ -109,6 +111,7 @@ bool solveInternal(const gmm::csr_matrix<double>& A, DataVector& b, DataVector&
 Gmmpp::~Gmmpp() {}
 
 bool Gmmpp::solve(SLE& system, DataVector& b, DataVector& x) const {
+  SGPP_INSTRUMENT_SCOPE("sle_solver::Gmmpp::solve");
 #ifdef USE_GMMPP
   Printer::getInstance().printStatusBegin("Solving linear system (Gmm++)...");
 
@@ -120,36 +123,41 @@ bool Gmmpp::solve(SLE& system, DataVector& b, DataVector& x) const {
   {
     gmm::row_matrix<gmm::rsvector<double>> A(n, n);
 
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) shared(system, A, nnz, rowsDone) default(none)
+    // parallelize only if the system is cloneable
+    const size_t numberOfThreads =
+        system.isCloneable()
+            ? ExecutionContext::getInstance().getNumberOfThreadsForRegion(system.getDimension())
+            : 1;
+
+#pragma omp parallel num_threads(numberOfThreads) shared(system, A, nnz, rowsDone) default(none)
     {
       SLE* system2 = &system;
 #ifdef _OPENMP
       std::unique_ptr<CloneableSLE> clonedSLE;
 
-      if (system.isCloneable() && (omp_get_max_threads() > 1)) {
+      if (system.isCloneable() && (omp_get_num_threads() > 1)) {
         dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
         system2 = clonedSLE.get();
       }
 
 #endif /* _OPENMP */
 
+      std::vector<size_t> rowIndices;
+      std::vector<double> rowValues;
+
 // copy system matrix to Gmm++ matrix object
-#pragma omp for ordered schedule(static)
+// (every thread writes to its own rows)
+#pragma omp for ordered schedule(static) reduction(+ : nnz)
 
       for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < n; j++) {
-          double entry = system2->getMatrixEntry(i, j);
-
-          if (entry != 0) {
-#pragma omp critical
-            {
-              A(i, j) = entry;
-              nnz++;
-            }
-          }
+        system2->getMatrixRow(i, rowIndices, rowValues);
+
+        for (size_t k = 0; k < rowValues.size(); k++) {
+          A(i, rowIndices[k]) = rowValues[k];
         }
 
+        nnz += rowValues.size();
+
 #pragma omp atomic
         rowsDone++;
 
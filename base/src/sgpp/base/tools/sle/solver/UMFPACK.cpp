@@ -3,6 +3,8 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/sle/solver/UMFPACK.hpp>
 #include <sgpp/base/tools/sle/system/CloneableSLE.hpp>
@@ -68,6 +70,7 @@ bool UMFPACK::solve(SLE& system, DataVector& b, DataVector& x) const {
 }
 
 bool UMFPACK::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
+  SGPP_INSTRUMENT_SCOPE("sle_solver::UMFPACK::solve");
 #ifdef USE_UMFPACK
   Printer::getInstance().printStatusBegin("Solving linear system (UMFPACK)...");
 
@@ -79,15 +82,20 @@ bool UMFPACK::solve(SLE& system, DataMatrix& B, DataMatrix& X) const {
   std::vector<double> Tx;
   size_t rowsDone = 0;
 
-// parallelize only if the system is cloneable
-#pragma omp parallel if (system.isCloneable()) \
+  // parallelize only if the system is cloneable
+  const size_t numberOfThreads =
+      system.isCloneable()
+          ? ExecutionContext::getInstance().getNumberOfThreadsForRegion(system.getDimension())
+          : 1;
+
+#pragma omp parallel num_threads(numberOfThreads) \
 shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
   {
     SLE* system2 = &system;
 #ifdef _OPENMP
     std::unique_ptr<CloneableSLE> clonedSLE;
 
-    if (system.isCloneable() && (omp_get_max_threads() > 1)) {
+    if (system.isCloneable() && (omp_get_num_threads() > 1)) {
       dynamic_cast<CloneableSLE&>(system).clone(clonedSLE);
       system2 = clonedSLE.get();
     }
@@ -97,19 +105,19 @@ shared(system, Ti, Tj, Tx, nnz, rowsDone) default(none)
     std::vector<uint32_t> curTi;
     std::vector<uint32_t> curTj;
     std::vector<double> curTx;
+    std::vector<size_t> rowIndices;
+    std::vector<double> rowValues;
 
 // get indices and values of nonzero entries
 #pragma omp for ordered schedule(static)
 
     for (uint32_t i = 0; i < n; i++) {
-      for (uint32_t j = 0; j < n; j++) {
-        double entry = system2->getMatrixEntry(i, j);
-
-        if (entry != 0) {
-          curTi.push_back(i);
-          curTj.push_back(j);
-          curTx.push_back(entry);
-        }
+      system2->getMatrixRow(i, rowIndices, rowValues);
+
+      for (size_t k = 0; k < rowValues.size(); k++) {
+        curTi.push_back(i);
+        curTj.push_back(static_cast<uint32_t>(rowIndices[k]));
+        curTx.push_back(rowValues[k]);
       }
 
 #pragma omp atomic
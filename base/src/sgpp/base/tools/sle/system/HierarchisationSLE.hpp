@@ -53,10 +53,14 @@
 #include <sgpp/base/grid/type/NaturalBsplineBoundaryGrid.hpp>
 #include <sgpp/base/grid/type/NakBsplineBoundaryGrid.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstring>
 #include <memory>
+#include <numeric>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -84,7 +88,11 @@ class HierarchisationSLE : public CloneableSLE {
    *                          grid points according to gridStorage)
    */
   HierarchisationSLE(Grid& grid, GridStorage& gridStorage)
-      : CloneableSLE(), grid(grid), gridStorage(gridStorage), basisType(INVALID) {
+      : CloneableSLE(),
+        grid(grid),
+        gridStorage(gridStorage),
+        basisType(INVALID),
+        supportTreeGridSize(0) {
     // initialize the correct basis (according to the grid)
     if (grid.getType() == GridType::Bspline) {
       bsplineBasis = std::unique_ptr<SBsplineBase>(
@@ -222,6 +230,94 @@ class HierarchisationSLE : public CloneableSLE {
     return evalBasisFunctionAtGridPoint(j, i);
   }
 
+  /**
+   * Retrieve all non-zero entries of a row, i.e., the values of all basis
+   * functions that do not vanish at the i-th grid point.
+   * Instead of evaluating all basis functions, the grid points are traversed
+   * dimension by dimension in a tree of their levels and indices
+   * (see buildSupportTree()), skipping every subtree whose 1D basis function
+   * vanishes at the grid point.
+   *
+   * @param       i               row index
+   * @param[out]  columnIndices   column indices of the non-zero entries
+   *                              (in ascending order)
+   * @param[out]  values          corresponding matrix entries
+   */
+  void getMatrixRow(size_t i, std::vector<size_t>& columnIndices,
+                    std::vector<double>& values) override {
+    const size_t d = gridStorage.getDimension();
+    columnIndices.clear();
+    values.clear();
+
+    if (supportTreeGridSize != gridStorage.getSize()) {
+      buildSupportTree();
+    }
+
+    if ((d == 0) || treeChildrenBegin.empty()) {
+      return;
+    }
+
+    const GridPoint& gpPoint = gridStorage[i];
+    std::vector<double> x(d);
+
+    for (size_t t = 0; t < d; t++) {
+      x[t] = gridStorage.getUnitCoordinate(gpPoint, t);
+    }
+
+    std::vector<std::pair<size_t, double>> entries;
+    addRowEntries(0, 0, 1.0, gpPoint, x, entries);
+    std::sort(entries.begin(), entries.end());
+
+    columnIndices.resize(entries.size());
+    values.resize(entries.size());
+
+    for (size_t k = 0; k < entries.size(); k++) {
+      columnIndices[k] = entries[k].first;
+      values[k] = entries[k].second;
+    }
+  }
+
+  /**
+   * Count all non-zero entries row by row via getMatrixRow().
+   *
+   * @return number of non-zero entries
+   */
+  size_t countNNZ() override {
+    const size_t n = getDimension();
+    std::vector<size_t> columnIndices;
+    std::vector<double> values;
+    size_t nnz = 0;
+
+    for (size_t i = 0; i < n; i++) {
+      getMatrixRow(i, columnIndices, values);
+      nnz += values.size();
+    }
+
+    return nnz;
+  }
+
+  /**
+   * Multiply the matrix with a vector row by row via getMatrixRow().
+   *
+   * @param       x   vector to be multiplied
+   * @param[out]  y   \f$y = Ax\f$
+   */
+  void matrixVectorMultiplication(const DataVector& x, DataVector& y) override {
+    const size_t n = getDimension();
+    std::vector<size_t> columnIndices;
+    std::vector<double> values;
+    y.resize(n);
+    y.setAll(0.0);
+
+    for (size_t i = 0; i < n; i++) {
+      getMatrixRow(i, columnIndices, values);
+
+      for (size_t k = 0; k < values.size(); k++) {
+        y[i] += values[k] * x[columnIndices[k]];
+      }
+    }
+  }
+
   /**
    * @return          sparse grid
    */
@@ -322,6 +418,212 @@ class HierarchisationSLE : public CloneableSLE {
     WAVELET_MODIFIED,
   } basisType;
 
+  /// number of grid points the support tree was built for
+  size_t supportTreeGridSize;
+  /// index of the first child of every node of the support tree
+  std::vector<size_t> treeChildrenBegin;
+  /// index after the last child of every node of the support tree
+  std::vector<size_t> treeChildrenEnd;
+  /// 1D level of every child
+  std::vector<GridPoint::level_type> treeChildLevel;
+  /// 1D index of every child
+  std::vector<GridPoint::index_type> treeChildIndex;
+  /// node (or grid point sequence number at depth d - 1) of every child
+  std::vector<size_t> treeChildNode;
+
+  /**
+   * (Re-)build the support tree for the current grid points.
+   * The grid points sorted lexicographically by their 1D levels and indices form
+   * a tree of depth d: the children of a node at depth t are the distinct
+   * (level, index) pairs in dimension t of all grid points sharing the node's
+   * levels and indices in the dimensions 0, ..., t - 1.
+   * The children of each node are stored contiguously, the children of the nodes
+   * at depth d - 1 point to the grid points.
+   */
+  void buildSupportTree() {
+    const size_t n = gridStorage.getSize();
+    const size_t d = gridStorage.getDimension();
+    std::vector<size_t> order(n);
+    std::iota(order.begin(), order.end(), 0);
+
+    std::sort(order.begin(), order.end(), [this, d](size_t i, size_t j) {
+      const GridPoint& gpI = gridStorage[i];
+      const GridPoint& gpJ = gridStorage[j];
+
+      for (size_t t = 0; t < d; t++) {
+        if (gpI.getLevel(t) != gpJ.getLevel(t)) {
+          return gpI.getLevel(t) < gpJ.getLevel(t);
+        } else if (gpI.getIndex(t) != gpJ.getIndex(t)) {
+          return gpI.getIndex(t) < gpJ.getIndex(t);
+        }
+      }
+
+      return false;
+    });
+
+    treeChildrenBegin.clear();
+    treeChildrenEnd.clear();
+    treeChildLevel.clear();
+    treeChildIndex.clear();
+    treeChildNode.clear();
+
+    if ((n > 0) && (d > 0)) {
+      addSupportTreeNode(order, 0, n, 0);
+    }
+
+    supportTreeGridSize = n;
+  }
+
+  /**
+   * Add a node and its subtree to the support tree.
+   *
+   * @param order     grid point sequence numbers in lexicographical order
+   * @param begin     first grid point of the node (index in order)
+   * @param end       index after the last grid point of the node
+   * @param t         depth of the node
+   * @return          index of the new node
+   */
+  size_t addSupportTreeNode(const std::vector<size_t>& order, size_t begin, size_t end,
+                            size_t t) {
+    const size_t node = treeChildrenBegin.size();
+    const size_t childrenBegin = treeChildLevel.size();
+    std::vector<size_t> childrenGridPointBegin;
+
+    treeChildrenBegin.push_back(childrenBegin);
+    treeChildrenEnd.push_back(childrenBegin);
+
+    // distinct (level, index) pairs in dimension t are consecutive in order
+    for (size_t k = begin; k < end; k++) {
+      const GridPoint& gp = gridStorage[order[k]];
+
+      if ((k == begin) || (gp.getLevel(t) != treeChildLevel.back()) ||
+          (gp.getIndex(t) != treeChildIndex.back())) {
+        treeChildLevel.push_back(gp.getLevel(t));
+        treeChildIndex.push_back(gp.getIndex(t));
+        treeChildNode.push_back(order[k]);
+        childrenGridPointBegin.push_back(k);
+      }
+    }
+
+    const size_t childCount = childrenGridPointBegin.size();
+    treeChildrenEnd[node] = childrenBegin + childCount;
+    childrenGridPointBegin.push_back(end);
+
+    if (t + 1 < gridStorage.getDimension()) {
+      for (size_t k = 0; k < childCount; k++) {
+        const size_t child = addSupportTreeNode(order, childrenGridPointBegin[k],
+                                                childrenGridPointBegin[k + 1], t + 1);
+        treeChildNode[childrenBegin + k] = child;
+      }
+    }
+
+    return node;
+  }
+
+  /**
+   * Traverse the subtree of a node and add the values of all basis functions
+   * in the subtree that do not vanish at a grid point.
+   *
+   * @param node          node of the support tree
+   * @param t             depth of the node
+   * @param value         product of the 1D values in the dimensions 0, ..., t - 1
+   * @param gpPoint       grid point
+   * @param x             unit coordinates of the grid point
+   * @param[out] entries  pairs of basis function indices and values
+   */
+  void addRowEntries(size_t node, size_t t, double value, const GridPoint& gpPoint,
+                     const std::vector<double>& x,
+                     std::vector<std::pair<size_t, double>>& entries) {
+    const bool isLastDimension = (t + 1 == gridStorage.getDimension());
+
+    for (size_t k = treeChildrenBegin[node]; k < treeChildrenEnd[node]; k++) {
+      const double value1d =
+          evalBasisFunction1DAtGridPoint(treeChildLevel[k], treeChildIndex[k], gpPoint, x[t], t);
+
+      if (value1d == 0.0) {
+        continue;
+      }
+
+      if (isLastDimension) {
+        entries.emplace_back(treeChildNode[k], value * value1d);
+      } else {
+        addRowEntries(treeChildNode[k], t + 1, value * value1d, gpPoint, x, entries);
+      }
+    }
+  }
+
+  /**
+   * @param l         1D level of the basis function
+   * @param i         1D index of the basis function
+   * @param gpPoint   grid point
+   * @param x         unit coordinate of the grid point in dimension t
+   * @param t         dimension
+   * @return          value of the 1D basis function in dimension t at the grid point
+   *                  (consistent with evalBasisFunctionAtGridPoint())
+   */
+  inline double evalBasisFunction1DAtGridPoint(GridPoint::level_type l, GridPoint::index_type i,
+                                               const GridPoint& gpPoint, double x, size_t t) {
+    switch (basisType) {
+      case BSPLINE:
+        return bsplineBasis->eval(l, i, x);
+      case BSPLINE_BOUNDARY:
+        return bsplineBoundaryBasis->eval(l, i, x);
+      case BSPLINE_CLENSHAW_CURTIS:
+        return bsplineClenshawCurtisBasis->eval(l, i, x);
+      case BSPLINE_MODIFIED:
+        return modBsplineBasis->eval(l, i, x);
+      case BSPLINE_MODIFIED_CLENSHAW_CURTIS:
+        return modBsplineClenshawCurtisBasis->eval(l, i, x);
+      case FUNDAMENTAL_NAK_SPLINE:
+      case FUNDAMENTAL_SPLINE:
+      case FUNDAMENTAL_SPLINE_MODIFIED:
+        if (gpPoint.getLevel(t) < l) {
+          return 0.0;
+        } else if (gpPoint.getLevel(t) == l) {
+          return ((gpPoint.getIndex(t) == i) ? 1.0 : 0.0);
+        } else if (basisType == FUNDAMENTAL_NAK_SPLINE) {
+          return fundamentalNakSplineBasis->eval(l, i, x);
+        } else if (basisType == FUNDAMENTAL_SPLINE) {
+          return fundamentalSplineBasis->eval(l, i, x);
+        } else {
+          return modFundamentalSplineBasis->eval(l, i, x);
+        }
+      case WEAKLY_FUNDAMENTAL_NAK_SPLINE:
+        return ((gpPoint.getLevel(t) < l) ? 0.0 : weaklyFundamentalNakSplineBasis->eval(l, i, x));
+      case WEAKLY_FUNDAMENTAL_NAK_SPLINE_MODIFIED:
+        return ((gpPoint.getLevel(t) < l) ? 0.0
+                                          : modWeaklyFundamentalNakSplineBasis->eval(l, i, x));
+      case WEAKLY_FUNDAMENTAL_SPLINE:
+        return ((gpPoint.getLevel(t) < l) ? 0.0 : weaklyFundamentalSplineBasis->eval(l, i, x));
+      case LINEAR:
+        return linearBasis->eval(l, i, x);
+      case LINEAR_BOUNDARY:
+        return linearL0BoundaryBasis->eval(l, i, x);
+      case LINEAR_CLENSHAW_CURTIS:
+        return linearClenshawCurtisBasis->eval(l, i, x);
+      case LINEAR_CLENSHAW_CURTIS_BOUNDARY:
+        return linearClenshawCurtisBoundaryBasis->eval(l, i, x);
+      case LINEAR_MODIFIED:
+        return modLinearBasis->eval(l, i, x);
+      case NATURAL_BSPLINE:
+        return naturalBsplineBasis->eval(l, i, x);
+      case NAK_BSPLINE:
+        return nakBsplineBasis->eval(l, i, x);
+      case NAK_BSPLINE_MODIFIED:
+        return modNakBsplineBasis->eval(l, i, x);
+      case WAVELET:
+        return waveletBasis->eval(l, i, x);
+      case WAVELET_BOUNDARY:
+        return waveletBoundaryBasis->eval(l, i, x);
+      case WAVELET_MODIFIED:
+        return modWaveletBasis->eval(l, i, x);
+      case NAK_BSPLINEBOUNDARY_COMBIGRID:
+        return nakBsplineBoundaryCombigridBasis->eval(l, i, x);
+      default:
+        return 0.0;
+    }
+  }
+
   /**
    * @param basisI    basis function index
    * @param pointJ    grid point index
@@ -9,6 +9,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cstddef>
+#include <vector>
 
 namespace sgpp {
 namespace base {
@@ -47,6 +48,33 @@ class SLE {
    */
   virtual double getMatrixEntry(size_t i, size_t j) = 0;
 
+  /**
+   * Retrieve all non-zero entries of a row.
+   * Standard implementation with \f$\mathcal{O}(n)\f$ lookups,
+   * systems with a known sparsity pattern should override this.
+   * The method is used by the sparse solvers to assemble the matrix.
+   *
+   * @param       i               row index
+   * @param[out]  columnIndices   column indices of the non-zero entries
+   *                              (in ascending order)
+   * @param[out]  values          corresponding matrix entries
+   */
+  virtual void getMatrixRow(size_t i, std::vector<size_t>& columnIndices,
+                            std::vector<double>& values) {
+    const size_t n = getDimension();
+    columnIndices.clear();
+    values.clear();
+
+    for (size_t j = 0; j < n; j++) {
+      const double entry = getMatrixEntry(i, j);
+
+      if (entry != 0.0) {
+        columnIndices.push_back(j);
+        values.push_back(entry);
+      }
+    }
+  }
+
   /**
    * Multiply the matrix with a vector.
    * Standard implementation with \f$\mathcal{O}(n^2)\f$ scalar
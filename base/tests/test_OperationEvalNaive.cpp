@@ -18,8 +18,10 @@
 #include <sgpp/base/operation/hash/common/basis/PolyClenshawCurtisBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/PolyClenshawCurtisBasis.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#include <list>
 #include <vector>
 #include <random>
 
@@ -32,12 +34,14 @@ using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::base::GridGenerator;
 using sgpp::base::GridPoint;
+using sgpp::base::GridStorage;
 using sgpp::base::GridType;
 using sgpp::base::OperationEval;
 using sgpp::base::OperationEvalGradient;
 using sgpp::base::OperationEvalHessian;
 using sgpp::base::OperationEvalPartialDerivative;
 using sgpp::base::SBasis;
+using sgpp::base::SurplusRefinementFunctor;
 using sgpp::base::SPolyBase;
 using sgpp::base::SPolyBoundaryBase;
 using sgpp::base::SPolyModifiedBase;
@@ -506,3 +510,126 @@ BOOST_AUTO_TEST_CASE(TestOperationEvalNaive) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestOperationEvalNaiveAfterRefinement) {
+  // the operations cache the 1D basis functions of the grid,
+  // they have to rebuild them after prepare() has been called
+  const size_t d = 3;
+  const size_t p = 3;
+
+  std::mt19937 generator;
+  generator.seed(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  std::unique_ptr<Grid> grid(Grid::createBsplineBoundaryGrid(d, p));
+  sgpp::base::SBsplineBoundaryBase basis(p);
+  grid->getGenerator().regular(3);
+
+  std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(*grid));
+  std::unique_ptr<OperationEvalGradient> opEvalGradient(
+      sgpp::op_factory::createOperationEvalGradientNaive(*grid));
+  std::unique_ptr<OperationEvalHessian> opEvalHessian(
+      sgpp::op_factory::createOperationEvalHessianNaive(*grid));
+
+  DataVector x(d);
+
+  for (size_t t = 0; t < d; t++) {
+    x[t] = uniformDistribution(generator);
+  }
+
+  for (size_t r = 0; r < 3; r++) {
+    const size_t n = grid->getSize();
+    DataVector alpha(n);
+
+    for (size_t i = 0; i < n; i++) {
+      alpha[i] = normalDistribution(generator);
+    }
+
+    // evaluate function, gradient, and Hessian by hand (unit bounding box)
+    double fxRef = 0.0;
+    DataVector gradientRef(d, 0.0);
+    DataMatrix hessianRef(d, d, 0.0);
+
+    for (size_t i = 0; i < n; i++) {
+      GridPoint& gp = grid->getStorage().getPoint(i);
+      DataVector phi(d), dphi(d), ddphi(d);
+
+      for (size_t t = 0; t < d; t++) {
+        phi[t] = basisEval(basis, gp.getLevel(t), gp.getIndex(t), x[t]);
+        dphi[t] = basisEvalDx(basis, gp.getLevel(t), gp.getIndex(t), x[t]);
+        ddphi[t] = basisEvalDxDx(basis, gp.getLevel(t), gp.getIndex(t), x[t]);
+      }
+
+      double val = alpha[i];
+
+      for (size_t t = 0; t < d; t++) {
+        val *= phi[t];
+      }
+
+      fxRef += val;
+
+      for (size_t j = 0; j < d; j++) {
+        val = alpha[i];
+
+        for (size_t t = 0; t < d; t++) {
+          val *= ((t == j) ? dphi[t] : phi[t]);
+        }
+
+        gradientRef[j] += val;
+
+        for (size_t k = 0; k < d; k++) {
+          val = alpha[i];
+
+          for (size_t t = 0; t < d; t++) {
+            if ((t == j) && (t == k)) {
+              val *= ddphi[t];
+            } else if ((t == j) || (t == k)) {
+              val *= dphi[t];
+            } else {
+              val *= phi[t];
+            }
+          }
+
+          hessianRef(j, k) += val;
+        }
+      }
+    }
+
+    DataVector gradient(d);
+    DataMatrix hessian(d, d);
+
+    checkClose(opEval->eval(alpha, x), fxRef);
+    checkClose(opEvalGradient->evalGradient(alpha, x, gradient), fxRef);
+    checkClose(gradient, gradientRef);
+    checkClose(opEvalHessian->evalHessian(alpha, x, gradient, hessian), fxRef);
+    checkClose(gradient, gradientRef);
+    checkClose(hessian, hessianRef);
+
+    if (r == 0) {
+      // refine the grid, the operations are reused for the refined grid
+      SurplusRefinementFunctor functor(alpha, 1);
+      grid->getGenerator().refine(functor);
+    } else if (r == 1) {
+      // replace the last grid point by a new one whose basis function does not vanish at x,
+      // the number of grid points does not change
+      GridStorage& storage = grid->getStorage();
+      GridPoint newPoint(d);
+
+      for (size_t t = 0; t < d; t++) {
+        newPoint.set(t, 6, 2 * static_cast<GridPoint::index_type>(x[t] * 32.0) + 1);
+      }
+
+      BOOST_REQUIRE(!storage.isContaining(newPoint));
+
+      std::list<size_t> removedPoints{n - 1};
+      storage.deletePoints(removedPoints);
+      storage.insert(newPoint);
+      BOOST_REQUIRE_EQUAL(storage.getSize(), n);
+    }
+
+    opEval->prepare();
+    opEvalGradient->prepare();
+    opEvalHessian->prepare();
+  }
+}
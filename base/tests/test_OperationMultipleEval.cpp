@@ -6,18 +6,33 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalLinear.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::base::GridStorage;
+using sgpp::base::OperationEval;
 using sgpp::base::OperationMultipleEval;
+using sgpp::base::OperationMultipleEvalLinear;
 
 BOOST_AUTO_TEST_SUITE(TestOperationMultipleEval)
 
@@ -78,4 +93,233 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalBsplineBlocks) {
+  // the B-spline evaluation skips blocks of data points outside of the supports, compare with
+  // the evaluation of single points for unordered and sorted data
+  const size_t dim = 2;
+  const size_t degree = 3;
+  const size_t numberDataPoints = 500;
+  std::unique_ptr<Grid> grid(Grid::createBsplineGrid(dim, degree));
+  grid->getGenerator().regular(5);
+  const size_t N = grid->getSize();
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  DataVector alpha(N);
+  DataVector source(numberDataPoints);
+
+  for (size_t i = 0; i < N; i++) {
+    alpha[i] = distribution(generator);
+  }
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    source[j] = distribution(generator);
+  }
+
+  std::vector<std::vector<double>> points(numberDataPoints, std::vector<double>(dim));
+
+  for (auto& point : points) {
+    for (double& x : point) {
+      x = distribution(generator);
+    }
+  }
+
+  std::unique_ptr<OperationEval> opEval(sgpp::op_factory::createOperationEvalNaive(*grid));
+
+  for (bool sorted : {false, true}) {
+    if (sorted) {
+      std::sort(points.begin(), points.end());
+    }
+
+    DataMatrix dataset(numberDataPoints, dim);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      dataset.setRow(j, DataVector(points[j]));
+    }
+
+    std::unique_ptr<OperationMultipleEval> opMultipleEval(
+        sgpp::op_factory::createOperationMultipleEvalNaive(*grid, dataset));
+
+    DataVector result(numberDataPoints);
+    opMultipleEval->mult(alpha, result);
+
+    DataVector resultTranspose(N);
+    opMultipleEval->multTranspose(source, resultTranspose);
+
+    DataVector resultTransposeRef(N, 0.0);
+
+    for (size_t j = 0; j < numberDataPoints; j++) {
+      DataVector point(points[j]);
+      BOOST_CHECK_SMALL(result[j] - opEval->eval(alpha, point), 1e-12);
+
+      for (size_t i = 0; i < N; i++) {
+        DataVector unitVector(N, 0.0);
+        unitVector[i] = 1.0;
+        resultTransposeRef[i] += source[j] * opEval->eval(unitVector, point);
+      }
+    }
+
+    for (size_t i = 0; i < N; i++) {
+      BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeRef[i], 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalCached) {
+  // the cached design matrix has to reproduce the recomputing operations, also after refinement
+  // and prepare()
+  const size_t dim = 3;
+  const size_t numberDataPoints = 400;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(j, d, distribution(generator));
+    }
+  }
+
+  DataVector source(numberDataPoints);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    source[j] = distribution(generator);
+  }
+
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.emplace_back(Grid::createLinearGrid(dim));
+  grids.emplace_back(Grid::createLinearBoundaryGrid(dim));
+  grids.emplace_back(Grid::createModLinearGrid(dim));
+
+  for (auto& grid : grids) {
+    grid->getGenerator().regular(3);
+
+    std::unique_ptr<OperationMultipleEval> opCached(
+        sgpp::op_factory::createOperationMultipleEvalCached(*grid, dataset, 64 * 1024 * 1024));
+    std::unique_ptr<OperationMultipleEval> opReference(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+    for (size_t refinement = 0; refinement < 2; refinement++) {
+      const size_t N = grid->getSize();
+      DataVector alpha(N);
+
+      for (size_t i = 0; i < N; i++) {
+        alpha[i] = distribution(generator);
+      }
+
+      // the second product is served from the cache
+      for (size_t repetition = 0; repetition < 2; repetition++) {
+        DataVector result(numberDataPoints);
+        DataVector resultReference(numberDataPoints);
+        opCached->mult(alpha, result);
+        opReference->mult(alpha, resultReference);
+
+        for (size_t j = 0; j < numberDataPoints; j++) {
+          BOOST_CHECK_SMALL(result[j] - resultReference[j], 1e-12);
+        }
+
+        DataVector resultTranspose(N);
+        DataVector resultTransposeReference(N);
+        opCached->multTranspose(source, resultTranspose);
+        opReference->multTranspose(source, resultTransposeReference);
+
+        for (size_t i = 0; i < N; i++) {
+          BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeReference[i], 1e-10);
+        }
+      }
+
+      sgpp::base::SurplusRefinementFunctor functor(alpha, 3);
+      grid->getGenerator().refine(functor);
+      opCached->prepare();
+    }
+  }
+
+  // a budget too small for the matrix falls back to the recomputation
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(3);
+  DataVector alpha(grid->getSize(), 1.0);
+  DataVector result(numberDataPoints);
+  DataVector resultReference(numberDataPoints);
+
+  OperationMultipleEvalLinear opSmallBudget(*grid, dataset, 1024);
+  OperationMultipleEvalLinear opLargeBudget(*grid, dataset, 64 * 1024 * 1024);
+  opSmallBudget.mult(alpha, result);
+  opLargeBudget.mult(alpha, resultReference);
+
+  BOOST_CHECK(!opSmallBudget.getDesignMatrix().isValid());
+  BOOST_CHECK(opLargeBudget.getDesignMatrix().isValid());
+  BOOST_CHECK_LE(opLargeBudget.getDesignMatrix().getMemoryFootprint(), 64 * 1024 * 1024);
+  // every data point lies in the support of one function per level
+  BOOST_CHECK_GE(opLargeBudget.getDesignMatrix().getNumberNonZeros(), numberDataPoints);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    BOOST_CHECK_SMALL(result[j] - resultReference[j], 1e-12);
+  }
+
+  // changes of the data in place have to be announced by prepare
+  dataset.set(0, 0, 0.5);
+  dataset.set(0, 1, 0.5);
+  dataset.set(0, 2, 0.5);
+  opLargeBudget.prepare();
+  opLargeBudget.mult(alpha, result);
+  BOOST_CHECK_CLOSE(result[0], 1.0, 1e-12);
+}
+
+BOOST_AUTO_TEST_CASE(testAlgorithmDGEMVAccumulation) {
+  // all accumulation strategies of the transposed product have to agree for any number of threads
+  const size_t dim = 3;
+  const size_t numberDataPoints = 1000;
+  std::unique_ptr<Grid> grid(Grid::createModLinearGrid(dim));
+  grid->getGenerator().regular(4);
+  const size_t N = grid->getSize();
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  DataMatrix dataset(numberDataPoints, dim);
+  DataVector source(numberDataPoints);
+
+  for (size_t j = 0; j < numberDataPoints; j++) {
+    source[j] = distribution(generator);
+
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(j, d, distribution(generator));
+    }
+  }
+
+  sgpp::base::LinearModifiedBasis<unsigned int, unsigned int> basis;
+  DataVector resultReference(N);
+  sgpp::base::AlgorithmDGEMV<sgpp::base::SLinearModifiedBase>(
+      sgpp::base::DGEMVAccumulation::PrivateCopies)
+      .mult_transposed(grid->getStorage(), basis, source, dataset, resultReference);
+
+#ifdef _OPENMP
+  const int maxThreads = omp_get_max_threads();
+#endif
+
+  for (int numThreads : {1, 2, 3, 8}) {
+#ifdef _OPENMP
+    omp_set_num_threads(numThreads);
+#endif
+
+    for (auto accumulation : {sgpp::base::DGEMVAccumulation::PrivateCopies,
+                              sgpp::base::DGEMVAccumulation::OwnerComputes,
+                              sgpp::base::DGEMVAccumulation::Automatic}) {
+      // stale values in the result must not be accumulated
+      DataVector result(N, 1.0);
+      sgpp::base::AlgorithmDGEMV<sgpp::base::SLinearModifiedBase>(accumulation)
+          .mult_transposed(grid->getStorage(), basis, source, dataset, result);
+
+      for (size_t i = 0; i < N; i++) {
+        BOOST_CHECK_SMALL(result[i] - resultReference[i], 1e-10);
+      }
+    }
+  }
+
+#ifdef _OPENMP
+  omp_set_num_threads(maxThreads);
+#endif
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -7,6 +7,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/function/scalar/InterpolantScalarFunction.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/function/scalar/ScalarFunction.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
@@ -120,6 +121,31 @@ void testSLESystem(SLE& system, const sgpp::base::DataVector& x, const sgpp::bas
     }
   }
 
+  // test getMatrixRow and countNNZ
+  std::vector<size_t> columnIndices;
+  std::vector<double> values;
+  size_t nnz = 0;
+
+  for (size_t i = 0; i < n; i++) {
+    system.getMatrixRow(i, columnIndices, values);
+    BOOST_CHECK_EQUAL(columnIndices.size(), values.size());
+    size_t k = 0;
+
+    for (size_t j = 0; j < n; j++) {
+      if (A(i, j) != 0.0) {
+        BOOST_REQUIRE_LT(k, values.size());
+        BOOST_CHECK_EQUAL(columnIndices[k], j);
+        BOOST_CHECK_CLOSE(values[k], A(i, j), 1e-12);
+        k++;
+      }
+    }
+
+    BOOST_CHECK_EQUAL(k, values.size());
+    nnz += values.size();
+  }
+
+  BOOST_CHECK_EQUAL(system.countNNZ(), nnz);
+
   // A*x calculated by sgpp::optimization
   sgpp::base::DataVector Ax2(0);
   system.matrixVectorMultiplication(x, Ax2);
@@ -333,3 +359,29 @@ BOOST_AUTO_TEST_CASE(TestHierarchisationSLE) {
     }
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestHierarchisationSLEGridChange) {
+  // Test the sparse row access of sgpp::base::HierarchisationSLE if the
+  // grid grows after the construction of the system.
+  RandomNumberGenerator::getInstance().setSeed(42);
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createModBsplineGrid(3, 3));
+  grid->getGenerator().regular(3);
+  HierarchisationSLE system(*grid);
+
+  for (size_t k = 0; k < 2; k++) {
+    const size_t n = grid->getSize();
+    sgpp::base::DataVector x(n);
+    sgpp::base::DataVector b(n);
+
+    for (size_t i = 0; i < n; i++) {
+      x[i] = RandomNumberGenerator::getInstance().getUniformRN();
+    }
+
+    sgpp::base::DataMatrix A(0, 0);
+    testSLESystem(system, x, b, A);
+
+    sgpp::base::SurplusRefinementFunctor functor(x, 5);
+    grid->getGenerator().refine(functor);
+  }
+}
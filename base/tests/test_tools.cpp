@@ -6,13 +6,29 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+#include <sgpp/base/tools/ExecutionContext.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
+#include <sgpp/base/tools/ThreadLocalClones.hpp>
 #include <sgpp/base/tools/sle/system/FullSLE.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <sstream>
 #include <string>
 #include <vector>
 
+using sgpp::base::ExecutionContext;
+using sgpp::base::Instrumentation;
 using sgpp::base::Printer;
 using sgpp::base::RandomNumberGenerator;
 
@@ -71,6 +87,93 @@ BOOST_AUTO_TEST_CASE(TestPrinter) {
   Printer::getInstance().setStream(&std::cout);
 }
 
+BOOST_AUTO_TEST_CASE(TestInstrumentation) {
+  // Test sgpp::base::Instrumentation.
+  Instrumentation& instrumentation = Instrumentation::getInstance();
+  instrumentation.reset();
+
+  // nothing is recorded while disabled
+  Instrumentation::disable();
+
+  {
+    SGPP_INSTRUMENT_SCOPE("disabledTimer");
+    SGPP_INSTRUMENT_COUNT("disabledCounter", 1.0);
+  }
+
+  BOOST_CHECK(instrumentation.getTimerStatistics().empty());
+  BOOST_CHECK(instrumentation.getCounterStatistics().empty());
+  BOOST_CHECK(instrumentation.getEvents().empty());
+
+  // record timers and counters from several threads
+  Instrumentation::enable();
+  const size_t n = 100;
+
+#pragma omp parallel for
+  for (size_t i = 0; i < n; i++) {
+    SGPP_INSTRUMENT_SCOPE("testTimer");
+    SGPP_INSTRUMENT_COUNT("testCounter", 2.0);
+  }
+
+  // timers of library operations
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+  sgpp::base::DataVector alpha(grid->getSize(), 1.0);
+  std::unique_ptr<sgpp::base::OperationHierarchisation> opHierarchisation(
+      sgpp::op_factory::createOperationHierarchisation(*grid));
+  opHierarchisation->doHierarchisation(alpha);
+
+  Instrumentation::disable();
+
+  const std::map<std::string, Instrumentation::TimerStatistics> timers =
+      instrumentation.getTimerStatistics();
+  const std::map<std::string, Instrumentation::CounterStatistics> counters =
+      instrumentation.getCounterStatistics();
+
+  BOOST_CHECK_EQUAL(timers.size(), 2U);
+  BOOST_CHECK_EQUAL(timers.at("testTimer").count, n);
+  BOOST_CHECK_GE(timers.at("testTimer").minSeconds, 0.0);
+  BOOST_CHECK_LE(timers.at("testTimer").minSeconds, timers.at("testTimer").maxSeconds);
+  BOOST_CHECK_LE(timers.at("testTimer").maxSeconds, timers.at("testTimer").totalSeconds);
+  BOOST_CHECK_EQUAL(timers.at("OperationHierarchisation::doHierarchisation").count, 1U);
+  BOOST_CHECK_EQUAL(counters.size(), 1U);
+  BOOST_CHECK_EQUAL(counters.at("testCounter").count, n);
+  BOOST_CHECK_EQUAL(counters.at("testCounter").sum, 2.0 * n);
+  BOOST_CHECK_EQUAL(instrumentation.getEvents().size(), 2 * n + 1);
+  BOOST_CHECK_EQUAL(instrumentation.getNumberOfDroppedEvents(), 0U);
+
+  // export
+  std::ostringstream json;
+  instrumentation.writeJSON(json);
+  BOOST_CHECK_NE(json.str().find("\"testTimer\": {\"count\": 100"), std::string::npos);
+  BOOST_CHECK_NE(json.str().find("\"testCounter\": {\"count\": 100, \"sum\": 200}"),
+                 std::string::npos);
+
+  std::ostringstream trace;
+  instrumentation.writeChromeTrace(trace);
+  BOOST_CHECK_EQUAL(trace.str().find("{\"traceEvents\": ["), 0);
+  BOOST_CHECK_NE(trace.str().find("\"name\": \"OperationHierarchisation::doHierarchisation\", "
+                                  "\"cat\": \"sgpp\", \"ph\": \"X\""),
+                 std::string::npos);
+  BOOST_CHECK_NE(trace.str().find("\"ph\": \"C\""), std::string::npos);
+
+  // events beyond the maximum number are only aggregated
+  instrumentation.reset();
+  instrumentation.setMaxNumberOfEvents(1);
+  Instrumentation::enable();
+
+  for (size_t i = 0; i < 3; i++) {
+    SGPP_INSTRUMENT_SCOPE("testTimer");
+  }
+
+  Instrumentation::disable();
+  BOOST_CHECK_EQUAL(instrumentation.getTimerStatistics().at("testTimer").count, 3U);
+  BOOST_CHECK_EQUAL(instrumentation.getEvents().size(), 1U);
+  BOOST_CHECK_EQUAL(instrumentation.getNumberOfDroppedEvents(), 2U);
+
+  instrumentation.setMaxNumberOfEvents(Instrumentation::DEFAULT_MAX_NUMBER_OF_EVENTS);
+  instrumentation.reset();
+}
+
 BOOST_AUTO_TEST_CASE(TestRandomNumberGenerator) {
   // Test sgpp::base::RandomNumberGenerator.
   const size_t seed = 42;
@@ -124,3 +227,85 @@ BOOST_AUTO_TEST_CASE(TestRandomNumberGenerator) {
     BOOST_CHECK_SMALL(calculateVariance(numbers) - (kDbl * kDbl - 1.0) / 12.0, 0.01 * kDbl * kDbl);
   }
 }
+
+/**
+ * Object that counts how often it has been cloned.
+ */
+class CountingCloneable {
+ public:
+  explicit CountingCloneable(std::atomic<size_t>& numberOfClones)
+      : numberOfClones(numberOfClones) {}
+
+  void clone(std::unique_ptr<CountingCloneable>& clone) const {
+    numberOfClones++;
+    clone.reset(new CountingCloneable(numberOfClones));
+  }
+
+ protected:
+  std::atomic<size_t>& numberOfClones;
+};
+
+BOOST_AUTO_TEST_CASE(TestExecutionContext) {
+  ExecutionContext& context = ExecutionContext::getInstance();
+  const size_t oldNumberOfThreads = context.getNumberOfThreads();
+  const ExecutionContext::NestingPolicy oldNestingPolicy = context.getNestingPolicy();
+
+  // thread budget outside of parallel regions, limited by the number of work items
+  context.setNumberOfThreads(4);
+  BOOST_CHECK_EQUAL(context.getNumberOfThreads(), 4);
+  BOOST_CHECK_EQUAL(context.getNumberOfThreadsForRegion(), 4);
+  BOOST_CHECK_EQUAL(context.getNumberOfThreadsForRegion(2), 2);
+  BOOST_CHECK_EQUAL(context.getNumberOfThreadsForRegion(0), 1);
+
+#ifdef _OPENMP
+  // nested regions
+  for (ExecutionContext::NestingPolicy nestingPolicy :
+       {ExecutionContext::NestingPolicy::Serialize, ExecutionContext::NestingPolicy::Nested}) {
+    context.setNestingPolicy(nestingPolicy);
+    size_t numberOfInnerThreads = 0;
+    bool isActive = false;
+
+#pragma omp parallel num_threads(2)
+    {
+#pragma omp single
+      {
+        isActive = (omp_get_num_threads() > 1);
+        numberOfInnerThreads = context.getNumberOfThreadsForRegion();
+      }
+    }
+
+    if (isActive) {
+      BOOST_CHECK_EQUAL(numberOfInnerThreads,
+                        (nestingPolicy == ExecutionContext::NestingPolicy::Nested) ? 2 : 1);
+    }
+  }
+#endif
+
+  // clones are created once per thread and reused in subsequent regions
+  std::atomic<size_t> numberOfClones(0);
+  CountingCloneable original(numberOfClones);
+  sgpp::base::ThreadLocalClones<CountingCloneable> clones(original);
+  const size_t numberOfThreads = context.getNumberOfThreadsForRegion();
+  clones.reserve(numberOfThreads);
+
+  // (Boost.Test macros are not thread-safe)
+  std::atomic<bool> isSharedBetweenThreads(false);
+
+  for (size_t k = 0; k < 3; k++) {
+#pragma omp parallel num_threads(numberOfThreads)
+    {
+      CountingCloneable& curObject = clones.get();
+#ifdef _OPENMP
+      if ((omp_get_num_threads() > 1) && (&curObject == &original)) {
+        isSharedBetweenThreads = true;
+      }
+#endif
+    }
+  }
+
+  BOOST_CHECK(!isSharedBetweenThreads);
+  BOOST_CHECK_LE(numberOfClones.load(), numberOfThreads);
+
+  context.setNestingPolicy(oldNestingPolicy);
+  context.setNumberOfThreads(oldNumberOfThreads);
+}
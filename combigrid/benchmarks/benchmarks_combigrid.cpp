@@ -0,0 +1,245 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE SGppCombigridBenchmarks
+#include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/common/basis/BsplineBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
+#include <sgpp/base/tools/BenchmarkRunner.hpp>
+#include <sgpp/combigrid/LevelIndexTypes.hpp>
+#include <sgpp/combigrid/basis/HeterogeneousBasis.hpp>
+#include <sgpp/combigrid/grid/CombinationGrid.hpp>
+#include <sgpp/combigrid/grid/CombinationGridIndexMap.hpp>
+#include <sgpp/combigrid/grid/FullGrid.hpp>
+#include <sgpp/combigrid/operation/OperationEvalCombinationGrid.hpp>
+#include <sgpp/combigrid/operation/OperationPole.hpp>
+#include <sgpp/combigrid/operation/OperationPoleHierarchisationLinear.hpp>
+#include <sgpp/combigrid/operation/OperationPoleNodalisationBspline.hpp>
+#include <sgpp/combigrid/operation/OperationUPCombinationGrid.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using sgpp::base::BenchmarkRunner;
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::combigrid::CombinationGrid;
+using sgpp::combigrid::CombinationGridIndexMap;
+using sgpp::combigrid::FullGrid;
+using sgpp::combigrid::HeterogeneousBasis;
+using sgpp::combigrid::OperationPole;
+
+namespace {
+
+BenchmarkRunner& getBenchmarkRunner() {
+  static BenchmarkRunner runner;
+  return runner;
+}
+
+/**
+ * Dimensionality and level of a benchmark case.
+ */
+struct BenchmarkConfiguration {
+  size_t dim;
+  sgpp::combigrid::level_t level;
+};
+
+/**
+ * Combination grid of a benchmark case together with its basis and 1D pole operator:
+ * hierarchical piecewise linear functions (hierarchisation) or nodal cubic B-splines
+ * (interpolation).
+ */
+struct BenchmarkSetup {
+  BenchmarkSetup(const BenchmarkConfiguration& configuration, bool useBsplines)
+      : linearBasis1d(),
+        bsplineBasis1d(3),
+        basis(useBsplines ? HeterogeneousBasis(configuration.dim, bsplineBasis1d, false)
+                          : HeterogeneousBasis(configuration.dim, linearBasis1d)),
+        combinationGrid(CombinationGrid::fromRegularSparse(configuration.dim,
+                                                           configuration.level, basis, false)),
+        operationPole(useBsplines
+                          ? static_cast<OperationPole*>(
+                                new sgpp::combigrid::OperationPoleNodalisationBspline(3))
+                          : new sgpp::combigrid::OperationPoleHierarchisationLinear()),
+        gridStorage(configuration.dim),
+        parameters{{"basis", useBsplines ? "bspline" : "linear"},
+                   {"dim", std::to_string(configuration.dim)},
+                   {"level", std::to_string(configuration.level)}},
+        values(),
+        numberOfFullGridPoints(0) {
+    combinationGrid.combinePoints(gridStorage);
+    parameters["gridSize"] = std::to_string(gridStorage.getSize());
+
+    for (const FullGrid& fullGrid : combinationGrid.getFullGrids()) {
+      values.emplace_back(fullGrid.getNumberOfIndexVectors(), 1.0);
+      numberOfFullGridPoints += fullGrid.getNumberOfIndexVectors();
+    }
+  }
+
+  sgpp::base::SLinearBase linearBasis1d;
+  sgpp::base::SBsplineBase bsplineBasis1d;
+  HeterogeneousBasis basis;
+  CombinationGrid combinationGrid;
+  std::unique_ptr<OperationPole> operationPole;
+  sgpp::base::GridStorage gridStorage;
+  BenchmarkRunner::Parameters parameters;
+  std::vector<DataVector> values;
+  size_t numberOfFullGridPoints;
+};
+
+std::vector<BenchmarkConfiguration> getBenchmarkConfigurations() {
+  return std::vector<BenchmarkConfiguration>{{2, 10}, {4, 7}, {8, 5}};
+}
+
+}  // namespace
+
+/**
+ * Reads the settings from the environment at the start and writes the results to
+ * benchmarks_combigrid.json in the directory given by SGPP_BENCHMARK_OUTPUT_DIR
+ * (default: working directory) at the end.
+ */
+struct BenchmarkFixture {
+  BenchmarkFixture() { getBenchmarkRunner().configureFromEnvironment(); }
+
+  ~BenchmarkFixture() {
+    const char* outputDirectory = std::getenv("SGPP_BENCHMARK_OUTPUT_DIR");
+    getBenchmarkRunner().writeJSON(
+        ((outputDirectory != nullptr) ? std::string(outputDirectory) + "/" : std::string()) +
+        "benchmarks_combigrid.json");
+  }
+};
+
+#if BOOST_VERSION >= 105900
+BOOST_GLOBAL_FIXTURE(BenchmarkFixture);
+#else
+BOOST_GLOBAL_FIXTURE(BenchmarkFixture)
+#endif /* BOOST_VERSION >= 105900 */
+
+BOOST_AUTO_TEST_CASE(benchmarkCombinationGridConstruction) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+
+  for (const BenchmarkConfiguration& configuration : getBenchmarkConfigurations()) {
+    const BenchmarkSetup setup(configuration, false);
+
+    // creation of the full grids and insertion of their points into a hash grid storage
+    runner.run("CombinationGridConstruction", setup.parameters, 1,
+               static_cast<double>(setup.gridStorage.getSize()), [&setup, &configuration]() {
+                 const CombinationGrid combinationGrid = CombinationGrid::fromRegularSparse(
+                     configuration.dim, configuration.level, setup.basis, false);
+                 sgpp::base::GridStorage gridStorage(configuration.dim);
+                 combinationGrid.combinePoints(gridStorage);
+                 BOOST_CHECK_EQUAL(gridStorage.getSize(), setup.gridStorage.getSize());
+               });
+  }
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkCombinationGridIndexMap) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+
+  for (const BenchmarkConfiguration& configuration : getBenchmarkConfigurations()) {
+    const BenchmarkSetup setup(configuration, false);
+    const CombinationGridIndexMap indexMap(setup.combinationGrid, setup.gridStorage);
+    DataVector sparseGridValues;
+    std::vector<DataVector> fullGridValues;
+
+    for (size_t numberOfThreads : runner.getNumbersOfThreads()) {
+      runner.run("CombinationGridIndexMap::construct", setup.parameters, numberOfThreads,
+                 static_cast<double>(setup.numberOfFullGridPoints), [&setup]() {
+                   const CombinationGridIndexMap newIndexMap(setup.combinationGrid,
+                                                             setup.gridStorage);
+                   BOOST_CHECK_EQUAL(newIndexMap.getNumberOfGridPoints(),
+                                     setup.gridStorage.getSize());
+                 });
+      runner.run("CombinationGridIndexMap::combine", setup.parameters, numberOfThreads,
+                 static_cast<double>(setup.numberOfFullGridPoints),
+                 [&setup, &indexMap, &sparseGridValues]() {
+                   indexMap.combineSparseGridValues(setup.values, sparseGridValues);
+                 });
+      runner.run("CombinationGridIndexMap::distribute", setup.parameters, numberOfThreads,
+                 static_cast<double>(setup.numberOfFullGridPoints),
+                 [&indexMap, &sparseGridValues, &fullGridValues]() {
+                   indexMap.distributeValuesToFullGrids(sparseGridValues, fullGridValues);
+                 });
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkOperationUPCombinationGrid) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+
+  for (bool useBsplines : {false, true}) {
+    for (const BenchmarkConfiguration& configuration : getBenchmarkConfigurations()) {
+      const BenchmarkSetup setup(configuration, useBsplines);
+      sgpp::combigrid::OperationUPCombinationGrid operation(setup.combinationGrid,
+                                                            *setup.operationPole);
+
+      for (size_t numberOfThreads : runner.getNumbersOfThreads()) {
+        // the operation is applied in-place, copy the values to keep them bounded
+        runner.run("OperationUPCombinationGrid::apply", setup.parameters, numberOfThreads,
+                   static_cast<double>(setup.numberOfFullGridPoints), [&setup, &operation]() {
+                     std::vector<DataVector> values = setup.values;
+                     operation.apply(values);
+                   });
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkOperationEvalCombinationGrid) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+  const size_t numberOfPoints = 1000;
+
+  for (bool useBsplines : {false, true}) {
+    for (const BenchmarkConfiguration& configuration : getBenchmarkConfigurations()) {
+      const BenchmarkSetup setup(configuration, useBsplines);
+      sgpp::combigrid::OperationEvalCombinationGrid operation(setup.combinationGrid);
+      std::mt19937 generator(42);
+      std::uniform_real_distribution<double> distribution(0.0, 1.0);
+      DataMatrix points(numberOfPoints, configuration.dim);
+      DataVector result(numberOfPoints);
+
+      for (size_t i = 0; i < numberOfPoints; i++) {
+        for (size_t t = 0; t < configuration.dim; t++) {
+          points(i, t) = distribution(generator);
+        }
+      }
+
+      for (size_t numberOfThreads : runner.getNumbersOfThreads()) {
+        runner.run("OperationEvalCombinationGrid::multiEval", setup.parameters, numberOfThreads,
+                   static_cast<double>(numberOfPoints),
+                   [&setup, &operation, &points, &result]() {
+                     operation.multiEval(setup.values, points, result);
+                     BOOST_CHECK(std::isfinite(result[0]));
+                   });
+      }
+    }
+  }
+}
+
+// fix for clang (from https://stackoverflow.com/a/33755176)
+#ifdef __clang__
+namespace boost {
+namespace unit_test {
+namespace ut_detail {
+
+std::string normalize_test_case_name(const_string name) {
+    return ((name[0] == '&') ? std::string(name.begin() + 1, name.size() - 1) :
+                               std::string(name.begin(), name.size()));
+}
+
+}  // namespace ut_detail
+}  // namespace unit_test
+}  // namespace boost
+#endif
@@ -13,11 +13,17 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <condition_variable>
+#include <exception>
 #include <limits>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
+#include <thread>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -49,7 +55,10 @@ AdaptiveCombinationGridGenerator::AdaptiveCombinationGridGenerator(
 
   for (const LevelVector& level : downwardClosedLevelSet) {
     subspacesAndQoI[level] = std::numeric_limits<double>::quiet_NaN();
-    activeSet.push_back(level);
+  }
+
+  for (const LevelVector& level : downwardClosedLevelSet) {
+    activeSet.insert(level);
     adaptLevel(level);
   }
 }
@@ -80,13 +89,10 @@ bool AdaptiveCombinationGridGenerator::adaptNextLevelVector(bool regular) {
     throw sgpp::base::not_implemented_exception("Parameter regular not yet implemented!");
   }
 
-  const std::map<LevelVector, double> relevance = getRelevanceOfActiveSet();
-  const auto pr = std::max_element(
-      relevance.begin(), relevance.end(),
-      [](const MapPairType& m1, const MapPairType& m2) { return m1.second < m2.second; });
-
-  if (pr != relevance.end()) {
-    adaptLevel(pr->first);
+  // ties are broken by the order of the level vectors, as for std::max_element on
+  // getRelevanceOfActiveSet()
+  if (!relevanceQueue.empty()) {
+    adaptLevel(LevelVector(relevanceQueue.top()));
     return true;
   } else {
     return false;
@@ -142,21 +148,13 @@ double AdaptiveCombinationGridGenerator::getDelta(const LevelVector& levelVector
 }
 
 std::map<LevelVector, double> AdaptiveCombinationGridGenerator::getPriorityQueue() const {
-  throw sgpp::base::not_implemented_exception("getPriorityQueue() not yet implemented!");
+  return std::map<LevelVector, double>(priorityQueue.getElements().begin(),
+                                       priorityQueue.getElements().end());
 }
 
 std::map<LevelVector, double> AdaptiveCombinationGridGenerator::getRelevanceOfActiveSet() const {
-  std::map<LevelVector, double> relevance;
-
-  for (const LevelVector& levelVector : activeSet) {
-    const double delta = getDelta(levelVector);
-
-    if (!std::isnan(delta)) {
-      relevance[levelVector] = relevanceCalculator->calculate(levelVector, delta);
-    }
-  }
-
-  return relevance;
+  return std::map<LevelVector, double>(relevanceQueue.getElements().begin(),
+                                       relevanceQueue.getElements().end());
 }
 
 std::map<LevelVector, double>
@@ -172,8 +170,7 @@ bool AdaptiveCombinationGridGenerator::isAdmissible(const LevelVector& level) co
     if (level[d] > minimumLevelVector[d]) {
       LevelVector neighborLevel = level;
       neighborLevel[d] -= 1;
-      const bool isInOldSet = (std::find(oldSet.begin(), oldSet.end(), neighborLevel) !=
-                               oldSet.end());
+      const bool isInOldSet = (oldSetIndex.find(neighborLevel) != oldSetIndex.end());
 
       if (!isInOldSet) {
         return false;
@@ -189,20 +186,203 @@ void AdaptiveCombinationGridGenerator::addNeighborsToActiveSet(const LevelVector
     LevelVector neighborLevel = level;
     neighborLevel[d] += 1;
 
-    if (isAdmissible(neighborLevel)) {
-      activeSet.push_back(neighborLevel);
+    if ((oldSetIndex.find(neighborLevel) == oldSetIndex.end()) && isAdmissible(neighborLevel) &&
+        activeSet.insert(neighborLevel).second) {
+      updateActiveLevel(neighborLevel);
     }
   }
 }
 
 void AdaptiveCombinationGridGenerator::adaptLevel(const LevelVector& level) {
-  assert(std::find(oldSet.begin(), oldSet.end(), level) == oldSet.end());
-  assert(std::find(activeSet.begin(), activeSet.end(), level) != activeSet.end());
+  assert(oldSetIndex.find(level) == oldSetIndex.end());
+  assert(activeSet.find(level) != activeSet.end());
 
   oldSet.push_back(level);
-  activeSet.remove(level);
+  oldSetIndex.insert(level);
+  activeSet.erase(level);
+  relevanceQueue.erase(level);
+  priorityQueue.erase(level);
+  pendingLevels.erase(level);
   addNeighborsToActiveSet(level);
 }
 
+bool AdaptiveCombinationGridGenerator::hasQoI(const LevelVector& level) const {
+  const auto it = subspacesAndQoI.find(level);
+  return (it != subspacesAndQoI.end()) && !std::isnan(it->second);
+}
+
+double AdaptiveCombinationGridGenerator::estimatePriority(const LevelVector& level) const {
+  std::map<LevelVector, double> deltasOfDownwardNeighbors;
+
+  for (size_t d = 0; d < level.size(); ++d) {
+    if (level[d] > minimumLevelVector[d]) {
+      LevelVector neighborLevel = level;
+      neighborLevel[d] -= 1;
+      deltasOfDownwardNeighbors[neighborLevel] = getDelta(neighborLevel);
+    }
+  }
+
+  const double priority = priorityEstimator->estimatePriority(level, deltasOfDownwardNeighbors);
+
+  // levels of unknown priority are evaluated last
+  return (std::isnan(priority) ? -std::numeric_limits<double>::infinity() : priority);
+}
+
+void AdaptiveCombinationGridGenerator::updateActiveLevel(const LevelVector& level) {
+  if (hasQoI(level)) {
+    priorityQueue.erase(level);
+    pendingLevels.erase(level);
+    const double delta = getDelta(level);
+
+    if (std::isnan(delta)) {
+      relevanceQueue.erase(level);
+    } else {
+      relevanceQueue.set(level, relevanceCalculator->calculate(level, delta));
+    }
+  } else {
+    relevanceQueue.erase(level);
+
+    if (pendingLevels.find(level) == pendingLevels.end()) {
+      priorityQueue.set(level, estimatePriority(level));
+    }
+  }
+}
+
+void AdaptiveCombinationGridGenerator::setQoIInformation(const LevelVector& level, double qoi) {
+  subspacesAndQoI[level] = qoi;
+
+  // the QoI enters the deltas of the levels in the upper hypercube of the level and therefore
+  // the priorities of their upper neighbors
+  LevelVector upperLevel = level;
+
+  for (level_t& l : upperLevel) {
+    l++;
+  }
+
+  std::unordered_set<LevelVector, LevelVectorTools::Hash> affectedLevels;
+
+  for (const LevelVector& hypercubeLevel :
+       LevelVectorTools::generateHyperCube(level, upperLevel)) {
+    affectedLevels.insert(hypercubeLevel);
+
+    for (size_t d = 0; d < hypercubeLevel.size(); ++d) {
+      LevelVector neighborLevel = hypercubeLevel;
+      neighborLevel[d] += 1;
+      affectedLevels.insert(neighborLevel);
+    }
+  }
+
+  for (const LevelVector& affectedLevel : affectedLevels) {
+    if (activeSet.find(affectedLevel) != activeSet.end()) {
+      updateActiveLevel(affectedLevel);
+    }
+  }
+}
+
+std::vector<LevelVector> AdaptiveCombinationGridGenerator::getLevelVectorsToEvaluate(
+    size_t numberOfLevelVectors) {
+  std::vector<LevelVector> levelVectors;
+
+  while ((levelVectors.size() < numberOfLevelVectors) && !priorityQueue.empty()) {
+    levelVectors.push_back(priorityQueue.pop());
+    pendingLevels.insert(levelVectors.back());
+  }
+
+  return levelVectors;
+}
+
+void AdaptiveCombinationGridGenerator::cancelEvaluation(const LevelVector& level) {
+  if (pendingLevels.erase(level) > 0) {
+    updateActiveLevel(level);
+  }
+}
+
+std::vector<LevelVector> AdaptiveCombinationGridGenerator::getPendingLevelVectors() const {
+  std::vector<LevelVector> pendingLevelVectors(pendingLevels.begin(), pendingLevels.end());
+  std::sort(pendingLevelVectors.begin(), pendingLevelVectors.end());
+  return pendingLevelVectors;
+}
+
+std::list<LevelVector> AdaptiveCombinationGridGenerator::getActiveSet() const {
+  std::list<LevelVector> activeSetList(activeSet.begin(), activeSet.end());
+  activeSetList.sort();
+  return activeSetList;
+}
+
+size_t AdaptiveCombinationGridGenerator::adaptConcurrently(
+    const std::function<double(const LevelVector&)>& qoiFunction, size_t maxNumberOfEvaluations,
+    size_t numberOfThreads) {
+  if (numberOfThreads == 0) {
+    numberOfThreads = std::max(std::thread::hardware_concurrency(), 1u);
+  }
+
+  std::mutex mutex;
+  std::condition_variable stateChanged;
+  size_t numberOfEvaluations = 0;
+  size_t numberOfRunningEvaluations = 0;
+  std::exception_ptr error;
+
+  // the generator is only accessed with the mutex locked, the QoI function without
+  auto worker = [&]() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (!error && (numberOfEvaluations < maxNumberOfEvaluations)) {
+      const std::vector<LevelVector> levelVectors = getLevelVectorsToEvaluate(1);
+
+      if (levelVectors.empty()) {
+        if (numberOfRunningEvaluations == 0) {
+          // no running evaluation can add new levels to the active set
+          break;
+        }
+
+        stateChanged.wait(lock);
+        continue;
+      }
+
+      numberOfEvaluations++;
+      numberOfRunningEvaluations++;
+      lock.unlock();
+
+      double qoi = 0.0;
+      std::exception_ptr evaluationError;
+
+      try {
+        qoi = qoiFunction(levelVectors[0]);
+      } catch (...) {
+        evaluationError = std::current_exception();
+      }
+
+      lock.lock();
+      numberOfRunningEvaluations--;
+
+      if (evaluationError) {
+        cancelEvaluation(levelVectors[0]);
+        error = evaluationError;
+      } else {
+        setQoIInformation(levelVectors[0], qoi);
+        adaptNextLevelVector();
+      }
+
+      stateChanged.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+
+  for (size_t i = 0; i < numberOfThreads; ++i) {
+    threads.emplace_back(worker);
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  return numberOfEvaluations;
+}
+
 }  // namespace combigrid
 }  // namespace sgpp
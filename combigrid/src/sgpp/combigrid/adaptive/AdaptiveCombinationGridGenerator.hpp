@@ -11,11 +11,14 @@
 #include <sgpp/combigrid/adaptive/RelevanceCalculator.hpp>
 #include <sgpp/combigrid/adaptive/WeightedRelevanceCalculator.hpp>
 #include <sgpp/combigrid/grid/CombinationGrid.hpp>
+#include <sgpp/combigrid/tools/IndexedPriorityQueue.hpp>
+#include <sgpp/combigrid/tools/LevelVectorTools.hpp>
 
 #include <functional>
 #include <list>
 #include <map>
 #include <memory>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -45,12 +48,17 @@ namespace combigrid {
  * a priority queue can be obtained by \c getPriorityQueue , which uses the \c priorityEstimator to
  * infer a priority for the active set levels from the QoIs of the downward neighbors.
  *
+ * For QoIs that are expensive to compute, \c getLevelVectorsToEvaluate hands out the active set
+ * levels with the highest priorities in batches for concurrent evaluation; the results can be
+ * passed back by \c setQoIInformation in any order. \c adaptConcurrently does this with a
+ * given QoI function in several threads. The relevances and priorities of the active set are
+ * kept in indexed priority queues and are only updated for the levels affected by a new QoI.
+ * The generator itself is not thread-safe.
+ *
  * Terminology is mostly taken from Gerstner, T. and Griebel, M., 2003. Dimension–adaptive
  * tensor–product quadrature. Computing, 71(1), pp.65-87.
  */
 class AdaptiveCombinationGridGenerator {
-  using MapPairType = std::pair<const std::vector<unsigned int>, double>;
-
  public:
   /**
    * @brief Construct a new AdaptiveCombinationGridGenerator object
@@ -106,8 +114,52 @@ class AdaptiveCombinationGridGenerator {
 
   /**
    * @brief set QoI information / a result for LevelVector level
+   *
+   * Results of level vectors handed out by \c getLevelVectorsToEvaluate can be set in any order.
+   */
+  void setQoIInformation(const LevelVector& level, double qoi);
+
+  /**
+   * @brief hand out the active set levels without result with the highest priorities for
+   * evaluation
+   *
+   * The level vectors are marked as pending and will not be handed out again until their result
+   * is set by \c setQoIInformation or the evaluation is cancelled by \c cancelEvaluation .
+   *
+   * @param numberOfLevelVectors  maximum number of level vectors
+   * @return level vectors ordered by decreasing priority, fewer than \c numberOfLevelVectors if
+   *         there are no more active set levels without result
+   */
+  std::vector<LevelVector> getLevelVectorsToEvaluate(size_t numberOfLevelVectors);
+
+  /**
+   * @brief return a level vector handed out by \c getLevelVectorsToEvaluate without result,
+   * e.g., if the evaluation failed, such that it can be handed out again
+   */
+  void cancelEvaluation(const LevelVector& level);
+
+  /**
+   * @brief Get the level vectors handed out by \c getLevelVectorsToEvaluate that have no result
+   * yet
+   */
+  std::vector<LevelVector> getPendingLevelVectors() const;
+
+  /**
+   * @brief evaluate the QoIs of the active set levels in several threads and adapt
+   *
+   * Every thread takes the level vector of the highest priority, evaluates the QoI function, sets
+   * the result, and adds the subspace of the highest relevance to the old set, until
+   * \c maxNumberOfEvaluations QoIs have been evaluated or there are no more level vectors to
+   * evaluate.
+   *
+   * @param qoiFunction             function computing the QoI of a level vector, is called
+   *                                concurrently from different threads
+   * @param maxNumberOfEvaluations  maximum number of calls of \c qoiFunction
+   * @param numberOfThreads         number of threads, 0 to use the hardware concurrency
+   * @return number of calls of \c qoiFunction
    */
-  void setQoIInformation(const LevelVector& level, double qoi) { subspacesAndQoI[level] = qoi; }
+  size_t adaptConcurrently(const std::function<double(const LevelVector&)>& qoiFunction,
+                           size_t maxNumberOfEvaluations, size_t numberOfThreads = 0);
 
   /**
    * @brief add the next most important subspace of known result to the old set
@@ -143,7 +195,7 @@ class AdaptiveCombinationGridGenerator {
    *
    * @return std::list<LevelVector> the active set
    */
-  std::list<LevelVector> getActiveSet() const { return activeSet; }
+  std::list<LevelVector> getActiveSet() const;
 
   /**
    * @brief Get the minimum Level Vector object
@@ -162,7 +214,7 @@ class AdaptiveCombinationGridGenerator {
 
   /**
    * @brief get a priority queue of elements in the active set that don't have a result / QoI /
-   * delta yet //TODO(pollinta): implement
+   * delta yet and are not pending (unknown priorities are -infinity)
    */
   std::map<LevelVector, double> getPriorityQueue() const;
 
@@ -185,6 +237,21 @@ class AdaptiveCombinationGridGenerator {
    */
   bool isAdmissible(const LevelVector& level) const;
 
+  /**
+   * @brief whether there is a result for LevelVector level
+   */
+  bool hasQoI(const LevelVector& level) const;
+
+  /**
+   * @brief estimate the priority of \c level from the deltas of its downward neighbors
+   */
+  double estimatePriority(const LevelVector& level) const;
+
+  /**
+   * @brief update the relevance or priority of the active set level \c level
+   */
+  void updateActiveLevel(const LevelVector& level);
+
   /**
    * @brief add forward neighbors of \c level to active set, if admissible
    */
@@ -213,8 +280,20 @@ class AdaptiveCombinationGridGenerator {
   // the old set = the level vectors that are definitely in our combigrid already
   std::vector<LevelVector> oldSet;
 
+  // the old set for fast lookups
+  std::unordered_set<LevelVector, LevelVectorTools::Hash> oldSetIndex;
+
   // the active set = the level vectors that may be added to our combigrid next
-  std::list<LevelVector> activeSet;
+  std::unordered_set<LevelVector, LevelVectorTools::Hash> activeSet;
+
+  // relevances of the active set levels with known delta
+  IndexedPriorityQueue<LevelVector, LevelVectorTools::Hash> relevanceQueue;
+
+  // estimated priorities of the active set levels without result that are not pending
+  IndexedPriorityQueue<LevelVector, LevelVectorTools::Hash> priorityQueue;
+
+  // the active set levels handed out for evaluation whose result is not set yet
+  std::unordered_set<LevelVector, LevelVectorTools::Hash> pendingLevels;
 
   // the relevance calculator used to relate delta and level vector to an "error" / relevance
   std::unique_ptr<RelevanceCalculator> relevanceCalculator;
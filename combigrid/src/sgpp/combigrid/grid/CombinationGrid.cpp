@@ -160,7 +160,7 @@ void CombinationGrid::combineSparseGridValues(const base::GridStorage& gridStora
   }
 
   const size_t n = fullGrids.size();
-  const size_t m = values[0].getNrows();
+  const size_t m = values[0].getNcols();
   const size_t dim = getDimension();
   IndexVector index(dim);
   IndexVectorRange range;
@@ -104,6 +104,9 @@ class CombinationGrid {
    * associated with every grid point. This method combines these grid values to have one value
    * for each point in the combined grid (usually a sparse grid).
    *
+   * Every full grid point is searched in \c gridStorage. If the method is called repeatedly for
+   * the same grids, CombinationGridIndexMap does the search only once.
+   *
    * @param[in] gridStorage   GridStorage containing the combined grid
    * @param[in] values        vector of DataVector, each DataVector corresponds to a full grid
    *                          and has the same size as the number of grid points of the full grid
@@ -121,11 +124,11 @@ class CombinationGrid {
    *
    * @param[in] gridStorage   GridStorage containing the combined grid
    * @param[in] values        vector of DataMatrix, each DataMatrix corresponds to a full grid
-   *                          and has the same number of columns as the number of grid points of
-   *                          the full grid (every column corresponds to one full grid point,
-   *                          the order of columns is given by IndexVectorRange)
-   * @param[out] result       matrix resulting from the combination, columns have the same order
-   *                          as \c gridStorage (every column corresponds to one grid point of the
+   *                          and has the same number of rows as the number of grid points of
+   *                          the full grid (every row corresponds to one full grid point,
+   *                          the order of rows is given by IndexVectorRange)
+   * @param[out] result       matrix resulting from the combination, rows have the same order
+   *                          as \c gridStorage (every row corresponds to one grid point of the
    *                          combined grid)
    */
   void combineSparseGridValues(const base::GridStorage& gridStorage,
@@ -148,7 +151,8 @@ class CombinationGrid {
 
   /**
    * Distribute values given on the combined grid to the full grids contained in this combination
-   * grid.
+   * grid. If the method is called repeatedly for the same grids, CombinationGridIndexMap
+   * searches the full grid points in \c gridStorage only once.
    *
    * @param[in] gridStorage   GridStorage containing the combined grid
    * @param[in] values        vector of values on the combined grid, same size as \c gridStorage
@@ -0,0 +1,242 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/ExecutionContext.hpp>
+#include <sgpp/combigrid/basis/HeterogeneousBasis.hpp>
+#include <sgpp/combigrid/grid/CombinationGridIndexMap.hpp>
+#include <sgpp/combigrid/tools/IndexVectorRange.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+CombinationGridIndexMap::CombinationGridIndexMap()
+    : coefficients(),
+      numberOfGridPoints(0),
+      fullGridOffsets(1, 0),
+      sequenceNumbers(),
+      contributionOffsets(1, 0),
+      contributingFullGrids(),
+      contributingPoints() {}
+
+CombinationGridIndexMap::CombinationGridIndexMap(const CombinationGrid& combinationGrid,
+                                                 const base::GridStorage& gridStorage)
+    : coefficients(combinationGrid.getCoefficients()),
+      numberOfGridPoints(gridStorage.getSize()),
+      fullGridOffsets(combinationGrid.getFullGrids().size() + 1, 0),
+      sequenceNumbers(),
+      contributionOffsets(gridStorage.getSize() + 1, 0),
+      contributingFullGrids(),
+      contributingPoints() {
+  const std::vector<FullGrid>& fullGrids = combinationGrid.getFullGrids();
+  const size_t n = fullGrids.size();
+  const size_t dim = combinationGrid.getDimension();
+  // the ranges are created before the parallel region, as they throw for unsupported grids
+  std::vector<IndexVectorRange> ranges;
+
+  for (size_t i = 0; i < n; i++) {
+    ranges.emplace_back(fullGrids[i]);
+    fullGridOffsets[i + 1] = fullGridOffsets[i] + fullGrids[i].getNumberOfIndexVectors();
+  }
+
+  sequenceNumbers.resize(fullGridOffsets[n]);
+
+  // the hash lookups are independent of each other
+  const size_t numberOfThreads =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(n);
+
+#pragma omp parallel num_threads(numberOfThreads)
+  {
+    base::GridPoint point(dim);
+
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < n; i++) {
+      const LevelVector& level = fullGrids[i].getLevel();
+      size_t j = fullGridOffsets[i];
+
+      for (const IndexVector& index : ranges[i]) {
+        for (size_t d = 0; d < dim; d++) {
+          level_t l = level[d];
+          index_t k = index[d];
+          HeterogeneousBasis::hierarchizeLevelIndex(l, k);
+          point.push(d, l, k);
+        }
+
+        point.rehash();
+        sequenceNumbers[j] = gridStorage.getSequenceNumber(point);
+        j++;
+      }
+    }
+  }
+
+  // inverse mapping from the grid points of the combined grid to the full grid points,
+  // sorted by full grids to sum up in the same order as CombinationGrid
+  for (size_t k : sequenceNumbers) {
+    if (k < numberOfGridPoints) {
+      contributionOffsets[k + 1]++;
+    }
+  }
+
+  for (size_t k = 0; k < numberOfGridPoints; k++) {
+    contributionOffsets[k + 1] += contributionOffsets[k];
+  }
+
+  contributingFullGrids.resize(contributionOffsets[numberOfGridPoints]);
+  contributingPoints.resize(contributionOffsets[numberOfGridPoints]);
+  std::vector<size_t> nextContribution(contributionOffsets.begin(), contributionOffsets.end() - 1);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = fullGridOffsets[i]; j < fullGridOffsets[i + 1]; j++) {
+      const size_t k = sequenceNumbers[j];
+
+      if (k < numberOfGridPoints) {
+        contributingFullGrids[nextContribution[k]] = i;
+        contributingPoints[nextContribution[k]] = j - fullGridOffsets[i];
+        nextContribution[k]++;
+      }
+    }
+  }
+}
+
+void CombinationGridIndexMap::combineSparseGridValues(const std::vector<base::DataVector>& values,
+                                                      base::DataVector& result) const {
+  result.resize(numberOfGridPoints);
+
+  const size_t numberOfThreads =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(numberOfGridPoints);
+
+#pragma omp parallel for schedule(static) num_threads(numberOfThreads)
+  for (size_t k = 0; k < numberOfGridPoints; k++) {
+    double value = 0.0;
+
+    for (size_t c = contributionOffsets[k]; c < contributionOffsets[k + 1]; c++) {
+      const size_t i = contributingFullGrids[c];
+      value += coefficients[i] * values[i][contributingPoints[c]];
+    }
+
+    result[k] = value;
+  }
+}
+
+void CombinationGridIndexMap::combineSparseGridValues(const std::vector<base::DataMatrix>& values,
+                                                      base::DataMatrix& result) const {
+  if (values.empty()) {
+    result.resize(numberOfGridPoints, 0);
+    return;
+  }
+
+  const size_t m = values[0].getNcols();
+  result.resize(numberOfGridPoints, m);
+  result.setAll(0.0);
+
+  const size_t numberOfThreads =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(numberOfGridPoints);
+
+#pragma omp parallel for schedule(static) num_threads(numberOfThreads)
+  for (size_t k = 0; k < numberOfGridPoints; k++) {
+    double* resultRow = result.getPointer() + k * m;
+
+    for (size_t c = contributionOffsets[k]; c < contributionOffsets[k + 1]; c++) {
+      const size_t i = contributingFullGrids[c];
+      const double* valuesRow = values[i].getPointer() + contributingPoints[c] * m;
+
+      for (size_t j = 0; j < m; j++) {
+        resultRow[j] += coefficients[i] * valuesRow[j];
+      }
+    }
+  }
+}
+
+void CombinationGridIndexMap::distributeValuesToFullGrid(const base::DataVector& values, size_t i,
+                                                         base::DataVector& result) const {
+  const size_t offset = fullGridOffsets[i];
+  const size_t numberOfPoints = fullGridOffsets[i + 1] - offset;
+  result.resize(numberOfPoints);
+
+  const size_t numberOfThreads =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(numberOfPoints);
+
+#pragma omp parallel for schedule(static) num_threads(numberOfThreads)
+  for (size_t j = 0; j < numberOfPoints; j++) {
+    const size_t k = sequenceNumbers[offset + j];
+    result[j] = ((k < numberOfGridPoints) ? values[k] : 0.0);
+  }
+}
+
+void CombinationGridIndexMap::distributeValuesToFullGrids(
+    const base::DataVector& values, std::vector<base::DataVector>& result) const {
+  const size_t n = getNumberOfFullGrids();
+  result.resize(n);
+
+  for (size_t i = 0; i < n; i++) {
+    result[i].resize(fullGridOffsets[i + 1] - fullGridOffsets[i]);
+  }
+
+  // the full grids differ much in size
+  const size_t numberOfThreads =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(n);
+
+#pragma omp parallel for schedule(dynamic) num_threads(numberOfThreads)
+  for (size_t i = 0; i < n; i++) {
+    base::DataVector& fullGridValues = result[i];
+
+    for (size_t j = fullGridOffsets[i]; j < fullGridOffsets[i + 1]; j++) {
+      const size_t k = sequenceNumbers[j];
+      fullGridValues[j - fullGridOffsets[i]] = ((k < numberOfGridPoints) ? values[k] : 0.0);
+    }
+  }
+}
+
+void CombinationGridIndexMap::distributeValuesToFullGrids(
+    const base::DataMatrix& values, std::vector<base::DataMatrix>& result) const {
+  const size_t n = getNumberOfFullGrids();
+  const size_t m = values.getNcols();
+  result.resize(n);
+
+  for (size_t i = 0; i < n; i++) {
+    result[i].resize(fullGridOffsets[i + 1] - fullGridOffsets[i], m);
+  }
+
+  const size_t numberOfThreads =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(n);
+
+#pragma omp parallel for schedule(dynamic) num_threads(numberOfThreads)
+  for (size_t i = 0; i < n; i++) {
+    double* resultRow = result[i].getPointer();
+
+    for (size_t j = fullGridOffsets[i]; j < fullGridOffsets[i + 1]; j++) {
+      const size_t k = sequenceNumbers[j];
+
+      if (k < numberOfGridPoints) {
+        const double* valuesRow = values.getPointer() + k * m;
+
+        for (size_t l = 0; l < m; l++) {
+          resultRow[l] = valuesRow[l];
+        }
+      } else {
+        for (size_t l = 0; l < m; l++) {
+          resultRow[l] = 0.0;
+        }
+      }
+
+      resultRow += m;
+    }
+  }
+}
+
+size_t CombinationGridIndexMap::getSequenceNumber(size_t i, size_t j) const {
+  return sequenceNumbers[fullGridOffsets[i] + j];
+}
+
+size_t CombinationGridIndexMap::getNumberOfFullGrids() const {
+  return fullGridOffsets.size() - 1;
+}
+
+size_t CombinationGridIndexMap::getNumberOfGridPoints() const { return numberOfGridPoints; }
+
+}  // namespace combigrid
+}  // namespace sgpp
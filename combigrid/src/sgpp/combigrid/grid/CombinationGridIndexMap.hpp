@@ -0,0 +1,147 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/combigrid/grid/CombinationGrid.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Precomputed mapping between the points of the full grids of a CombinationGrid and the points
+ * of a GridStorage containing the combined grid.
+ *
+ * The methods \c CombinationGrid::combineSparseGridValues and
+ * \c CombinationGrid::distributeValuesToFullGrids search every point in the full grids each time
+ * they are called. This class does the search once in the constructor; afterwards, combining
+ * is a parallel gather over the points of the combined grid and distributing is a parallel
+ * scatter over the points of the full grids. The results are the same as the results of the
+ * methods of CombinationGrid.
+ *
+ * The map has to be constructed again if the full grids, the coefficients, or the grid storage
+ * change.
+ */
+class CombinationGridIndexMap {
+ public:
+  /**
+   * Default constructor, creates an empty map.
+   */
+  CombinationGridIndexMap();
+
+  /**
+   * Constructor, looks up every full grid point in the grid storage.
+   *
+   * @param combinationGrid   combination grid
+   * @param gridStorage       GridStorage containing the combined grid (usually created with
+   *                          \c CombinationGrid::combinePoints)
+   */
+  CombinationGridIndexMap(const CombinationGrid& combinationGrid,
+                          const base::GridStorage& gridStorage);
+
+  /**
+   * Same as \c CombinationGrid::combineSparseGridValues.
+   *
+   * @param[in] values    vector of DataVector, each DataVector corresponds to a full grid
+   *                      and has the same size as the number of grid points of the full grid
+   *                      (the order of DataVector entries is given by IndexVectorRange)
+   * @param[out] result   vector resulting from the combination, same order as the grid storage
+   */
+  void combineSparseGridValues(const std::vector<base::DataVector>& values,
+                               base::DataVector& result) const;
+
+  /**
+   * Vector version of the other \c combineSparseGridValues method.
+   *
+   * @param[in] values    vector of DataMatrix, each DataMatrix corresponds to a full grid
+   *                      and has the same number of rows as the number of grid points of
+   *                      the full grid (every row corresponds to one full grid point,
+   *                      the order of rows is given by IndexVectorRange), all matrices have
+   *                      the same number of columns
+   * @param[out] result   matrix resulting from the combination, rows have the same order
+   *                      as the grid storage (every row corresponds to one grid point of the
+   *                      combined grid)
+   */
+  void combineSparseGridValues(const std::vector<base::DataMatrix>& values,
+                               base::DataMatrix& result) const;
+
+  /**
+   * Same as \c CombinationGrid::distributeValuesToFullGrid for the i-th full grid.
+   *
+   * @param[in] values    vector of values on the combined grid, same size as the grid storage
+   * @param[in] i         index of the full grid in the combination grid
+   * @param[out] result   vector of values on the full grid, same size as the number of grid
+   *                      points of the full grid (the order is given by IndexVectorRange)
+   */
+  void distributeValuesToFullGrid(const base::DataVector& values, size_t i,
+                                  base::DataVector& result) const;
+
+  /**
+   * Same as \c CombinationGrid::distributeValuesToFullGrids.
+   *
+   * @param[in] values    vector of values on the combined grid, same size as the grid storage
+   * @param[out] result   vector of vectors with values on the full grids, every vector
+   *                      corresponds to one full grid of the combination grid (the order of
+   *                      DataVector entries is given by IndexVectorRange)
+   */
+  void distributeValuesToFullGrids(const base::DataVector& values,
+                                   std::vector<base::DataVector>& result) const;
+
+  /**
+   * Vector version of the other \c distributeValuesToFullGrids method.
+   *
+   * @param[in] values    matrix of values on the combined grid, every row corresponds to one
+   *                      grid point of the combined grid
+   * @param[out] result   vector of matrices with values on the full grids, every matrix
+   *                      corresponds to one full grid of the combination grid and has one row
+   *                      per full grid point (the order of rows is given by IndexVectorRange)
+   */
+  void distributeValuesToFullGrids(const base::DataMatrix& values,
+                                   std::vector<base::DataMatrix>& result) const;
+
+  /**
+   * @param i   index of the full grid in the combination grid
+   * @param j   index of the point in the full grid (in the order of IndexVectorRange)
+   * @return sequence number of the point in the grid storage, or a value greater or equal to
+   *         the size of the grid storage if the grid storage does not contain the point
+   */
+  size_t getSequenceNumber(size_t i, size_t j) const;
+
+  /**
+   * @return number of full grids
+   */
+  size_t getNumberOfFullGrids() const;
+
+  /**
+   * @return number of grid points of the combined grid
+   */
+  size_t getNumberOfGridPoints() const;
+
+ protected:
+  /// coefficients of the full grids
+  base::DataVector coefficients;
+  /// number of grid points of the combined grid
+  size_t numberOfGridPoints;
+  /// offsets of the full grids in \c sequenceNumbers, one more entry than full grids
+  std::vector<size_t> fullGridOffsets;
+  /// sequence numbers of all full grid points in the grid storage
+  std::vector<size_t> sequenceNumbers;
+  /// offsets of the grid points of the combined grid in \c contributingFullGrids and
+  /// \c contributingPoints, one more entry than grid points
+  std::vector<size_t> contributionOffsets;
+  /// full grids containing the grid points of the combined grid
+  std::vector<size_t> contributingFullGrids;
+  /// indices of the grid points of the combined grid in the full grids
+  std::vector<size_t> contributingPoints;
+};
+
+}  // namespace combigrid
+}  // namespace sgpp
@@ -0,0 +1,215 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <cassert>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Max-heap of keys with priorities, in which the position of every key is stored in a hash map.
+ * In contrast to \c std::priority_queue, the priority of a key can be changed and a key can be
+ * removed in logarithmic time.
+ *
+ * Keys with equal priority are ordered by \c operator< (smaller keys first), such that the order
+ * does not depend on the order of insertion.
+ *
+ * @tparam Key    type of the keys, has to be hashable with \c Hash and comparable with
+ *                \c operator<
+ * @tparam Hash   hash function for the keys
+ */
+template <class Key, class Hash = std::hash<Key>>
+class IndexedPriorityQueue {
+ public:
+  /**
+   * @return whether the queue is empty
+   */
+  bool empty() const { return heap.empty(); }
+
+  /**
+   * @return number of keys in the queue
+   */
+  size_t size() const { return heap.size(); }
+
+  /**
+   * @param key   key
+   * @return whether the key is in the queue
+   */
+  bool contains(const Key& key) const { return (positions.find(key) != positions.end()); }
+
+  /**
+   * @param key   key, has to be in the queue
+   * @return priority of the key
+   */
+  double getPriority(const Key& key) const { return heap[positions.at(key)].second; }
+
+  /**
+   * Insert a key or change the priority of a key that is already in the queue.
+   *
+   * @param key       key
+   * @param priority  priority of the key
+   */
+  void set(const Key& key, double priority) {
+    auto it = positions.find(key);
+
+    if (it == positions.end()) {
+      positions.emplace(key, heap.size());
+      heap.emplace_back(key, priority);
+      siftUp(heap.size() - 1);
+    } else {
+      const size_t position = it->second;
+      heap[position].second = priority;
+      siftDown(siftUp(position));
+    }
+  }
+
+  /**
+   * Remove a key from the queue, does nothing if the key is not in the queue.
+   *
+   * @param key   key
+   */
+  void erase(const Key& key) {
+    auto it = positions.find(key);
+
+    if (it == positions.end()) {
+      return;
+    }
+
+    const size_t position = it->second;
+    positions.erase(it);
+
+    if (position == heap.size() - 1) {
+      heap.pop_back();
+      return;
+    }
+
+    heap[position] = std::move(heap.back());
+    heap.pop_back();
+    positions[heap[position].first] = position;
+    siftDown(siftUp(position));
+  }
+
+  /**
+   * @return key with the highest priority, the queue must not be empty
+   */
+  const Key& top() const {
+    assert(!heap.empty());
+    return heap[0].first;
+  }
+
+  /**
+   * @return highest priority, the queue must not be empty
+   */
+  double topPriority() const {
+    assert(!heap.empty());
+    return heap[0].second;
+  }
+
+  /**
+   * Remove the key with the highest priority.
+   *
+   * @return key with the highest priority, the queue must not be empty
+   */
+  Key pop() {
+    Key key = top();
+    erase(key);
+    return key;
+  }
+
+  /**
+   * Remove all keys.
+   */
+  void clear() {
+    heap.clear();
+    positions.clear();
+  }
+
+  /**
+   * @return pairs of keys and priorities in the order of the heap (not sorted)
+   */
+  const std::vector<std::pair<Key, double>>& getElements() const { return heap; }
+
+ protected:
+  /**
+   * @return whether the entry at position a has to be above the entry at position b
+   */
+  bool isAbove(size_t a, size_t b) const {
+    return (heap[a].second > heap[b].second) ||
+           ((heap[a].second == heap[b].second) && (heap[a].first < heap[b].first));
+  }
+
+  /**
+   * Swap two entries of the heap and update their positions.
+   */
+  void swapEntries(size_t a, size_t b) {
+    std::swap(heap[a], heap[b]);
+    positions[heap[a].first] = a;
+    positions[heap[b].first] = b;
+  }
+
+  /**
+   * Move an entry up until the heap property holds.
+   *
+   * @return new position of the entry
+   */
+  size_t siftUp(size_t position) {
+    while (position > 0) {
+      const size_t parent = (position - 1) / 2;
+
+      if (!isAbove(position, parent)) {
+        break;
+      }
+
+      swapEntries(position, parent);
+      position = parent;
+    }
+
+    return position;
+  }
+
+  /**
+   * Move an entry down until the heap property holds.
+   *
+   * @return new position of the entry
+   */
+  size_t siftDown(size_t position) {
+    while (true) {
+      const size_t left = 2 * position + 1;
+      const size_t right = left + 1;
+      size_t largest = position;
+
+      if ((left < heap.size()) && isAbove(left, largest)) {
+        largest = left;
+      }
+
+      if ((right < heap.size()) && isAbove(right, largest)) {
+        largest = right;
+      }
+
+      if (largest == position) {
+        return position;
+      }
+
+      swapEntries(position, largest);
+      position = largest;
+    }
+  }
+
+  /// pairs of keys and priorities, ordered as a binary max-heap
+  std::vector<std::pair<Key, double>> heap;
+  /// positions of the keys in \c heap
+  std::unordered_map<Key, size_t, Hash> positions;
+};
+
+}  // namespace combigrid
+}  // namespace sgpp
@@ -15,6 +15,7 @@
 #include <sgpp/combigrid/adaptive/AdaptiveCombinationGridGenerator.hpp>
 #include <sgpp/combigrid/basis/HeterogeneousBasis.hpp>
 #include <sgpp/combigrid/grid/CombinationGrid.hpp>
+#include <sgpp/combigrid/grid/CombinationGridIndexMap.hpp>
 #include <sgpp/combigrid/grid/FullGrid.hpp>
 #include <sgpp/combigrid/operation/OperationEvalCombinationGrid.hpp>
 #include <sgpp/combigrid/operation/OperationPole.hpp>
@@ -25,11 +26,13 @@
 #include <sgpp/combigrid/operation/OperationUPCombinationGrid.hpp>
 #include <sgpp/combigrid/operation/OperationUPFullGrid.hpp>
 #include <sgpp/combigrid/tools/IndexVectorRange.hpp>
+#include <sgpp/combigrid/tools/IndexedPriorityQueue.hpp>
 #include <sgpp/combigrid/tools/LevelVectorTools.hpp>
 
 #include <boost/test/unit_test.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <memory>
 #include <numeric>
@@ -39,10 +42,12 @@ using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::combigrid::AdaptiveCombinationGridGenerator;
 using sgpp::combigrid::CombinationGrid;
+using sgpp::combigrid::CombinationGridIndexMap;
 using sgpp::combigrid::FullGrid;
 using sgpp::combigrid::HeterogeneousBasis;
 using sgpp::combigrid::IndexVector;
 using sgpp::combigrid::IndexVectorRange;
+using sgpp::combigrid::IndexedPriorityQueue;
 using sgpp::combigrid::LevelVector;
 using sgpp::combigrid::LevelVectorTools;
 using sgpp::combigrid::OperationEvalCombinationGrid;
@@ -309,6 +314,94 @@ BOOST_AUTO_TEST_CASE(testCombinationGrid) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testCombinationGridIndexMap) {
+  sgpp::base::SBsplineBase basis1d;
+  const HeterogeneousBasis basis(3, basis1d);
+
+  for (bool hasBoundary : {true, false}) {
+    const CombinationGrid combinationGrid =
+        CombinationGrid::fromRegularSparse(3, 5, basis, hasBoundary);
+    const std::vector<FullGrid>& fullGrids = combinationGrid.getFullGrids();
+    const size_t n = fullGrids.size();
+
+    // the second grid storage does not contain all full grid points
+    for (sgpp::combigrid::level_t storageLevel : {5, 4}) {
+      sgpp::base::GridStorage gridStorage(3);
+      CombinationGrid::fromRegularSparse(3, storageLevel, basis, hasBoundary)
+          .combinePoints(gridStorage);
+      const size_t N = gridStorage.getSize();
+      const CombinationGridIndexMap indexMap(combinationGrid, gridStorage);
+      BOOST_CHECK_EQUAL(indexMap.getNumberOfFullGrids(), n);
+      BOOST_CHECK_EQUAL(indexMap.getNumberOfGridPoints(), N);
+
+      std::vector<DataVector> values(n);
+      std::vector<DataMatrix> matrixValues(n);
+
+      for (size_t i = 0; i < n; i++) {
+        const size_t numberOfPoints = fullGrids[i].getNumberOfIndexVectors();
+        values[i].resize(numberOfPoints);
+        matrixValues[i].resize(numberOfPoints, 2);
+
+        for (size_t j = 0; j < numberOfPoints; j++) {
+          values[i][j] = std::sin(static_cast<double>(i) + 0.37 * static_cast<double>(j));
+          matrixValues[i](j, 0) = values[i][j];
+          matrixValues[i](j, 1) = -2.0 * values[i][j];
+        }
+      }
+
+      DataVector correctResult;
+      DataVector result;
+      combinationGrid.combineSparseGridValues(gridStorage, values, correctResult);
+      indexMap.combineSparseGridValues(values, result);
+      BOOST_CHECK_EQUAL_COLLECTIONS(result.begin(), result.end(), correctResult.begin(),
+                                    correctResult.end());
+
+      DataMatrix correctMatrixResult;
+      DataMatrix matrixResult;
+      combinationGrid.combineSparseGridValues(gridStorage, matrixValues, correctMatrixResult);
+      indexMap.combineSparseGridValues(matrixValues, matrixResult);
+      BOOST_CHECK_EQUAL(matrixResult.getNrows(), N);
+      BOOST_CHECK_EQUAL(matrixResult.getNcols(), 2);
+      BOOST_CHECK_EQUAL_COLLECTIONS(matrixResult.begin(), matrixResult.end(),
+                                    correctMatrixResult.begin(), correctMatrixResult.end());
+
+      for (size_t k = 0; k < N; k++) {
+        BOOST_CHECK_EQUAL(matrixResult(k, 0), result[k]);
+      }
+
+      std::vector<DataVector> correctDistributedValues;
+      std::vector<DataVector> distributedValues;
+      combinationGrid.distributeValuesToFullGrids(gridStorage, result, correctDistributedValues);
+      indexMap.distributeValuesToFullGrids(result, distributedValues);
+      BOOST_CHECK_EQUAL(distributedValues.size(), n);
+
+      std::vector<DataMatrix> distributedMatrixValues;
+      indexMap.distributeValuesToFullGrids(matrixResult, distributedMatrixValues);
+      BOOST_CHECK_EQUAL(distributedMatrixValues.size(), n);
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK_EQUAL_COLLECTIONS(distributedValues[i].begin(), distributedValues[i].end(),
+                                      correctDistributedValues[i].begin(),
+                                      correctDistributedValues[i].end());
+
+        DataVector fullGridValues;
+        indexMap.distributeValuesToFullGrid(result, i, fullGridValues);
+        BOOST_CHECK_EQUAL_COLLECTIONS(fullGridValues.begin(), fullGridValues.end(),
+                                      correctDistributedValues[i].begin(),
+                                      correctDistributedValues[i].end());
+
+        BOOST_CHECK_EQUAL(distributedMatrixValues[i].getNrows(), fullGridValues.getSize());
+
+        for (size_t j = 0; j < fullGridValues.getSize(); j++) {
+          BOOST_CHECK_EQUAL(distributedMatrixValues[i](j, 0), fullGridValues[j]);
+          const size_t k = indexMap.getSequenceNumber(i, j);
+          BOOST_CHECK_EQUAL(distributedMatrixValues[i](j, 1), (k < N) ? matrixResult(k, 1) : 0.0);
+        }
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testIndexVectorRangeIterator) {
   sgpp::base::SBsplineBase basis1d;
   const HeterogeneousBasis basis(2, basis1d);
@@ -573,3 +666,179 @@ BOOST_AUTO_TEST_CASE(testAdaptiveCombinationGridGenerator) {
                                   largerSubspaces.begin(), largerSubspaces.end());
   }
 }
+
+BOOST_AUTO_TEST_CASE(testIndexedPriorityQueue) {
+  IndexedPriorityQueue<LevelVector, LevelVectorTools::Hash> queue;
+  queue.set({1, 2}, 0.5);
+  queue.set({2, 1}, 2.0);
+  queue.set({0, 3}, 1.0);
+  queue.set({3, 0}, 1.0);
+  queue.set({1, 1}, -1.0);
+  BOOST_CHECK_EQUAL(queue.size(), 5);
+  BOOST_CHECK_EQUAL(queue.top(), LevelVector({2, 1}));
+
+  queue.set({2, 1}, 0.0);
+  queue.set({1, 1}, 3.0);
+  queue.erase({1, 2});
+  queue.erase({4, 4});
+  BOOST_CHECK(!queue.contains({1, 2}));
+  BOOST_CHECK(queue.contains({2, 1}));
+  BOOST_CHECK_EQUAL(queue.getPriority({2, 1}), 0.0);
+
+  // equal priorities are ordered by the keys
+  const std::vector<LevelVector> correctOrder = {{1, 1}, {0, 3}, {3, 0}, {2, 1}};
+
+  for (const LevelVector& level : correctOrder) {
+    BOOST_CHECK_EQUAL(queue.pop(), level);
+  }
+
+  BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(testAdaptiveCombinationGridGeneratorBatch) {
+  sgpp::base::SBsplineBase basis1d;
+  HeterogeneousBasis basis(3, basis1d);
+  const CombinationGrid combinationGrid = CombinationGrid::fromRegularSparse(3, 3, basis);
+
+  // anisotropic QoI with decaying deltas
+  auto qoiFunction = [](const LevelVector& level) {
+    double qoi = 1.0;
+
+    for (size_t d = 0; d < level.size(); d++) {
+      qoi *= 1.0 - std::pow(2.0, -static_cast<double>((d + 1) * (level[d] + 1)));
+    }
+
+    return qoi;
+  };
+
+  // the incrementally updated relevances and priorities have to match recomputed ones
+  auto checkQueues = [](const AdaptiveCombinationGridGenerator& generator) {
+    const sgpp::combigrid::WeightedRelevanceCalculator relevanceCalculator;
+    const sgpp::combigrid::AveragingPriorityEstimator priorityEstimator;
+    const std::map<LevelVector, double> relevances = generator.getRelevanceOfActiveSet();
+    const std::map<LevelVector, double> priorities = generator.getPriorityQueue();
+    const std::vector<LevelVector> pending = generator.getPendingLevelVectors();
+    const LevelVector& minimumLevel = generator.getMinimumLevelVector();
+
+    for (const LevelVector& level : generator.getActiveSet()) {
+      const double delta = generator.getDelta(level);
+
+      if (!std::isnan(delta)) {
+        BOOST_CHECK_EQUAL(relevances.at(level), relevanceCalculator.calculate(level, delta));
+        BOOST_CHECK_EQUAL(priorities.count(level), 0);
+      } else if (std::find(pending.begin(), pending.end(), level) == pending.end()) {
+        std::map<LevelVector, double> deltasOfDownwardNeighbors;
+
+        for (size_t d = 0; d < level.size(); d++) {
+          if (level[d] > minimumLevel[d]) {
+            LevelVector neighborLevel = level;
+            neighborLevel[d]--;
+            deltasOfDownwardNeighbors[neighborLevel] = generator.getDelta(neighborLevel);
+          }
+        }
+
+        BOOST_CHECK_EQUAL(priorities.at(level),
+                          priorityEstimator.estimatePriority(level, deltasOfDownwardNeighbors));
+        BOOST_CHECK_EQUAL(relevances.count(level), 0);
+      }
+    }
+  };
+
+  auto generator = AdaptiveCombinationGridGenerator::fromCombinationGrid(combinationGrid);
+
+  for (const LevelVector& level : generator.getOldSet()) {
+    generator.setQoIInformation(level, qoiFunction(level));
+  }
+
+  BOOST_CHECK(!generator.adaptAllKnown());
+  checkQueues(generator);
+
+  const size_t numberOfActiveLevels = generator.getActiveSet().size();
+  std::map<LevelVector, double> priorities = generator.getPriorityQueue();
+  BOOST_CHECK_EQUAL(priorities.size(), numberOfActiveLevels);
+
+  // the batches are disjoint and ordered by decreasing priority
+  const std::vector<LevelVector> batch1 = generator.getLevelVectorsToEvaluate(4);
+  const std::vector<LevelVector> batch2 = generator.getLevelVectorsToEvaluate(3);
+  BOOST_CHECK_EQUAL(batch1.size(), 4);
+  BOOST_CHECK_EQUAL(batch2.size(), 3);
+  BOOST_CHECK_EQUAL(generator.getPendingLevelVectors().size(), 7);
+  BOOST_CHECK_EQUAL(generator.getPriorityQueue().size(), numberOfActiveLevels - 7);
+
+  for (size_t i = 1; i < batch1.size(); i++) {
+    BOOST_CHECK_GE(priorities.at(batch1[i - 1]), priorities.at(batch1[i]));
+  }
+
+  BOOST_CHECK_GE(priorities.at(batch1.back()), priorities.at(batch2.front()));
+
+  for (const auto& entry : generator.getPriorityQueue()) {
+    BOOST_CHECK_GE(priorities.at(batch2.back()), entry.second);
+  }
+
+  // results arrive in a different order
+  for (auto it = batch1.rbegin(); it != batch1.rend(); ++it) {
+    generator.setQoIInformation(*it, qoiFunction(*it));
+    checkQueues(generator);
+  }
+
+  BOOST_CHECK_EQUAL(generator.getPendingLevelVectors().size(), 3);
+  BOOST_CHECK_EQUAL(generator.getRelevanceOfActiveSet().size(), 4);
+
+  generator.cancelEvaluation(batch2[0]);
+  BOOST_CHECK_EQUAL(generator.getPendingLevelVectors().size(), 2);
+  BOOST_CHECK_EQUAL(generator.getPriorityQueue().count(batch2[0]), 1);
+
+  BOOST_CHECK(generator.adaptAllKnown());
+  BOOST_CHECK_EQUAL(generator.getRelevanceOfActiveSet().size(), 0);
+  checkQueues(generator);
+
+  // concurrent evaluation with one thread is the same as sequential evaluation
+  auto sequentialGenerator = AdaptiveCombinationGridGenerator::fromCombinationGrid(combinationGrid);
+  auto concurrentGenerator = AdaptiveCombinationGridGenerator::fromCombinationGrid(combinationGrid);
+
+  for (const LevelVector& level : sequentialGenerator.getOldSet()) {
+    sequentialGenerator.setQoIInformation(level, qoiFunction(level));
+    concurrentGenerator.setQoIInformation(level, qoiFunction(level));
+  }
+
+  for (size_t i = 0; i < 20; i++) {
+    const LevelVector level = sequentialGenerator.getLevelVectorsToEvaluate(1)[0];
+    sequentialGenerator.setQoIInformation(level, qoiFunction(level));
+    sequentialGenerator.adaptNextLevelVector();
+  }
+
+  BOOST_CHECK_EQUAL(concurrentGenerator.adaptConcurrently(qoiFunction, 20, 1), 20);
+  const std::vector<LevelVector> sequentialOldSet = sequentialGenerator.getOldSet();
+  const std::vector<LevelVector> concurrentOldSet = concurrentGenerator.getOldSet();
+  BOOST_CHECK_EQUAL_COLLECTIONS(concurrentOldSet.begin(), concurrentOldSet.end(),
+                                sequentialOldSet.begin(), sequentialOldSet.end());
+
+  // with several threads, the old set stays downward closed and every level has its QoI
+  auto parallelGenerator = AdaptiveCombinationGridGenerator::fromCombinationGrid(combinationGrid);
+  BOOST_CHECK_EQUAL(parallelGenerator.getOldSet().size(), 20);
+
+  for (const LevelVector& level : parallelGenerator.getOldSet()) {
+    parallelGenerator.setQoIInformation(level, qoiFunction(level));
+  }
+
+  BOOST_CHECK_EQUAL(parallelGenerator.adaptConcurrently(qoiFunction, 40, 4), 40);
+  parallelGenerator.adaptAllKnown();
+  BOOST_CHECK(parallelGenerator.getPendingLevelVectors().empty());
+  checkQueues(parallelGenerator);
+
+  const std::vector<LevelVector> parallelOldSet = parallelGenerator.getOldSet();
+  BOOST_CHECK_EQUAL(parallelOldSet.size(), 20 + 40);
+
+  for (const LevelVector& level : parallelOldSet) {
+    BOOST_CHECK_EQUAL(parallelGenerator.getSubspacesAndQoIs().at(level), qoiFunction(level));
+
+    for (size_t d = 0; d < level.size(); d++) {
+      if (level[d] > 0) {
+        LevelVector neighborLevel = level;
+        neighborLevel[d]--;
+        BOOST_CHECK(std::find(parallelOldSet.begin(), parallelOldSet.end(), neighborLevel) !=
+                    parallelOldSet.end());
+      }
+    }
+  }
+}
@@ -29,6 +29,7 @@
 %rename (getConstTargets) sgpp::datadriven::Dataset::getTargets() const;
 %rename (getConstData) sgpp::datadriven::Dataset::getData() const;
 %include "datadriven/src/sgpp/datadriven/tools/Dataset.hpp"
+%include "datadriven/src/sgpp/datadriven/tools/SpaceFillingCurveOrder.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/RefinementMonitor.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/RefinementMonitorConvergence.hpp"
 %include "datadriven/src/sgpp/datadriven/algorithm/RefinementMonitorPeriodic.hpp"
@@ -76,11 +77,9 @@
 %include "datadriven/src/sgpp/datadriven/algorithm/DBMatDMS_SMW.hpp"
 #endif /* USE_GSL */
 
-#ifdef __AVX__
 %include "datadriven/src/sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/AbstractOperationMultipleEvalSubspace.hpp"
 %include "datadriven/src/sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/simple/OperationMultipleEvalSubspaceSimple.hpp"
 %include "datadriven/src/sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/simple/SubspaceNodeSimple.hpp"
-#endif
 
 %include "OpFactory.i"
 
@@ -120,6 +119,7 @@
 %include "datadriven/src/sgpp/datadriven/application/learnersgdeonoffparallel/NetworkMessageData.hpp"
 %include "datadriven/src/sgpp/datadriven/application/learnersgdeonoffparallel/PendingMPIRequest.hpp"
 %include "datadriven/src/sgpp/datadriven/application/learnersgdeonoffparallel/RoundRobinScheduler.hpp"
+%include "datadriven/src/sgpp/datadriven/application/learnersgdeonoffparallel/LeastLoadedScheduler.hpp"
 #endif
 
 %include "datadriven/src/sgpp/datadriven/configuration/DensityEstimationTypeParser.hpp"
@@ -133,6 +133,7 @@
 %ignore sgpp::datadriven::DataShufflingFunctorCrossValidation::operator();
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctor.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/shuffling/DataSourceShufflingTypeParser.hpp"
+%include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/SpaceFillingCurveTypeParser.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorFactory.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorRandom.hpp"
 %include "datadriven/src/sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorSequential.hpp"
@@ -0,0 +1,139 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/datadriven/algorithm/DMSystemMatrix.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Measures mult and multTranspose of an operation, averaged over some repetitions. The first call
+ * records the cached matrix, it is measured separately.
+ */
+void measure(sgpp::base::OperationMultipleEval& op, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& source, size_t repetitions, double& firstTime,
+             double& multTime, double& multTransposeTime) {
+  sgpp::base::DataVector result(source.getSize());
+  sgpp::base::DataVector resultTranspose(alpha.getSize());
+  sgpp::base::SGppStopwatch stopwatch;
+
+  stopwatch.start();
+  op.mult(alpha, result);
+  firstTime = stopwatch.stop();
+
+  multTime = 0.0;
+  multTransposeTime = 0.0;
+
+  for (size_t repetition = 0; repetition < repetitions; repetition++) {
+    stopwatch.start();
+    op.mult(alpha, result);
+    multTime += stopwatch.stop();
+
+    stopwatch.start();
+    op.multTranspose(source, resultTranspose);
+    multTransposeTime += stopwatch.stop();
+  }
+
+  multTime /= static_cast<double>(repetitions);
+  multTransposeTime /= static_cast<double>(repetitions);
+}
+
+// arg 1: number of data points (default 20000)
+// arg 2: dimension (default 4)
+// arg 3: level of the regular grids (default 5)
+// arg 4: number of repetitions (default 10)
+// arg 5: memory budget of the cached matrix in MB (default 1024)
+//
+// Compares the recomputing multiple evaluation of linear, linear boundary and modified linear
+// grids with the evaluation from a cached sparse matrix, both for single products and for the
+// CG iterations of a regression with DMSystemMatrix. A budget smaller than the matrix shows the
+// fallback to the recomputation.
+int main(int argc, char* argv[]) {
+  size_t numDataPoints = (argc > 1) ? std::atoi(argv[1]) : 20000;
+  size_t dim = (argc > 2) ? std::atoi(argv[2]) : 4;
+  size_t level = (argc > 3) ? std::atoi(argv[3]) : 5;
+  size_t repetitions = (argc > 4) ? std::atoi(argv[4]) : 10;
+  size_t memoryBudget =
+      static_cast<size_t>((argc > 5) ? std::atoi(argv[5]) : 1024) * 1024 * 1024;
+
+  std::mt19937 mt(42);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+  sgpp::base::DataMatrix data(numDataPoints, dim);
+  sgpp::base::DataVector targets(numDataPoints);
+
+  for (size_t i = 0; i < numDataPoints; i++) {
+    double value = 1.0;
+
+    for (size_t d = 0; d < dim; d++) {
+      data.set(i, d, uniform(mt));
+      value *= 4.0 * data.get(i, d) * (1.0 - data.get(i, d));
+    }
+
+    targets[i] = value;
+  }
+
+  std::vector<std::pair<std::string, std::unique_ptr<sgpp::base::Grid>>> grids;
+  grids.emplace_back("linear", std::unique_ptr<sgpp::base::Grid>(
+                                   sgpp::base::Grid::createLinearGrid(dim)));
+  grids.emplace_back("linear boundary", std::unique_ptr<sgpp::base::Grid>(
+                                            sgpp::base::Grid::createLinearBoundaryGrid(dim)));
+  grids.emplace_back("modified linear", std::unique_ptr<sgpp::base::Grid>(
+                                            sgpp::base::Grid::createModLinearGrid(dim)));
+
+  std::cout << "data points: " << numDataPoints << ", budget [MB]: " << memoryBudget / 1024 / 1024
+            << std::endl;
+  std::cout << "grid, grid points, mode, first mult [s], mult [s], multTranspose [s], CG [s]"
+            << std::endl;
+
+  for (auto& grid : grids) {
+    grid.second->getGenerator().regular(level);
+    sgpp::base::DataVector alpha(grid.second->getSize(), 1.0);
+    sgpp::base::DataVector source(numDataPoints, 1.0);
+
+    for (bool cached : {false, true}) {
+      std::unique_ptr<sgpp::base::OperationMultipleEval> op(
+          cached ? sgpp::op_factory::createOperationMultipleEvalCached(*grid.second, data,
+                                                                       memoryBudget)
+                 : sgpp::op_factory::createOperationMultipleEval(*grid.second, data));
+
+      double firstTime, multTime, multTransposeTime;
+      measure(*op, alpha, source, repetitions, firstTime, multTime, multTransposeTime);
+
+      // a fixed number of iterations, so both modes do the same work
+      std::shared_ptr<sgpp::base::OperationMatrix> C(
+          sgpp::op_factory::createOperationIdentity(*grid.second));
+      sgpp::datadriven::DMSystemMatrix systemMatrix(*grid.second, data, C, 1e-4,
+                                                    cached ? memoryBudget : 0);
+      sgpp::base::DataVector b(grid.second->getSize());
+      sgpp::base::DataVector solution(grid.second->getSize(), 0.0);
+      sgpp::solver::ConjugateGradients cg(repetitions, 0.0);
+      sgpp::base::SGppStopwatch stopwatch;
+
+      stopwatch.start();
+      systemMatrix.generateb(targets, b);
+      cg.solve(systemMatrix, solution, b, false, false);
+      double cgTime = stopwatch.stop();
+
+      std::cout << grid.first << ", " << grid.second->getSize() << ", "
+                << (cached ? "cached" : "recompute") << ", " << firstTime << ", " << multTime
+                << ", " << multTransposeTime << ", " << cgTime << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/SpaceFillingCurveOrder.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Measures mult and multTranspose of an operation, averaged over some repetitions.
+ */
+void measure(sgpp::base::OperationMultipleEval& op, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& source, size_t repetitions, double& multTime,
+             double& multTransposeTime) {
+  sgpp::base::DataVector result(source.getSize());
+  sgpp::base::DataVector resultTranspose(alpha.getSize());
+  sgpp::base::SGppStopwatch stopwatch;
+
+  multTime = 0.0;
+  multTransposeTime = 0.0;
+
+  for (size_t repetition = 0; repetition < repetitions; repetition++) {
+    stopwatch.start();
+    op.mult(alpha, result);
+    multTime += stopwatch.stop();
+
+    stopwatch.start();
+    op.multTranspose(source, resultTranspose);
+    multTransposeTime += stopwatch.stop();
+  }
+
+  multTime /= static_cast<double>(repetitions);
+  multTransposeTime /= static_cast<double>(repetitions);
+}
+
+// arg 1: number of data points (default 20000)
+// arg 2: dimension (default 4)
+// arg 3: level of the regular grids (default 5)
+// arg 4: number of repetitions (default 3)
+//
+// Orders a clustered dataset along the Morton and the Hilbert curve and compares the runtime of
+// the streaming evaluation of a linear grid and of the B-spline evaluation with the unordered
+// data. Both skip blocks of points outside of the supports of the basis functions, which only
+// pays off for ordered data. Cache misses can be compared by running the example with e.g.
+//   perf stat -e cache-misses ./multieval_ordering 200000 5 6
+int main(int argc, char* argv[]) {
+  size_t numDataPoints = (argc > 1) ? std::atoi(argv[1]) : 20000;
+  size_t dim = (argc > 2) ? std::atoi(argv[2]) : 4;
+  size_t level = (argc > 3) ? std::atoi(argv[3]) : 5;
+  size_t repetitions = (argc > 4) ? std::atoi(argv[4]) : 3;
+
+  // a few clusters, the typical case for the support of a density or a classifier
+  std::mt19937 mt(42);
+  std::uniform_real_distribution<double> uniform(0.1, 0.9);
+  std::normal_distribution<double> normal(0.0, 0.05);
+  const size_t numClusters = 8;
+  std::vector<std::vector<double>> centers(numClusters, std::vector<double>(dim));
+
+  for (auto& center : centers) {
+    for (double& x : center) {
+      x = uniform(mt);
+    }
+  }
+
+  sgpp::datadriven::Dataset unordered(numDataPoints, dim);
+
+  for (size_t i = 0; i < numDataPoints; i++) {
+    const std::vector<double>& center = centers[mt() % numClusters];
+
+    for (size_t d = 0; d < dim; d++) {
+      unordered.getData().set(i, d, std::min(1.0, std::max(0.0, center[d] + normal(mt))));
+    }
+  }
+
+  std::unique_ptr<sgpp::base::Grid> linearGrid(sgpp::base::Grid::createLinearGrid(dim));
+  linearGrid->getGenerator().regular(level);
+  std::unique_ptr<sgpp::base::Grid> bsplineGrid(sgpp::base::Grid::createBsplineGrid(dim, 3));
+  bsplineGrid->getGenerator().regular(level);
+
+  sgpp::base::DataVector source(numDataPoints, 1.0);
+  sgpp::base::DataVector linearAlpha(linearGrid->getSize(), 1.0);
+  sgpp::base::DataVector bsplineAlpha(bsplineGrid->getSize(), 1.0);
+
+  std::cout << "data points: " << numDataPoints << ", grid points: " << linearGrid->getSize()
+            << std::endl;
+  std::cout << "ordering, streaming mult [s], streaming multTranspose [s], B-spline mult [s], "
+               "B-spline multTranspose [s]"
+            << std::endl;
+
+  const std::vector<std::pair<std::string, sgpp::datadriven::SpaceFillingCurveType>> orderings =
+      {{"none", sgpp::datadriven::SpaceFillingCurveType::None},
+       {"morton", sgpp::datadriven::SpaceFillingCurveType::Morton},
+       {"hilbert", sgpp::datadriven::SpaceFillingCurveType::Hilbert}};
+
+  for (auto& ordering : orderings) {
+    sgpp::datadriven::Dataset dataset(unordered);
+    sgpp::datadriven::SpaceFillingCurveOrder::orderDataset(dataset, ordering.second);
+
+    double streamingMult, streamingMultTranspose;
+    sgpp::datadriven::OperationMultiEvalStreaming streaming(*linearGrid, dataset.getData());
+    measure(streaming, linearAlpha, source, repetitions, streamingMult, streamingMultTranspose);
+
+    double bsplineMult, bsplineMultTranspose;
+    std::unique_ptr<sgpp::base::OperationMultipleEval> bspline(
+        sgpp::op_factory::createOperationMultipleEvalNaive(*bsplineGrid, dataset.getData()));
+    measure(*bspline, bsplineAlpha, source, 1, bsplineMult, bsplineMultTranspose);
+
+    std::cout << ordering.first << ", " << streamingMult << ", " << streamingMultTranspose
+              << ", " << bsplineMult << ", " << bsplineMultTranspose << std::endl;
+  }
+
+  return 0;
+}
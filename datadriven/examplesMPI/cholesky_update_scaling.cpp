@@ -0,0 +1,153 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef USE_SCALAPACK
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDMSChol.hpp>
+#include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
+#include <sgpp/datadriven/scalapack/DataMatrixDistributed.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::BlacsProcessGrid;
+using sgpp::datadriven::DataMatrixDistributed;
+
+/**
+ * Measures the time of an operation on all processes (wall clock time of the slowest process).
+ */
+template <typename F>
+double measure(F operation) {
+  MPI_Barrier(MPI_COMM_WORLD);
+  auto start = std::chrono::system_clock::now();
+  operation();
+  MPI_Barrier(MPI_COMM_WORLD);
+  auto end = std::chrono::system_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+// arg 1: size of the cholesky factor (default 2000)
+// arg 2: block size of the distribution (default 64)
+//
+// Compares the update of a distributed cholesky factor after a change of the regularization
+// parameter by gathering it on the master process, n rank one updates there and distributing it
+// again with the distributed update DataMatrixDistributed::choleskyUpdateDiagonal. Additionally,
+// the distributed updates for coarsening and refinement (1% of the grid points) are measured.
+// The measurements are repeated for process grids of 1, 2, 4, ... of the available MPI ranks, e.g.
+//   mpirun -n 16 ./cholesky_update_scaling 4000 64
+int main(int argc, char* argv[]) {
+  BlacsProcessGrid::initializeBlacs();
+  {
+    size_t n = (argc > 1) ? std::atoi(argv[1]) : 2000;
+    size_t blockSize = (argc > 2) ? std::atoi(argv[2]) : 64;
+    double lambdaUpdate = 0.1;
+    size_t numModified = std::max<size_t>(1, n / 100);
+    bool isMaster = (BlacsProcessGrid::getCurrentProcess() == 0);
+
+    // well conditioned lower triangular factor, available on every process
+    DataMatrix l(n, n, 0.0);
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < i; j++) {
+        l.set(i, j, 1.0 / static_cast<double>(1 + i - j));
+      }
+      l.set(i, i, std::sqrt(static_cast<double>(n)));
+    }
+
+    // rows that are removed (spread over the factor) and appended
+    std::vector<size_t> removed;
+    for (size_t i = 0; i < numModified; i++) {
+      removed.push_back((i * n) / numModified);
+    }
+
+    size_t reducedSize = n - removed.size();
+    DataMatrix newRows(numModified, reducedSize + numModified, 0.0);
+    for (size_t i = 0; i < numModified; i++) {
+      newRows.set(i, reducedSize + i, static_cast<double>(n));
+    }
+
+    if (isMaster) {
+      std::cout << "n = " << n << ", block size = " << blockSize << std::endl;
+      std::cout << "processes, grid, gather/update/distribute [s], distributed update [s], "
+                << "remove " << numModified << " [s], add " << numModified << " [s]"
+                << std::endl;
+    }
+
+    for (int processes = 1; processes <= BlacsProcessGrid::availableProcesses();
+         processes *= 2) {
+      // process grid as square as possible
+      int rows = static_cast<int>(std::sqrt(static_cast<double>(processes)));
+      while (processes % rows != 0) {
+        rows--;
+      }
+      auto processGrid = std::make_shared<BlacsProcessGrid>(rows, processes / rows);
+
+      DataMatrixDistributed lDistributed =
+          DataMatrixDistributed::fromSharedData(l.data(), processGrid, n, n, blockSize, blockSize);
+      DataMatrixDistributed lReference = lDistributed;
+
+      // previous implementation: gather, update on the master process and distribute again
+      double gatherTime = measure([&]() {
+        if (processGrid->isProcessInGrid()) {
+          DataMatrix lLocal = lReference.toLocalDataMatrix();
+          if (processGrid->getCurrentRow() == 0 && processGrid->getCurrentColumn() == 0) {
+            DataVector alpha(n);
+            DataVector b(n, 1.0);
+            sgpp::datadriven::DBMatDMSChol().solve(lLocal, alpha, b, 0.0, lambdaUpdate);
+          }
+          lReference.distribute(lLocal.data(), 0, 0);
+        }
+      });
+
+      double distributedTime = measure([&]() {
+        if (processGrid->isProcessInGrid()) {
+          DataMatrixDistributed::choleskyUpdateDiagonal(lDistributed, lambdaUpdate);
+        }
+      });
+
+      double removeTime = measure([&]() {
+        if (processGrid->isProcessInGrid()) {
+          DataMatrixDistributed::choleskyRemoveRowsColumns(lDistributed, removed);
+        }
+      });
+
+      DataMatrixDistributed newRowsDistributed = DataMatrixDistributed::fromSharedData(
+          newRows.data(), processGrid, numModified, reducedSize + numModified, blockSize,
+          blockSize);
+
+      double addTime = measure([&]() {
+        if (processGrid->isProcessInGrid()) {
+          DataMatrixDistributed::choleskyAddRowsColumns(lDistributed, newRowsDistributed);
+        }
+      });
+
+      if (isMaster) {
+        std::cout << processes << ", " << rows << "x" << processes / rows << ", " << gatherTime
+                  << ", " << distributedTime << ", " << removeTime << ", " << addTime
+                  << std::endl;
+      }
+    }
+  }
+  BlacsProcessGrid::exitBlacs();
+  return 0;
+}
+
+#else
+#include <iostream>
+int main(int argc, char** argv) {
+  std::cout << "error: build with ScaLAPACK to enable this example" << std::endl;
+  return 0;
+}
+#endif
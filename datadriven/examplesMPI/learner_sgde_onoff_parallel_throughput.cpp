@@ -0,0 +1,139 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#if defined(USE_MPI) && defined(USE_GSL)
+
+#include <omp.h>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/LearnerSGDEOnOffParallel.hpp>
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/LeastLoadedScheduler.hpp>
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/MPIMethods.hpp>
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/RoundRobinScheduler.hpp>
+#include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
+#include <sgpp/datadriven/configuration/RegularizationConfiguration.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+/**
+ * Two classes of normally distributed points around opposite corners of the unit cube, the
+ * same on every process.
+ */
+sgpp::datadriven::Dataset createDataset(size_t numDataPoints, size_t dim, unsigned int seed) {
+  std::mt19937 mt(seed);
+  std::normal_distribution<double> dist(0.0, 0.15);
+  sgpp::datadriven::Dataset dataset(numDataPoints, dim);
+
+  for (size_t i = 0; i < numDataPoints; i++) {
+    double label = (i % 2 == 0) ? -1.0 : 1.0;
+    double center = (label < 0.0) ? 0.3 : 0.7;
+
+    for (size_t d = 0; d < dim; d++) {
+      dataset.getData().set(i, d, std::min(1.0, std::max(0.0, center + dist(mt))));
+    }
+
+    dataset.getTargets()[i] = label;
+  }
+
+  return dataset;
+}
+
+// arg 1: scheduler, roundrobin or leastloaded (default leastloaded)
+// arg 2: number of training data points (default 20000)
+// arg 3: batch size (default 100)
+// arg 4: refinement period in data points (default 2000)
+// arg 5: dimension (default 2)
+//
+// Trains LearnerSGDEOnOffParallel on synthetic data and prints the training throughput in
+// batches per second on the master, e.g.
+//   mpirun -np 4 ./learner_sgde_onoff_parallel_throughput leastloaded 40000 100 4000
+// The learner initializes MPI itself, so only one configuration can be measured per run.
+int main(int argc, char* argv[]) {
+  omp_set_num_threads(1);
+
+  std::string schedulerType = (argc > 1) ? argv[1] : "leastloaded";
+  size_t numDataPoints = (argc > 2) ? std::atoi(argv[2]) : 20000;
+  size_t batchSize = (argc > 3) ? std::atoi(argv[3]) : 100;
+  size_t refPeriod = (argc > 4) ? std::atoi(argv[4]) : 2000;
+  size_t dim = (argc > 5) ? std::atoi(argv[5]) : 2;
+
+  sgpp::datadriven::Dataset trainDataset = createDataset(numDataPoints, dim, 42);
+  sgpp::datadriven::Dataset testDataset = createDataset(numDataPoints / 10, dim, 43);
+  sgpp::datadriven::Dataset validationDataset = createDataset(numDataPoints / 10, dim, 44);
+
+  size_t classNum = 2;
+  sgpp::base::DataVector classLabels(classNum);
+  classLabels[0] = -1;
+  classLabels[1] = 1;
+
+  sgpp::base::RegularGridConfiguration gridConfig;
+  gridConfig.dim_ = dim;
+  gridConfig.level_ = 3;
+  gridConfig.type_ = sgpp::base::GridType::Linear;
+
+  sgpp::datadriven::RegularizationConfiguration regularizationConfig{};
+  regularizationConfig.type_ = sgpp::datadriven::RegularizationType::Identity;
+  regularizationConfig.lambda_ = 0.01;
+
+  sgpp::datadriven::DensityEstimationConfiguration densityEstimationConfig;
+  densityEstimationConfig.decomposition_ = sgpp::datadriven::MatrixDecompositionType::DenseIchol;
+  densityEstimationConfig.iCholSweepsDecompose_ = 2;
+  densityEstimationConfig.iCholSweepsRefine_ = 2;
+
+  sgpp::base::AdaptivityConfiguration adaptConfig;
+  adaptConfig.numRefinements_ = numDataPoints / std::max<size_t>(1, refPeriod);
+  adaptConfig.numRefinementPoints_ = 7;
+  adaptConfig.refinementThreshold_ = 0.0;
+
+  std::unique_ptr<sgpp::datadriven::MPITaskScheduler> scheduler;
+  if (schedulerType == "roundrobin") {
+    scheduler.reset(new sgpp::datadriven::RoundRobinScheduler(batchSize));
+  } else {
+    schedulerType = "leastloaded";
+    scheduler.reset(new sgpp::datadriven::LeastLoadedScheduler(batchSize));
+  }
+
+  sgpp::datadriven::LearnerSGDEOnOffParallel learner(
+      gridConfig, adaptConfig, regularizationConfig, densityEstimationConfig, trainDataset,
+      testDataset, &validationDataset, classLabels, classNum, false, 0.0, *scheduler);
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  sgpp::base::SGppStopwatch stopwatch;
+  stopwatch.start();
+  learner.trainParallel(batchSize, 1, "zero", "periodic", refPeriod, 0.001, 140, 10);
+  double deltaTime = stopwatch.stop();
+
+  MPI_Barrier(MPI_COMM_WORLD);
+
+  double accuracy = learner.getAccuracy();
+
+  if (sgpp::datadriven::MPIMethods::isMaster()) {
+    size_t numBatches = (numDataPoints + batchSize - 1) / batchSize;
+    std::cout << "scheduler, workers, batches, refinements, time [s], batches/s, accuracy"
+              << std::endl;
+    std::cout << schedulerType << ", " << sgpp::datadriven::MPIMethods::getWorldSize() - 1
+              << ", " << numBatches << ", " << adaptConfig.numRefinements_ << ", " << deltaTime
+              << ", " << static_cast<double>(numBatches) / deltaTime << ", " << accuracy
+              << std::endl;
+  }
+
+  return 0;
+}
+
+#else
+#include <iostream>
+int main(int argc, char** argv) {
+  std::cout << "error: build with MPI and GSL to enable this example" << std::endl;
+  return 0;
+}
+#endif
@@ -0,0 +1,138 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef USE_MPI
+
+#define MPICH_SKIP_MPICXX
+#define OMPI_SKIP_MPICXX
+#include <mpi.h>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalMPI/OperationMultiEvalMPI.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <random>
+
+// arg 1: number of data points (default 100000)
+// arg 2: dimension (default 5)
+// arg 3: level of the regular grid (default 6)
+// arg 4: number of repetitions (default 5)
+//
+// Evaluates a sparse grid function on a dataset with the pipelined mode of
+// OperationMultiEvalMPI, compares the results of mult and multTranspose with a single process
+// evaluation and prints the duration and the shares of the ranks after every repetition, e.g.
+//   mpirun -n 4 ./multieval_pipelined 200000 5 6 10
+int main(int argc, char* argv[]) {
+  MPI_Init(&argc, &argv);
+
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+  size_t numDataPoints = (argc > 1) ? std::atoi(argv[1]) : 100000;
+  size_t dim = (argc > 2) ? std::atoi(argv[2]) : 5;
+  size_t level = (argc > 3) ? std::atoi(argv[3]) : 6;
+  size_t repetitions = (argc > 4) ? std::atoi(argv[4]) : 5;
+
+  // the same dataset on every rank
+  std::mt19937 mt(42);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  sgpp::base::DataMatrix dataset(numDataPoints, dim);
+
+  for (size_t i = 0; i < numDataPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, dist(mt));
+    }
+  }
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+
+  sgpp::base::DataVector alpha(grid->getSize());
+  sgpp::base::DataVector source(numDataPoints);
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = dist(mt);
+  }
+
+  for (size_t i = 0; i < source.getSize(); i++) {
+    source[i] = dist(mt);
+  }
+
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT,
+      sgpp::datadriven::OperationMultipleEvalMPIType::PIPELINED);
+  std::unique_ptr<sgpp::datadriven::OperationMultiEvalMPI> evalMPI(
+      dynamic_cast<sgpp::datadriven::OperationMultiEvalMPI*>(
+          sgpp::op_factory::createOperationMultipleEval(*grid, dataset, configuration)));
+
+  // reference values of a single process
+  sgpp::datadriven::OperationMultiEvalStreaming evalReference(*grid, dataset);
+  sgpp::base::DataVector resultReference(numDataPoints);
+  sgpp::base::DataVector resultTransposeReference(grid->getSize());
+  evalReference.mult(alpha, resultReference);
+  evalReference.multTranspose(source, resultTransposeReference);
+
+  if (rank == 0) {
+    std::cout << "data points: " << numDataPoints << ", grid points: " << grid->getSize()
+              << std::endl;
+    std::cout << "repetition, mult [s], multTranspose [s], max. error, shares" << std::endl;
+  }
+
+  sgpp::base::DataVector result(numDataPoints);
+  sgpp::base::DataVector resultTranspose(grid->getSize());
+
+  for (size_t repetition = 0; repetition < repetitions; repetition++) {
+    evalMPI->mult(alpha, result);
+    double multDuration = evalMPI->getDuration();
+    evalMPI->multTranspose(source, resultTranspose);
+    double multTransposeDuration = evalMPI->getDuration();
+
+    double maxError = 0.0;
+
+    for (size_t i = 0; i < numDataPoints; i++) {
+      maxError = std::max(maxError, std::abs(result[i] - resultReference[i]));
+    }
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      maxError = std::max(maxError, std::abs(resultTranspose[i] - resultTransposeReference[i]) /
+                                        std::max(1.0, std::abs(resultTransposeReference[i])));
+    }
+
+    // all ranks have to agree on the result
+    MPI_Allreduce(MPI_IN_PLACE, &maxError, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+      std::cout << repetition << ", " << multDuration << ", " << multTransposeDuration << ", "
+                << maxError << ",";
+
+      for (double weight : evalMPI->getRankWeights()) {
+        std::cout << " " << weight;
+      }
+
+      std::cout << std::endl;
+    }
+  }
+
+  evalMPI.reset();
+  MPI_Finalize();
+  return 0;
+}
+
+#else
+#include <iostream>
+int main(int argc, char** argv) {
+  std::cout << "error: build with MPI to enable this example" << std::endl;
+  return 0;
+}
+#endif
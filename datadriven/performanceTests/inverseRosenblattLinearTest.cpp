@@ -0,0 +1,109 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationLinear.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationLinearBatched.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace InverseRosenblattLinear {
+
+size_t numSamples = 2000;
+
+struct InverseRosenblattFixture {
+  InverseRosenblattFixture() {
+    outFile.open("resultsInverseRosenblattLinear.csv");
+    outFile << "Dimensions, Level, Grid size, Implementation, Samples per second" << std::endl;
+  }
+  ~InverseRosenblattFixture() { outFile.close(); }
+  std::ofstream outFile;
+} logger;
+
+/**
+ * Measures the throughput (samples per second) of the inverse Rosenblatt transformation
+ * that constructs the conditioned and marginalized grids for every sample and of the batched
+ * implementation on a regular grid and checks that both coincide.
+ */
+void compareThroughput(size_t dim, size_t level) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+  const size_t gridSize = grid->getSize();
+
+  // hierarchized product of parabolas as density
+  sgpp::base::DataVector alpha(gridSize);
+  sgpp::base::DataVector coords(dim);
+
+  for (size_t i = 0; i < gridSize; i++) {
+    grid->getStorage().getPoint(i).getStandardCoordinates(coords);
+    alpha[i] = 1.0;
+
+    for (size_t d = 0; d < dim; d++) {
+      alpha[i] *= 4.0 * coords[d] * (1.0 - coords[d]);
+    }
+  }
+
+  std::unique_ptr<sgpp::base::OperationHierarchisation>(
+      sgpp::op_factory::createOperationHierarchisation(*grid))
+      ->doHierarchisation(alpha);
+
+  std::mt19937 mt(42);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  sgpp::base::DataMatrix pointscdf(numSamples, dim);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      pointscdf.set(i, d, dist(mt));
+    }
+  }
+
+  sgpp::datadriven::OperationInverseRosenblattTransformationLinear opReference(grid.get());
+  sgpp::datadriven::OperationInverseRosenblattTransformationLinearBatched opBatched(grid.get());
+
+  std::vector<sgpp::datadriven::OperationInverseRosenblattTransformation*> ops = {&opReference,
+                                                                                 &opBatched};
+  std::vector<std::string> names = {"per sample grids", "batched"};
+  std::vector<sgpp::base::DataMatrix> points(2, sgpp::base::DataMatrix(numSamples, dim));
+
+  for (size_t k = 0; k < ops.size(); k++) {
+    auto start = std::chrono::system_clock::now();
+    ops[k]->doTransformation(&alpha, &pointscdf, &points[k]);
+    auto end = std::chrono::system_clock::now();
+    double samplesPerSecond =
+        static_cast<double>(numSamples) / std::chrono::duration<double>(end - start).count();
+
+    BOOST_TEST_MESSAGE("dim " << dim << ", level " << level << ", grid size " << gridSize << ", "
+                              << names[k] << ": " << samplesPerSecond << " samples/s");
+    logger.outFile << dim << "," << level << "," << gridSize << "," << names[k] << ","
+                   << samplesPerSecond << std::endl;
+  }
+
+  for (size_t i = 0; i < numSamples; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      BOOST_CHECK_SMALL(points[1].get(i, d) - points[0].get(i, d), 1e-10);
+    }
+  }
+}
+
+}  // namespace InverseRosenblattLinear
+
+BOOST_AUTO_TEST_SUITE(InverseRosenblattLinear)
+
+BOOST_AUTO_TEST_CASE(Dim2) { InverseRosenblattLinear::compareThroughput(2, 6); }
+
+BOOST_AUTO_TEST_CASE(Dim4) { InverseRosenblattLinear::compareThroughput(4, 5); }
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,158 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#define BOOST_TEST_DYN_LINK
+#include "testsCommon.hpp"
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace MultiEvalStreamingCPU {
+
+std::string fileName = "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz";
+
+std::string datasetName = "Friedman 4d";
+
+size_t level = 6;
+
+size_t levelBoundary = 5;
+
+size_t degree = 3;
+
+size_t runs = 5;
+
+struct StreamingCPUFixture {
+  StreamingCPUFixture() {
+    outFile.open("resultsStreamingCPU.csv");
+    outFile << "Dataset, Basis, Kernel, Operation, Grid size, Duration (s)" << std::endl;
+  }
+  ~StreamingCPUFixture() { outFile.close(); }
+  std::ofstream outFile;
+} logger;
+
+/**
+ * Measures the average runtime of mult and multTranspose of the streaming kernel and
+ * of the generic implementation in base for a regular grid and checks that both coincide.
+ */
+void compareRuntimes(sgpp::base::Grid& grid, const std::string& basisName, size_t gridLevel) {
+  std::string content = uncompressFile(fileName);
+
+  sgpp::datadriven::ARFFTools arffTools;
+  sgpp::datadriven::Dataset dataset = arffTools.readARFFFromString(content);
+  sgpp::base::DataMatrix& trainingData = dataset.getData();
+
+  grid.getGenerator().regular(gridLevel);
+  const size_t gridSize = grid.getSize();
+  BOOST_TEST_MESSAGE(basisName << ": number of grid points: " << gridSize);
+
+  std::mt19937 mt(42);
+  std::uniform_real_distribution<double> dist(1, 100);
+  sgpp::base::DataVector alpha(gridSize);
+  sgpp::base::DataVector source(dataset.getNumberInstances());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = dist(mt);
+  }
+
+  for (size_t i = 0; i < source.getSize(); i++) {
+    source[i] = dist(mt);
+  }
+
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+  std::unique_ptr<sgpp::base::OperationMultipleEval> evalStreaming(
+      sgpp::op_factory::createOperationMultipleEval(grid, trainingData, configuration));
+  std::unique_ptr<sgpp::base::OperationMultipleEval> evalBase(
+      sgpp::op_factory::createOperationMultipleEval(grid, trainingData));
+
+  std::vector<sgpp::base::OperationMultipleEval*> evals = {evalBase.get(), evalStreaming.get()};
+  std::vector<std::string> kernelNames = {"base", "streaming"};
+  std::vector<sgpp::base::DataVector> results(2, sgpp::base::DataVector(source.getSize()));
+  std::vector<sgpp::base::DataVector> resultsTranspose(2, sgpp::base::DataVector(gridSize));
+
+  for (size_t k = 0; k < evals.size(); k++) {
+    double durationMult = 0.0;
+    double durationMultTranspose = 0.0;
+
+    for (size_t r = 0; r < runs; r++) {
+      auto start = std::chrono::system_clock::now();
+      evals[k]->mult(alpha, results[k]);
+      auto end = std::chrono::system_clock::now();
+      durationMult += std::chrono::duration<double>(end - start).count();
+
+      start = std::chrono::system_clock::now();
+      evals[k]->multTranspose(source, resultsTranspose[k]);
+      end = std::chrono::system_clock::now();
+      durationMultTranspose += std::chrono::duration<double>(end - start).count();
+    }
+
+    durationMult /= static_cast<double>(runs);
+    durationMultTranspose /= static_cast<double>(runs);
+    BOOST_TEST_MESSAGE(kernelNames[k] << ": mult " << durationMult << " s, multTranspose "
+                                      << durationMultTranspose << " s");
+
+    logger.outFile << datasetName << "," << basisName << "," << kernelNames[k] << ",mult,"
+                   << gridSize << "," << durationMult << std::endl;
+    logger.outFile << datasetName << "," << basisName << "," << kernelNames[k]
+                   << ",multTranspose," << gridSize << "," << durationMultTranspose << std::endl;
+  }
+
+  for (size_t i = 0; i < results[0].getSize(); i++) {
+    BOOST_CHECK_CLOSE(results[1][i], results[0][i], 1e-8);
+  }
+
+  for (size_t i = 0; i < gridSize; i++) {
+    BOOST_CHECK_CLOSE(resultsTranspose[1][i], resultsTranspose[0][i], 1e-8);
+  }
+}
+
+}  // namespace MultiEvalStreamingCPU
+
+BOOST_AUTO_TEST_SUITE(MultiEvalStreamingCPU)
+
+BOOST_AUTO_TEST_CASE(LinearBoundary) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearBoundaryGrid(4));
+  MultiEvalStreamingCPU::compareRuntimes(*grid, "LinearBoundary",
+                                         MultiEvalStreamingCPU::levelBoundary);
+}
+
+BOOST_AUTO_TEST_CASE(Poly) {
+  std::unique_ptr<sgpp::base::Grid> grid(
+      sgpp::base::Grid::createPolyGrid(4, MultiEvalStreamingCPU::degree));
+  MultiEvalStreamingCPU::compareRuntimes(*grid, "Poly", MultiEvalStreamingCPU::level);
+}
+
+BOOST_AUTO_TEST_CASE(ModPoly) {
+  std::unique_ptr<sgpp::base::Grid> grid(
+      sgpp::base::Grid::createModPolyGrid(4, MultiEvalStreamingCPU::degree));
+  MultiEvalStreamingCPU::compareRuntimes(*grid, "ModPoly", MultiEvalStreamingCPU::level);
+}
+
+BOOST_AUTO_TEST_CASE(PolyBoundary) {
+  std::unique_ptr<sgpp::base::Grid> grid(
+      sgpp::base::Grid::createPolyBoundaryGrid(4, MultiEvalStreamingCPU::degree));
+  MultiEvalStreamingCPU::compareRuntimes(*grid, "PolyBoundary",
+                                         MultiEvalStreamingCPU::levelBoundary);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
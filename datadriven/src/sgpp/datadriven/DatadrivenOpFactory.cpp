@@ -19,6 +19,7 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationDensityMarginalizeLinear.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensityRejectionSamplingLinear.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensitySampling1DLinear.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationDensitySamplingCDFTableLinear.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensitySamplingLinear.hpp>
 
 #include <sgpp/datadriven/operation/hash/simple/OperationRegularizationDiagonalLinearBoundary.hpp>
@@ -40,6 +41,7 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationBsplineBoundary.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationBsplineClenshawCurtis.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationLinear.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationLinearBatched.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationModBspline.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationModBsplineClenshawCurtis.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationModPoly.hpp>
@@ -87,12 +89,12 @@
 #include <sgpp/datadriven/operation/hash/simple/OperationTestPrewavelet.hpp>
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalAdaptive/OperationMultipleEvalAdaptive.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
 
-#ifdef __AVX__
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/combined/OperationMultipleEvalSubspaceCombined.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/simple/OperationMultipleEvalSubspaceSimple.hpp>
-#endif
 
 #ifdef USE_OCL
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalStreamingBSplineOCL/StreamingBSplineOCLOperatorFactory.hpp>
@@ -231,6 +233,14 @@ datadriven::OperationDensitySampling* createOperationDensitySampling(base::Grid&
         "OperationDensitySampling is not implemented for this grid type.");
 }
 
+datadriven::OperationDensitySampling* createOperationDensitySamplingCDFTable(base::Grid& grid) {
+  if (grid.getType() == base::GridType::Linear)
+    return new datadriven::OperationDensitySamplingCDFTableLinear(&grid);
+  else
+    throw base::factory_exception(
+        "OperationDensitySamplingCDFTable is not implemented for this grid type.");
+}
+
 datadriven::OperationDensityRejectionSampling* createOperationDensityRejectionSampling(
     base::Grid& grid) {
   if (grid.getType() == base::GridType::Linear)
@@ -324,7 +334,7 @@ datadriven::OperationTransformation1D* createOperationRosenblattTransformation1D
 datadriven::OperationInverseRosenblattTransformation*
 createOperationInverseRosenblattTransformation(base::Grid& grid) {
   if (grid.getType() == base::GridType::Linear)
-    return new datadriven::OperationInverseRosenblattTransformationLinear(&grid);
+    return new datadriven::OperationInverseRosenblattTransformationLinearBatched(&grid);
   else if (grid.getType() == base::GridType::Poly)
     return new datadriven::OperationInverseRosenblattTransformationPoly(&grid);
   else if (grid.getType() == base::GridType::ModPoly)
@@ -419,6 +429,18 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #else
     throw base::factory_exception(
         "Error creating function: the library wasn't compiled with MPI support");
+#endif
+  } else if (configuration.getMPIType() ==
+             sgpp::datadriven::OperationMultipleEvalMPIType::PIPELINED) {
+#ifdef USE_MPI
+    if (grid.getType() == base::GridType::Linear) {
+      return new datadriven::OperationMultiEvalMPI(
+          grid, dataset, sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+          sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT, false, true);
+    }
+#else
+    throw base::factory_exception(
+        "Error creating function: the library wasn't compiled with MPI support");
 #endif
   } else if (configuration.getMPIType() == sgpp::datadriven::OperationMultipleEvalMPIType::HPX) {
 #ifdef USE_HPX
@@ -436,6 +458,10 @@ base::OperationMultipleEval* createOperationMultipleEval(
     return createOperationMultipleEval(grid, dataset);
   }
 
+  if (configuration.getType() == sgpp::datadriven::OperationMultipleEvalType::ADAPTIVE) {
+    return new datadriven::OperationMultipleEvalAdaptive(grid, dataset, configuration);
+  }
+
   if (grid.getType() == base::GridType::Linear) {
     if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT ||
         configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
@@ -453,20 +479,10 @@ base::OperationMultipleEval* createOperationMultipleEval(
     } else if (configuration.getType() == datadriven::OperationMultipleEvalType::SUBSPACELINEAR) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT ||
           configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::COMBINED) {
-#ifdef __AVX__
         return new datadriven::OperationMultipleEvalSubspaceCombined(grid, dataset);
-#else
-        throw base::factory_exception(
-            "Error creating function: the library wasn't compiled with AVX");
-#endif
       } else if (configuration.getSubType() ==
                  sgpp::datadriven::OperationMultipleEvalSubType::SIMPLE) {
-#ifdef __AVX__
         return new datadriven::OperationMultipleEvalSubspaceSimple(grid, dataset);
-#else
-        throw base::factory_exception(
-            "Error creating function: the library wasn't compiled with AVX");
-#endif
       }
     } else if (configuration.getType() == datadriven::OperationMultipleEvalType::SCALAPACK) {
 #ifdef USE_SCALAPACK
@@ -476,6 +492,15 @@ base::OperationMultipleEval* createOperationMultipleEval(
           "Error creating function: the library wasn't compiled with ScaLAPACK support");
 #endif
     }
+  } else if (grid.getType() == base::GridType::LinearBoundary ||
+             grid.getType() == base::GridType::LinearL0Boundary) {
+    if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        // on the unit cube, the boundary basis functions of level 0 coincide with the
+        // hat function formula used by the linear kernel
+        return new datadriven::OperationMultiEvalStreaming(grid, dataset);
+      }
+    }
   } else if (grid.getType() == base::GridType::ModLinear) {
     if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
@@ -527,7 +552,11 @@ base::OperationMultipleEval* createOperationMultipleEval(
       }
     }
   } else if (grid.getType() == base::GridType::Poly) {
-    if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT) {
+    if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingPoly(grid, dataset);
+      }
+    } else if (configuration.getType() == datadriven::OperationMultipleEvalType::DEFAULT) {
       if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::CUDA) {
 #ifdef USE_CUDA
         return new datadriven::OperationMultiEvalCuda(grid, dataset, grid.getDegree(), false);
@@ -546,6 +575,13 @@ base::OperationMultipleEval* createOperationMultipleEval(
 #endif
       }
     }
+  } else if (grid.getType() == base::GridType::ModPoly ||
+             grid.getType() == base::GridType::PolyBoundary) {
+    if (configuration.getType() == datadriven::OperationMultipleEvalType::STREAMING) {
+      if (configuration.getSubType() == sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT) {
+        return new datadriven::OperationMultiEvalStreamingPoly(grid, dataset);
+      }
+    }
   }
 
   throw base::factory_exception("OperationMultiEval is not implemented for this grid type.");
@@ -86,6 +86,15 @@ datadriven::OperationDensitySampling1D* createOperationDensitySampling1D(base::G
  */
 datadriven::OperationDensitySampling* createOperationDensitySampling(base::Grid& grid);
 
+/**
+ * Factory method, returning an OperationDensitySampling for the grid that draws the
+ * samples with precomputed CDF tables of the surpluses.
+ *
+ * @param grid Grid which is to be used for the operation
+ * @return Pointer to new OperationDensitySampling for the Grid grid
+ */
+datadriven::OperationDensitySampling* createOperationDensitySamplingCDFTable(base::Grid& grid);
+
 /**
  * Factory method, returning an OperationDensityRejectionSampling for the grid.
  *
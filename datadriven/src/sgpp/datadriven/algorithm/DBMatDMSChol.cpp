@@ -60,15 +60,7 @@ void DBMatDMSChol::solveParallel(DataMatrixDistributed& decompMatrix, DataVector
 
   // If regularization paramter is changed enter
   if (lambda_up != 0.0) {
-    // current implementation: gather and update decomposition on master process
-    DataMatrix decompMatrixLocal = decompMatrix.toLocalDataMatrix();
-
-    auto processGrid = decompMatrix.getProcessGrid();
-    if (processGrid->getCurrentRow() == 0 && processGrid->getCurrentColumn() == 0) {
-      choleskyUpdateLambda(decompMatrixLocal, lambda_up);
-    }
-
-    decompMatrix.distribute(decompMatrixLocal.data(), 0, 0);
+    choleskyUpdateLambdaParallel(decompMatrix, lambda_up);
   }
 
   // Solve (R + lambda * I)alpha = b to obtain density declaring coefficents
@@ -289,6 +281,13 @@ void DBMatDMSChol::choleskyUpdateLambda(sgpp::base::DataMatrix& decompMatrix,
   }
 }
 
+void DBMatDMSChol::choleskyUpdateLambdaParallel(DataMatrixDistributed& decompMatrix,
+                                                double lambda_up) const {
+  // the n rank one updates (downdates) with sqrt(|lambda_up|) * e_i of choleskyUpdateLambda add
+  // lambda_up to the diagonal, which is done directly on the distributed factor
+  DataMatrixDistributed::choleskyUpdateDiagonal(decompMatrix, lambda_up);
+}
+
 void DBMatDMSChol::choleskyBackwardSolve(const sgpp::base::DataMatrix& decompMatrix,
                                          const sgpp::base::DataVector& y,
                                          sgpp::base::DataVector& alpha) const {
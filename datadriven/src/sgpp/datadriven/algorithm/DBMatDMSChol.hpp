@@ -37,7 +37,9 @@ class DBMatDMSChol : public DBMatDecompMatrixSolver {
                      const sgpp::base::DataVector& b, double lambda_old, double lambda_new) const;
 
   /**
-   * Parallel (distributed) version of solve.
+   * Parallel (distributed) version of solve. If lambda_new differs from lambda_old, decompMatrix is
+   * modified on the block-cyclic data of all processes, no local copy of the factor is used or
+   * updated.
    * @param decompMatrix the LL' lower triangular cholesky factor
    * @param x input: the right hand vector of the equation system, output: the vector of unknowns
    * (the result is stored there)
@@ -80,6 +82,16 @@ class DBMatDMSChol : public DBMatDecompMatrixSolver {
   virtual void choleskyUpdateLambda(sgpp::base::DataMatrix& decompMatrix,
                                     double lambdaUpdate) const;
 
+  /**
+   * Parallel (distributed) version of choleskyUpdateLambda. The decomposition is updated on the
+   * block-cyclic data of all processes without gathering it, see
+   * DataMatrixDistributed::choleskyUpdateDiagonal.
+   * @param decompMatrix decomposed matrix to be modified
+   * @param lambdaUpdate the value by which the regularization parameter modifies the diagonal.
+   */
+  virtual void choleskyUpdateLambdaParallel(DataMatrixDistributed& decompMatrix,
+                                            double lambdaUpdate) const;
+
   /**
    * Perform Backward substitution solving the triangular system $A alpha = y$
    * @param decompMatrix Triangular matrix
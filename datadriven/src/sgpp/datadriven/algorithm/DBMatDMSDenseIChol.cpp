@@ -38,6 +38,19 @@ void DBMatDMSDenseIChol::choleskyUpdateLambda(sgpp::base::DataMatrix& decompMatr
                                 densityEstimationConfig.iCholSweepsUpdateLambda_);
 }
 
+void DBMatDMSDenseIChol::choleskyUpdateLambdaParallel(DataMatrixDistributed& decompMatrix,
+                                                      double lambdaUpdate) const {
+  // gather and update decomposition on master process
+  DataMatrix decompMatrixLocal = decompMatrix.toLocalDataMatrix();
+
+  auto processGrid = decompMatrix.getProcessGrid();
+  if (processGrid->getCurrentRow() == 0 && processGrid->getCurrentColumn() == 0) {
+    choleskyUpdateLambda(decompMatrixLocal, lambdaUpdate);
+  }
+
+  decompMatrix.distribute(decompMatrixLocal.data(), 0, 0);
+}
+
 void DBMatDMSDenseIChol::choleskyBackwardSolve(const sgpp::base::DataMatrix& decompMatrix,
                                                const sgpp::base::DataVector& y,
                                                sgpp::base::DataVector& alpha) const {
@@ -36,6 +36,15 @@ class DBMatDMSDenseIChol : public DBMatDMSChol {
    */
   void choleskyUpdateLambda(DataMatrix& decompMatrix, double lambdaUp) const override;
 
+  /**
+   * Parallel version of choleskyUpdateLambda. The incomplete factorization is computed from the
+   * local proxy matrix, hence the decomposition is gathered and updated on the master process.
+   * @param decompMatrix
+   * @param lambdaUp
+   */
+  void choleskyUpdateLambdaParallel(DataMatrixDistributed& decompMatrix,
+                                    double lambdaUp) const override;
+
   /**
    * Perform backward substitution solving the triangular system $A alpha = y$ with a parallel
    * Jaccobi solver.
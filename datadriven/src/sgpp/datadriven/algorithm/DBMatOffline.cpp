@@ -48,14 +48,19 @@ using sgpp::base::OperationMatrix;
 using sgpp::base::RegularGridConfiguration;
 
 DBMatOffline::DBMatOffline()
-     : lhsMatrix(), isConstructed(false), isDecomposed(false), lhsInverse(), interactions() {
-}
+     : lhsMatrix(),
+       isConstructed(false),
+       isDecomposed(false),
+       lhsInverse(),
+       isLocalDecompositionOutdated(false),
+       interactions() {}
 
 DBMatOffline::DBMatOffline(const DBMatOffline& rhs)
     : lhsMatrix(rhs.lhsMatrix),
       isConstructed(rhs.isConstructed),
       isDecomposed(rhs.isDecomposed),
       lhsInverse(rhs.lhsInverse),
+      isLocalDecompositionOutdated(rhs.isLocalDecompositionOutdated),
       interactions(rhs.interactions) {}
 
 DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs) {
@@ -66,12 +71,17 @@ DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs)
   isConstructed = rhs.isConstructed;
   isDecomposed = rhs.isDecomposed;
   lhsInverse = rhs.lhsInverse;
+  isLocalDecompositionOutdated = rhs.isLocalDecompositionOutdated;
   interactions = rhs.interactions;
   return *this;
 }
 
 DBMatOffline::DBMatOffline(const std::string& filepath)
-    : lhsMatrix(), isConstructed(true), isDecomposed(true), lhsInverse() {
+    : lhsMatrix(),
+      isConstructed(true),
+      isDecomposed(true),
+      lhsInverse(),
+      isLocalDecompositionOutdated(false) {
   // Parse the interactions
   parseInter(filepath, interactions);
 
@@ -79,11 +89,13 @@ DBMatOffline::DBMatOffline(const std::string& filepath)
 }
 
 DataMatrix& DBMatOffline::getDecomposedMatrix() {
-  if (isDecomposed) {
-    return lhsMatrix;
-  } else {
+  if (!isDecomposed) {
     throw data_exception("Matrix was not decomposed yet");
+  } else if (isLocalDecompositionOutdated) {
+    throw data_exception(
+        "Local decomposition is outdated, call syncLocalDecomposition() first");
   }
+  return lhsMatrix;
 }
 
 DataMatrix& DBMatOffline::getInverseMatrix() { return this->lhsInverse; }
@@ -116,6 +128,11 @@ DataMatrixDistributed& DBMatOffline::getDecomposedInverseDistributed() {
 void DBMatOffline::syncDistributedDecomposition(std::shared_ptr<BlacsProcessGrid> processGrid,
                                                 const ParallelConfiguration& parallelConfig) {
 #ifdef USE_SCALAPACK
+  if (isLocalDecompositionOutdated) {
+    throw data_exception(
+        "In DBMatOffline::syncDistributedDecomposition\nCan't sync, because the local "
+        "decomposition is outdated");
+  }
   if (isDecomposed) {
     lhsDistributed = DataMatrixDistributed::fromSharedData(
         lhsMatrix.data(), processGrid, lhsMatrix.getNrows(), lhsMatrix.getNcols(),
@@ -129,6 +146,16 @@ void DBMatOffline::syncDistributedDecomposition(std::shared_ptr<BlacsProcessGrid
   // no action needed without scalapack
 }
 
+void DBMatOffline::syncLocalDecomposition() {
+#ifdef USE_SCALAPACK
+  if (isLocalDecompositionOutdated) {
+    lhsMatrix = lhsDistributed.toLocalDataMatrixBroadcast();
+    isLocalDecompositionOutdated = false;
+  }
+#endif
+  // the local decomposition can only be outdated with scalapack
+}
+
 void DBMatOffline::syncDistributedInverse(std::shared_ptr<BlacsProcessGrid> processGrid,
                                           const ParallelConfiguration& parallelConfig) {
 #ifdef USE_SCALAPACK
@@ -169,6 +196,9 @@ void DBMatOffline::store(const std::string& fileName) {
 #ifdef USE_GSL
   if (!isDecomposed) {
     throw algorithm_exception("Matrix not decomposed yet");
+  } else if (isLocalDecompositionOutdated) {
+    throw algorithm_exception(
+        "Local decomposition is outdated, call syncLocalDecomposition() first");
   }
 
   // Write configuration
@@ -279,7 +309,14 @@ void sgpp::datadriven::DBMatOffline::parseInter(
   std::cout << interactions.size() << std::endl;
 }
 
-size_t DBMatOffline::getGridSize() { return lhsMatrix.getNrows(); }
+size_t DBMatOffline::getGridSize() {
+#ifdef USE_SCALAPACK
+  if (isLocalDecompositionOutdated) {
+    return lhsDistributed.getGlobalRows();
+  }
+#endif
+  return lhsMatrix.getNrows();
+}
 
 sgpp::base::DataMatrix& DBMatOffline::getLhsMatrix_ONLY_FOR_TESTING() { return this->lhsMatrix; }
 
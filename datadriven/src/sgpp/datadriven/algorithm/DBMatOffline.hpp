@@ -86,7 +86,8 @@ class DBMatOffline {
   virtual bool isRefineable() = 0;
 
   /**
-   * Get a reference to the decomposed matrix. Throws if matrix has not yet been decomposed.
+   * Get a reference to the decomposed matrix. Throws if matrix has not yet been decomposed or if
+   * the local decomposition is outdated, see syncLocalDecomposition().
    *
    * @return decomposed matrix
    */
@@ -150,7 +151,8 @@ class DBMatOffline {
   DataMatrixDistributed& getDecomposedInverseDistributed();
 
   /**
-   * Synchronizes the decomposed matrix.
+   * Synchronizes the decomposed matrix (local to distributed). Throws if the local decomposition
+   * is outdated, since this would overwrite the newer distributed one.
    * Override if more matrices have to be synched.
    * @param processGrid process grid to distribute the matrix on
    * @param parallelConfig
@@ -158,6 +160,15 @@ class DBMatOffline {
   virtual void syncDistributedDecomposition(std::shared_ptr<BlacsProcessGrid> processGrid,
                                             const ParallelConfiguration& parallelConfig);
 
+  /**
+   * Synchronizes the local decomposed matrix with the distributed one (distributed to local),
+   * which is needed after the distributed decomposition was modified in place, e.g. by
+   * DBMatOfflineChol::choleskyModificationParallel, before the local decomposition can be used
+   * again (serialization, local solves or modifications). Has to be called on all processes.
+   * Does nothing if the local decomposition is up to date.
+   */
+  void syncLocalDecomposition();
+
   /**
    * Synchronizes the inverse matrix
    * @param processGrid process grid to distribute the matrix on
@@ -227,13 +238,15 @@ class DBMatOffline {
                                         const ParallelConfiguration& parallelConfig);
 
   /**
-   * Serialize the DBMatOffline Object
+   * Serialize the DBMatOffline Object. Throws if the local decomposition is outdated, see
+   * syncLocalDecomposition().
    * @param fileName path where to store the file.
    */
   virtual void store(const std::string& fileName);
 
   /**
-   * Returns the dimensionality of the quadratic lhs matrix (i.e. the number of rows)
+   * Returns the dimensionality of the quadratic lhs matrix (i.e. the number of rows). Taken from
+   * the distributed decomposition if the local one is outdated.
    * @return the grid size
    */
   virtual size_t getGridSize();
@@ -250,6 +263,8 @@ class DBMatOffline {
   bool isConstructed;     // If the matrix was built
   bool isDecomposed;      // If the matrix was decomposed
   DataMatrix lhsInverse;  // stores the explicitly computed inverse (only in SMW case)
+  // If only the distributed decomposition is up to date, see syncLocalDecomposition()
+  bool isLocalDecompositionOutdated;
 
   // distributed lhs, only initialized in ScaLAPACK version
   DataMatrixDistributed lhsDistributed;
@@ -117,6 +117,7 @@ void DBMatOfflineChol::decomposeMatrixParallel(
   this->lhsDistributed.toLocalDataMatrixBroadcast(this->lhsMatrix);
 
   this->isDecomposed = true;
+  this->isLocalDecompositionOutdated = false;
 
   return;
 #endif /* USE_SCALAPACK */
@@ -128,6 +129,10 @@ void DBMatOfflineChol::compute_inverse() {
     throw sgpp::base::algorithm_exception(
         "in DBMatOfflineChol::compute_inverse:\noffline matrix not decomposed "
         "yet.\n");
+  } else if (isLocalDecompositionOutdated) {
+    throw sgpp::base::algorithm_exception(
+        "in DBMatOfflineChol::compute_inverse:\nlocal decomposition is outdated, "
+        "call syncLocalDecomposition() first.\n");
   }
   // initialize lhsInverse
   this->lhsInverse =
@@ -156,6 +161,10 @@ void DBMatOfflineChol::compute_inverse_parallel(
     throw sgpp::base::algorithm_exception(
         "in DBMatOfflineChol::compute_inverse_parallel:\noffline matrix not "
         "decomposed yet.\n");
+  } else if (isLocalDecompositionOutdated) {
+    throw sgpp::base::algorithm_exception(
+        "in DBMatOfflineChol::compute_inverse_parallel:\nlocal decomposition is "
+        "outdated, call syncLocalDecomposition() first.\n");
   }
   size_t n = this->lhsMatrix.getNrows();
 
@@ -197,7 +206,10 @@ void DBMatOfflineChol::choleskyModification(
     Grid& grid, datadriven::DensityEstimationConfiguration&, size_t newPoints,
     std::vector<size_t>& deletedPoints, double lambda) {
 #ifdef USE_GSL
-
+  if (isLocalDecompositionOutdated) {
+    throw algorithm_exception(
+        "Local decomposition is outdated, call syncLocalDecomposition() first!");
+  }
   // Start coarsening
   // If list 'deletedPoints' is not empty, grid points got removed
   if (deletedPoints.size() > 0) {
@@ -305,6 +317,55 @@ void DBMatOfflineChol::choleskyModification(
 #endif /*USE_GSL*/
 }
 
+void DBMatOfflineChol::choleskyModificationParallel(
+    Grid& grid, datadriven::DensityEstimationConfiguration&, size_t newPoints,
+    std::vector<size_t>& deletedPoints, double lambda,
+    std::shared_ptr<BlacsProcessGrid> processGrid,
+    const ParallelConfiguration& parallelConfig) {
+#ifdef USE_SCALAPACK
+  if (!isDecomposed) {
+    throw algorithm_exception("Matrix was not decomposed, yet!");
+  }
+
+  // Start coarsening
+  if (deletedPoints.size() > 0) {
+    DataMatrixDistributed::choleskyRemoveRowsColumns(lhsDistributed,
+                                                     deletedPoints);
+  }
+
+  // Start refinement
+  if (newPoints > 0) {
+    size_t gridSize = grid.getStorage().getSize();
+
+    // DataMatrix to collect vectors to append, computed on every process
+    DataMatrix mat_refine(gridSize, newPoints);
+
+    this->compute_L2_refine_vectors(&mat_refine, &grid, newPoints);
+
+    // add lambda to diagonal elements
+    for (size_t i = gridSize - newPoints; i < gridSize; i++) {
+      double res = mat_refine.get(i, i - gridSize + newPoints);
+      mat_refine.set(i, i - gridSize + newPoints, res + lambda);
+    }
+
+    // the new rows are available on every process, distribute them without
+    // network transfers
+    mat_refine.transpose();
+    DataMatrixDistributed newRows = DataMatrixDistributed::fromSharedData(
+        mat_refine.data(), processGrid, newPoints, gridSize,
+        parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
+
+    DataMatrixDistributed::choleskyAddRowsColumns(lhsDistributed, newRows);
+  }
+
+  // the factor is not gathered here, as the distributed version does not need the local one,
+  // it is only synchronized on demand by syncLocalDecomposition()
+  isLocalDecompositionOutdated = true;
+#else
+  throw algorithm_exception("built without ScaLAPACK");
+#endif /* USE_SCALAPACK */
+}
+
 void DBMatOfflineChol::choleskyAddPoint(DataVector& newCol, size_t size) {
 #ifdef USE_GSL
   if (!isDecomposed) {
@@ -123,6 +123,27 @@ class DBMatOfflineChol : public DBMatOfflineGE {
       datadriven::DensityEstimationConfiguration& densityEstimationConfig,
       size_t newPoints, std::vector<size_t>& deletedPoints, double lambda);
 
+  /**
+   * Parallel (distributed) version of choleskyModification. The distributed cholesky
+   * factorization is modified directly on the block-cyclic data of all processes, without
+   * gathering it on a master process. The local decomposed matrix is not updated and marked as
+   * outdated, call syncLocalDecomposition() before using it again.
+   *
+   * @param grid the underlying grid
+   * @param densityEstimationConfig configuration for the density estimation
+   * @param newPoints amount of refined points
+   * @param deletedPoints list of indices of last coarsed points
+   * @param lambda the regularization parameter
+   * @param processGrid process grid the factorization is distributed on
+   * @param parallelConfig
+   */
+  virtual void choleskyModificationParallel(
+      Grid& grid,
+      datadriven::DensityEstimationConfiguration& densityEstimationConfig,
+      size_t newPoints, std::vector<size_t>& deletedPoints, double lambda,
+      std::shared_ptr<BlacsProcessGrid> processGrid,
+      const ParallelConfiguration& parallelConfig);
+
   /*
    * explicitly computes the inverse
    * note: the computed inverse is not the inverse of the decomposed matrix,
@@ -201,10 +201,9 @@ void DBMatOnlineDE::computeDensityFunctionParallel(
     // not needed in the
     // local version
     bSaveDistributed = std::make_unique<DataVectorDistributed>(
-        processGrid, offlineObject.getDecomposedMatrix().getNcols(),
-        parallelConfig.rowBlockSize_);
+        processGrid, offlineObject.getGridSize(), parallelConfig.rowBlockSize_);
     bTotalPointsDistributed = std::make_unique<DataVectorDistributed>(
-        processGrid, offlineObject.getDecomposedMatrix().getNcols(),
+        processGrid, offlineObject.getGridSize(),
         parallelConfig.rowBlockSize_);
 
     distributedVectorsInitialized = true;
@@ -311,7 +310,9 @@ DataVectorDistributed DBMatOnlineDE::computeBFromBatchParallel(
     const ParallelConfiguration& parallelConfig,
     std::shared_ptr<BlacsProcessGrid> processGrid) {
   if (m.getNrows() > 0) {
-    DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
+    // the local decomposition may be outdated after distributed modifications, its size is still
+    // known to the offline object
+    size_t lhsSize = offlineObject.getGridSize();
 
     // in case OrthoAdapt, the current size is not lhs size, but B size
     bool use_B_size = false;
@@ -345,7 +346,7 @@ DataVectorDistributed DBMatOnlineDE::computeBFromBatchParallel(
     // Compute right hand side of the equation:
     size_t numberOfPoints = m.getNrows();
 
-    size_t bSize = use_B_size ? B_size : lhsMatrix.getNcols();
+    size_t bSize = use_B_size ? B_size : lhsSize;
 
     DataVectorDistributed b(processGrid, bSize, parallelConfig.rowBlockSize_);
 
@@ -99,5 +99,20 @@ std::vector<size_t> DBMatOnlineDEChol::updateSystemMatrixDecomposition(
   return return_vector;
 }
 
+std::vector<size_t> DBMatOnlineDEChol::updateSystemMatrixDecompositionParallel(
+    DensityEstimationConfiguration& densityEstimationConfig, Grid& grid,
+    size_t numAddedGridPoints, std::vector<size_t>& deletedGridPointIndices,
+    double lambda, std::shared_ptr<BlacsProcessGrid> processGrid,
+    const ParallelConfiguration& parallelConfig) {
+  DBMatOffline* offlineObject = &getOfflineObject();
+  dynamic_cast<DBMatOfflineChol*>(offlineObject)
+      ->choleskyModificationParallel(grid, densityEstimationConfig,
+                                     numAddedGridPoints,
+                                     deletedGridPointIndices, lambda,
+                                     processGrid, parallelConfig);
+  std::vector<size_t> return_vector = {};
+  return return_vector;
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
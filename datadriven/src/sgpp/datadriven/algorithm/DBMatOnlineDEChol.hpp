@@ -52,6 +52,27 @@ class DBMatOnlineDEChol : public DBMatOnlineDE {
       size_t numAddedGridPoints, std::vector<size_t>& deletedGridPointIndices,
       double lambda) override;
 
+  /**
+   * Parallel/Distributed version of updateSystemMatrixDecomposition, delegates
+   * call to choleskyModificationParallel. Only the distributed decomposition is
+   * updated, the local one is outdated afterwards and must not be synchronized
+   * to the distributed one, see DBMatOffline::syncLocalDecomposition().
+   * @param densityEstimationConfig Configuration to the density estimation
+   * @param grid the underlying grid
+   * @param numAddedGridPoints Number of grid points inserted at the end of the
+   * grid storage
+   * @param deletedGridPointIndices Indices of grid points that were deleted
+   * @param lambda The last best lambda value
+   * @param processGrid process grid the decomposition is distributed on
+   * @param parallelConfig
+   * @return list of grid points, that cannot be coarsened
+   */
+  std::vector<size_t> updateSystemMatrixDecompositionParallel(
+      DensityEstimationConfiguration& densityEstimationConfig, Grid& grid,
+      size_t numAddedGridPoints, std::vector<size_t>& deletedGridPointIndices,
+      double lambda, std::shared_ptr<BlacsProcessGrid> processGrid,
+      const ParallelConfiguration& parallelConfig);
+
  protected:
   void solveSLE(DataVector& alpha, DataVector& b, Grid& grid,
                 DensityEstimationConfiguration& densityEstimationConfig,
@@ -14,10 +14,19 @@ namespace sgpp {
 namespace datadriven {
 
 DMSystemMatrix::DMSystemMatrix(sgpp::base::Grid& grid, sgpp::base::DataMatrix& trainData,
-                               std::shared_ptr<base::OperationMatrix> C, double lambdaRegression)
-    : DMSystemMatrixBase(trainData, lambdaRegression), grid(grid), C(std::move(C)) {
+                               std::shared_ptr<base::OperationMatrix> C, double lambdaRegression,
+                               size_t designMatrixMemoryBudget)
+    : DMSystemMatrixBase(trainData, lambdaRegression),
+      grid(grid),
+      C(std::move(C)),
+      reuseB(designMatrixMemoryBudget > 0) {
   // this->B = sgpp::op_factory::createOperationMultiEval(grid);
-  this->B.reset(sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+  if (reuseB) {
+    this->B.reset(sgpp::op_factory::createOperationMultipleEvalCached(grid, this->dataset_,
+                                                                      designMatrixMemoryBudget));
+  } else {
+    this->B.reset(sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+  }
 }
 
 DMSystemMatrix::~DMSystemMatrix() {}
@@ -33,11 +42,16 @@ void DMSystemMatrix::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector&
 
   // this->B->mult(alpha, temp);
 
-  std::unique_ptr<base::OperationMultipleEval> op(
-      sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
-  sgpp::base::DataVector temp2(this->dataset_.getNrows());
-  // op->mult(*(this->dataset_), alpha, temp2);
-  op->mult(alpha, temp);
+  if (reuseB) {
+    // the cached data matrix is recorded again after changes of the grid, see prepareGrid
+    this->B->mult(alpha, temp);
+    this->B->multTranspose(temp, result);
+  } else {
+    std::unique_ptr<base::OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+    op->mult(alpha, temp);
+    op->multTranspose(temp, result);
+  }
 
   /*if (temp.getSize() != temp2.getSize()) {
    std::cout << "error: sizes don't match" << std::endl;
@@ -66,7 +80,6 @@ void DMSystemMatrix::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector&
   //          }
   //        }
   //      }
-  op->multTranspose(temp, result);
 
   sgpp::base::DataVector temptwo(alpha.getSize());
   this->C->mult(alpha, temptwo);
@@ -77,10 +90,16 @@ void DMSystemMatrix::generateb(sgpp::base::DataVector& classes, sgpp::base::Data
   // this->B->multTranspose((*this->dataset_), classes, b);
   // this->B->multTranspose(classes, b);
 
-  std::unique_ptr<base::OperationMultipleEval> op(
-      sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
-  op->multTranspose(classes, b);
+  if (reuseB) {
+    this->B->multTranspose(classes, b);
+  } else {
+    std::unique_ptr<base::OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(grid, this->dataset_));
+    op->multTranspose(classes, b);
+  }
 }
 
+void DMSystemMatrix::prepareGrid() { this->B->prepare(); }
+
 }  // namespace datadriven
 }  // namespace sgpp
@@ -32,6 +32,8 @@ class DMSystemMatrix : public DMSystemMatrixBase {
   std::shared_ptr<base::OperationMatrix> C;
   /// OperationB for calculating the data matrix
   std::unique_ptr<base::OperationMultipleEval> B;
+  /// whether B caches the data matrix and is reused in all products
+  bool reuseB;
 
  public:
   /**
@@ -41,9 +43,13 @@ class DMSystemMatrix : public DMSystemMatrixBase {
    * @param trainData reference to base::DataVector that contains the training data
    * @param C the regression functional
    * @param lambdaRegression the lambda, the regression parameter
+   * @param designMatrixMemoryBudget if not 0, the data matrix is recorded once in a sparse matrix
+   * of at most this many bytes and reused in all iterations of the solver (only for linear,
+   * linear boundary and modified linear grids)
    */
   DMSystemMatrix(base::Grid& grid, base::DataMatrix& trainData,
-                 std::shared_ptr<base::OperationMatrix> C, double lambdaRegression);
+                 std::shared_ptr<base::OperationMatrix> C, double lambdaRegression,
+                 size_t designMatrixMemoryBudget = 0);
 
   /**
    * Std-Destructor
@@ -60,6 +66,11 @@ class DMSystemMatrix : public DMSystemMatrixBase {
    *   multiplication on the rhs
    */
   virtual void generateb(base::DataVector& classes, base::DataVector& b);
+
+  /**
+   * Drops the cached data matrix, it is recorded again for the changed grid
+   */
+  virtual void prepareGrid();
 };
 
 }  // namespace datadriven
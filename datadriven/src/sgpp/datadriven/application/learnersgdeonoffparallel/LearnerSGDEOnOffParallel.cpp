@@ -17,6 +17,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOnlineDEFactory.hpp>
 #include <sgpp/datadriven/algorithm/GridFactory.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorConvergence.hpp>
+#include <sgpp/datadriven/algorithm/RefinementMonitorPeriodic.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/MPIMethods.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/MPITaskScheduler.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/RefinementHandler.hpp>
@@ -25,9 +26,11 @@
 #include <sgpp/datadriven/functors/classification/ZeroCrossingRefinementFunctor.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <algorithm>
 #include <climits>
 #include <list>
 #include <map>
+#include <memory>
 #include <numeric>
 #include <set>
 #include <string>
@@ -111,6 +114,7 @@ LearnerSGDEOnOffParallel::LearnerSGDEOnOffParallel(
 
   localGridVersions.insert(localGridVersions.begin(), numClasses,
                            MINIMUM_CONSISTENT_GRID_VERSION);
+  pendingGridVersions.insert(pendingGridVersions.begin(), numClasses, 0);
   mpiTaskScheduler.setLearnerInstance(this);
   workerActive = true;
 
@@ -206,10 +210,13 @@ double LearnerSGDEOnOffParallel::getError(Dataset &dataset) const {
   return res;
 }
 
-void LearnerSGDEOnOffParallel::updateAlpha(size_t classIndex,
-                                           std::list<size_t> *deletedPoints,
-                                           size_t newPoints) {
-  DataVector &alpha = *(alphas[classIndex]);
+/**
+ * Removes the deleted grid points from an alpha vector and appends zeros for
+ * the new grid points
+ */
+static void applyRefinementToAlpha(DataVector &alpha,
+                                   const std::list<size_t> *deletedPoints,
+                                   size_t newPoints) {
   if (alpha.getSize() != 0 && deletedPoints != nullptr &&
       !deletedPoints->empty()) {
     std::vector<size_t> vecDeletedPoints{std::begin(*deletedPoints),
@@ -221,6 +228,12 @@ void LearnerSGDEOnOffParallel::updateAlpha(size_t classIndex,
   }
 }
 
+void LearnerSGDEOnOffParallel::updateAlpha(size_t classIndex,
+                                           std::list<size_t> *deletedPoints,
+                                           size_t newPoints) {
+  applyRefinementToAlpha(*(alphas[classIndex]), deletedPoints, newPoints);
+}
+
 void LearnerSGDEOnOffParallel::trainParallel(
     size_t batchSize, size_t maxDataPasses, std::string refinementFunctorType,
     std::string refMonitor, size_t refPeriod, double accDeclineThreshold,
@@ -252,9 +265,14 @@ void LearnerSGDEOnOffParallel::trainParallel(
   // initialize refinement variables
   double currentValidError = 0.0;
   double currentTrainError = 0.0;
-  // create convergence monitor object
-  RefinementMonitorConvergence monitor{accDeclineThreshold,
-                                       accDeclineBufferSize, minRefInterval};
+  // create monitor object
+  std::unique_ptr<RefinementMonitor> monitor;
+  if (refMonitor == "periodic") {
+    monitor.reset(new RefinementMonitorPeriodic(refPeriod));
+  } else {
+    monitor.reset(new RefinementMonitorConvergence(
+        accDeclineThreshold, accDeclineBufferSize, minRefInterval));
+  }
 
   // counts number of performed refinements
   size_t numberOfCompletedRefinements = 0;
@@ -294,7 +312,7 @@ void LearnerSGDEOnOffParallel::trainParallel(
       // check if refinement should be performed
       size_t refinementsNecessary = refinementHandler.checkRefinementNecessary(
           refMonitor, refPeriod, batchSize, currentValidError,
-          currentTrainError, numberOfCompletedRefinements, monitor,
+          currentTrainError, numberOfCompletedRefinements, *monitor,
           adaptivityConfig);
       while (refinementsNecessary > 0) {
         while (!refinementHandler.checkReadyForRefinement()) {
@@ -313,7 +331,7 @@ void LearnerSGDEOnOffParallel::trainParallel(
         mpiTaskScheduler.onRefinementStarted();
 
         doRefinementForAll(refinementFunctorType, refMonitor, onlineObjects,
-                           monitor);
+                           *monitor);
         numberOfCompletedRefinements += 1;
         refinementsNecessary--;
         D(std::cout << "Refinement at " << processedPoints << " complete"
@@ -342,6 +360,14 @@ void LearnerSGDEOnOffParallel::trainParallel(
     processedPoints = 0;
   }  // end while
 
+  // Wait for the last batches and system matrix decompositions
+  while (mpiTaskScheduler.hasOutstandingTasks() ||
+         !checkAllRefinementsCompleted()) {
+    D(std::cout << "Waiting for outstanding batches before shutdown"
+                << std::endl;)
+    MPIMethods::waitForAnyMPIRequestsToComplete();
+  }
+
   shutdownMPINodes();
 
   std::cout << "#Training finished (This is MASTER)" << std::endl;
@@ -430,48 +456,24 @@ void LearnerSGDEOnOffParallel::doRefinementForAll(
         classIndex, adaptivityConfig);
   }
 
-  // Wait for all new system matrix decompositions to come back
-  CHECK_SIZE_T_TO_INT(getNumClasses())
-  MPIMethods::waitForIncomingMessageType(
-      UPDATE_GRID, static_cast<int>(getNumClasses()),
-      [](PendingMPIRequest &request) {
-        auto *refinementResultNetworkMessage =
-            static_cast<RefinementResultNetworkMessage *>(
-                static_cast<void *>(request.buffer->payload));
-        // Ensure it is a system matrix packet and the last in the sequence
-        D(std::cout << "Test packet grid version "
-                    << refinementResultNetworkMessage->gridversion
-                    << ", update type "
-                    << refinementResultNetworkMessage->updateType << std::endl;)
-        return isVersionConsistent(
-                   refinementResultNetworkMessage->gridversion) &&
-               refinementResultNetworkMessage->updateType ==
-                   SYSTEM_MATRIX_DECOMPOSITION;
-      });
+  // The new system matrix decompositions are received asynchronously, workers
+  // continue training on the old grids in the meantime
 }
 
 void LearnerSGDEOnOffParallel::computeNewSystemMatrixDecomposition(
     size_t classIndex, size_t gridVersion) {
-  // The first check is to ensure that all segments of an update have been
-  // received
-  // (intermediate segments set grid version to TEMPORARILY_INCONSISTENT)
-  RefinementResult &refinementResult =
-      refinementHandler.getRefinementResult(classIndex);
-  while (getLocalGridVersion(classIndex) != GRID_RECEIVED_ADDED_POINTS ||
-         (refinementResult.deletedGridPointsIndices.empty() &&
-          refinementResult.addedGridPoints.empty())) {
+  // Wait until the refinement results of this grid version have been received
+  while (getPendingGridVersion(classIndex) != gridVersion) {
     D(std::cout << "Refinement results have not arrived yet (grid version "
-                << getLocalGridVersion(classIndex) << ", additions "
-                << refinementResult.addedGridPoints.size() << ", deletions "
-                << refinementResult.deletedGridPointsIndices.size()
-                << "). Waiting..." << std::endl;)
-    // Do not use waitForConsistent here, we want GRID_ADDITIONS or
-    // GRID_DELETIONS, not consistency
-
+                << getLocalGridVersion(classIndex) << ", pending version "
+                << getPendingGridVersion(classIndex) << "). Waiting..."
+                << std::endl;)
     MPIMethods::waitForIncomingMessageType(UPDATE_GRID);
     D(std::cout << "Updates have arrived. Attempting to resume." << std::endl;)
   }
 
+  RefinementResult &refinementResult =
+      refinementHandler.getRefinementResult(classIndex);
   std::cout << "Computing system matrix modification for class " << classIndex
             << "(+" << refinementResult.addedGridPoints.size() << ", -"
             << refinementResult.deletedGridPointsIndices.size() << ")"
@@ -483,10 +485,12 @@ void LearnerSGDEOnOffParallel::computeNewSystemMatrixDecomposition(
   std::vector<size_t> idxToDelete{
       std::begin(refinementResult.deletedGridPointsIndices),
       std::end(refinementResult.deletedGridPointsIndices)};
+  size_t numberOfNewPoints = refinementResult.addedGridPoints.size();
+  applyPendingRefinement(classIndex);
+
   densEst->updateSystemMatrixDecomposition(
-      densityEstimationConfig, *(grids[classIndex]),
-      refinementResult.addedGridPoints.size(), idxToDelete,
-      regularizationConfig.lambda_);
+      densityEstimationConfig, *(grids[classIndex]), numberOfNewPoints,
+      idxToDelete, regularizationConfig.lambda_);
 
   setLocalGridVersion(classIndex, gridVersion);
   D(std::cout << "Send system matrix update to master for class " << classIndex
@@ -589,20 +593,13 @@ void LearnerSGDEOnOffParallel::train(
 
     if ((*p.first).getNrows() > 0) {
       // update density function for current class
-      RefinementResult &classRefinementResult =
-          refinementHandler.getRefinementResult(classIndex);
+      // (pending refinement results are kept until the grid is updated)
       std::cout << "Calling compute density function class " << classIndex
-                << " (refinement +"
-                << classRefinementResult.addedGridPoints.size() << ", -"
-                << classRefinementResult.deletedGridPointsIndices.size() << ")"
+                << " (grid version " << getLocalGridVersion(classIndex) << ")"
                 << std::endl;
       densityFunctions[classIndex].first->computeDensityFunction(
           *(alphas[classIndex]), *p.first, *(grids[classIndex]),
           densityEstimationConfig, true, doCrossValidation);
-      D(std::cout << "Clearing the refinement results class " << classIndex
-                  << std::endl;)
-      classRefinementResult.deletedGridPointsIndices.clear();
-      classRefinementResult.addedGridPoints.clear();
 
       if (usePrior) {
         double newPrior =
@@ -636,12 +633,15 @@ void LearnerSGDEOnOffParallel::shutdownMPINodes() {
 }
 
 void LearnerSGDEOnOffParallel::workBatch(Dataset dataset, size_t batchOffset,
+                                         size_t assignedGridVersion,
+                                         size_t minimumGridVersion,
                                          bool doCrossValidation) {
-  waitForAllGridsConsistent();
+  waitForAllGridsConsistent(minimumGridVersion);
 
   // assemble next batch
   std::cout << "Learning with batch of size " << dataset.getNumberInstances()
             << " at offset " << batchOffset << std::endl;
+  size_t assignedBatchOffset = batchOffset;
   assembleNextBatchData(&dataset, &batchOffset);
   D(std::cout << "Batch of size " << dataset.getNumberInstances()
               << " assembled, starting with training." << std::endl;)
@@ -658,7 +658,8 @@ void LearnerSGDEOnOffParallel::workBatch(Dataset dataset, size_t batchOffset,
                 << std::endl;)
     DataVector alphaVector = *(alphas[classIndex]);
     MPIMethods::sendMergeGridNetworkMessage(
-        classIndex, batchOffset, dataset.getNumberInstances(), alphaVector);
+        classIndex, assignedBatchOffset, dataset.getNumberInstances(),
+        assignedGridVersion, alphaVector);
 
     D(DataVector &dataVector =
           getDensityFunctions()[classIndex].first->getAlpha();
@@ -671,16 +672,18 @@ void LearnerSGDEOnOffParallel::workBatch(Dataset dataset, size_t batchOffset,
               << " requested by master." << std::endl;)
 }
 
-void LearnerSGDEOnOffParallel::waitForAllGridsConsistent() {
+void LearnerSGDEOnOffParallel::waitForAllGridsConsistent(
+    size_t minimumGridVersion) {
   size_t classIndex = 0;
   while (classIndex < localGridVersions.size()) {
-    // We need to wait if the grid is not consistent or when there are differing
-    // grid versions
+    // We need to wait if the grid is not consistent, too old or when there are
+    // differing grid versions
     if (!checkGridStateConsistent(classIndex) ||
+        getLocalGridVersion(classIndex) < minimumGridVersion ||
         getLocalGridVersion(classIndex) != getLocalGridVersion(0)) {
       std::cout << "Attempted to train from an inconsistent grid " << classIndex
                 << " version " << getLocalGridVersion(classIndex) << std::endl;
-      MPIMethods::waitForGridConsistent(classIndex);
+      MPIMethods::waitForIncomingMessageType(UPDATE_GRID);
       // start over, waiting might have changed other grids
       classIndex = 0;
     } else {
@@ -695,6 +698,12 @@ bool LearnerSGDEOnOffParallel::isVersionConsistent(size_t version) {
 
 size_t LearnerSGDEOnOffParallel::assignBatchToWorker(size_t batchOffset,
                                                      bool doCrossValidation) {
+  while (!mpiTaskScheduler.isWorkerAvailable()) {
+    D(std::cout << "No worker available, waiting for merge requests"
+                << std::endl;)
+    MPIMethods::waitForAnyMPIRequestsToComplete();
+  }
+
   AssignTaskResult assignTaskResult{};
   mpiTaskScheduler.assignTaskVariableTaskSize(TRAIN_FROM_BATCH,
                                               assignTaskResult);
@@ -708,14 +717,24 @@ size_t LearnerSGDEOnOffParallel::assignBatchToWorker(size_t batchOffset,
   std::cout << "Assigning batch " << batchOffset << " to worker "
             << assignTaskResult.workerID << " with size "
             << assignTaskResult.taskSize << std::endl;
+  // While a refinement is pending, the batch may still be trained on the
+  // previous grid, the master updates the alpha vector when merging
+  size_t assignedGridVersion = getLocalGridVersion(0);
+  size_t minimumGridVersion = checkAllRefinementsCompleted()
+                                  ? assignedGridVersion
+                                  : assignedGridVersion - 1;
+
+  mpiTaskScheduler.onTaskAssigned(assignTaskResult.workerID, batchOffset,
+                                  assignTaskResult.taskSize);
   MPIMethods::assignBatch(assignTaskResult.workerID, batchOffset,
-                          assignTaskResult.taskSize, doCrossValidation);
+                          assignTaskResult.taskSize, assignedGridVersion,
+                          minimumGridVersion, doCrossValidation);
   return assignTaskResult.taskSize;
 }
 
 void LearnerSGDEOnOffParallel::mergeAlphaValues(
-    size_t classIndex, size_t remoteGridVersion, DataVector dataVector,
-    size_t batchOffset, size_t batchSize, bool isLastPacketInSeries) {
+    size_t classIndex, size_t remoteGridVersion, size_t assignedGridVersion,
+    DataVector dataVector, size_t batchOffset, size_t batchSize, int workerID) {
   MPIMethods::waitForGridConsistent(classIndex);
 
   D(std::cout << "Remote alpha sum " << classIndex << " is "
@@ -731,70 +750,38 @@ void LearnerSGDEOnOffParallel::mergeAlphaValues(
   }
 
   size_t localGridVersion = getLocalGridVersion(classIndex);
-  if (isLastPacketInSeries) {
-    mpiTaskScheduler.onMergeRequestIncoming(
-        batchOffset, batchSize, remoteGridVersion, localGridVersion);
-  }
-
-  if (remoteGridVersion != localGridVersion) {
-    D(std::cout << "Received merge grid request with incorrect grid version!"
-                << " local: " << localGridVersion
-                << ", remote: " << remoteGridVersion << std::endl;)
-    if (remoteGridVersion + 1 == localGridVersion) {
-      RefinementResult &refinementResult =
-          refinementHandler.getRefinementResult(classIndex);
-      std::list<size_t> &deletedPoints =
-          refinementResult.deletedGridPointsIndices;
-      std::list<LevelIndexVector> &addedPoints =
-          refinementResult.addedGridPoints;
-
-      D(std::cout << "Attempting to automatically compensate for outdated grid."
-                  << std::endl
-                  << "Refinement result has " << addedPoints.size()
-                  << " additions and " << deletedPoints.size() << " deletions"
-                  << std::endl
-                  << "The original remote size is " << dataVector.size()
-                  << std::endl;)
-      if (!deletedPoints.empty() || !addedPoints.empty()) {
-        D(std::cout << "Found necessary refinement data" << std::endl;)
+  mpiTaskScheduler.onMergeRequestIncoming(workerID, batchOffset, batchSize,
+                                          assignedGridVersion,
+                                          localGridVersion);
+
+  if (remoteGridVersion > localGridVersion) {
+    std::cout << "Received merge request with newer grid " << classIndex
+              << " version " << remoteGridVersion << " (local "
+              << localGridVersion << ")" << std::endl;
+    throw algorithm_exception("Received a merge request from a newer grid");
+  }
 
-        // See DBMatOnlineDe::updateAlpha()
-        if (!deletedPoints.empty()) {
-          D(std::cout << "Copying vector (deleting deleted grid points)."
-                      << std::endl;)
-          DataVector newAlpha(dataVector.getSize() - deletedPoints.size() +
-                              addedPoints.size());
-          for (size_t i = 0; i < dataVector.getSize(); i++) {
-            if (std::find(deletedPoints.begin(), deletedPoints.end(), i) !=
-                deletedPoints.end()) {
-              continue;
-            }
-
-            newAlpha.append(dataVector.get(i));
-          }
-          // set new alpha
-          dataVector = newAlpha;
-        }
-        dataVector.resizeZero(dataVector.size() + addedPoints.size());
-        D(std::cout << "New alpha vector is now " << dataVector.size()
-                    << " elements long." << std::endl;)
-      } else {
-        std::cout
-            << "Refinement data has already been deleted." << std::endl
-            << "This is probably because the master is training from batches. "
-            << std::endl
-            << "Cannot compensate, will now fail." << std::endl;
-        throw sgpp::base::algorithm_exception(
-            "Missing refinement data for alpha update.");
-      }
-    } else {
+  // Update the alpha vector with the refinements it was not trained on
+  for (size_t version = remoteGridVersion + 1; version <= localGridVersion;
+       version++) {
+    const RefinementResult *refinementResult =
+        refinementHandler.getRefinementResultForVersion(classIndex, version);
+    if (refinementResult == nullptr) {
       std::cout << "Merge request " << batchOffset << ", size " << batchSize
-                << ", older than one refinement cycle. Increase the refinement "
-                   "period."
-                << std::endl;
+                << ", version " << remoteGridVersion
+                << " is older than the stored refinement cycles." << std::endl;
       throw sgpp::base::algorithm_exception(
-          "Merge request older than one refinement cycle.");
+          "Missing refinement data for alpha update.");
     }
+
+    D(std::cout << "Compensating outdated alpha vector for grid version "
+                << version << " (" << refinementResult->addedGridPoints.size()
+                << " additions, "
+                << refinementResult->deletedGridPointsIndices.size()
+                << " deletions)" << std::endl;)
+    applyRefinementToAlpha(dataVector,
+                           &(refinementResult->deletedGridPointsIndices),
+                           refinementResult->addedGridPoints.size());
   }
 
   DataVector &localAlpha = *(alphas[classIndex]);
@@ -828,6 +815,32 @@ size_t LearnerSGDEOnOffParallel::getLocalGridVersion(size_t classIndex) {
   return localGridVersions[classIndex];
 }
 
+size_t LearnerSGDEOnOffParallel::getPendingGridVersion(size_t classIndex) {
+  return pendingGridVersions[classIndex];
+}
+
+void LearnerSGDEOnOffParallel::setPendingGridVersion(size_t classIndex,
+                                                     size_t gridVersion) {
+  pendingGridVersions[classIndex] = gridVersion;
+}
+
+bool LearnerSGDEOnOffParallel::checkAllRefinementsCompleted() {
+  return std::all_of(pendingGridVersions.begin(), pendingGridVersions.end(),
+                     [](size_t version) { return version == 0; });
+}
+
+void LearnerSGDEOnOffParallel::applyPendingRefinement(size_t classIndex) {
+  RefinementResult &refinementResult =
+      refinementHandler.getRefinementResult(classIndex);
+  refinementHandler.updateClassVariablesAfterRefinement(
+      classIndex, &refinementResult, densityFunctions[classIndex].first.get(),
+      *(grids[classIndex]));
+
+  refinementResult.deletedGridPointsIndices.clear();
+  refinementResult.addedGridPoints.clear();
+  setPendingGridVersion(classIndex, 0);
+}
+
 bool LearnerSGDEOnOffParallel::checkAllGridsConsistent() {
   return std::all_of(
       localGridVersions.begin(), localGridVersions.end(),
@@ -131,34 +131,42 @@ class LearnerSGDEOnOffParallel {
   void assembleNextBatchData(Dataset *dataBatch, size_t *batchOffset) const;
 
   /**
-   * Train from a batch. Will wait until all grids are consistent, fill the
-   * dataset,
+   * Train from a batch. Will wait until all grids are consistent and have at
+   * least the minimum grid version, fill the dataset,
    * learn from the dataset and send the new alpha vector to the master
    *
    * @param dataset An empty dataset with size and dimension set.
    * @param batchOffset The offset from the start of the training set to
    * assemble the batch from.
+   * @param assignedGridVersion The grid version of the master when the batch
+   * was assigned
+   * @param minimumGridVersion The oldest grid version the batch may be trained
+   * on
    * @param doCrossValidation Whether to cross validate results.
    */
-  void workBatch(Dataset dataset, size_t batchOffset, bool doCrossValidation);
+  void workBatch(Dataset dataset, size_t batchOffset,
+                 size_t assignedGridVersion, size_t minimumGridVersion,
+                 bool doCrossValidation);
 
   /**
    * Merge alpha values received from a remote process into the local alpha
-   * vector.
+   * vector. Alpha vectors of older grids are updated with the stored
+   * refinement results first.
    *
    * @param classIndex The class to which the alpha vector belongs
    * @param remoteGridVersion The remote grid version this alpha vector was
    * trained on
+   * @param assignedGridVersion The grid version of the master when the batch
+   * was assigned
    * @param dataVector The alpha vector itself
    * @param batchOffset The offset from the start of the training set this
    * vector was trained from
    * @param batchSize The size of the batch this vector was trained from
-   * @param isLastPacketInSeries Whether this merge is the last merge in several
-   * for the same class and batch
+   * @param workerID The MPI rank of the worker that sent this vector
    */
   void mergeAlphaValues(size_t classIndex, size_t remoteGridVersion,
-                        DataVector dataVector, size_t batchOffset,
-                        size_t batchSize, bool isLastPacketInSeries);
+                        size_t assignedGridVersion, DataVector dataVector,
+                        size_t batchOffset, size_t batchSize, int workerID);
 
   /**
    * Returns the internally stored current version of the grid
@@ -176,9 +184,46 @@ class LearnerSGDEOnOffParallel {
    */
   void setLocalGridVersion(size_t classIndex, size_t gridVersion);
 
+  /**
+   * Returns the grid version of a refinement that has been started but not
+   * completed yet. On master the refinement completes when the new system
+   * matrix decomposition is received, on workers when it is applied to the
+   * grid.
+   *
+   * @param classIndex The class of the grid to search for
+   * @return The grid version after the pending refinement or 0 if there is none
+   */
+  size_t getPendingGridVersion(size_t classIndex);
+
+  /**
+   * Set the grid version of a pending refinement
+   *
+   * @param classIndex The class of the grid to search for
+   * @param gridVersion The grid version after the pending refinement or 0 if
+   * the refinement has been completed
+   */
+  void setPendingGridVersion(size_t classIndex, size_t gridVersion);
+
+  /**
+   * Check whether there are no pending refinements for any class.
+   *
+   * @return Whether all refinements are completed
+   */
+  bool checkAllRefinementsCompleted();
+
+  /**
+   * Applies the refinement results received from master to the grid and the
+   * alpha vector of a class. Until then, workers keep training on the old
+   * grid.
+   *
+   * @param classIndex The class for which to apply the refinement
+   */
+  void applyPendingRefinement(size_t classIndex);
+
   /**
    * Update the system matrix decomposition after a refinement step.
-   * This will wait for the receiving of refinement results to complete.
+   * This will wait for the receiving of refinement results to complete and
+   * apply them to the grid.
    * After computation, the system matrix is sent back to the master
    *
    * @param classIndex The class for which to update the system matrix
@@ -368,6 +413,12 @@ class LearnerSGDEOnOffParallel {
    */
   std::vector<size_t> localGridVersions;
 
+  /**
+   * Vector that holds the grid version of a pending refinement for every class
+   * (0 if there is none)
+   */
+  std::vector<size_t> pendingGridVersions;
+
   /**
    * Boolean used to detect when a shutdown of a worker has been requested
    */
@@ -442,9 +493,12 @@ class LearnerSGDEOnOffParallel {
       std::map<double, int> &classIndices) const;
 
   /**
-   * Wait for all grids to reach a consistent state before continuing
+   * Wait for all grids to reach a consistent state with the same version
+   * before continuing
+   *
+   * @param minimumGridVersion The grid version all grids need to reach
    */
-  void waitForAllGridsConsistent();
+  void waitForAllGridsConsistent(size_t minimumGridVersion);
 };
 }  // namespace datadriven
 }  // namespace sgpp
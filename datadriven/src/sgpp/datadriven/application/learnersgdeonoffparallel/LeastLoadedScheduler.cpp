@@ -0,0 +1,126 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/MPIMethods.hpp>
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/LeastLoadedScheduler.hpp>
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/LearnerSGDEOnOffParallel.hpp>
+#include <sgpp/base/exception/algorithm_exception.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace datadriven {
+LeastLoadedScheduler::LeastLoadedScheduler(size_t batchSize,
+                                             size_t maxOutstandingBatchesPerWorker)
+    : batchSize(batchSize),
+      maxOutstandingBatchesPerWorker(std::max<size_t>(1, maxOutstandingBatchesPerWorker)),
+      refinementCycle(0),
+      outstandingBatches(),
+      numOutstandingBatches(),
+      numCompletedBatches() {
+  learnerInstance = nullptr;
+}
+
+size_t LeastLoadedScheduler::getNumberOfProcesses() {
+  return static_cast<size_t>(MPIMethods::getWorldSize());
+}
+
+void LeastLoadedScheduler::initializeWorkers() {
+  size_t worldSize = getNumberOfProcesses();
+  if (numOutstandingBatches.size() != worldSize) {
+    numOutstandingBatches.resize(worldSize, 0);
+    numCompletedBatches.resize(worldSize, 0);
+  }
+}
+
+int LeastLoadedScheduler::selectWorker() {
+  initializeWorkers();
+  if (numOutstandingBatches.size() < 2) {
+    throw sgpp::base::algorithm_exception("No workers available for scheduling.");
+  }
+
+  // The master (rank 0) does not train
+  size_t selectedWorker = 1;
+  for (size_t worker = 2; worker < numOutstandingBatches.size(); worker++) {
+    if (numOutstandingBatches[worker] < numOutstandingBatches[selectedWorker] ||
+        (numOutstandingBatches[worker] == numOutstandingBatches[selectedWorker] &&
+         numCompletedBatches[worker] > numCompletedBatches[selectedWorker])) {
+      selectedWorker = worker;
+    }
+  }
+  return static_cast<int>(selectedWorker);
+}
+
+void LeastLoadedScheduler::assignTaskVariableTaskSize(TaskType taskType,
+                                                       AssignTaskResult &result) {
+  assignTaskStaticTaskSize(taskType, result);
+  result.taskSize = batchSize;
+}
+
+void LeastLoadedScheduler::assignTaskStaticTaskSize(TaskType /*taskType*/,
+                                                     AssignTaskResult &result) {
+  result.workerID = selectWorker();
+}
+
+bool LeastLoadedScheduler::isReadyForRefinement() {
+  return std::none_of(outstandingBatches.begin(), outstandingBatches.end(),
+                      [this](const OutstandingBatch &batch) {
+                        return batch.refinementCycle < refinementCycle;
+                      });
+}
+
+void LeastLoadedScheduler::onMergeRequestIncoming(int workerID, size_t batchOffset,
+                                                   size_t /*batchSize*/,
+                                                   size_t /*assignedGridVersion*/,
+                                                   size_t /*localGridVersion*/) {
+  // Offsets repeat between data passes, possibly on different workers, hence the worker is
+  // matched as well. A worker trains its batches in order, so its older batch is merged first.
+  auto batch = std::find_if(outstandingBatches.begin(), outstandingBatches.end(),
+                            [workerID, batchOffset](const OutstandingBatch &batch) {
+                              return batch.workerID == workerID &&
+                                     batch.batchOffset == batchOffset;
+                            });
+  if (batch == outstandingBatches.end()) {
+    throw sgpp::base::algorithm_exception("Received merge request for a batch not assigned.");
+  }
+
+  batch->remainingMerges--;
+  if (batch->remainingMerges == 0) {
+    numOutstandingBatches[batch->workerID]--;
+    numCompletedBatches[batch->workerID]++;
+    outstandingBatches.erase(batch);
+  }
+}
+
+void LeastLoadedScheduler::onRefinementStarted() {
+  if (!isReadyForRefinement()) {
+    throw sgpp::base::algorithm_exception("Refinement started illegally.");
+  }
+  refinementCycle++;
+}
+
+void LeastLoadedScheduler::onTaskAssigned(int workerID, size_t batchOffset,
+                                           size_t /*batchSize*/) {
+  initializeWorkers();
+  outstandingBatches.push_back(
+      OutstandingBatch{workerID, batchOffset, refinementCycle, learnerInstance->getNumClasses()});
+  numOutstandingBatches[workerID]++;
+}
+
+bool LeastLoadedScheduler::isWorkerAvailable() {
+  initializeWorkers();
+  if (numOutstandingBatches.size() < 2) {
+    // Let selectWorker report the missing workers
+    return true;
+  }
+  return std::any_of(numOutstandingBatches.begin() + 1, numOutstandingBatches.end(),
+                     [this](size_t numOutstanding) {
+                       return numOutstanding < maxOutstandingBatchesPerWorker;
+                     });
+}
+
+bool LeastLoadedScheduler::hasOutstandingTasks() { return !outstandingBatches.empty(); }
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,159 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/MPITaskScheduler.hpp>
+
+#include <list>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+/**
+ * Scheduler that assigns every batch to the worker with the fewest outstanding batches.
+ * The master holds back batches until some worker has less than the maximum number of
+ * outstanding batches. Faster workers merge their results earlier and thus receive more batches.
+ * Once assigned, a batch stays with its worker, there is no stealing between workers.
+ */
+class LeastLoadedScheduler : public MPITaskScheduler {
+ public:
+  /**
+   * Create a scheduler that keeps the batches in the queue of the master until a worker is idle
+   * enough to take them.
+   * @param batchSize The size of one training batch to distribute.
+   * @param maxOutstandingBatchesPerWorker The number of batches a worker may have queued, more
+   * than one allows workers to train while their last results are transferred.
+   */
+  explicit LeastLoadedScheduler(size_t batchSize, size_t maxOutstandingBatchesPerWorker = 2);
+
+  /**
+   * Assign a task of static size to the least loaded worker.
+   * @param taskType Type of task to assign to a worker.
+   * @param result The result of determining assignment.
+   */
+  void assignTaskStaticTaskSize(TaskType taskType, AssignTaskResult &result) override;
+
+  /**
+   * Assign a task of variable size equal to the batch size to the least loaded worker.
+   * @param taskType Type of task to assign to a worker.
+   * @param result The result of determining assignment.
+   */
+  void assignTaskVariableTaskSize(TaskType taskType, AssignTaskResult &result) override;
+
+  /**
+   * Check whether the master can start to refine. This can only happen if all batches assigned
+   * before the last refinement have been merged.
+   * @return Whether to start refining.
+   */
+  bool isReadyForRefinement() override;
+
+  /**
+   * Count the merge request for the outstanding batch of this worker at this offset. Once the
+   * results of all classes have been merged, the worker can take another batch.
+   * @param workerID The MPI rank of the worker that trained from the batch.
+   * @param batchOffset The offset of the batch that was trained from.
+   * @param batchSize Not used.
+   * @param assignedGridVersion Not used.
+   * @param localGridVersion Not used.
+   */
+  void onMergeRequestIncoming(int workerID, size_t batchOffset, size_t batchSize,
+                              size_t assignedGridVersion, size_t localGridVersion) override;
+
+  /**
+   * Start a new refinement cycle.
+   */
+  void onRefinementStarted() override;
+
+  /**
+   * Track the batch as outstanding for the worker.
+   * @param workerID The MPI rank of the worker the batch was assigned to.
+   * @param batchOffset The offset of the assigned batch.
+   * @param batchSize Not used.
+   */
+  void onTaskAssigned(int workerID, size_t batchOffset, size_t batchSize) override;
+
+  /**
+   * Check whether any worker has less than the maximum number of outstanding batches.
+   * @return Whether a worker can accept another batch.
+   */
+  bool isWorkerAvailable() override;
+
+  /**
+   * Check whether there are batches whose results have not been merged yet.
+   * @return Whether there are outstanding batches.
+   */
+  bool hasOutstandingTasks() override;
+
+ protected:
+  /**
+   * A batch that has been assigned to a worker but not been merged completely.
+   */
+  struct OutstandingBatch {
+    /**
+     * The MPI rank of the worker training the batch.
+     */
+    int workerID;
+    /**
+     * The offset of the batch in the training data.
+     */
+    size_t batchOffset;
+    /**
+     * The refinement cycle in which the batch was assigned.
+     */
+    size_t refinementCycle;
+    /**
+     * The number of classes whose alpha vectors have not been merged yet.
+     */
+    size_t remainingMerges;
+  };
+
+  /**
+   * Select the worker with the fewest outstanding batches, preferring workers that have
+   * completed more batches so far.
+   * @return The MPI rank of the selected worker.
+   */
+  int selectWorker();
+
+  /**
+   * Resize the per worker statistics to the number of MPI processes.
+   */
+  void initializeWorkers();
+
+  /**
+   * Get the number of MPI processes, including the master.
+   * @return The MPI world size.
+   */
+  virtual size_t getNumberOfProcesses();
+
+  /**
+   * The batch size to use for all workers.
+   */
+  size_t batchSize;
+  /**
+   * The maximum number of outstanding batches of a worker.
+   */
+  size_t maxOutstandingBatchesPerWorker;
+  /**
+   * The number of refinement cycles started so far.
+   */
+  size_t refinementCycle;
+  /**
+   * The batches that have been assigned but not merged completely, oldest first.
+   */
+  std::list<OutstandingBatch> outstandingBatches;
+  /**
+   * The number of outstanding batches of every worker (indexed by MPI rank).
+   */
+  std::vector<size_t> numOutstandingBatches;
+  /**
+   * The number of completed batches of every worker (indexed by MPI rank).
+   */
+  std::vector<size_t> numCompletedBatches;
+};
+}  // namespace datadriven
+}  // namespace sgpp
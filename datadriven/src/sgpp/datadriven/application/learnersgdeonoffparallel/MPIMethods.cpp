@@ -57,12 +57,12 @@ void MPIMethods::initMPI(LearnerSGDEOnOffParallel *learnerInstance) {
 
   // Setup receiving messages from master/workers
   {
-    auto *mpiPacket = new MPI_Packet;
+    auto *mpiPacket = new MPI_Packet();
     auto &unicastInputRequest = createPendingMPIRequest(mpiPacket, true);
     unicastInputRequest.disposeAfterCallback = false;
     unicastInputRequest.callback = [](PendingMPIRequest &request) {
       D(std::cout << "Incoming MPI unicast" << std::endl;)
-      handleIncomingRequestFromCallback(request);
+      handleIncomingRequestFromCallback(request, MPI_TAG_STANDARD_COMMAND_FRAME);
 
       D(std::cout << "Restarting irecv request." << std::endl;)
       MPI_Irecv(request.buffer, sizeof(MPI_Packet), MPI_UNSIGNED_CHAR, MPI_ANY_SOURCE,
@@ -78,12 +78,12 @@ void MPIMethods::initMPI(LearnerSGDEOnOffParallel *learnerInstance) {
   }
   // Setup receiving high priority messages from master/workers
   {
-    auto *mpiPacket = new MPI_Packet;
+    auto *mpiPacket = new MPI_Packet();
     auto &unicastInputRequest = createPendingMPIRequest(mpiPacket, true);
     unicastInputRequest.disposeAfterCallback = false;
     unicastInputRequest.callback = [](PendingMPIRequest &request) {
       D(std::cout << "Incoming MPI high priority unicast" << std::endl;)
-      handleIncomingRequestFromCallback(request);
+      handleIncomingRequestFromCallback(request, MPI_TAG_HIGH_PRIORITY_NO_BLOCK_FRAME);
 
       D(std::cout << "Restarting irecv request." << std::endl;)
       MPI_Irecv(request.buffer, sizeof(MPI_Packet), MPI_UNSIGNED_CHAR, MPI_ANY_SOURCE,
@@ -99,12 +99,17 @@ void MPIMethods::initMPI(LearnerSGDEOnOffParallel *learnerInstance) {
     std::cout << "Started listening for high priority unicasts from any sources" << std::endl;
   }
   if (!isMaster()) {
-    auto *mpiPacket = new MPI_Packet;
+    auto *mpiPacket = new MPI_Packet();
     auto &broadcastInputRequest = createPendingMPIRequest(mpiPacket, true);
     broadcastInputRequest.disposeAfterCallback = false;
     broadcastInputRequest.callback = [](PendingMPIRequest &request) {
       D(std::cout << "Incoming MPI broadcast" << std::endl;)
-      handleIncomingRequestFromCallback(request);
+      handleIncomingRequestFromCallback(request, MPI_ANY_TAG);
+
+      // The shutdown broadcast is the last one, don't wait for further broadcasts
+      if (request.disposeAfterCallback) {
+        return;
+      }
 
       D(std::cout << "Restarting ibcast request." << std::endl;)
       MPI_Ibcast(request.buffer, sizeof(MPI_Packet), MPI_UNSIGNED_CHAR, MPI_MASTER_RANK,
@@ -120,7 +125,10 @@ void MPIMethods::initMPI(LearnerSGDEOnOffParallel *learnerInstance) {
   MPIMethods::learnerInstance = learnerInstance;
 }
 
-void MPIMethods::handleIncomingRequestFromCallback(PendingMPIRequest &request) {
+void MPIMethods::handleIncomingRequestFromCallback(PendingMPIRequest &request, int frameTag) {
+  // The frame has to be received before processing, as processing might wait for other messages
+  receiveFrame(request, frameTag);
+
   processIncomingMPICommands(request);
 
   D(std::cout << "Zeroing MPI Request" << std::endl;)
@@ -128,6 +136,64 @@ void MPIMethods::handleIncomingRequestFromCallback(PendingMPIRequest &request) {
 
   D(std::cout << "Zeroing Buffer" << std::endl;)
   std::memset(request.buffer, 0, sizeof(MPI_Packet));
+  request.frame.clear();
+}
+
+void MPIMethods::receiveFrame(PendingMPIRequest &request, int frameTag) {
+  size_t frameSize = request.buffer->frameSize;
+
+  // A packet whose processing threw is processed again with the frame received before
+  if (request.frame.size() == frameSize) {
+    return;
+  }
+
+  request.frame.resize(frameSize);
+
+  D(std::cout << "Receiving frame of " << frameSize << " bytes" << std::endl;)
+  CHECK_SIZE_T_TO_INT(frameSize)
+  if (frameTag == MPI_ANY_TAG) {
+    // Nonblocking collectives do not match blocking ones, so the frame is received with Ibcast
+    MPI_Request frameRequest;
+    MPI_Ibcast(request.frame.data(), static_cast<int>(frameSize), MPI_UNSIGNED_CHAR,
+               MPI_MASTER_RANK, MPI_COMM_WORLD, &frameRequest);
+    MPI_Wait(&frameRequest, MPI_STATUS_IGNORE);
+  } else {
+    MPI_Recv(request.frame.data(), static_cast<int>(frameSize), MPI_UNSIGNED_CHAR,
+             request.buffer->sourceRank, frameTag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+  }
+}
+
+void MPIMethods::sendPacketWithFrame(int destinationRank, MPI_Packet *mpiPacket,
+                                     std::vector<unsigned char> &frame, bool highPriority) {
+  int rank;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  mpiPacket->sourceRank = rank;
+  mpiPacket->frameSize = frame.size();
+
+  if (destinationRank == MPI_ANY_SOURCE) {
+    sendIBcast(mpiPacket);
+  } else {
+    sendISend(destinationRank, mpiPacket, sizeof(MPI_Packet), highPriority);
+  }
+
+  if (frame.empty()) {
+    return;
+  }
+
+  // The frame is kept alive by its pending request until the transmission has completed
+  PendingMPIRequest &frameRequest = createPendingMPIRequest(nullptr, false);
+  frameRequest.frame.swap(frame);
+
+  CHECK_SIZE_T_TO_INT(frameRequest.frame.size())
+  int frameSize = static_cast<int>(frameRequest.frame.size());
+  if (destinationRank == MPI_ANY_SOURCE) {
+    MPI_Ibcast(frameRequest.frame.data(), frameSize, MPI_UNSIGNED_CHAR, MPI_MASTER_RANK,
+               MPI_COMM_WORLD, frameRequest.getMPIRequestFromHandle());
+  } else {
+    MPI_Isend(frameRequest.frame.data(), frameSize, MPI_UNSIGNED_CHAR, destinationRank,
+              highPriority ? MPI_TAG_HIGH_PRIORITY_NO_BLOCK_FRAME : MPI_TAG_STANDARD_COMMAND_FRAME,
+              MPI_COMM_WORLD, frameRequest.getMPIRequestFromHandle());
+  }
 }
 
 void
@@ -135,68 +201,59 @@ MPIMethods::sendRefinementUpdates(size_t &classIndex, std::list<size_t> &deleted
                                   std::list<LevelIndexVector> &addedGridPoints) {
   // Deleted grid points
   {
-    std::list<size_t>::const_iterator iterator = deletedGridPointsIndices.begin();
-    std::list<size_t>::const_iterator listEnd = deletedGridPointsIndices.end();
-    while (iterator != listEnd) {
-      auto *mpiPacket = new MPI_Packet;
-      mpiPacket->commandID = UPDATE_GRID;
-
-      auto *networkMessage =
-          static_cast<RefinementResultNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
-
-      networkMessage->classIndex = classIndex;
-      networkMessage->updateType = DELETED_GRID_POINTS_LIST;
-
-      size_t numPointsInBuffer = fillBufferWithData<std::list<size_t>::const_iterator>(
-          static_cast<void *>(networkMessage->payload),
-          static_cast<void *>(std::end(networkMessage->payload)),
-          iterator,
-          listEnd);
-      networkMessage->listLength = numPointsInBuffer;
-
-      networkMessage->gridversion = (iterator == listEnd) ? GRID_RECEIVED_DELETED_INDEXES
-                                                          : GRID_TEMPORARILY_INCONSISTENT;
-
-      D(std::cout << "Sending updated for class " << networkMessage->classIndex
-                  << " with " << networkMessage->listLength
-                  << " deletions" << " (grid version " << networkMessage->gridversion << ")"
-                  << std::endl;)
-
-      sendIBcast(mpiPacket);
+    auto *mpiPacket = new MPI_Packet();
+    mpiPacket->commandID = UPDATE_GRID;
+
+    auto *networkMessage =
+        static_cast<RefinementResultNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
+
+    networkMessage->classIndex = classIndex;
+    networkMessage->updateType = DELETED_GRID_POINTS_LIST;
+    networkMessage->listLength = deletedGridPointsIndices.size();
+    networkMessage->gridversion = learnerInstance->getLocalGridVersion(classIndex);
+
+    std::vector<unsigned char> frame(deletedGridPointsIndices.size() * sizeof(size_t));
+    auto *framePointer = static_cast<size_t *>(static_cast<void *>(frame.data()));
+    for (size_t index : deletedGridPointsIndices) {
+      *framePointer++ = index;
     }
+
+    D(std::cout << "Sending updated for class " << networkMessage->classIndex
+                << " with " << networkMessage->listLength
+                << " deletions" << " (grid version " << networkMessage->gridversion << ")"
+                << std::endl;)
+
+    sendPacketWithFrame(MPI_ANY_SOURCE, mpiPacket, frame);
   }
   // Added grid points
   {
-    auto iterator = addedGridPoints.begin();
-    std::list<LevelIndexVector>::const_iterator listEnd = addedGridPoints.end();
-    while (iterator != listEnd) {
-      auto *mpiPacket = new MPI_Packet;
-      mpiPacket->commandID = UPDATE_GRID;
-
-      auto *networkMessage =
-          static_cast<RefinementResultNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
-
-      networkMessage->classIndex = classIndex;
-      networkMessage->updateType = ADDED_GRID_POINTS_LIST;
+    auto *mpiPacket = new MPI_Packet();
+    mpiPacket->commandID = UPDATE_GRID;
 
-      size_t numPointsInBuffer = fillBufferWithLevelIndexData(networkMessage->payload,
-                                                              std::end(
-                                                                  networkMessage->payload),
-                                                              iterator,
-                                                              listEnd);
-      networkMessage->listLength = numPointsInBuffer;
+    auto *networkMessage =
+        static_cast<RefinementResultNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
 
-      networkMessage->gridversion = (iterator == listEnd) ? GRID_RECEIVED_ADDED_POINTS
-                                                          : GRID_TEMPORARILY_INCONSISTENT;
+    networkMessage->classIndex = classIndex;
+    networkMessage->updateType = ADDED_GRID_POINTS_LIST;
+    networkMessage->listLength = addedGridPoints.size();
+    networkMessage->gridversion = learnerInstance->getLocalGridVersion(classIndex);
 
+    size_t dimensionality = learnerInstance->getDimensionality();
+    std::vector<unsigned char> frame(addedGridPoints.size() * dimensionality *
+                                     sizeof(LevelIndexPair));
+    auto *framePointer = static_cast<LevelIndexPair *>(static_cast<void *>(frame.data()));
+    for (LevelIndexVector &levelIndexVector : addedGridPoints) {
+      for (size_t currentDimension = 0; currentDimension < dimensionality; currentDimension++) {
+        *framePointer++ = levelIndexVector[currentDimension];
+      }
+    }
 
-      D(std::cout << "Sending updated for class " << networkMessage->classIndex
-                  << " with " << networkMessage->listLength
-                  << " additions" << " (grid version " << networkMessage->gridversion << ")"
-                  << std::endl;)
+    D(std::cout << "Sending updated for class " << networkMessage->classIndex
+                << " with " << networkMessage->listLength
+                << " additions" << " (grid version " << networkMessage->gridversion << ")"
+                << std::endl;)
 
-      sendIBcast(mpiPacket);
-    }
+    sendPacketWithFrame(MPI_ANY_SOURCE, mpiPacket, frame);
   }
 }
 
@@ -204,66 +261,52 @@ MPIMethods::sendRefinementUpdates(size_t &classIndex, std::list<size_t> &deleted
 void MPIMethods::sendSystemMatrixDecomposition(const size_t &classIndex,
                                                DataMatrix &newSystemMatrixDecomposition,
                                                int mpiTarget) {
-  auto iterator = newSystemMatrixDecomposition.begin();
-  auto listEnd = newSystemMatrixDecomposition.end();
-
-  size_t offset = 0;
-  while (iterator != listEnd) {
-    auto *mpiPacket = new MPI_Packet;
-    mpiPacket->commandID = UPDATE_GRID;
-
-    auto *networkMessage =
-        static_cast<RefinementResultNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
-
-    networkMessage->classIndex = classIndex;
-    networkMessage->updateType = SYSTEM_MATRIX_DECOMPOSITION;
-
-    auto *systemMatrixNetworkMessage =
-        static_cast<RefinementResultSystemMatrixNetworkMessage *>(
-            static_cast<void *>(networkMessage->payload));
-
-    systemMatrixNetworkMessage->matrixWidth = newSystemMatrixDecomposition.getNcols();
-    systemMatrixNetworkMessage->matrixHeight = newSystemMatrixDecomposition.getNrows();
-    systemMatrixNetworkMessage->offset = offset;
-
-    size_t numPointInBuffer = fillBufferWithData(systemMatrixNetworkMessage->payload,
-                                                 std::end(systemMatrixNetworkMessage->payload),
-                                                 iterator, listEnd);
-    networkMessage->listLength = numPointInBuffer;
-
-    offset += numPointInBuffer;
-
-    networkMessage->gridversion = (iterator == listEnd) ? learnerInstance->getLocalGridVersion(
-        classIndex) : GRID_TEMPORARILY_INCONSISTENT;
-
-    if (mpiTarget != MPI_ANY_SOURCE) {
-      D(std::cout << "Sending system matrix for class " << networkMessage->classIndex
-                  << " offset " << systemMatrixNetworkMessage->offset
-                  << " with " << networkMessage->listLength
-                  << " values" << " (grid version " << networkMessage->gridversion
-                  << ", target "
-                  << mpiTarget << ")" << std::endl;)
-      sendISend(mpiTarget, mpiPacket, sizeof(MPI_Packet), true);
-    } else {
-      D(std::cout << "Broadcasting system matrix for class " << networkMessage->classIndex
-                  << " offset " << systemMatrixNetworkMessage->offset
-                  << " with " << networkMessage->listLength
-                  << " values" << " (grid version " << networkMessage->gridversion << ")"
-                  << std::endl;)
-      sendIBcast(mpiPacket);
-    }
+  auto *mpiPacket = new MPI_Packet();
+  mpiPacket->commandID = UPDATE_GRID;
+
+  auto *networkMessage =
+      static_cast<RefinementResultNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
+
+  networkMessage->classIndex = classIndex;
+  networkMessage->updateType = SYSTEM_MATRIX_DECOMPOSITION;
+  networkMessage->listLength = newSystemMatrixDecomposition.size();
+  networkMessage->gridversion = learnerInstance->getLocalGridVersion(classIndex);
+
+  auto *systemMatrixNetworkMessage =
+      static_cast<RefinementResultSystemMatrixNetworkMessage *>(
+          static_cast<void *>(networkMessage->payload));
+
+  systemMatrixNetworkMessage->matrixWidth = newSystemMatrixDecomposition.getNcols();
+  systemMatrixNetworkMessage->matrixHeight = newSystemMatrixDecomposition.getNrows();
+
+  std::vector<unsigned char> frame(newSystemMatrixDecomposition.size() * sizeof(double));
+  std::memcpy(frame.data(), newSystemMatrixDecomposition.data(), frame.size());
+
+  if (mpiTarget != MPI_ANY_SOURCE) {
+    D(std::cout << "Sending system matrix for class " << networkMessage->classIndex
+                << " with " << networkMessage->listLength
+                << " values" << " (grid version " << networkMessage->gridversion
+                << ", target "
+                << mpiTarget << ")" << std::endl;)
+    sendPacketWithFrame(mpiTarget, mpiPacket, frame, true);
+  } else {
+    D(std::cout << "Broadcasting system matrix for class " << networkMessage->classIndex
+                << " with " << networkMessage->listLength
+                << " values" << " (grid version " << networkMessage->gridversion << ")"
+                << std::endl;)
+    sendPacketWithFrame(MPI_ANY_SOURCE, mpiPacket, frame);
   }
 }
 
 void MPIMethods::bcastCommandNoArgs(MPI_COMMAND_ID commandId) {
-  auto *mpiPacket = new MPI_Packet;
+  auto *mpiPacket = new MPI_Packet();
   mpiPacket->commandID = commandId;
 
   sendIBcast(mpiPacket);
 }
 
 void MPIMethods::sendCommandNoArgs(const int destinationRank, MPI_COMMAND_ID commandId) {
-  auto *mpiPacket = new MPI_Packet;
+  auto *mpiPacket = new MPI_Packet();
   mpiPacket->commandID = commandId;
 
   sendISend(destinationRank, mpiPacket);
@@ -308,114 +351,59 @@ PendingMPIRequest &MPIMethods::createPendingMPIRequest(MPI_Packet *mpiPacket, bo
   return pendingMPIRequest;
 }
 
-void MPIMethods::receiveMergeGridNetworkMessage(MergeGridNetworkMessage &networkMessage) {
-  base::DataVector alphaVector(networkMessage.alphaTotalSize);
-
-  auto *payload = static_cast<double *>(static_cast<void *>(networkMessage.payload));
-  for (size_t index = 0; index < networkMessage.payloadLength; index++) {
-    alphaVector[networkMessage.payloadOffset + index] = payload[index];
+void MPIMethods::receiveMergeGridNetworkMessage(MergeGridNetworkMessage &networkMessage,
+                                                const std::vector<unsigned char> &frame,
+                                                int sourceRank) {
+  if (frame.size() != networkMessage.alphaTotalSize * sizeof(double)) {
+    std::cout << "Received merge request with " << frame.size() << " bytes for "
+              << networkMessage.alphaTotalSize << " alpha values" << std::endl;
+    throw sgpp::base::algorithm_exception("Merge request with incomplete frame received.");
   }
 
-  bool isLastPacketInSeries =
-      networkMessage.payloadLength + networkMessage.payloadOffset ==
-          networkMessage.alphaTotalSize;
+  base::DataVector alphaVector(networkMessage.alphaTotalSize);
+  std::memcpy(alphaVector.getPointer(), frame.data(), frame.size());
 
   learnerInstance->mergeAlphaValues(networkMessage.classIndex, networkMessage.gridversion,
-                                    alphaVector,
+                                    networkMessage.assignedGridversion, alphaVector,
                                     networkMessage.batchOffset, networkMessage.batchSize,
-                                    isLastPacketInSeries);
+                                    sourceRank);
 
-  D(std::cout << "Updated alpha values from network message offset "
-              << networkMessage.payloadOffset
-              << ", class " << networkMessage.classIndex
-              << ", length " << networkMessage.payloadLength << ", alpha vector length "
-              << networkMessage.alphaTotalSize << std::endl;)
+  D(std::cout << "Updated alpha values from network message class " << networkMessage.classIndex
+              << ", alpha vector length " << networkMessage.alphaTotalSize << std::endl;)
 }
 
 size_t
 MPIMethods::sendMergeGridNetworkMessage(size_t classIndex, size_t batchOffset, size_t batchSize,
+                                        size_t assignedGridVersion,
                                         base::DataVector &alphaVector) {
-  size_t offset = 0;
-  auto beginIterator = alphaVector.begin();
-  auto endIterator = alphaVector.end();
+  auto *mpiPacket = new MPI_Packet();
+  mpiPacket->commandID = MERGE_GRID;
 
-  while (offset < alphaVector.size()) {
-    auto *mpiPacket = new MPI_Packet;
-    mpiPacket->commandID = MERGE_GRID;
+  void *payloadPointer = &(mpiPacket->payload);
 
-    void *payloadPointer = &(mpiPacket->payload);
+  auto *networkMessage = static_cast<MergeGridNetworkMessage *>(payloadPointer);
 
-    auto *networkMessage = static_cast<MergeGridNetworkMessage *>(payloadPointer);
-
-    networkMessage->classIndex = classIndex;
-    networkMessage->gridversion = learnerInstance->getLocalGridVersion(classIndex);
-    networkMessage->payloadOffset = offset;
-    networkMessage->batchSize = batchSize;
-    networkMessage->batchOffset = batchOffset;
-    networkMessage->alphaTotalSize = alphaVector.size();
-
-    size_t numPointsInPacket = 0;
-
-    numPointsInPacket = fillBufferWithData(networkMessage->payload,
-                                           std::end(networkMessage->payload),
-                                           beginIterator, endIterator);
-
-    networkMessage->payloadLength = numPointsInPacket;
-
-    D(
-        std::cout << "Sending merge for class " << classIndex
-                  << " offset " << offset
-                  << " with " << numPointsInPacket << " values"
-                  << " and grid version " << networkMessage->gridversion << std::endl;
-        std::cout << "Alpha sum is "
-                  << std::accumulate(alphaVector.begin(), alphaVector.end(), 0.0)
-                  << std::endl;
-    )
-    sendISend(MPI_MASTER_RANK, mpiPacket);
-    offset += numPointsInPacket;
-  }
+  networkMessage->classIndex = classIndex;
+  networkMessage->gridversion = learnerInstance->getLocalGridVersion(classIndex);
+  networkMessage->assignedGridversion = assignedGridVersion;
+  networkMessage->batchSize = batchSize;
+  networkMessage->batchOffset = batchOffset;
+  networkMessage->alphaTotalSize = alphaVector.size();
 
-  return offset;
-}
+  std::vector<unsigned char> frame(alphaVector.size() * sizeof(double));
+  std::memcpy(frame.data(), alphaVector.getPointer(), frame.size());
 
-size_t
-MPIMethods::fillBufferWithLevelIndexData(void *buffer, const void *bufferEnd,
-                                         std::list<LevelIndexVector>::iterator &iterator,
-                                         std::list<LevelIndexVector>::const_iterator &listEnd) {
-  size_t copiedValues = 0;
-  auto *bufferPointer = static_cast<LevelIndexPair *>(buffer);
-  while (iterator != listEnd && bufferPointer < bufferEnd) {
-    LevelIndexVector levelIndexVector = *iterator;
-    if (bufferPointer + 2 * levelIndexVector.size() * sizeof(size_t) >= bufferEnd) {
-      break;
-    }
-    for (auto &levelIndexPair : levelIndexVector) {
-      bufferPointer->level = levelIndexPair.level;
-      bufferPointer->index = levelIndexPair.index;
-      bufferPointer++;
-    }
-    copiedValues++;
-    iterator++;
-  }
-  return copiedValues;
-}
+  D(
+      std::cout << "Sending merge for class " << classIndex
+                << " with " << alphaVector.size() << " values"
+                << " and grid version " << networkMessage->gridversion << std::endl;
+      std::cout << "Alpha sum is "
+                << std::accumulate(alphaVector.begin(), alphaVector.end(), 0.0)
+                << std::endl;
+  )
+  sendPacketWithFrame(MPI_MASTER_RANK, mpiPacket, frame);
 
-template<typename Iterator>
-size_t
-MPIMethods::fillBufferWithData(void *buffer, void *bufferEnd, Iterator &iterator,
-                               Iterator &listEnd) {
-  auto *bufferPointer = (typename std::iterator_traits<Iterator>::value_type *) buffer;
-  size_t copiedValues = 0;
-  while (bufferPointer + sizeof(typename std::iterator_traits<Iterator>::value_type) <
-      bufferEnd &&
-      iterator != listEnd) {
-    *bufferPointer = *iterator;
-
-    bufferPointer++;
-    iterator++;
-    copiedValues++;
-  }
-  return copiedValues;
+  return alphaVector.size();
 }
 
 void MPIMethods::processCompletedMPIRequests() {
@@ -586,111 +574,78 @@ MPIMethods::findPendingMPIRequest(unsigned int completedRequestIndex) {
   throw sgpp::base::algorithm_exception("Could not find PendingMPIRequest for Pool Index.");
 }
 
-void MPIMethods::receiveGridComponentsUpdate(RefinementResultNetworkMessage *networkMessage) {
+void MPIMethods::receiveGridComponentsUpdate(RefinementResultNetworkMessage *networkMessage,
+                                             const std::vector<unsigned char> &frame) {
   size_t classIndex = networkMessage->classIndex;
   RefinementResult &refinementResult = learnerInstance->getRefinementHandler().getRefinementResult(
       classIndex);
 
   size_t listLength = networkMessage->listLength;
-  size_t processedPoints = 0;
-  void *bufferEnd = std::end(networkMessage->payload);
 
   D(std::cout << "Receiving " << listLength << " grid modifications for class " << classIndex
               << " (update type " << networkMessage->updateType << ", remote grid version "
               << networkMessage->gridversion << ")"
               << std::endl;)
 
-  if (learnerInstance->checkGridStateConsistent(classIndex) &&
-      !learnerInstance->isVersionConsistent(networkMessage->gridversion)) {
-    D(std::cout << "Received first message in multi segment grid update of type "
-                << networkMessage->updateType << std::endl;)
-    while (!isMaster() && networkMessage->updateType != SYSTEM_MATRIX_DECOMPOSITION
-        && (!refinementResult.addedGridPoints.empty() ||
-            !refinementResult.deletedGridPointsIndices.empty())) {
-      std::cout
-          << "Received first message in multi segment grid update,"
-          << " however refinement results have not been cleared ("
-          << refinementResult.addedGridPoints.size() << " additions, "
-          << refinementResult.deletedGridPointsIndices.size() << " deletions)."
-          << std::endl;
-      waitForIncomingMessageType(ASSIGN_BATCH);
-    }
-  }
   switch (networkMessage->updateType) {
     case DELETED_GRID_POINTS_LIST: {
-      auto *bufferIterator = static_cast<size_t *>(static_cast<void *>(networkMessage->payload));
-      while (bufferIterator < bufferEnd && processedPoints < listLength) {
-        refinementResult.deletedGridPointsIndices.push_back(*bufferIterator);
-        bufferIterator++;
-        processedPoints++;
+      if (frame.size() != listLength * sizeof(size_t)) {
+        throw sgpp::base::algorithm_exception("Deleted grid points with incomplete frame.");
       }
+      auto *bufferIterator = static_cast<const size_t *>(static_cast<const void *>(frame.data()));
+      refinementResult.deletedGridPointsIndices.assign(bufferIterator,
+                                                       bufferIterator + listLength);
     }
       break;
     case ADDED_GRID_POINTS_LIST: {
-      auto *bufferIterator =
-          static_cast<LevelIndexPair *>(static_cast<void *>(networkMessage->payload));
       size_t dimensionality = learnerInstance->getDimensionality();
-      while (bufferIterator < bufferEnd && processedPoints < listLength) {
-        LevelIndexVector dataVector(dimensionality);
-        size_t currentDimension = 0;
-        while (currentDimension < dimensionality && bufferIterator < bufferEnd) {
-          dataVector[currentDimension].level = bufferIterator->level;
-          dataVector[currentDimension].index = bufferIterator->index;
-          bufferIterator++;
-
-          currentDimension++;
-        }
-        refinementResult.addedGridPoints.push_back(dataVector);
-        processedPoints++;
+      if (frame.size() != listLength * dimensionality * sizeof(LevelIndexPair)) {
+        throw sgpp::base::algorithm_exception("Added grid points with incomplete frame.");
       }
+      auto *bufferIterator =
+          static_cast<const LevelIndexPair *>(static_cast<const void *>(frame.data()));
+      refinementResult.addedGridPoints.clear();
+      for (size_t point = 0; point < listLength; point++) {
+        refinementResult.addedGridPoints.emplace_back(bufferIterator,
+                                                      bufferIterator + dimensionality);
+        bufferIterator += dimensionality;
+      }
+
+      // The grid is changed when the new system matrix decomposition arrives, until then
+      // training continues on the old grid
+      learnerInstance->setPendingGridVersion(classIndex, networkMessage->gridversion);
       break;
     }
     case SYSTEM_MATRIX_DECOMPOSITION: {
       auto *systemMatrixNetworkMessage =
           static_cast<RefinementResultSystemMatrixNetworkMessage *>(
               static_cast<void *>(networkMessage->payload));
+
+      if (frame.size() != listLength * sizeof(double) ||
+          listLength != systemMatrixNetworkMessage->matrixHeight *
+                            systemMatrixNetworkMessage->matrixWidth) {
+        throw sgpp::base::algorithm_exception("System matrix update with incomplete frame.");
+      }
+
+      if (!isMaster() && learnerInstance->getPendingGridVersion(classIndex) != 0) {
+        learnerInstance->applyPendingRefinement(classIndex);
+      }
+
       DataMatrix &systemMatrixDecomposition =
           learnerInstance->getDensityFunctions()[classIndex]
               .first->getOfflineObject().getDecomposedMatrix();
 
-      D(std::cout << "Receiving system matrix decomposition update at offset "
-                  << systemMatrixNetworkMessage->offset
-                  << std::endl;)
-
-      if (systemMatrixNetworkMessage->offset == 0) {
-        size_t oldSize = systemMatrixDecomposition.size();
-        systemMatrixDecomposition.resizeRowsCols(systemMatrixNetworkMessage->matrixHeight,
-                                             systemMatrixNetworkMessage->matrixWidth);
-        std::cout << "Adjusted size of system matrix decomposition " << classIndex << " from "
-                  << oldSize
-                  << " to "
-                  << systemMatrixDecomposition.size() << std::endl;
-      } else if (learnerInstance->getLocalGridVersion(classIndex) !=
-          GRID_TEMPORARILY_INCONSISTENT) {
-        std::cout
-            << "Update with non-null offset arrived "
-            << "but grid version not set to inconsistent (version is "
-            << learnerInstance->getLocalGridVersion(classIndex) << std::endl;
-        throw sgpp::base::algorithm_exception("Secondary update received on consistent grid.");
-      }
+      D(size_t oldSize = systemMatrixDecomposition.size();)
+      systemMatrixDecomposition.resizeRowsCols(systemMatrixNetworkMessage->matrixHeight,
+                                               systemMatrixNetworkMessage->matrixWidth);
+      D(std::cout << "Adjusted size of system matrix decomposition " << classIndex << " from "
+                  << oldSize << " to " << systemMatrixDecomposition.size() << std::endl;)
+      std::memcpy(systemMatrixDecomposition.data(), frame.data(), frame.size());
 
-      auto *bufferIterator =
-          static_cast<double *>(static_cast<void *>(systemMatrixNetworkMessage->payload));
-      while (bufferIterator < bufferEnd && processedPoints < listLength) {
-//                        std::cout << "Copy from " << &*bufferIterator << " to "
-//                                  << (systemMatrixNetworkMessage->offset + processedPoints)
-// << std::endl;
-        systemMatrixDecomposition[systemMatrixNetworkMessage->offset +
-            processedPoints] = *bufferIterator;
-        bufferIterator++;
-        processedPoints++;
-      }
+      learnerInstance->setLocalGridVersion(classIndex, networkMessage->gridversion);
 
-//                    std::cout << "Copy successful" << std::endl;
-      if (isMaster() &&
-          systemMatrixNetworkMessage->offset + processedPoints ==
-              systemMatrixDecomposition.size()) {
-        learnerInstance->setLocalGridVersion(classIndex, networkMessage->gridversion);
+      if (isMaster()) {
+        learnerInstance->setPendingGridVersion(classIndex, 0);
 
         D(std::cout << "Received system matrix decomposition for class " << classIndex
                     << ", will now broadcast decomposition" << std::endl;)
@@ -709,21 +664,6 @@ void MPIMethods::receiveGridComponentsUpdate(RefinementResultNetworkMessage *net
               << " additions, "
               << refinementResult.deletedGridPointsIndices.size() <<
               " deletions)" << std::endl;)
-
-  // If this is not the last message in a series (gridversion inconsistent),
-  // then don't update variables yet
-  if (networkMessage->gridversion == GRID_RECEIVED_ADDED_POINTS && !isMaster()) {
-    D(std::cout << "Updating class " << classIndex
-                << " variables as grid is now consistent with version "
-                << networkMessage->gridversion << std::endl;)
-    learnerInstance->getRefinementHandler()
-        .updateClassVariablesAfterRefinement(classIndex,
-                                             &refinementResult,
-                                             learnerInstance->getDensityFunctions()[classIndex]
-                                                 .first.get(),
-                                                 learnerInstance->getGrid(classIndex));
-  }
-  learnerInstance->setLocalGridVersion(classIndex, networkMessage->gridversion);
 }
 
 void MPIMethods::processIncomingMPICommands(PendingMPIRequest &pendingMPIRequest) {
@@ -735,12 +675,13 @@ void MPIMethods::processIncomingMPICommands(PendingMPIRequest &pendingMPIRequest
     case UPDATE_GRID: {
       auto *refinementResultNetworkMessage =
           static_cast<RefinementResultNetworkMessage *>(networkMessagePointer);
-      receiveGridComponentsUpdate(refinementResultNetworkMessage);
+      receiveGridComponentsUpdate(refinementResultNetworkMessage, pendingMPIRequest.frame);
     }
       break;
     case MERGE_GRID: {
       auto *mergeGridNetworkMessage = static_cast<MergeGridNetworkMessage *>(networkMessagePointer);
-      receiveMergeGridNetworkMessage(*mergeGridNetworkMessage);
+      receiveMergeGridNetworkMessage(*mergeGridNetworkMessage, pendingMPIRequest.frame,
+                                     mpiPacket->sourceRank);
     }
       break;
     case ASSIGN_BATCH:runBatch(mpiPacket);
@@ -769,10 +710,13 @@ void MPIMethods::finalizeMPI() {
   std::cout << pendingMPIRequests.size() << " MPI requests pending before finalize" << std::endl;
   size_t requestNum = 0;
   for (PendingMPIRequest &pendingMPIRequest : pendingMPIRequests) {
-    std::cout << "Cancelling pending mpi request " << requestNum << " at " << &pendingMPIRequest
-              << std::endl;
     MPI_Request *mpiRequestHandle = pendingMPIRequest.getMPIRequestFromHandle();
-    MPI_Cancel(mpiRequestHandle);
+    // Only receives can be cancelled, outgoing messages (and broadcasts) have to complete
+    if (pendingMPIRequest.inbound && pendingMPIRequest.buffer->commandID == NULL_COMMAND) {
+      std::cout << "Cancelling pending mpi request " << requestNum << " at "
+                << &pendingMPIRequest << std::endl;
+      MPI_Cancel(mpiRequestHandle);
+    }
     MPI_Wait(mpiRequestHandle, MPI_STATUS_IGNORE);
     delete pendingMPIRequest.buffer;
     requestNum++;
@@ -783,13 +727,16 @@ void MPIMethods::finalizeMPI() {
 }
 
 void MPIMethods::assignBatch(const int workerID, size_t batchOffset, size_t batchSize,
+                             size_t assignedGridVersion, size_t minimumGridVersion,
                              bool doCrossValidation) {
-  auto *mpiPacket = new MPI_Packet;
+  auto *mpiPacket = new MPI_Packet();
   mpiPacket->commandID = ASSIGN_BATCH;
 
   auto *message = static_cast<AssignBatchNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
   message->batchOffset = batchOffset;
   message->batchSize = batchSize;
+  message->assignedGridversion = assignedGridVersion;
+  message->minimumGridversion = minimumGridVersion;
   message->doCrossValidation = doCrossValidation;
 
   sendISend(workerID, mpiPacket, calculateTotalPacketSize(sizeof(AssignBatchNetworkMessage)));
@@ -805,11 +752,12 @@ void MPIMethods::runBatch(MPI_Packet *assignBatchMessage) {
   D(std::cout << "runbatch dim " << learnerInstance->getDimensionality() << std::endl;)
   D(std::cout << "creating dataset" << std::endl;)
   Dataset dataset{message->batchSize, learnerInstance->getDimensionality()};
-  learnerInstance->workBatch(dataset, message->batchOffset, message->doCrossValidation);
+  learnerInstance->workBatch(dataset, message->batchOffset, message->assignedGridversion,
+                             message->minimumGridversion, message->doCrossValidation);
 }
 
 void MPIMethods::assignSystemMatrixUpdate(const int workerID, size_t classIndex) {
-  auto *mpiPacket = new MPI_Packet;
+  auto *mpiPacket = new MPI_Packet();
   mpiPacket->commandID = COMPUTE_UPDATE_SYSTEM_MATRIX_DECOMPOSITION;
 
   auto *message =
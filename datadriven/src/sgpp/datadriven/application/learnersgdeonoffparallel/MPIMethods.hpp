@@ -15,19 +15,6 @@
 #include <vector>
 #include <list>
 
-/**
- * Constant for determining whether the grid is currently receiving segmented update lists
- */
-#define GRID_TEMPORARILY_INCONSISTENT 5
-/**
- * Constant for determining whether receiving the list of deleted grid points has completed
- */
-#define GRID_RECEIVED_DELETED_INDEXES 6
-/**
- * Constant for determining whether receiving the list of added grid points has completed
- */
-#define GRID_RECEIVED_ADDED_POINTS 7
-
 /**
  * Check to determine whether a size_t to integer cast is safe
  */
@@ -99,13 +86,17 @@ class MPIMethods {
   static void processIncomingMPICommands(PendingMPIRequest &pendingMPIRequest);
 
   /**
-   * Receive potentially segmented message that contains modifications to the grid.
-   * Extract the data into a refinement result and apply to grid or apply to system matrix.
+   * Receive a message that contains modifications to the grid.
+   * Extract the data into a refinement result or apply it to the system matrix.
    * This includes additions, deletions, and system matrix updates.
-   * @param networkMessage The message containing the modification data.
+   * Workers keep training on the old grid until the new system matrix decomposition arrives, only
+   * then the refinement result is applied to the grid.
+   * @param networkMessage The message describing the modification data.
+   * @param frame The frame containing the modification data.
    */
   static void
-  receiveGridComponentsUpdate(sgpp::datadriven::RefinementResultNetworkMessage *networkMessage);
+  receiveGridComponentsUpdate(sgpp::datadriven::RefinementResultNetworkMessage *networkMessage,
+                              const std::vector<unsigned char> &frame);
 
   /**
    * Cancel any remaining requests and shutdown the MPI communicator.
@@ -126,11 +117,15 @@ class MPIMethods {
    * @param workerID The MPI rank of the worker to command.
    * @param batchOffset The offset from the start of the training set to learn from.
    * @param batchSize The size of the batch to learn from.
+   * @param assignedGridVersion The grid version of the master at the time of the assignment.
+   * @param minimumGridVersion The oldest grid version the worker may train on.
    * @param doCrossValidation Whether to apply cross-validation
    */
   static void assignBatch(int workerID,
                           size_t batchOffset,
                           size_t batchSize,
+                          size_t assignedGridVersion,
+                          size_t minimumGridVersion,
                           bool doCrossValidation);
 
   /**
@@ -149,10 +144,12 @@ class MPIMethods {
    * @param classIndex The index of the class to send results for.
    * @param batchOffset The offset from the start of the dataset used in this batch.
    * @param batchSize The size of the current batch.
+   * @param assignedGridVersion The grid version of the master when the batch was assigned.
    * @param alphaVector The results vector to transmit.
    * @return The number of successfully sent values.
    */
   static size_t sendMergeGridNetworkMessage(size_t classIndex, size_t batchOffset, size_t batchSize,
+                                            size_t assignedGridVersion,
                                             base::DataVector &alphaVector);
 
   /**
@@ -161,19 +158,6 @@ class MPIMethods {
    */
   static size_t getQueueSize();
 
-  /**
-   * Copy the level index data for as many grid points as possible into the buffer specified.
-   * @param buffer The start of the buffer to copy to.
-   * @param bufferEnd The end of the buffer to copy to.
-   * @param iterator The start of the data to copy.
-   * @param listEnd The end of the data to copy.
-   * @return The number of grid points copied.
-   */
-  static size_t fillBufferWithLevelIndexData(
-      void *buffer, const void *bufferEnd,
-      std::list<std::vector<LevelIndexPair>>::iterator &iterator,
-      std::list<std::vector<LevelIndexPair>>::const_iterator &listEnd);
-
   /**
    * Send an assembled packet as an MPI Broadcast from the master.
    * @param mpiPacket The packet to transmit.
@@ -182,17 +166,15 @@ class MPIMethods {
   static PendingMPIRequest &sendIBcast(MPI_Packet *mpiPacket);
 
   /**
-   * Copy data from a specified iterator type into a message's payload.
-   * @tparam Iterator The type of iterator used to read values to copy.
-   * @param buffer The start of the buffer to copy to.
-   * @param bufferEnd The end of the buffer to copy to.
-   * @param iterator The start of the data to copy from.
-   * @param listEnd The end of the data to copy from.
-   * @return How many values of the iterator's type could be copied.
+   * Send an MPI packet followed by its frame, both asynchronously. The frame is a single message
+   * regardless of its size, on the frame tag of the packet's channel.
+   * @param destinationRank The MPI rank of the destination. Use MPI_ANY_SOURCE for broadcast.
+   * @param mpiPacket The MPI packet to send, its frame size and source rank are set here.
+   * @param frame The frame to send, it is moved into the pending request.
+   * @param highPriority Whether to send the packet on the high priority no_wait channel.
    */
-  template<typename Iterator>
-  static size_t fillBufferWithData(void *buffer, void *bufferEnd, Iterator &iterator,
-                                   Iterator &listEnd);
+  static void sendPacketWithFrame(int destinationRank, MPI_Packet *mpiPacket,
+                                  std::vector<unsigned char> &frame, bool highPriority = false);
 
   /**
    * Send the refinement updates for a specified class to all workers over a broadcast.
@@ -302,12 +284,21 @@ class MPIMethods {
   static void runBatch(MPI_Packet *assignBatchMessage);
 
   /**
-   * Receive a packet of changes from the master and apply them to the grid and refinement result
-   * or to the system matrix decomposition.
-   * @param networkMessage The packet containing the changes
+   * Receive the alpha vector trained by a worker and merge it into the master's alpha vector.
+   * @param networkMessage The packet describing the alpha vector
+   * @param frame The frame containing the alpha values
+   * @param sourceRank The MPI rank of the worker that sent the packet
    */
   static void
-  receiveMergeGridNetworkMessage(MergeGridNetworkMessage &networkMessage);
+  receiveMergeGridNetworkMessage(MergeGridNetworkMessage &networkMessage,
+                                 const std::vector<unsigned char> &frame, int sourceRank);
+
+  /**
+   * Receive the frame announced by an incoming packet into the request's frame buffer.
+   * @param request The completed inbound request.
+   * @param frameTag The tag of the frame, MPI_ANY_TAG if the frame is broadcast by the master.
+   */
+  static void receiveFrame(PendingMPIRequest &request, int frameTag);
 
   /**
    * Create a pending MPI request for the specified packet in preparation to sending it.
@@ -340,9 +331,12 @@ class MPIMethods {
   static unsigned int executeMPIWaitAny();
 
   /**
-   * Callback function that processes the request and zeros then memory region afterwards
+   * Callback function that receives the frame of the request, processes the request and zeros
+   * the memory region afterwards
+   * @param request The completed inbound request.
+   * @param frameTag The tag of the request's frame, MPI_ANY_TAG for broadcasts.
    */
-  static void handleIncomingRequestFromCallback(PendingMPIRequest &request);
+  static void handleIncomingRequestFromCallback(PendingMPIRequest &request, int frameTag);
 
   /**
    * Create a message track request that tests each message against a predicate until the target
@@ -74,17 +74,41 @@ class MPITaskScheduler {
   /**
    * Callback for when training results are received from workers. Can be used to update tracking
    * of assigned batches.
+   * @param workerID The MPI rank of the worker that trained from the batch.
    * @param batchOffset The offset of the batch that was trained from.
    * @param batchSize The size of the batch used for training.
-   * @param remoteGridVersion The grid version of the worker used for training.
+   * @param assignedGridVersion The grid version of the master when the batch was assigned.
    * @param localGridVersion The grid version of the master upond reception.
    */
   virtual void
-  onMergeRequestIncoming(size_t batchOffset,
+  onMergeRequestIncoming(int workerID,
+                         size_t batchOffset,
                          size_t batchSize,
-                         size_t remoteGridVersion,
+                         size_t assignedGridVersion,
                          size_t localGridVersion) = 0;
 
+  /**
+   * Callback for when a batch has been assigned to a worker. Can be used to track the load of
+   * the workers.
+   * @param workerID The MPI rank of the worker the batch was assigned to.
+   * @param batchOffset The offset of the assigned batch.
+   * @param batchSize The size of the assigned batch.
+   */
+  virtual void onTaskAssigned(int /*workerID*/, size_t /*batchOffset*/, size_t /*batchSize*/) {}
+
+  /**
+   * Check whether a batch can be assigned right now. If not, the master processes incoming
+   * messages until a worker becomes available.
+   * @return Whether a worker can accept another batch.
+   */
+  virtual bool isWorkerAvailable() { return true; }
+
+  /**
+   * Check whether there are assigned batches whose results have not been merged yet.
+   * @return Whether there are outstanding batches.
+   */
+  virtual bool hasOutstandingTasks() = 0;
+
   /**
    * Set the learner instance for which to task schedule.
    * @param instance The learner instance.
@@ -5,11 +5,13 @@
 
 #pragma once
 
-#define MPI_PACKET_MAX_PAYLOAD_SIZE 4096
+#define MPI_PACKET_MAX_PAYLOAD_SIZE 256
 #define MPI_MASTER_RANK 0
 #define MPI_MAX_PROCESSOR_NAME_LENGTH 256
 #define MPI_TAG_HIGH_PRIORITY_NO_BLOCK 42
 #define MPI_TAG_STANDARD_COMMAND 41
+#define MPI_TAG_HIGH_PRIORITY_NO_BLOCK_FRAME 44
+#define MPI_TAG_STANDARD_COMMAND_FRAME 43
 
 #define REFINENEMT_RESULT_PAYLOAD_SIZE (MPI_PACKET_MAX_PAYLOAD_SIZE\
                                    - 3 * sizeof(size_t)\
@@ -58,13 +60,23 @@ enum MPI_COMMAND_ID {
 
 /**
  * A packet sent over MPI, using a command as a descriptor, and a wrapped package in the payload
- * for data.
+ * for data. Bulk data (alpha vectors, grid modifications, system matrices) is not split into
+ * packets, it follows the packet as a single variable-length frame on the corresponding frame tag
+ * (or broadcast).
  */
 struct MPI_Packet {
   /**
    * The MPI command of this specific packet.
    */
   MPI_COMMAND_ID commandID;
+  /**
+   * The MPI rank of the sender, required to receive the frame of point to point messages.
+   */
+  int sourceRank;
+  /**
+   * The size in bytes of the frame following this packet, zero if there is none.
+   */
+  size_t frameSize;
   /**
    * The packet's data segment.
    */
@@ -90,12 +102,12 @@ enum RefinementResultsUpdateType {
 };
 
 /**
- * Packet wrapped in an UPDATE_GRID MPI_Packet, containing segmented changes for a specified class.
+ * Packet wrapped in an UPDATE_GRID MPI_Packet, describing the changes for a specified class that
+ * are contained in the frame of the packet.
  */
 struct RefinementResultNetworkMessage {
   /**
-   * The version of the grid to set after applying the results. If more segments follow,
-   * this version will be set to inconsistent.
+   * The version of the grid after applying the results.
    */
   size_t gridversion;
   /**
@@ -103,7 +115,7 @@ struct RefinementResultNetworkMessage {
    */
   size_t classIndex;
   /**
-   * The number of changes contained in this specific packet.
+   * The number of changes contained in the frame.
    */
   size_t listLength;
   /**
@@ -119,7 +131,7 @@ struct RefinementResultNetworkMessage {
 
 /**
  * Packet wrapped in a RefinementResultNetwork Message that contains additional
- * information required when updating the system matrix.
+ * information required when updating the system matrix. The matrix itself is sent in the frame.
  */
 struct RefinementResultSystemMatrixNetworkMessage {
   /**
@@ -130,20 +142,11 @@ struct RefinementResultSystemMatrixNetworkMessage {
    * The new target system matrix height.
    */
   size_t matrixHeight;
-  /**
-   * The offset from the start of the matrix to copy to.
-   */
-  size_t offset;
-
-  /**
-   * The data to be copied.
-   */
-  unsigned char payload[REFINENEMT_RESULT_PAYLOAD_SIZE - 3 * sizeof(size_t)];
 };
 
 /**
- * Packet wrapper in MPI_Packet containing segmented data from the alpha vector of the trained
- * system.
+ * Packet wrapped in MPI_Packet describing the alpha vector of the trained system, which is sent
+ * in the frame.
  */
 struct MergeGridNetworkMessage {
   /**
@@ -151,17 +154,13 @@ struct MergeGridNetworkMessage {
    */
   size_t gridversion;
   /**
-   * The index of the class that was trained.
-   */
-  size_t classIndex;
-  /**
-   * The offset from the start of the alpha vector where this segment of data starts.
+   * The version of the master's grid when the batch was assigned.
    */
-  size_t payloadOffset;
+  size_t assignedGridversion;
   /**
-   * The number of values contained in this segment.
+   * The index of the class that was trained.
    */
-  size_t payloadLength;
+  size_t classIndex;
   /**
    * The size of the batch that was trained with.
    */
@@ -171,15 +170,9 @@ struct MergeGridNetworkMessage {
    */
   size_t batchOffset;
   /**
-   * The total size of the alpha vector over all segments.
+   * The total size of the alpha vector.
    */
   size_t alphaTotalSize;
-
-  /**
-   * The packet's data.
-   */
-  unsigned char payload[(MPI_PACKET_MAX_PAYLOAD_SIZE
-      - 7 * sizeof(size_t))];
 };
 
 /**
@@ -194,6 +187,15 @@ struct AssignBatchNetworkMessage {
    * The size of the batch to learn from.
    */
   size_t batchSize;
+  /**
+   * The version of the master's grid when the batch was assigned.
+   */
+  size_t assignedGridversion;
+  /**
+   * The oldest grid version the worker may train the batch on. Workers keep training on the old
+   * grid while a refinement is in progress, afterwards they have to wait for the new grid.
+   */
+  size_t minimumGridversion;
   /**
    * Whether to do cross validation.
    */
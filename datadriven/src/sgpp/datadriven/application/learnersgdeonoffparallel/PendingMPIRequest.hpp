@@ -9,6 +9,8 @@
 
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/MPIRequestPool.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace datadriven {
 class PendingMPIRequest {
@@ -28,6 +30,11 @@ class PendingMPIRequest {
    * The buffer that contains the actual data to be sent or received.
    */
   sgpp::datadriven::MPI_Packet *buffer;
+  /**
+   * The variable-length frame of the message. Outgoing frames are kept here until the transmission
+   * is completed, incoming frames are received here before the callback is executed.
+   */
+  std::vector<unsigned char> frame;
   /**
    * The callback to execute when the incoming/outgoing MPIRequest is completed.
    */
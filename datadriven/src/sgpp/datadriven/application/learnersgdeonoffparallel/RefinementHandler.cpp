@@ -16,15 +16,21 @@
 #include <sgpp/datadriven/algorithm/RefinementMonitorConvergence.hpp>
 #include <sgpp/base/exception/algorithm_exception.hpp>
 
+#include <map>
 #include <vector>
 #include <string>
 
 namespace sgpp {
 namespace datadriven {
+
+// Number of refinement cycles kept to update merged alpha vectors of older grids
+static const size_t REFINEMENT_HISTORY_LENGTH = 2;
+
 bool RefinementHandler::checkReadyForRefinement() const {
   // All local grids in a consistent state and have OK from scheduler
   return learnerInstance->getScheduler().isReadyForRefinement()
-      && learnerInstance->checkAllGridsConsistent();
+      && learnerInstance->checkAllGridsConsistent()
+      && learnerInstance->checkAllRefinementsCompleted();
 }
 
 void RefinementHandler::doRefinementForClass(
@@ -173,6 +179,13 @@ void RefinementHandler::updateClassVariablesAfterRefinement(
 
     learnerInstance->setLocalGridVersion(classIndex, currentGridVersion + 1);
 
+    // Keep the changes to update alpha vectors that are merged from the previous grid
+    std::map<size_t, RefinementResult> &classHistory = refinementHistory[classIndex];
+    classHistory[currentGridVersion + 1] = *refinementResult;
+    while (classHistory.size() > REFINEMENT_HISTORY_LENGTH) {
+      classHistory.erase(classHistory.begin());
+    }
+
     // Send class update in preparation for system matrix decomposition update
     MPIMethods::sendRefinementUpdates(classIndex, refinementResult->deletedGridPointsIndices,
                                       refinementResult->addedGridPoints);
@@ -187,6 +200,9 @@ void RefinementHandler::updateClassVariablesAfterRefinement(
                 << " to worker "
                 << assignTaskResult.workerID << std::endl;
       MPIMethods::assignSystemMatrixUpdate(assignTaskResult.workerID, classIndex);
+
+      // The refinement completes once the new decomposition has been received
+      learnerInstance->setPendingGridVersion(classIndex, currentGridVersion + 1);
     }
   }
 
@@ -194,6 +210,11 @@ void RefinementHandler::updateClassVariablesAfterRefinement(
   D(size_t oldSize = densEst->getAlpha().size();)
   learnerInstance->updateAlpha(classIndex, &(refinementResult->deletedGridPointsIndices),
                        refinementResult->addedGridPoints.size());
+
+  // update the stored right hand side of the online object
+  std::vector<size_t> deletedPoints{std::begin(refinementResult->deletedGridPointsIndices),
+                                    std::end(refinementResult->deletedGridPointsIndices)};
+  densEst->updateRhs(grid.getSize(), deletedPoints);
   D(std::cout << "Updated alpha vector " << classIndex << " (old size " << oldSize
               << ", new size " <<
               densEst->getAlpha().size() << ")" << std::endl;)
@@ -215,10 +236,13 @@ size_t RefinementHandler::checkRefinementNecessary(
   // check if and how many refinements should be performed
   size_t refinementsNecessary = 0;
   if (offline->isRefineable() && numberOfCompletedRefinements < adaptivityConfig.numRefinements_) {
-    currentValidError = learnerInstance->getError(*learnerInstance->getValidationData());
-    currentTrainError = learnerInstance->getError(
-        learnerInstance->getTrainData());  // if train dataset is large
-    // use a subset for error
+    // The periodic monitor doesn't need the errors, which are costly to evaluate on master
+    if (refMonitor != "periodic") {
+      currentValidError = learnerInstance->getError(*learnerInstance->getValidationData());
+      currentTrainError = learnerInstance->getError(
+          learnerInstance->getTrainData());  // if train dataset is large
+      // use a subset for error
+    }
     monitor.pushToBuffer(batchSize, currentValidError, currentTrainError);
     refinementsNecessary = monitor.refinementsNecessary();
   }
@@ -310,6 +334,13 @@ RefinementResult &RefinementHandler::getRefinementResult(size_t classIndex) {
   return vectorRefinementResults[classIndex];
 }
 
+const RefinementResult *RefinementHandler::getRefinementResultForVersion(
+    size_t classIndex, size_t gridVersion) const {
+  const std::map<size_t, RefinementResult> &classHistory = refinementHistory[classIndex];
+  auto iterator = classHistory.find(gridVersion);
+  return (iterator == classHistory.end()) ? nullptr : &(iterator->second);
+}
+
 RefinementHandler::RefinementHandler(
     LearnerSGDEOnOffParallel *learnerInstance,
     size_t numClasses) {
@@ -317,6 +348,7 @@ RefinementHandler::RefinementHandler(
   RefinementResult initResult{};
   vectorRefinementResults.insert(
       vectorRefinementResults.begin(), numClasses, initResult);
+  refinementHistory.resize(numClasses);
 }
 }  // namespace datadriven
 }  // namespace sgpp
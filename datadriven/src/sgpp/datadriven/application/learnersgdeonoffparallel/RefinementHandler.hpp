@@ -41,6 +41,12 @@ class RefinementHandler {
   std::vector<RefinementResult> vectorRefinementResults;
   LearnerSGDEOnOffParallel *learnerInstance;
 
+  /**
+   * The refinement results of the last refinement cycles for every class, mapped to the grid
+   * version they resulted in. Used on master to update outdated alpha vectors.
+   */
+  std::vector<std::map<size_t, RefinementResult>> refinementHistory;
+
   /**
    * Logic that handles data-based and zero-crossing refinement functors
    * @param preCompute Whether to precompute evaluations in the functor
@@ -104,7 +110,18 @@ class RefinementHandler {
   RefinementResult &getRefinementResult(size_t classIndex);
 
   /**
-    * Check whether all grids are consistent and the scheduler is currently allowing refinement.
+   * Fetches the refinement results that changed the grid of a class to a specific version.
+   * Only the last two refinement cycles are stored.
+   * @param classIndex The class to search refinement results for
+   * @param gridVersion The grid version that resulted from the refinement
+   * @return A pointer to the stored refinement results or nullptr if they are no longer stored
+   */
+  const RefinementResult *getRefinementResultForVersion(size_t classIndex,
+                                                        size_t gridVersion) const;
+
+  /**
+    * Check whether all grids are consistent, all previous refinements are completed and the
+    * scheduler is currently allowing refinement.
     * @return Whether refinement is currently possible
     */
   bool checkReadyForRefinement() const;
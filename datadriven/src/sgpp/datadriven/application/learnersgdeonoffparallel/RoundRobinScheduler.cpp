@@ -38,19 +38,24 @@ bool RoundRobinScheduler::isReadyForRefinement() {
   return numOutstandingRequestsLastRefinement == 0;
 }
 
-void RoundRobinScheduler::onMergeRequestIncoming(size_t /*batchOffset*/,
+void RoundRobinScheduler::onMergeRequestIncoming(int /*workerID*/,
+                                                 size_t /*batchOffset*/,
                                                  size_t /*batchSize*/,
-                                                 size_t remoteGridVersion,
+                                                 size_t assignedGridVersion,
                                                  size_t localGridVersion) {
-  if (remoteGridVersion == localGridVersion) {
+  if (assignedGridVersion == localGridVersion) {
     numOutstandingRequestsCurrentRefinement--;
-  } else if (remoteGridVersion + 1 == localGridVersion) {
+  } else if (assignedGridVersion + 1 == localGridVersion) {
     numOutstandingRequestsLastRefinement--;
   } else {
     throw sgpp::base::algorithm_exception("Received merge request that was too old.");
   }
 }
 
+bool RoundRobinScheduler::hasOutstandingTasks() {
+  return numOutstandingRequestsCurrentRefinement + numOutstandingRequestsLastRefinement > 0;
+}
+
 void RoundRobinScheduler::onRefinementStarted() {
   if (numOutstandingRequestsLastRefinement != 0) {
     throw sgpp::base::algorithm_exception("Refinement started illegally.");
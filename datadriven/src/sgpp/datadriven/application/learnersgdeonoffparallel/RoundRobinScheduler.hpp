@@ -45,13 +45,20 @@ class RoundRobinScheduler : public MPITaskScheduler {
    * Update the number of outstanding requests when a request is completed by a worker.
    * The difference in grid versions is used to determine whether to update the current number
    * of outstanding requests or the previous number of outstanding requests.
+   * @param workerID Not used.
    * @param batchOffset Not used.
    * @param batchSize Not used.
-   * @param remoteGridVersion The grid version that was used to train the batch.
+   * @param assignedGridVersion The grid version of the master when the batch was assigned.
    * @param localGridVersion The current grid version on the master.
    */
-  void onMergeRequestIncoming(size_t batchOffset, size_t batchSize,
-                              size_t remoteGridVersion, size_t localGridVersion) override;
+  void onMergeRequestIncoming(int workerID, size_t batchOffset, size_t batchSize,
+                              size_t assignedGridVersion, size_t localGridVersion) override;
+
+  /**
+   * Check whether there are outstanding requests of the current or the previous refinement cycle.
+   * @return Whether there are outstanding requests.
+   */
+  bool hasOutstandingTasks() override;
 
   /**
    * Move the number of current outstanding requests into the number of previous outstanding
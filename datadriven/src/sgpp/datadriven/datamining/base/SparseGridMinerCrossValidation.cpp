@@ -6,6 +6,7 @@
 #include <sgpp/datadriven/datamining/base/SparseGridMinerCrossValidation.hpp>
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
@@ -21,6 +22,7 @@ SparseGridMinerCrossValidation::SparseGridMinerCrossValidation(
     : SparseGridMiner(fitter, scorer, visualizer, postProcesser), dataSource{dataSource} {}
 
 double SparseGridMinerCrossValidation::learn(bool verbose) {
+  SGPP_INSTRUMENT_SCOPE("SparseGridMiner::learn");
   // todo(fuchsgdk): see below
 
 #ifdef USE_SCALAPACK
@@ -95,7 +97,10 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
         }
 
         // Train model on new batch
-        fitter->update(*dataset);
+        {
+          SGPP_INSTRUMENT_SCOPE("SparseGridMiner::fit");
+          fitter->update(*dataset);
+        }
 
         // Evaluate the score on the training and validation data
         double scoreTrain = scorer->test(*fitter, *dataset);
@@ -113,6 +118,7 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
         monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
         size_t refinements = monitor->refinementsNecessary();
         while (refinements--) {
+          SGPP_INSTRUMENT_SCOPE("SparseGridMiner::adapt");
           fitter->adapt();
         }
 
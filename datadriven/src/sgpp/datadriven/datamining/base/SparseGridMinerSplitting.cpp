@@ -6,6 +6,7 @@
 #include <sgpp/datadriven/datamining/base/SparseGridMinerSplitting.hpp>
 
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
 #include <sgpp/datadriven/datamining/builder/ScorerFactory.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
@@ -23,6 +24,7 @@ SparseGridMinerSplitting::SparseGridMinerSplitting(DataSourceSplitting* dataSour
     : SparseGridMiner(fitter, scorer, visualizer, postProcesser), dataSource{dataSource} {}
 
 double SparseGridMinerSplitting::learn(bool verbose) {
+  SGPP_INSTRUMENT_SCOPE("SparseGridMiner::learn");
 #ifdef USE_SCALAPACK
   if (fitter->getFitterConfiguration().getParallelConfig().scalapackEnabled_) {
     auto processGrid = fitter->getProcessGrid();
@@ -82,7 +84,10 @@ double SparseGridMinerSplitting::learn(bool verbose) {
         print(out);
       }
       // Train model on new batch
-      fitter->update(*dataset);
+      {
+        SGPP_INSTRUMENT_SCOPE("SparseGridMiner::fit");
+        fitter->update(*dataset);
+      }
 
       // Evaluate the score on the training and validation data
       double scoreTrain = scorer->test(*fitter, *dataset);
@@ -101,6 +106,7 @@ double SparseGridMinerSplitting::learn(bool verbose) {
       monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
       size_t refinements = monitor->refinementsNecessary();
       while (refinements--) {
+        SGPP_INSTRUMENT_SCOPE("SparseGridMiner::adapt");
         fitter->adapt();
       }
       if (verbose) {
@@ -115,6 +121,7 @@ double SparseGridMinerSplitting::learn(bool verbose) {
 }
 
 double SparseGridMinerSplitting::optimizeLambda(bool verbose) {
+  SGPP_INSTRUMENT_SCOPE("SparseGridMiner::optimizeLambda");
   // init the scorer
   std::unique_ptr<ScorerFactory> factory = std::make_unique<ScorerFactory>();
   lambdaOptimizationScorer = std::unique_ptr<Scorer>(factory->buildRegularizationScorer(
@@ -206,7 +213,10 @@ double SparseGridMinerSplitting::evaluateLambda(double lambda, bool verbose) {
     }
 
     // Train model on new batch
-    fitter->update(*dataset);
+    {
+      SGPP_INSTRUMENT_SCOPE("SparseGridMiner::fit");
+      fitter->update(*dataset);
+    }
     iteration++;
   }
 
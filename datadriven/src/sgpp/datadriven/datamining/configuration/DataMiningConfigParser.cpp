@@ -29,6 +29,7 @@
 
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceFileTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformationTypeParser.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/SpaceFillingCurveTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataSourceShufflingTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/scoring/ScorerMetricTypeParser.hpp>
@@ -203,6 +204,18 @@ bool DataMiningConfigParser::getDataSourceConfig(
 
     config.randomSeed = parseUInt(*dataSourceConfig, "randomSeed",
                                   defaults.randomSeed, "dataSource");
+
+    // parse the ordering of the samples
+    if (dataSourceConfig->contains("ordering")) {
+      config.ordering = SpaceFillingCurveTypeParser::parse(
+          (*dataSourceConfig)["ordering"].get());
+    } else {
+      std::cout
+          << "# Did not find dataSource[ordering]. Setting default value "
+          << SpaceFillingCurveTypeParser::toString(defaults.ordering) << "."
+          << std::endl;
+      config.ordering = defaults.ordering;
+    }
     config.epochs =
         parseUInt(*dataSourceConfig, "epochs", defaults.epochs, "dataSource");
 
@@ -819,6 +832,22 @@ bool DataMiningConfigParser::getVisualizationParameters(
     config.maxNumberIterations =
         parseUInt(*visualizationParameters, "maxNumberIterations",
                   defaults.maxNumberIterations, "visualization");
+
+    config.earlyExaggeration =
+        parseDouble(*visualizationParameters, "earlyExaggeration",
+                    defaults.earlyExaggeration, "visualization");
+
+    config.exaggerationIterations =
+        parseUInt(*visualizationParameters, "exaggerationIterations",
+                  defaults.exaggerationIterations, "visualization");
+
+    config.progressInterval =
+        parseUInt(*visualizationParameters, "progressInterval",
+                  defaults.progressInterval, "visualization");
+
+    config.runAsynchronously =
+        parseBool(*visualizationParameters, "runAsynchronously",
+                  defaults.runAsynchronously, "visualization");
   } else {
     std::cout << "# Could not find specification of visualization parameters. "
                  "Falling Back to default values."
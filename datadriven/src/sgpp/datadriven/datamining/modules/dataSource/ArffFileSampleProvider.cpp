@@ -10,8 +10,10 @@
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
@@ -46,6 +48,7 @@ void ArffFileSampleProvider::readFile(const std::string& fileName,
                                       size_t readinCutoff,
                                       std::vector<size_t> readinColumns,
                                       std::vector<double> readinClasses) {
+  SGPP_INSTRUMENT_SCOPE("SampleProvider::readFile");
   try {
     dataset = ARFFTools::readARFFFromFile(fileName, hasTargets, readinCutoff,
         readinColumns, readinClasses);
@@ -114,6 +117,15 @@ Dataset* ArffFileSampleProvider::splitDataset(size_t howMany) {
   return tmpDataset.release();
 }
 
+bool ArffFileSampleProvider::isSampleLine(const std::string& line, size_t /*lineNumber*/) const {
+  return !line.empty() && line.find('@') == line.npos && line.find('%') == line.npos;
+}
+
+void ArffFileSampleProvider::setDataset(Dataset&& dataset) {
+  this->dataset = std::move(dataset);
+  counter = 0;
+}
+
 void ArffFileSampleProvider::reset() {
   counter = 0;
 }
@@ -10,8 +10,10 @@
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
@@ -46,6 +48,7 @@ void CSVFileSampleProvider::readFile(const std::string& fileName,
                                      size_t readinCutoff,
                                      std::vector<size_t> readinColumns,
                                      std::vector<double> readinClasses) {
+  SGPP_INSTRUMENT_SCOPE("SampleProvider::readFile");
   try {
     // call readCSV with skipfirstline set to true
     dataset = CSVTools::readCSVFromFile(fileName, true, hasTargets, readinCutoff,
@@ -114,6 +117,15 @@ Dataset* CSVFileSampleProvider::splitDataset(size_t howMany) {
   return tmpDataset.release();
 }
 
+bool CSVFileSampleProvider::isSampleLine(const std::string& line, size_t lineNumber) const {
+  return lineNumber > 0 && !line.empty();
+}
+
+void CSVFileSampleProvider::setDataset(Dataset&& dataset) {
+  this->dataset = std::move(dataset);
+  counter = 0;
+}
+
 void CSVFileSampleProvider::reset() {
   counter = 0;
 }
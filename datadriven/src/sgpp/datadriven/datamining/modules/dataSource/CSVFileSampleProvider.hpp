@@ -74,6 +74,16 @@ class CSVFileSampleProvider : public FileSampleProvider {
                   std::vector<size_t> readinColumns = std::vector<size_t>(),
                   std::vector<double> readinClasses = std::vector<double>()) override;
 
+  /**
+   * The first line (column names) and empty lines are skipped.
+   * @param line the line without the line break
+   * @param lineNumber the number of the line in the file, starting with 0
+   * @return whether the line contains a sample
+   */
+  bool isSampleLine(const std::string &line, size_t lineNumber) const override;
+
+  void setDataset(Dataset &&dataset) override;
+
   /**
    * Resets the state of the sample provider (e.g. to start a new epoch)
    */
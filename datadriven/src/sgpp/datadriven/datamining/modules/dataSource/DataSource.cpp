@@ -5,11 +5,13 @@
 
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSource.hpp>
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceIterator.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformation.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformationBuilder.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/SpaceFillingCurveOrder.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <iostream>
@@ -38,6 +40,7 @@ DataSourceIterator DataSource::begin() { return DataSourceIterator(*this, 0); }
 DataSourceIterator DataSource::end() { return DataSourceIterator(*this, config.numBatches); }
 
 Dataset* DataSource::getAllSamples() {
+  SGPP_INSTRUMENT_SCOPE("DataSource::getAllSamples");
   Dataset* dataset = nullptr;
 
   sampleProvider->reset();
@@ -50,13 +53,14 @@ Dataset* DataSource::getAllSamples() {
   // Transform dataset if wanted
   if (!(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
     dataTransformation->initialize(dataset, config.dataTransformationConfig);
-    return dataTransformation->doTransformation(dataset);
+    return orderSamples(dataTransformation->doTransformation(dataset));
   } else {
-    return dataset;
+    return orderSamples(dataset);
   }
 }
 
 Dataset* DataSource::getNextSamples() {
+  SGPP_INSTRUMENT_SCOPE("DataSource::getNextSamples");
   Dataset* dataset = nullptr;
 
   // only one iteration: we want all samples
@@ -67,9 +71,9 @@ Dataset* DataSource::getNextSamples() {
     // Transform dataset if wanted
     if (!(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
       dataTransformation->initialize(dataset, config.dataTransformationConfig);
-      return dataTransformation->doTransformation(dataset);
+      return orderSamples(dataTransformation->doTransformation(dataset));
     } else {
-      return dataset;
+      return orderSamples(dataset);
     }
     // several iterations
   } else {
@@ -80,14 +84,14 @@ Dataset* DataSource::getNextSamples() {
     if (currentIteration == 1 &&
         !(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
       dataTransformation->initialize(dataset, config.dataTransformationConfig);
-      return dataTransformation->doTransformation(dataset);
+      return orderSamples(dataTransformation->doTransformation(dataset));
     }
 
     // Transform dataset if wanted
     if (!(config.dataTransformationConfig.type == DataTransformationType::NONE))
-      return dataTransformation->doTransformation(dataset);
+      return orderSamples(dataTransformation->doTransformation(dataset));
     else
-      return dataset;
+      return orderSamples(dataset);
   }
 }
 
@@ -95,5 +99,12 @@ const DataSourceConfig& DataSource::getConfig() const { return config; }
 
 size_t DataSource::getCurrentIteration() const { return currentIteration; }
 
+Dataset* DataSource::orderSamples(Dataset* dataset) {
+  if (dataset != nullptr && config.ordering != SpaceFillingCurveType::None) {
+    SpaceFillingCurveOrder::orderDataset(*dataset, config.ordering);
+  }
+  return dataset;
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -83,6 +83,14 @@ class DataSource {
   virtual Dataset *getValidationData() = 0;
 
  protected:
+  /**
+   * Orders the samples along the space filling curve specified in the configuration. The
+   * permutation is kept in the dataset, see #sgpp::datadriven::Dataset::getPermutation().
+   * @param dataset the samples to order in place, may be nullptr
+   * @return the ordered dataset
+   */
+  Dataset* orderSamples(Dataset* dataset);
+
   /**
    * Configuration file that determines all relevant properties of the object.
    */
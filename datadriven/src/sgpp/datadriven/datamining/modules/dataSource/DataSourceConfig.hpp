@@ -6,6 +6,7 @@
 #pragma once
 
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformationConfig.hpp>
+#include <sgpp/datadriven/tools/SpaceFillingCurveOrder.hpp>
 
 #include <string>
 #include <vector>
@@ -71,6 +72,11 @@ struct DataSourceConfig {
    * Seed for the shuffling prng
    */
   int64_t randomSeed = -1;
+  /**
+   * Space filling curve along which the samples of every batch are ordered after reading and
+   * transforming them, the permutation is stored in the dataset
+   */
+  SpaceFillingCurveType ordering = SpaceFillingCurveType::None;
   /**
    * The number of epochs to train on
    */
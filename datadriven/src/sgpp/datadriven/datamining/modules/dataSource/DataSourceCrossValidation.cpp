@@ -33,7 +33,7 @@ void DataSourceCrossValidation::reset() {
   // Retrieve validation data again
   delete validationData;
   size_t validationSize = shuffling->getCurrentFoldSize(sampleProvider->getNumSamples());
-  validationData = sampleProvider->getNextSamples(validationSize);
+  validationData = orderSamples(sampleProvider->getNextSamples(validationSize));
 }
 
 void DataSourceCrossValidation::setFold(size_t foldIdx) {
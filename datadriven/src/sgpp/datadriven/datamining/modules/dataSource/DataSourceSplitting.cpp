@@ -21,7 +21,7 @@ void DataSourceSplitting::reset() {
   delete validationData;
   size_t validationSize = static_cast<size_t>(config.validationPortion *
       static_cast<double>(sampleProvider->getNumSamples()));
-  validationData = sampleProvider->getNextSamples(validationSize);
+  validationData = orderSamples(sampleProvider->getNextSamples(validationSize));
 }
 
 } /* namespace datadriven */
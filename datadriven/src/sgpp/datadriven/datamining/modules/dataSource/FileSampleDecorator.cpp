@@ -6,6 +6,7 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleDecorator.hpp>
 
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
@@ -54,5 +55,13 @@ void FileSampleDecorator::readString(const std::string &input,
                                      std::vector<double> readinClasses) {
   fileSampleProvider->readString(input, hasTargets, readinCutoff, readinColumns, readinClasses);
 }
+
+bool FileSampleDecorator::isSampleLine(const std::string &line, size_t lineNumber) const {
+  return fileSampleProvider->isSampleLine(line, lineNumber);
+}
+
+void FileSampleDecorator::setDataset(Dataset &&dataset) {
+  fileSampleProvider->setDataset(std::move(dataset));
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -79,6 +79,10 @@ class FileSampleDecorator : public FileSampleProvider {
                   std::vector<size_t> readinColumns = std::vector<size_t>(),
                   std::vector<double> readinClasses = std::vector<double>()) override;
 
+  bool isSampleLine(const std::string &line, size_t lineNumber) const override;
+
+  void setDataset(Dataset &&dataset) override;
+
  protected:
   /**
    * Delegate #sgpp::datadriven::FileSampleProvider object. Calls to the object will be wrapped by
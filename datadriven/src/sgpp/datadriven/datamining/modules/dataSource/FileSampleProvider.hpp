@@ -54,6 +54,22 @@ class FileSampleProvider : public SampleProvider {
                           size_t readinCutoff = -1,
                           std::vector<size_t> readinColumns = std::vector<size_t>(),
                           std::vector<double> readinClasses = std::vector<double>()) = 0;
+
+  /**
+   * Decides whether a line of the file format contains a sample or e.g. a header or comment. Used
+   * by readers that split the file into lines themselves, e.g. to parse it in parallel.
+   * @param line the line without the line break
+   * @param lineNumber the number of the line in the file, starting with 0
+   * @return whether the line contains a sample
+   */
+  virtual bool isSampleLine(const std::string &line, size_t lineNumber) const = 0;
+
+  /**
+   * Replaces the samples by a dataset that has been read elsewhere, e.g. by a decorator that
+   * parses the file itself. Resets the state of the sample provider.
+   * @param dataset the new samples
+   */
+  virtual void setDataset(Dataset &&dataset) = 0;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -0,0 +1,153 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#include <sgpp/datadriven/datamining/modules/dataSource/GzipBlockReader.hpp>
+
+#include <sgpp/base/exception/file_exception.hpp>
+
+#include <zlib.h>
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+GzipBlockReader::GzipBlockReader(const std::string& fileName, size_t blockSize, size_t maxBlocks)
+    : blockSize(std::max(blockSize, static_cast<size_t>(1))),
+      maxBlocks(std::max(maxBlocks, static_cast<size_t>(1))),
+      finished(false),
+      stopped(false) {
+  gzFile inFileZ = gzopen(fileName.c_str(), "rb");
+
+  if (inFileZ == nullptr) {
+    throw base::file_exception("failed to open Gzip compressed file.");
+  }
+
+  // gzread continues with the next member at the end of each member
+  gzbuffer(inFileZ, 1 << 17);
+  thread = std::thread(&GzipBlockReader::decompress, this, static_cast<void*>(inFileZ));
+}
+
+GzipBlockReader::~GzipBlockReader() {
+  stop();
+  thread.join();
+}
+
+bool GzipBlockReader::next(Block& block) {
+  std::unique_lock<std::mutex> lock(mutex);
+  blockAvailable.wait(lock, [this] { return !blocks.empty() || finished || stopped; });
+
+  if (stopped) {
+    return false;
+  }
+
+  if (blocks.empty()) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+
+    return false;
+  }
+
+  block = std::move(blocks.front());
+  blocks.pop_front();
+  spaceAvailable.notify_one();
+  return true;
+}
+
+void GzipBlockReader::stop() {
+  std::lock_guard<std::mutex> lock(mutex);
+  stopped = true;
+  blockAvailable.notify_all();
+  spaceAvailable.notify_all();
+}
+
+bool GzipBlockReader::push(Block&& block) {
+  std::unique_lock<std::mutex> lock(mutex);
+  spaceAvailable.wait(lock, [this] { return blocks.size() < maxBlocks || stopped; });
+
+  if (stopped) {
+    return false;
+  }
+
+  blocks.push_back(std::move(block));
+  blockAvailable.notify_one();
+  return true;
+}
+
+void GzipBlockReader::decompress(void* file) {
+  gzFile inFileZ = static_cast<gzFile>(file);
+  std::vector<char> buffer(std::min(blockSize, static_cast<size_t>(1) << 16));
+  Block block;
+  size_t nextLine = 0;
+
+  try {
+    block.text.reserve(blockSize + buffer.size());
+
+    while (true) {
+      int unzippedBytes = gzread(inFileZ, buffer.data(), static_cast<unsigned int>(buffer.size()));
+
+      if (unzippedBytes < 0) {
+        throw base::file_exception("failed to decompress Gzip compressed file.");
+      }
+
+      if (unzippedBytes == 0) {
+        break;
+      }
+
+      block.text.append(buffer.data(), unzippedBytes);
+
+      if (block.text.size() < blockSize) {
+        continue;
+      }
+
+      size_t lastLineBreak = block.text.rfind('\n');
+
+      if (lastLineBreak == std::string::npos) {
+        // a single line longer than the block size
+        continue;
+      }
+
+      // the incomplete last line is carried over to the next block
+      Block nextBlock;
+      nextBlock.index = block.index + 1;
+      nextBlock.text.reserve(blockSize + buffer.size());
+      nextBlock.text.assign(block.text, lastLineBreak + 1, std::string::npos);
+      block.text.resize(lastLineBreak + 1);
+
+      block.firstLine = nextLine;
+      nextLine += std::count(block.text.begin(), block.text.end(), '\n');
+
+      if (!push(std::move(block))) {
+        gzclose(inFileZ);
+        return;
+      }
+
+      block = std::move(nextBlock);
+    }
+
+    if (!block.text.empty()) {
+      block.firstLine = nextLine;
+      push(std::move(block));
+    }
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex);
+    error = std::current_exception();
+  }
+
+  gzclose(inFileZ);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  finished = true;
+  blockAvailable.notify_all();
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
+#endif
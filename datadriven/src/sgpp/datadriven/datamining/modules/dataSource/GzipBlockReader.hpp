@@ -0,0 +1,102 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Decompresses a gzip compressed text file in a background thread into blocks of whole lines.
+ *
+ * The blocks are kept in a bounded queue, so decompression runs ahead of the consumers by at most
+ * a fixed number of blocks and the uncompressed file is never held in memory as a whole. Several
+ * consumer threads may take blocks concurrently, the blocks carry their position in the file to
+ * restore the order. Files consisting of several gzip members (e.g. written by pigz or bgzip) are
+ * read member after member.
+ */
+class GzipBlockReader {
+ public:
+  /**
+   * A block of whole lines of the uncompressed file.
+   */
+  struct Block {
+    /// position of the block in the file, starting with 0
+    size_t index = 0;
+    /// number of the first line of the block in the file, starting with 0
+    size_t firstLine = 0;
+    /// the lines including their line breaks, the last line of the file may lack it
+    std::string text;
+  };
+
+  /**
+   * Opens the file and starts decompressing it in the background. Throws if the file can not be
+   * opened.
+   * @param fileName path to the gzip compressed file
+   * @param blockSize approximate number of uncompressed bytes per block, a block is extended to
+   *        the end of its last line
+   * @param maxBlocks maximum number of blocks decompressed ahead of the consumers
+   */
+  explicit GzipBlockReader(const std::string &fileName, size_t blockSize = 1 << 20,
+                           size_t maxBlocks = 8);
+
+  GzipBlockReader(const GzipBlockReader &rhs) = delete;
+
+  GzipBlockReader &operator=(const GzipBlockReader &rhs) = delete;
+
+  /**
+   * Stops the decompression and waits for the background thread.
+   */
+  ~GzipBlockReader();
+
+  /**
+   * Takes the next block, waiting for the decompression if necessary. Thread safe. Rethrows
+   * errors of the decompression.
+   * @param[out] block the next block
+   * @return false if the file has been read completely or the reader has been stopped
+   */
+  bool next(Block &block);
+
+  /**
+   * Stops the decompression, all further calls of #next return false.
+   */
+  void stop();
+
+ private:
+  /**
+   * Main function of the background thread, closes the file at the end.
+   * @param file the opened gzFile
+   */
+  void decompress(void *file);
+
+  /**
+   * Appends a block to the queue, waits while the queue is full.
+   * @return false if the reader has been stopped
+   */
+  bool push(Block &&block);
+
+  size_t blockSize;
+  size_t maxBlocks;
+  std::deque<Block> blocks;
+  bool finished;
+  bool stopped;
+  std::exception_ptr error;
+  std::mutex mutex;
+  std::condition_variable blockAvailable;
+  std::condition_variable spaceAvailable;
+  std::thread thread;
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
+#endif
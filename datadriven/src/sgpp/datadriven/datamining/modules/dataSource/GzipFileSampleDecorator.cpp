@@ -7,18 +7,45 @@
 
 #include <sgpp/datadriven/datamining/modules/dataSource/GzipFileSampleDecorator.hpp>
 
+#include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/GzipBlockReader.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
+#include <sgpp/globaldef.hpp>
 
-#include <zlib.h>
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace sgpp {
 namespace datadriven {
 
-GzipFileSampleDecorator::GzipFileSampleDecorator(FileSampleProvider* const fileSampleProvider)
-    : FileSampleDecorator(fileSampleProvider) {}
+GzipFileSampleDecorator::GzipFileSampleDecorator(FileSampleProvider* const fileSampleProvider,
+                                                 bool streamSamples, size_t numParserThreads)
+    : FileSampleDecorator(fileSampleProvider),
+      streamSamples(streamSamples),
+      numParserThreads(numParserThreads),
+      hasTargets(false),
+      readinCutoff(std::numeric_limits<size_t>::max()),
+      numColumns(0),
+      dimension(0),
+      pendingOffset(0),
+      numDelivered(0) {}
+
+GzipFileSampleDecorator::GzipFileSampleDecorator(const GzipFileSampleDecorator& rhs)
+    : FileSampleDecorator(rhs),
+      streamSamples(rhs.streamSamples),
+      numParserThreads(rhs.numParserThreads),
+      hasTargets(false),
+      readinCutoff(std::numeric_limits<size_t>::max()),
+      numColumns(0),
+      dimension(0),
+      pendingOffset(0),
+      numDelivered(0) {}
 
 SampleProvider* GzipFileSampleDecorator::clone() const {
   return dynamic_cast<SampleProvider*>(new GzipFileSampleDecorator{*this});
@@ -29,35 +56,176 @@ void GzipFileSampleDecorator::readFile(const std::string& fileName,
                                        size_t readinCutoff,
                                        std::vector<size_t> readinColumns,
                                        std::vector<double> readinClasses) {
-  gzFile inFileZ = gzopen(fileName.c_str(), "rb");
+  SGPP_INSTRUMENT_SCOPE("SampleProvider::readFile");
+  this->fileName = fileName;
+  this->hasTargets = hasTargets;
+  this->readinCutoff = readinCutoff;
+  this->readinColumns = readinColumns;
+  this->readinClasses = readinClasses;
+  numColumns = 0;
+  dimension = readinColumns.size();
+
+  startParser();
+
+  if (streamSamples) {
+    // the dimension has to be known before the first samples are requested
+    while (numColumns == 0 && parser->next(pendingBlock)) {
+      checkColumns(pendingBlock);
+    }
+
+    return;
+  }
 
-  if (inFileZ == nullptr) {
-    throw base::file_exception("failed to open Gzip compressed file.");
+  std::vector<ParallelSampleParser::SampleBlock> blocks;
+  ParallelSampleParser::SampleBlock block;
+  size_t numSamples = 0;
+
+  while (numSamples < readinCutoff && parser->next(block)) {
+    checkColumns(block);
+    numSamples += block.numSamples;
+    blocks.push_back(std::move(block));
   }
 
-  size_t unzippedBytes = 0;
-  std::vector<char> unzippedData(8192);
+  parser.reset();
+
+  if (numColumns == 0) {
+    throw base::data_exception("Gzip compressed file contains no samples.");
+  }
 
-  std::string convert;
-  convert.reserve(unzippedData.size());
+  numSamples = std::min(numSamples, readinCutoff);
+  Dataset dataset(numSamples, dimension);
+  size_t row = 0;
 
-  while (true) {
-    unzippedBytes =
-        gzread(inFileZ, unzippedData.data(), static_cast<unsigned int>(unzippedData.size() - 1));
+  for (auto& parsedBlock : blocks) {
+    size_t numRows = std::min(parsedBlock.numSamples, numSamples - row);
+    std::copy(parsedBlock.samples.begin(), parsedBlock.samples.begin() + numRows * dimension,
+              dataset.getData().begin() + row * dimension);
 
-    if (unzippedBytes > 0) {
-      convert.append(unzippedData.begin(), unzippedData.begin() + unzippedBytes);
-    } else {
-      break;
+    if (hasTargets) {
+      std::copy(parsedBlock.targets.begin(), parsedBlock.targets.begin() + numRows,
+                dataset.getTargets().begin() + row);
     }
+
+    row += numRows;
+    // release the parsed values while the dataset is filled
+    ParallelSampleParser::SampleBlock().samples.swap(parsedBlock.samples);
+    ParallelSampleParser::SampleBlock().targets.swap(parsedBlock.targets);
+  }
+
+  fileSampleProvider->setDataset(std::move(dataset));
+}
+
+Dataset* GzipFileSampleDecorator::getNextSamples(size_t howMany) {
+  if (streamSamples) {
+    return takeSamples(howMany);
+  } else {
+    return FileSampleDecorator::getNextSamples(howMany);
   }
+}
+
+Dataset* GzipFileSampleDecorator::getAllSamples() {
+  if (streamSamples) {
+    return takeSamples(std::numeric_limits<size_t>::max());
+  } else {
+    return FileSampleDecorator::getAllSamples();
+  }
+}
 
-  gzclose(inFileZ);
-  fileSampleProvider->readString(convert, hasTargets,
-    readinCutoff, readinColumns, readinClasses);
+size_t GzipFileSampleDecorator::getDim() const {
+  if (!streamSamples) {
+    return FileSampleDecorator::getDim();
+  } else if (dimension != 0) {
+    return dimension;
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
+}
+
+size_t GzipFileSampleDecorator::getNumSamples() const {
+  if (!streamSamples) {
+    return FileSampleDecorator::getNumSamples();
+  } else if (dimension != 0) {
+    return numDelivered;
+  } else {
+    throw base::file_exception{"No dataset loaded."};
+  }
 }
 
 void GzipFileSampleDecorator::reset() {
+  if (!streamSamples) {
+    fileSampleProvider->reset();
+  } else if (!fileName.empty()) {
+    startParser();
+  }
+}
+
+void GzipFileSampleDecorator::startParser() {
+  // the old threads have to be stopped before the state is reset
+  parser.reset();
+  pendingBlock = ParallelSampleParser::SampleBlock();
+  pendingOffset = 0;
+  numDelivered = 0;
+  parser = std::make_unique<ParallelSampleParser>(std::make_unique<GzipBlockReader>(fileName),
+                                                  *fileSampleProvider, hasTargets, readinColumns,
+                                                  readinClasses, numParserThreads);
+}
+
+void GzipFileSampleDecorator::checkColumns(const ParallelSampleParser::SampleBlock& block) {
+  if (block.numColumns == 0) {
+    return;
+  }
+
+  if (numColumns == 0) {
+    numColumns = block.numColumns;
+
+    if (readinColumns.empty()) {
+      dimension = numColumns - (hasTargets ? 1 : 0);
+    }
+  } else if (block.numColumns != numColumns) {
+    throw base::data_exception("Gzip compressed file has lines with different numbers of columns.");
+  }
+}
+
+Dataset* GzipFileSampleDecorator::takeSamples(size_t howMany) {
+  if (!parser) {
+    throw base::file_exception{"No dataset loaded."};
+  }
+
+  howMany = std::min(howMany, readinCutoff - std::min(readinCutoff, numDelivered));
+  std::vector<double> samples;
+  std::vector<double> targets;
+  size_t numSamples = 0;
+
+  while (numSamples < howMany) {
+    if (pendingOffset >= pendingBlock.numSamples) {
+      if (!parser->next(pendingBlock)) {
+        break;
+      }
+
+      checkColumns(pendingBlock);
+      pendingOffset = 0;
+      continue;
+    }
+
+    size_t numRows = std::min(pendingBlock.numSamples - pendingOffset, howMany - numSamples);
+    samples.insert(samples.end(), pendingBlock.samples.begin() + pendingOffset * dimension,
+                   pendingBlock.samples.begin() + (pendingOffset + numRows) * dimension);
+
+    if (hasTargets) {
+      targets.insert(targets.end(), pendingBlock.targets.begin() + pendingOffset,
+                     pendingBlock.targets.begin() + pendingOffset + numRows);
+    }
+
+    pendingOffset += numRows;
+    numSamples += numRows;
+  }
+
+  auto dataset = std::make_unique<Dataset>(numSamples, dimension);
+  std::copy(samples.begin(), samples.end(), dataset->getData().begin());
+  std::copy(targets.begin(), targets.end(), dataset->getTargets().begin());
+  numDelivered += numSamples;
+
+  return dataset.release();
 }
 
 } /* namespace datadriven */
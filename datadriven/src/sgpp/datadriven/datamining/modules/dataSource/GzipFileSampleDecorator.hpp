@@ -7,7 +7,9 @@
 #pragma once
 
 #include <sgpp/datadriven/datamining/modules/dataSource/FileSampleDecorator.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/ParallelSampleParser.hpp>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -17,7 +19,14 @@ namespace datadriven {
  * Adds the ability to read gzip compressed files to file sample providers.
  *
  * This class wraps any valid #sgpp::datadriven::FileSampleProvider object and adds a decompression
- * step to the #readFile member function before trying to parse the contents of the file.
+ * step to the #readFile member function. The file is decompressed in a background thread into
+ * blocks of whole lines, which are parsed in parallel while the following blocks are decompressed.
+ * The wrapped provider decides which lines contain samples.
+ *
+ * By default the whole file is read by #readFile and the samples are handed to the wrapped
+ * provider. If the samples are streamed, #readFile only starts reading and #getNextSamples returns
+ * the samples in the order of the file as soon as they are parsed, without keeping the whole
+ * dataset in memory. Shuffling of the wrapped provider is not applied in that case.
  */
 class GzipFileSampleDecorator : public FileSampleDecorator {
  public:
@@ -25,14 +34,25 @@ class GzipFileSampleDecorator : public FileSampleDecorator {
    * Constructor decorating a FileSampleProvider object.
    *
    * @param fileSampleProvider: pointer to the object to be used as a delegate.
+   * @param streamSamples whether the samples are delivered in batches while the file is read
+   * @param numParserThreads number of threads parsing the decompressed blocks, 0 to choose it from
+   *        the hardware concurrency
+   */
+  explicit GzipFileSampleDecorator(FileSampleProvider* fileSampleProvider,
+                                   bool streamSamples = false, size_t numParserThreads = 0);
+
+  /**
+   * Copy constructor, copies the settings and the samples of the wrapped provider, but not the
+   * state of a running stream.
+   * @param rhs the object to copy from
    */
-  explicit GzipFileSampleDecorator(FileSampleProvider* fileSampleProvider);
+  GzipFileSampleDecorator(const GzipFileSampleDecorator &rhs);
 
   SampleProvider* clone() const override;
 
   /**
-   * Decompresses a .gz file and delegates the contents down to the
-   * sample provider.
+   * Decompresses a .gz file and parses its contents, either completely, handing the samples to
+   * the sample provider, or in the background if the samples are streamed.
    * @param fileName path to the file
    * @param hasTargets whether the file has targets (i.e. supervised learning)
    * @param readinCutoff see FileSampleProvider.hpp
@@ -46,9 +66,68 @@ class GzipFileSampleDecorator : public FileSampleDecorator {
                 std::vector<double> readinClasses = std::vector<double>()) override;
 
   /**
-   * Resets the state of the sample provider (e.g. to start a new epoch)
+   * Returns the next samples. If the samples are streamed, waits until they are parsed.
+   * @param howMany number of samples
+   * @return the samples, less than howMany at the end of the file
+   */
+  Dataset *getNextSamples(size_t howMany) override;
+
+  Dataset *getAllSamples() override;
+
+  size_t getDim() const override;
+
+  /**
+   * @return the number of samples, if the samples are streamed the number of samples delivered
+   * so far, as the total number is only known at the end of the file
+   */
+  size_t getNumSamples() const override;
+
+  /**
+   * Resets the state of the sample provider (e.g. to start a new epoch). If the samples are
+   * streamed, the file is read again from the start.
    */
   void reset() override;
+
+ private:
+  /**
+   * Starts decompressing and parsing the file of the last #readFile call.
+   */
+  void startParser();
+
+  /**
+   * Checks that a parsed block has the same number of columns as the previous ones and determines
+   * the dimension from the first block containing samples.
+   */
+  void checkColumns(const ParallelSampleParser::SampleBlock &block);
+
+  /**
+   * Takes samples of the running stream.
+   */
+  Dataset *takeSamples(size_t howMany);
+
+  bool streamSamples;
+  size_t numParserThreads;
+
+  /// arguments of the last #readFile call
+  std::string fileName;
+  bool hasTargets;
+  size_t readinCutoff;
+  std::vector<size_t> readinColumns;
+  std::vector<double> readinClasses;
+
+  /// number of values per line of the file, 0 if not known yet
+  size_t numColumns;
+  /// dimension of the samples
+  size_t dimension;
+
+  /// the running stream, only if the samples are streamed
+  std::unique_ptr<ParallelSampleParser> parser;
+  /// parsed block of the stream that has not been delivered completely
+  ParallelSampleParser::SampleBlock pendingBlock;
+  /// number of samples of pendingBlock that have been delivered
+  size_t pendingOffset;
+  /// number of samples delivered since the last reset
+  size_t numDelivered;
 };
 
 } /* namespace datadriven */
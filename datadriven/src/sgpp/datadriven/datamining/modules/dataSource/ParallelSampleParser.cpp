@@ -0,0 +1,202 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#include <sgpp/datadriven/datamining/modules/dataSource/ParallelSampleParser.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+ParallelSampleParser::ParallelSampleParser(std::unique_ptr<GzipBlockReader> reader,
+                                           const FileSampleProvider& format, bool hasTargets,
+                                           std::vector<size_t> readinColumns,
+                                           std::vector<double> readinClasses, size_t numThreads,
+                                           size_t maxBlocks)
+    : reader(std::move(reader)),
+      format(format),
+      hasTargets(hasTargets),
+      readinColumns(std::move(readinColumns)),
+      readinClasses(std::move(readinClasses)),
+      maxBlocks(std::max(maxBlocks, static_cast<size_t>(1))),
+      nextIndex(0),
+      numFinished(0),
+      stopped(false) {
+  if (numThreads == 0) {
+    // one core is busy with the decompression
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    numThreads = (hardwareThreads > 2) ? hardwareThreads - 1 : 1;
+  }
+
+  for (size_t i = 0; i < numThreads; i++) {
+    threads.emplace_back(&ParallelSampleParser::parse, this);
+  }
+}
+
+ParallelSampleParser::~ParallelSampleParser() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopped = true;
+    parsedChanged.notify_all();
+  }
+
+  reader->stop();
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+bool ParallelSampleParser::next(SampleBlock& block) {
+  std::unique_lock<std::mutex> lock(mutex);
+  parsedChanged.wait(lock, [this] {
+    return parsed.count(nextIndex) > 0 || error || numFinished == threads.size();
+  });
+
+  auto it = parsed.find(nextIndex);
+
+  if (it != parsed.end()) {
+    block = std::move(it->second);
+    parsed.erase(it);
+    nextIndex++;
+    parsedChanged.notify_all();
+    return true;
+  }
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+
+  return false;
+}
+
+void ParallelSampleParser::parse() {
+  try {
+    GzipBlockReader::Block block;
+
+    while (reader->next(block)) {
+      SampleBlock samples;
+      parseBlock(block, samples);
+
+      std::unique_lock<std::mutex> lock(mutex);
+      // the block taken next may always be stored, otherwise the consumer could wait forever
+      parsedChanged.wait(lock, [this, &block] {
+        return stopped || parsed.size() < maxBlocks || block.index == nextIndex;
+      });
+
+      if (stopped) {
+        break;
+      }
+
+      parsed.emplace(block.index, std::move(samples));
+      parsedChanged.notify_all();
+    }
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (!error) {
+      error = std::current_exception();
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  numFinished++;
+  parsedChanged.notify_all();
+}
+
+void ParallelSampleParser::parseBlock(const GzipBlockReader::Block& block,
+                                      SampleBlock& samples) const {
+  const std::string& text = block.text;
+  const size_t numTargets = hasTargets ? 1 : 0;
+  size_t lineNumber = block.firstLine;
+  size_t position = 0;
+  std::string line;
+  std::vector<double> values;
+
+  for (; position < text.size(); lineNumber++) {
+    size_t lineBreak = std::min(text.find('\n', position), text.size());
+    size_t lineEnd = (lineBreak > position && text[lineBreak - 1] == '\r') ? lineBreak - 1
+                                                                           : lineBreak;
+    line.assign(text, position, lineEnd - position);
+    position = lineBreak + 1;
+
+    if (!format.isSampleLine(line, lineNumber)) {
+      continue;
+    }
+
+    // comma separated values, invalid values are read as 0 like atof does
+    values.clear();
+    const char* value = line.c_str();
+
+    while (true) {
+      char* valueEnd = nullptr;
+      double parsedValue = std::strtod(value, &valueEnd);
+      values.push_back(valueEnd == value ? 0.0 : parsedValue);
+      const char* separator = std::strchr(valueEnd, ',');
+
+      if (separator == nullptr) {
+        break;
+      }
+
+      value = separator + 1;
+    }
+
+    if (samples.numColumns == 0) {
+      samples.numColumns = values.size();
+
+      if (values.size() <= numTargets) {
+        throw base::data_exception("ParallelSampleParser: no columns for the samples");
+      }
+
+      if (!readinColumns.empty() &&
+          *std::max_element(readinColumns.begin(), readinColumns.end()) >=
+              values.size() - numTargets) {
+        throw base::data_exception("ParallelSampleParser: invalid column selection");
+      }
+    } else if (values.size() != samples.numColumns) {
+      throw base::data_exception("ParallelSampleParser: wrong number of columns");
+    }
+
+    if (hasTargets) {
+      double target = values.back();
+      // the same tolerance as the ARFF and CSV readers
+      bool isSelectedClass = readinClasses.empty();
+
+      for (double cl : readinClasses) {
+        isSelectedClass = isSelectedClass || std::fabs(target - cl) < 0.001;
+      }
+
+      if (!isSelectedClass) {
+        continue;
+      }
+
+      samples.targets.push_back(target);
+    }
+
+    if (readinColumns.empty()) {
+      samples.samples.insert(samples.samples.end(), values.begin(), values.end() - numTargets);
+    } else {
+      for (size_t column : readinColumns) {
+        samples.samples.push_back(values[column]);
+      }
+    }
+
+    samples.numSamples++;
+  }
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
+#endif
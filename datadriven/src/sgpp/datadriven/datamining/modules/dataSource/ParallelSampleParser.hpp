@@ -0,0 +1,114 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+#pragma once
+
+#include <sgpp/datadriven/datamining/modules/dataSource/FileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/GzipBlockReader.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Parses the blocks of a #sgpp::datadriven::GzipBlockReader into samples in several threads,
+ * while the reader decompresses the following blocks, and returns the parsed blocks in the order
+ * of the file.
+ *
+ * Lines are accepted as samples according to the file format given by a
+ * #sgpp::datadriven::FileSampleProvider and consist of comma separated values, the last one being
+ * the target if the file has targets.
+ */
+class ParallelSampleParser {
+ public:
+  /**
+   * The selected samples of one block of lines.
+   */
+  struct SampleBlock {
+    /// number of values per line of the file, including the target
+    size_t numColumns = 0;
+    /// number of samples
+    size_t numSamples = 0;
+    /// the samples row by row, restricted to the selected columns
+    std::vector<double> samples;
+    /// the targets, empty if the file has no targets
+    std::vector<double> targets;
+  };
+
+  /**
+   * Starts the parser threads.
+   * @param reader the reader of the file, the parser takes ownership
+   * @param format decides which lines contain samples, has to outlive the parser
+   * @param hasTargets whether the last value of each line is the target
+   * @param readinColumns see FileSampleProvider.hpp
+   * @param readinClasses see FileSampleProvider.hpp
+   * @param numThreads number of parser threads, 0 to choose it from the hardware concurrency
+   * @param maxBlocks maximum number of parsed blocks waiting to be taken
+   */
+  ParallelSampleParser(std::unique_ptr<GzipBlockReader> reader, const FileSampleProvider &format,
+                       bool hasTargets, std::vector<size_t> readinColumns,
+                       std::vector<double> readinClasses, size_t numThreads = 0,
+                       size_t maxBlocks = 8);
+
+  ParallelSampleParser(const ParallelSampleParser &rhs) = delete;
+
+  ParallelSampleParser &operator=(const ParallelSampleParser &rhs) = delete;
+
+  /**
+   * Stops reading and parsing and waits for the threads.
+   */
+  ~ParallelSampleParser();
+
+  /**
+   * Takes the next parsed block in the order of the file, waits if it is not parsed yet. Rethrows
+   * errors of the reader and the parser threads.
+   * @param[out] block the next block
+   * @return false if all blocks have been taken
+   */
+  bool next(SampleBlock &block);
+
+ private:
+  /**
+   * Main function of the parser threads.
+   */
+  void parse();
+
+  /**
+   * Parses the lines of one block.
+   */
+  void parseBlock(const GzipBlockReader::Block &block, SampleBlock &samples) const;
+
+  std::unique_ptr<GzipBlockReader> reader;
+  const FileSampleProvider &format;
+  bool hasTargets;
+  std::vector<size_t> readinColumns;
+  std::vector<double> readinClasses;
+  size_t maxBlocks;
+
+  /// parsed blocks by their index
+  std::map<size_t, SampleBlock> parsed;
+  /// index of the block to be taken next
+  size_t nextIndex;
+  /// number of parser threads that have finished
+  size_t numFinished;
+  bool stopped;
+  std::exception_ptr error;
+  std::mutex mutex;
+  std::condition_variable parsedChanged;
+  std::vector<std::thread> threads;
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
+#endif
@@ -0,0 +1,46 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/SpaceFillingCurveTypeParser.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <algorithm>
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::data_exception;
+
+SpaceFillingCurveType SpaceFillingCurveTypeParser::parse(const std::string& input) {
+  auto inputLower = input;
+  std::transform(inputLower.begin(), inputLower.end(), inputLower.begin(), ::tolower);
+
+  if (inputLower == curveTypeMap.at(SpaceFillingCurveType::None)) {
+    return SpaceFillingCurveType::None;
+  } else if (inputLower == curveTypeMap.at(SpaceFillingCurveType::Morton)) {
+    return SpaceFillingCurveType::Morton;
+  } else if (inputLower == curveTypeMap.at(SpaceFillingCurveType::Hilbert)) {
+    return SpaceFillingCurveType::Hilbert;
+  } else {
+    const std::string errorMsg =
+        "Failed to convert string \"" + input + "\" to any known SpaceFillingCurveType";
+    throw data_exception(errorMsg.c_str());
+  }
+}
+
+const std::string& SpaceFillingCurveTypeParser::toString(SpaceFillingCurveType type) {
+  return curveTypeMap.at(type);
+}
+
+const SpaceFillingCurveTypeParser::CurveTypeMap_t SpaceFillingCurveTypeParser::curveTypeMap =
+    []() {
+      return CurveTypeMap_t{std::make_pair(SpaceFillingCurveType::None, "none"),
+                            std::make_pair(SpaceFillingCurveType::Morton, "morton"),
+                            std::make_pair(SpaceFillingCurveType::Hilbert, "hilbert")};
+    }();
+} /* namespace datadriven */
+} /* namespace sgpp */
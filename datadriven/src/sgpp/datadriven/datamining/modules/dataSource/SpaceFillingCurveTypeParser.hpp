@@ -0,0 +1,48 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/tools/SpaceFillingCurveOrder.hpp>
+
+#include <map>
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Convenience class to convert strings to #sgpp::datadriven::SpaceFillingCurveType and generate
+ * string representations for values of #sgpp::datadriven::SpaceFillingCurveType.
+ */
+class SpaceFillingCurveTypeParser {
+ public:
+  /**
+   * Convert strings to values #sgpp::datadriven::SpaceFillingCurveType. Throws if there is no valid
+   * representation
+   * @param input case insensitive string representation of a
+   * #sgpp::datadriven::SpaceFillingCurveType.
+   * @return the corresponding #sgpp::datadriven::SpaceFillingCurveType.
+   */
+  static SpaceFillingCurveType parse(const std::string& input);
+
+  /**
+   * generate string representations for values of #sgpp::datadriven::SpaceFillingCurveType.
+   * @param type enum value.
+   * @return string representation of a #sgpp::datadriven::SpaceFillingCurveType.
+   */
+  static const std::string& toString(SpaceFillingCurveType type);
+
+ private:
+  typedef std::map<SpaceFillingCurveType, std::string> CurveTypeMap_t;
+  /**
+   * Map containing all values of #sgpp::datadriven::SpaceFillingCurveType and the corresponding
+   * string representation.
+   */
+  static const CurveTypeMap_t curveTypeMap;
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
@@ -4,6 +4,7 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingClustering.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingDensityEstimationCG.hpp>
@@ -13,7 +14,6 @@
 
 #include <map>
 #include <iostream>
-#include <ctime>
 #include <vector>
 
 using sgpp::base::DataMatrix;
@@ -160,13 +160,9 @@ void ModelFittingClustering::generateSimilarityGraph() {
 }
 
 void ModelFittingClustering::updateVpTree(DataMatrix &newDataset) {
-  clock_t start = std::clock();
+  SGPP_INSTRUMENT_SCOPE("ModelFittingClustering::updateVpTree");
   if (vpTree == nullptr) {
     this->vpTree = std::make_unique<VpTree>(newDataset);
-    clock_t end = std::clock();
-    std::cout << "VpTree updated in  " <<
-              std::to_string(static_cast<double>(end - start) / CLOCKS_PER_SEC) << " seconds"
-              << std::endl;
   }
 }
 
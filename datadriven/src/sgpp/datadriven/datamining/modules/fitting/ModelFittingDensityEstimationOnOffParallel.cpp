@@ -11,6 +11,7 @@
 #include <sgpp/base/grid/generation/functors/SurplusVolumeRefinementFunctor.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDatabase.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOnlineDEChol.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOnlineDEFactory.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOnlineDE_SMW.hpp>
 #include <sgpp/datadriven/scalapack/DataMatrixDistributed.hpp>
@@ -212,6 +213,19 @@ bool ModelFittingDensityEstimationOnOffParallel::adapt(
         config->getDensityEstimationConfig(), *grid, newNoPoints - oldNoPoints,
         deletedGridPoints, config->getRegularizationConfig().lambda_,
         processGrid, parallelConfig);
+#endif      /* USE_SCALAPACK */
+  } else if (densityEstimationConfig.decomposition_ ==
+             MatrixDecompositionType::Chol) {
+#ifdef USE_SCALAPACK
+    // the cholesky factorization is modified directly on the distributed
+    // matrix
+    sgpp::datadriven::DBMatOnlineDEChol* online_Chol_pointer;
+    online_Chol_pointer =
+        static_cast<sgpp::datadriven::DBMatOnlineDEChol*>(&*online);
+    online_Chol_pointer->updateSystemMatrixDecompositionParallel(
+        config->getDensityEstimationConfig(), *grid, newNoPoints - oldNoPoints,
+        deletedGridPoints, config->getRegularizationConfig().lambda_,
+        processGrid, parallelConfig);
 #endif      /* USE_SCALAPACK */
   } else {  // every other decomposition type than SMW
     // Update online object: lhs, rhs and recompute the density function based
@@ -222,7 +236,11 @@ bool ModelFittingDensityEstimationOnOffParallel::adapt(
   }
   online->updateRhs(newNoPoints, deletedGridPoints);
 
-  online->syncDistributedDecomposition(processGrid, parallelConfig);
+  // the distributed cholesky factorization is already up to date, the local
+  // one is outdated and only synchronized on demand
+  if (densityEstimationConfig.decomposition_ != MatrixDecompositionType::Chol) {
+    online->syncDistributedDecomposition(processGrid, parallelConfig);
+  }
   return true;
 }
 
@@ -7,6 +7,7 @@
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingClustering.hpp>
 
 #include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingDensityEstimationOnOffParallel.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 
@@ -18,6 +19,7 @@ namespace datadriven {
 Scorer::Scorer(Metric* metric) : metric{std::unique_ptr<Metric>{metric}} {}
 
 double Scorer::test(ModelFittingBase& model, Dataset& testDataset, bool lowerIsBetter) {
+  SGPP_INSTRUMENT_SCOPE("Scorer::test");
 #ifdef USE_SCALAPACK
   if (model.getFitterConfiguration().getParallelConfig().scalapackEnabled_) {
     return testDistributed(model, testDataset, lowerIsBetter);
@@ -66,6 +68,7 @@ double Scorer::testDistributed(ModelFittingBase& model, Dataset& testDataset, bo
 
 double Scorer::testPostProcessing(ModelFittingBase& model,
                                   DataSource& dataSource) {
+  SGPP_INSTRUMENT_SCOPE("Scorer::testPostProcessing");
   return metric->measurePostProcessing(model, dataSource);
 }
 
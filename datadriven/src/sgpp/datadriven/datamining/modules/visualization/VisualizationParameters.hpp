@@ -31,6 +31,30 @@ struct VisualizationParameters {
    * algorithm
    */
   std::size_t maxNumberIterations = 1000;
+
+  /*
+   * The factor by which the input similarities of tsne are exaggerated during the first
+   * iterations, which lets clusters form earlier
+   */
+  double earlyExaggeration = 12.0;
+
+  /*
+   * The number of iterations of tsne with exaggerated similarities, 0 disables the
+   * exaggeration
+   */
+  std::size_t exaggerationIterations = 250;
+
+  /*
+   * The number of iterations between two progress checkpoints of tsne, in which the current
+   * error is evaluated and reported
+   */
+  std::size_t progressInterval = 50;
+
+  /*
+   * Whether tsne is started in a background thread as soon as the data is available, so that it
+   * runs while the model is trained instead of blocking the post processing
+   */
+  bool runAsynchronously = true;
 };
 }  // namespace datadriven
 }  // namespace sgpp
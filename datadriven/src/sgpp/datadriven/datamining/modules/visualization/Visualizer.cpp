@@ -6,9 +6,12 @@
 
 #include <sgpp/datadriven/datamining/modules/visualization/Visualizer.hpp>
 #include <sgpp/datadriven/datamining/modules/visualization/algorithms/bhtsne/tsne.hpp>
+#include <omp.h>
 #include <string>
 #include<iostream>
 #include <algorithm>
+#include <future>
+#include <memory>
 #include <vector>
 #ifdef _WIN32
 #include <direct.h>
@@ -37,13 +40,45 @@ void Visualizer::createFolder(std::string folder_path) {
 }
 void Visualizer::runTsne(DataMatrix &originalData,
   DataMatrix &compressedData) {
+    if (pendingTsne.valid()) {
+      std::cout << "Waiting for the tsne compression running in the background" << std::endl;
+      DataMatrix result = pendingTsne.get();
+      if (pendingTsneRows == originalData.getNrows()) {
+        compressedData = result;
+        return;
+      }
+    }
+
+    compressedData = compressTsne(originalData, config.getVisualizationParameters(),
+      config.getGeneralConfig().numberCores);
+}
+
+void Visualizer::startTsne(const DataMatrix &originalData) {
+  if (pendingTsne.valid()) {
+    return;
+  }
+  pendingTsneRows = originalData.getNrows();
+  pendingTsne = std::async(std::launch::async, &Visualizer::compressTsne, originalData,
+    config.getVisualizationParameters(), config.getGeneralConfig().numberCores);
+}
+
+bool Visualizer::needsTsne() {
+  return config.getGeneralConfig().execute && config.getGeneralConfig().algorithm == "tsne" &&
+    std::find(config.getGeneralConfig().plots.begin(), config.getGeneralConfig().plots.end(),
+      "scatterplots") != config.getGeneralConfig().plots.end();
+}
+
+DataMatrix Visualizer::compressTsne(DataMatrix originalData, VisualizationParameters parameters,
+  size_t numberCores) {
     if (originalData.getNcols() <= 2) {
       std::cout << "The tsne algorithm can only be applied if "
       "the dimension is greater than 2" << std::endl;
-      compressedData = originalData;
-      return;
+      return originalData;
     }
 
+    // the number of threads is a per thread setting when running in the background
+    omp_set_num_threads(static_cast<int>(std::max<size_t>(1, numberCores)));
+
     size_t N = originalData.getNrows();
     size_t D = originalData.getNcols();
 
@@ -58,11 +93,13 @@ void Visualizer::runTsne(DataMatrix &originalData,
 
     TSNE tsne;
     tsne.run(input, N, D , output, 2,
-    config.getVisualizationParameters().perplexity, config.getVisualizationParameters().theta,
-    config.getVisualizationParameters().seed, false,
-    config.getVisualizationParameters().maxNumberIterations);
+    parameters.perplexity, parameters.theta,
+    parameters.seed, false,
+    parameters.maxNumberIterations, 250,
+    parameters.earlyExaggeration, parameters.exaggerationIterations,
+    parameters.progressInterval);
 
-    compressedData = DataMatrix(output.get(), N, 2);
+    return DataMatrix(output.get(), N, 2);
 }
 
 void Visualizer::initializeHeatmapMatrix(DataMatrix &heatmapMatrix, size_t &nDimensions) {
@@ -10,6 +10,7 @@
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
 #include <sgpp/datadriven/datamining/modules/visualization/VisualizerConfiguration.hpp>
 #include <sgpp/datadriven/tools/CSVTools.hpp>
+#include <future>
 #include <string>
 
 namespace sgpp {
@@ -44,12 +45,21 @@ class Visualizer{
     size_t fold = 0)= 0;
 
   /**
-   * Runs the tsne algorithm to visualize high dimensional data in 2 dimensions
+   * Runs the tsne algorithm to visualize high dimensional data in 2 dimensions. If the
+   * compression of the same points has been started with startTsne before, this waits for and
+   * returns its result instead.
    * @param originalData Matrix with the original points in high dimensional space
    * @param compressedData Matrix which will contain the compressed points
    */
   void runTsne(DataMatrix &originalData, DataMatrix &compressedData);
 
+  /**
+   * Starts the tsne algorithm in a background thread, so that the compression runs while the
+   * model is trained. Does nothing if a compression is already pending.
+   * @param originalData Matrix with the original points in high dimensional space, copied
+   */
+  void startTsne(const DataMatrix &originalData);
+
   /**
    * Get the configuration of the visualizer object.
    * @return configuration of the visualizer object
@@ -99,6 +109,23 @@ class Visualizer{
    */
   void initializeCutMatrix(DataMatrix &cutMatrix, size_t &nDimensions);
 
+  /**
+   * Checks whether the post processing of this visualizer needs a tsne compression
+   * @return true if tsne is the selected algorithm and the scatterplots are requested
+   */
+  bool needsTsne();
+
+  /**
+   * Compresses data with the tsne algorithm, does not access the visualizer object so that it can
+   * be run in a background thread
+   * @param originalData Matrix with the original points in high dimensional space
+   * @param parameters The parameters of the algorithm
+   * @param numberCores The number of threads to use
+   * @return Matrix with the compressed points
+   */
+  static DataMatrix compressTsne(DataMatrix originalData, VisualizationParameters parameters,
+                                 size_t numberCores);
+
   /**
  * Method which generates the linear cuts graphs for models of 3 or more dimensions
  * @param model the model used to evaluate the linear cuts
@@ -265,6 +292,17 @@ class Visualizer{
    * Matrix with reduced dimensional data
    */
   DataMatrix compressedData;
+
+  /**
+   * Pending result of a tsne compression started by startTsne
+   */
+  std::future<DataMatrix> pendingTsne;
+
+  /**
+   * Number of points of the pending tsne compression
+   */
+  size_t pendingTsneRows = 0;
+
   /**
    * Resolution used in the graphs
    */
@@ -35,6 +35,10 @@ void VisualizerClassification::runVisualization(ModelFittingBase &model, DataSou
   size_t nDimensions = model.getDataset()->getDimension();
   if (epoch == 0 && fold == 0 && batch == 0) {
     originalData = dataSource.getAllSamples()->getData();
+    // Compress the points for the scatter plots while the model is trained
+    if (needsTsne() && config.getVisualizationParameters().runAsynchronously) {
+      startTsne(originalData);
+    }
     resolution = static_cast<size_t>(pow(2,
       model.getFitterConfiguration().getGridConfig().level_+2));
     visualizerDensityEstimation->setResolution(resolution);
@@ -57,6 +57,10 @@ void VisualizerDensityEstimation::runVisualization(ModelFittingBase &model, Data
   if (epoch == 0 && fold == 0 && batch == 0) {
     resolution = static_cast<size_t>(pow(2,
       model.getFitterConfiguration().getGridConfig().level_+2));
+    // Compress the points for the scatter plots while the model is trained
+    if (needsTsne() && config.getVisualizationParameters().runAsynchronously) {
+      startTsne(dataSource.getAllSamples()->getData());
+    }
   }
 
   size_t nDimensions = model.getDataset()->getDimension();
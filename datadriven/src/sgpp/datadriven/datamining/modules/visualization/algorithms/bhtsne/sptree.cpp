@@ -107,7 +107,7 @@ bool Cell::containsPoint(double point[]) {
 SPTree::SPTree(size_t D, double* inp_data, size_t N) {
   // Compute mean, width, and height of current map (boundaries of SPTree)
   size_t nD = 0;
-  double* mean_Y = new double[D];
+  double* mean_Y = new double[D]();
   double*  min_Y = new double[D];
   for (size_t d = 0; d < D; d++) {
     min_Y[d] =  DBL_MAX;
@@ -210,8 +210,6 @@ void SPTree::init(SPTree* inp_parent, size_t D, double* inp_data,
   for (size_t d = 0; d < D; d++) {
     center_of_mass[d] = .0;
   }
-
-  buff = new double[D];
 }
 
 
@@ -222,7 +220,6 @@ SPTree::~SPTree() {
   }
   delete[] children;
   delete[] center_of_mass;
-  delete[] buff;
   delete boundary;
 }
 
@@ -401,8 +398,9 @@ size_t SPTree::getDepth() {
 
 
 // Compute non-edge forces using Barnes-Hut algorithm
+// (only reads the tree, so it can be called for different points in parallel)
 void SPTree::computeNonEdgeForces(size_t point_index, double theta,
-  double neg_f[], double* sum_Q) {
+  double neg_f[], double* sum_Q) const {
   // Make sure that we spend no time on empty nodes or self-interactions
   if (cum_size == 0 || (is_leaf && size == 1 && index[0] == point_index)) {
     return;
@@ -412,10 +410,8 @@ void SPTree::computeNonEdgeForces(size_t point_index, double theta,
   double D = .0;
   size_t ind = point_index * dimension;
   for (size_t d = 0; d < dimension; d++) {
-    buff[d] = data[ind + d] - center_of_mass[d];
-  }
-  for (size_t d = 0; d < dimension; d++) {
-    D += buff[d] * buff[d];
+    double diff = data[ind + d] - center_of_mass[d];
+    D += diff * diff;
   }
 
   // Check whether we can use this node as a "summary"
@@ -432,7 +428,7 @@ void SPTree::computeNonEdgeForces(size_t point_index, double theta,
       *sum_Q += mult;
       mult *= D;
       for (size_t d = 0; d < dimension; d++) {
-        neg_f[d] += mult * buff[d];
+        neg_f[d] += mult * (data[ind + d] - center_of_mass[d]);
       }
   } else {
       // Recursively apply Barnes-Hut to children
@@ -445,31 +441,27 @@ void SPTree::computeNonEdgeForces(size_t point_index, double theta,
 
 // Computes edge forces
 void SPTree::computeEdgeForces(size_t* row_P, size_t* col_P,
-  double* val_P, size_t N, double* pos_f) {
-  // Loop over all edges in the graph
-  size_t ind1 = 0;
-  size_t ind2 = 0;
-  double D;
+  double* val_P, size_t N, double* pos_f) const {
+  // Loop over all edges in the graph, every point only writes its own forces
+  #pragma omp parallel for schedule(dynamic, 64)
   for (size_t n = 0; n < N; n++) {
+    size_t ind1 = n * dimension;
     for (size_t i = row_P[n]; i < row_P[n + 1]; i++) {
       // Compute pairwise distance and Q-value
-      D = 1.0;
-      ind2 = col_P[i] * dimension;
+      double D = 1.0;
+      size_t ind2 = col_P[i] * dimension;
       for (size_t d = 0; d < dimension; d++) {
-        buff[d] = data[ind1 + d] - data[ind2 + d];
-      }
-      for (size_t d = 0; d < dimension; d++) {
-        D += buff[d] * buff[d];
+        double diff = data[ind1 + d] - data[ind2 + d];
+        D += diff * diff;
       }
       D = val_P[i] / D;
 
       // Sum positive force
       for (size_t d = 0; d < dimension; d++) {
-        pos_f[ind1 + d] += D * buff[d];
+        pos_f[ind1 + d] += D * (data[ind1 + d] - data[ind2 + d]);
       }
     }
-    ind1 += dimension;
-}
+  }
 }
 }  // namespace datadriven
 }  // namespace sgpp
@@ -114,9 +114,6 @@ class SPTree {
   // Fixed constants
   static const size_t QT_NODE_CAPACITY = 1;
 
-  // A buffer we use when doing force computations
-  double* buff;
-
   // Pointer to the parent
   SPTree* parent;
   // Dimension of the three
@@ -243,7 +240,8 @@ class SPTree {
    * @param neg_f Array where the positive forces part of the gradient will be stored
    * @param sum_Q Stores the cumulative sum of all negative forces
    */
-  void computeNonEdgeForces(size_t point_index, double theta, double neg_f[], double* sum_Q);
+  void computeNonEdgeForces(size_t point_index, double theta, double neg_f[],
+    double* sum_Q) const;
   /**
    * Computes the positive forces part of the gradient for t-SNE
    * @param row_P Array with pointers to the array inp_col_P indicating,
@@ -254,7 +252,7 @@ class SPTree {
    * @param pos_f Array where the positive forces part of the gradient will be stored
    */
   void computeEdgeForces(size_t* row_P, size_t* col_P,
-    double* val_P, size_t N, double* pos_f);
+    double* val_P, size_t N, double* pos_f) const;
 
  private:
   /**
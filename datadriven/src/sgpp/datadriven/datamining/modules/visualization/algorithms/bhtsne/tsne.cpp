@@ -34,12 +34,14 @@
 /**
  * Code originally taken from https://lvdmaaten.github.io/tsne/
  * It has been modified in order to be adapted to the SG++ datamining
- * pipeline structure
+ * pipeline structure and has been parallelized
  */
 
 #include <sgpp/datadriven/datamining/modules/visualization/algorithms/bhtsne/tsne.hpp>
 #include <sgpp/datadriven/datamining/modules/visualization/algorithms/bhtsne/vptree.hpp>
 #include <sgpp/datadriven/datamining/modules/visualization/algorithms/bhtsne/sptree.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <cfloat>
 #include <iostream>
 #include <vector>
@@ -48,7 +50,8 @@
 #include <cstdlib>
 #include <cstdio>
 #include <cstring>
-#include <ctime>
+#include <random>
+#include <utility>
 
 namespace sgpp {
 namespace datadriven {
@@ -59,36 +62,35 @@ TSNE::TSNE() {
 // Perform t-SNE
 void TSNE::run(std::unique_ptr<double[]> &X, size_t N, size_t D,
   std::unique_ptr<double[]> &Y, size_t no_dims, double perplexity,
-  double theta, size_t rand_seed, bool skip_random_init, size_t max_iter, size_t mom_switch_iter) {
-  srand(static_cast<unsigned int>(rand_seed));
+  double theta, size_t rand_seed, bool skip_random_init, size_t max_iter, size_t mom_switch_iter,
+  double exaggeration, size_t stop_lying_iter, size_t checkpoint_interval) {
+  generator.seed(static_cast<std::mt19937::result_type>(rand_seed));
+  checkpoints.clear();
   // Determine whether we are using an exact algorithm
   if (static_cast<double>(N - 1) < 3 * perplexity) {
-    printf("Perplexity too large for the number of data points!\n");
-    exit(1);
+    throw sgpp::base::data_exception(
+      "TSNE::run: Perplexity too large for the number of data points");
   }
   printf("Using no_dims = %zu, perplexity = %f, and theta = %f\n", no_dims, perplexity, theta);
 
   // Set learning parameters
-  float total_time = .0;
-  clock_t start, end;
+  double total_time = .0;
+  sgpp::base::SGppStopwatch stopwatch;
   double momentum = .5, final_momentum = .8;
   double eta = 200.0;
 
   // Allocate some memory
-  static std::unique_ptr<double[]> dY (new double[N * no_dims]());
-  static std::unique_ptr<double[]> uY  (new double[N * no_dims]());
-  static std::unique_ptr<double[]> gains (new double[N * no_dims]());
+  std::unique_ptr<double[]> dY (new double[N * no_dims]());
+  std::unique_ptr<double[]> uY  (new double[N * no_dims]());
+  std::unique_ptr<double[]> gains (new double[N * no_dims]());
 
-  for (size_t i = 0; i < N * no_dims; i++) {
-    uY[i] =  .0;
-  }
   for (size_t i = 0; i < N * no_dims; i++) {
     gains[i] = 1.0;
   }
 
   // Normalize input data (to prevent numerical problems)
   printf("Computing input similarities...\n");
-  start = clock();
+  stopwatch.start();
   zeroMean(X.get(), N, D);
   double max_X = .0;
 
@@ -105,9 +107,9 @@ void TSNE::run(std::unique_ptr<double[]> &X, size_t N, size_t D,
 
   // Allocate the memory we need
   size_t K = static_cast<size_t> (3 * perplexity);
-  static std::unique_ptr<size_t[]> row_P (new size_t[N + 1]());
-  static std::unique_ptr<size_t[]> col_P (new size_t[N*K]());
-  static std::unique_ptr<double[]> val_P (new double[N*K]());
+  std::unique_ptr<size_t[]> row_P (new size_t[N + 1]());
+  std::unique_ptr<size_t[]> col_P (new size_t[N*K]());
+  std::unique_ptr<double[]> val_P (new double[N*K]());
 
   // Compute input similarities for approximate t-SNE
   // Compute asymmetric pairwise input similarities
@@ -125,7 +127,14 @@ void TSNE::run(std::unique_ptr<double[]> &X, size_t N, size_t D,
     val_P[i] /= sum_P;
   }
 
-  end = clock();
+  // Lie about the input similarities during the first iterations
+  if (stop_lying_iter > 0) {
+    for (size_t i = 0; i < row_P[N]; i++) {
+      val_P[i] *= exaggeration;
+    }
+  }
+
+  double similarities_time = stopwatch.stop();
 
   // Initialize solution (randomly)
   if (!skip_random_init) {
@@ -136,14 +145,15 @@ void TSNE::run(std::unique_ptr<double[]> &X, size_t N, size_t D,
 
   printf("Input similarities computed in %4.2f seconds "
     "(sparsity = %f)!\nLearning embedding...\n",
-    static_cast<double> ((end - start) / CLOCKS_PER_SEC),
+    similarities_time,
     static_cast<double> (row_P[N]) /
     (static_cast<double> (N) * static_cast<double> (N)));
 
-  start = clock();
+  stopwatch.start();
   for (size_t iter = 0; iter < max_iter; iter++) {
     computeGradient(row_P, col_P, val_P, Y, N, no_dims, dY, theta);
     // Update gains
+    #pragma omp parallel for
     for (size_t i = 0; i < N * no_dims; i++) {
       gains[i] = (sign(dY[i]) != sign(uY[i])) ? (gains[i] + .2) : (gains[i] * .8);
       if (gains[i] < .01) {
@@ -156,32 +166,39 @@ void TSNE::run(std::unique_ptr<double[]> &X, size_t N, size_t D,
     // Make solution zero-mean
     zeroMean(Y.get(), N, no_dims);
 
+    // Stop lying about the P-values after a while, and switch momentum
+    if (iter == stop_lying_iter && stop_lying_iter > 0) {
+      for (size_t i = 0; i < row_P[N]; i++) {
+        val_P[i] /= exaggeration;
+      }
+    }
     if (iter == mom_switch_iter) {
       momentum = final_momentum;
     }
 
     // Print out progress
-    if (iter > 0 && (iter % 50 == 0 || iter == max_iter - 1)) {
-      end = clock();
-      double C = .0;
-        // doing approximate computation here!
-      C = evaluateError(row_P, col_P, val_P, Y, N, no_dims, theta);
-      if (iter == 0) {
-          printf("Iteration %zu: error is %f\n", iter + 1, C);
-      } else {
-        total_time += static_cast<float> ((end - start) / CLOCKS_PER_SEC);
-        printf("Iteration %zu: error is %f (50 iterations in %4.2f seconds)\n",
-          iter, C, static_cast<float> ((end - start) / CLOCKS_PER_SEC));
-      }
-      start = clock();
+    if (checkpoint_interval > 0 && iter > 0 &&
+        (iter % checkpoint_interval == 0 || iter == max_iter - 1)) {
+      double elapsed = stopwatch.stop();
+      total_time += elapsed;
+      // doing approximate computation here!
+      double C = evaluateError(row_P, col_P, val_P, Y, N, no_dims, theta);
+      checkpoints.emplace_back(iter, C);
+      printf("Iteration %zu: error is %f (%zu iterations in %4.2f seconds)\n",
+        iter, C, checkpoint_interval, elapsed);
+      stopwatch.start();
     }
   }
-  end = clock(); total_time += static_cast<float> ((end - start) / CLOCKS_PER_SEC);
+  total_time += stopwatch.stop();
 
   // Clean up memory
   printf("Fitting performed in %4.2f seconds.\n", total_time);
 }
 
+const std::vector<std::pair<size_t, double>> &TSNE::getCheckpoints() const {
+  return checkpoints;
+}
+
 
 // Compute gradient of the t-SNE cost function (using Barnes-Hut algorithm)
 void TSNE::computeGradient(std::unique_ptr<size_t[]>  &inp_row_P,
@@ -203,11 +220,16 @@ void TSNE::computeGradient(std::unique_ptr<size_t[]>  &inp_row_P,
   tree->computeEdgeForces(inp_row_P.get(), inp_col_P.get(),
     inp_val_P.get(), N, pos_f);
 
+  // The tree traversal depends on the point, hence the dynamic schedule
+  #pragma omp parallel for schedule(dynamic, 64) reduction(+ : sum_Q)
   for (size_t n = 0; n < N; n++) {
-    tree->computeNonEdgeForces(n, theta, neg_f + n * D, &sum_Q);
+    double point_sum_Q = .0;
+    tree->computeNonEdgeForces(n, theta, neg_f + n * D, &point_sum_Q);
+    sum_Q += point_sum_Q;
   }
 
   // Compute final t-SNE gradient
+  #pragma omp parallel for
   for (size_t i = 0; i < N * D; i++) {
     dC[i] = pos_f[i] - (neg_f[i] / sum_Q);
   }
@@ -224,23 +246,31 @@ double TSNE::evaluateError(std::unique_ptr<size_t[]>  &row_P,
   std::unique_ptr<double[]>  &Y, size_t N, size_t D, double theta) {
   // Get estimate of normalization term
   SPTree* tree = new SPTree(D, Y.get(), N);
-  static std::unique_ptr<double[]> buff (new double[D]());
   double sum_Q = .0;
-  for (size_t n = 0; n < N; n++) {
-    tree->computeNonEdgeForces(n, theta, buff.get(), &sum_Q);
+  #pragma omp parallel reduction(+ : sum_Q)
+  {
+    // the forces themselves are not needed
+    std::vector<double> buff(D);
+    #pragma omp for schedule(dynamic, 64)
+    for (size_t n = 0; n < N; n++) {
+      double point_sum_Q = .0;
+      tree->computeNonEdgeForces(n, theta, buff.data(), &point_sum_Q);
+      sum_Q += point_sum_Q;
+    }
   }
 
   // Loop over all edges to compute t-SNE error
-  size_t ind1, ind2;
-  double C = .0, Q;
+  double C = .0;
+  #pragma omp parallel for reduction(+ : C)
   for (size_t n = 0; n < N; n++) {
-    ind1 = n * D;
+    size_t ind1 = n * D;
     for (size_t i = row_P[n]; i < row_P[n + 1]; i++) {
-      Q = .0;
-      ind2 = col_P[i] * D;
-      for (size_t d = 0; d < D; d++) buff[d]  = Y[ind1 + d];
-      for (size_t d = 0; d < D; d++) buff[d] -= Y[ind2 + d];
-      for (size_t d = 0; d < D; d++) Q += buff[d] * buff[d];
+      double Q = .0;
+      size_t ind2 = col_P[i] * D;
+      for (size_t d = 0; d < D; d++) {
+        double diff = Y[ind1 + d] - Y[ind2 + d];
+        Q += diff * diff;
+      }
       Q = (1.0 / (1.0 + Q)) / sum_Q;
       C += val_P[i] * log((val_P[i] + FLT_MIN) / (Q + FLT_MIN));
     }
@@ -260,7 +290,6 @@ void TSNE::computeGaussianPerplexity(std::unique_ptr<double[]>  &X,
     if (perplexity > static_cast<double>(K)) {
       printf("Perplexity should be lower than K!\n");
     }
-    std::unique_ptr<double[]>cur_P (new double[N-1]);
     row_P[0] = 0;
     for (size_t n = 0; n < N; n++) {
       row_P[n + 1] = row_P[n] + static_cast<size_t> (K);
@@ -276,76 +305,78 @@ void TSNE::computeGaussianPerplexity(std::unique_ptr<double[]>  &X,
     }
     tree->create(obj_X);
 
-    // Loop over all points to find nearest neighbors
+    // Loop over all points to find nearest neighbors, the rows of P are independent
     printf("Building tree...\n");
-    std::vector<DataPoint> indices;
-    std::vector<double> distances;
+    #pragma omp parallel
+    {
+      std::vector<double> cur_P(K);
+      std::vector<DataPoint> indices;
+      std::vector<double> distances;
+
+      #pragma omp for schedule(dynamic, 16)
+      for (size_t n = 0; n < N; n++) {
+        // Find nearest neighbors
+        indices.clear();
+        distances.clear();
+        tree->search(obj_X[n], K + 1, &indices, &distances);
+
+        // Initialize some variables for binary search
+        bool found = false;
+        double beta = 1.0;
+        double min_beta = -DBL_MAX;
+        double max_beta =  DBL_MAX;
+        double tol = 1e-5;
+
+        // Iterate until we found a good perplexity
+        int iter = 0; double sum_P;
+        while (!found && iter < 200) {
+          // Compute Gaussian kernel row
+          for (size_t m = 0; m < K; m++) {
+            cur_P[m] = exp(-beta * distances[m + 1] * distances[m + 1]);
+          }
 
-    for (size_t n = 0; n < N; n++) {
-      if (n % 10000 == 0) {
-        printf(" - point %zu of %zu\n", n, N);
-      }
-      // Find nearest neighbors
-      indices.clear();
-      distances.clear();
-      tree->search(obj_X[n], K + 1, &indices, &distances);
-
-      // Initialize some variables for binary search
-      bool found = false;
-      double beta = 1.0;
-      double min_beta = -DBL_MAX;
-      double max_beta =  DBL_MAX;
-      double tol = 1e-5;
-
-      // Iterate until we found a good perplexity
-      int iter = 0; double sum_P;
-      while (!found && iter < 200) {
-        // Compute Gaussian kernel row
-        for (size_t m = 0; m < K; m++) {
-          cur_P[m] = exp(-beta * distances[m + 1] * distances[m + 1]);
-        }
+          // Compute entropy of current row
+          sum_P = DBL_MIN;
+          for (size_t m = 0; m < K; m++) {
+            sum_P += cur_P[m];
+          }
+          double H = .0;
+          for (size_t m = 0; m < K; m++) {
+            H += beta * (distances[m + 1] * distances[m + 1] * cur_P[m]);
+          }
+          H = (H / sum_P) + log(sum_P);
 
-        // Compute entropy of current row
-        sum_P = DBL_MIN;
-        for (size_t m = 0; m < K; m++) {
-          sum_P += cur_P[m];
-        }
-        double H = .0;
-        for (size_t m = 0; m < K; m++) {
-          H += beta * (distances[m + 1] * distances[m + 1] * cur_P[m]);
-        }
-        H = (H / sum_P) + log(sum_P);
-
-        // Evaluate whether the entropy is within the tolerance level
-        double Hdiff = H - log(perplexity);
-        if (Hdiff < tol && -Hdiff < tol) {
-          found = true;
-        } else {
-          if (Hdiff > 0) {
-            min_beta = beta;
-            if (max_beta == DBL_MAX || max_beta == -DBL_MAX) {
-                beta *= 2.0;
-            } else {
-              beta = (beta + max_beta) / 2.0;
-            }
+          // Evaluate whether the entropy is within the tolerance level
+          double Hdiff = H - log(perplexity);
+          if (Hdiff < tol && -Hdiff < tol) {
+            found = true;
           } else {
-            max_beta = beta;
-            if (min_beta == -DBL_MAX || min_beta == DBL_MAX) {
-                beta /= 2.0;
+            if (Hdiff > 0) {
+              min_beta = beta;
+              if (max_beta == DBL_MAX || max_beta == -DBL_MAX) {
+                  beta *= 2.0;
+              } else {
+                beta = (beta + max_beta) / 2.0;
+              }
             } else {
-              beta = (beta + min_beta) / 2.0;
+              max_beta = beta;
+              if (min_beta == -DBL_MAX || min_beta == DBL_MAX) {
+                  beta /= 2.0;
+              } else {
+                beta = (beta + min_beta) / 2.0;
+              }
             }
           }
+          // Update iteration counter
+          iter++;
         }
-        // Update iteration counter
-        iter++;
-      }
 
-      // Row-normalize current row of P and store in matrix
-      for (size_t m = 0; m < K; m++) {
-        cur_P[m] /= sum_P;
-        col_P[row_P[n] + m] = (size_t) indices[m + 1].index();
-        val_P[row_P[n] + m] = cur_P[m];
+        // Row-normalize current row of P and store in matrix
+        for (size_t m = 0; m < K; m++) {
+          cur_P[m] /= sum_P;
+          col_P[row_P[n] + m] = (size_t) indices[m + 1].index();
+          val_P[row_P[n] + m] = cur_P[m];
+        }
       }
     }
     // Clean up memory
@@ -451,8 +482,8 @@ void TSNE::symmetrizeMatrix(std::unique_ptr<size_t[]> &row_P,
 // Makes data zero-mean
 void TSNE::zeroMean(double* X, size_t N, size_t D) {
   // Compute data mean
- static std::unique_ptr<double[]> mean (new double[D]());
- size_t nD = 0;
+  std::vector<double> mean(D, .0);
+  size_t nD = 0;
 
   for (size_t n = 0; n < N; n++) {
     for (size_t d = 0; d < D; d++) {
@@ -478,10 +509,11 @@ void TSNE::zeroMean(double* X, size_t N, size_t D) {
 
 // Generates a Gaussian random number
 double TSNE::randn() {
+  std::uniform_real_distribution<double> uniform(-1.0, 1.0);
   double x, y, radius;
   do {
-    x = 2 * (rand() / (static_cast<double> (RAND_MAX) + 1)) - 1;
-    y = 2 * (rand() / (static_cast<double> (RAND_MAX) + 1)) - 1;
+    x = uniform(generator);
+    y = uniform(generator);
     radius = (x * x) + (y * y);
   } while ((radius >= 1.0) || (radius == 0.0));
   radius = sqrt(-2 * log(radius) / radius);
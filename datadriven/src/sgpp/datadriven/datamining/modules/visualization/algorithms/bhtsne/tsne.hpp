@@ -37,6 +37,9 @@
  */
 
 #include <memory>
+#include <random>
+#include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -65,11 +68,23 @@ class TSNE {
    * @param skip_random_init bool to determine if we skip the random initizialization
    * @param max_iter Maximum number of iterations
    * @param mom_switch_iter Iteration in which to change the momentum value of the gradient descent
+   * @param exaggeration Factor by which the input similarities are multiplied during the first
+   * iterations (early exaggeration), 1 disables it
+   * @param stop_lying_iter Iteration in which the early exaggeration is stopped
+   * @param checkpoint_interval Number of iterations between two progress checkpoints, in which the
+   * error is evaluated and reported
    */
   void run(std::unique_ptr<double[]> &X, size_t N, size_t D,
     std::unique_ptr<double[]> &Y, size_t no_dims, double perplexity,
     double theta, size_t rand_seed,
-    bool skip_random_init, size_t max_iter, size_t mom_switch_iter = 250);
+    bool skip_random_init, size_t max_iter, size_t mom_switch_iter = 250,
+    double exaggeration = 1.0, size_t stop_lying_iter = 0, size_t checkpoint_interval = 50);
+
+  /**
+   * Returns the progress checkpoints of the last run
+   * @return Pairs of iteration and the value of the Kullback-Leibler divergence in that iteration
+   */
+  const std::vector<std::pair<size_t, double>> &getCheckpoints() const;
 
  private:
   /**
@@ -155,6 +170,17 @@ class TSNE {
    * @return Random number
    */
   double randn();
+
+  /**
+   * Random number generator for the initialization, independent of the global state of rand()
+   * since the algorithm may run in a background thread
+   */
+  std::mt19937 generator;
+
+  /**
+   * Iterations and errors of the progress checkpoints of the last run
+   */
+  std::vector<std::pair<size_t, double>> checkpoints;
 };
 
 }  // namespace datadriven
@@ -117,7 +117,7 @@ class DataPoint {
   DataPoint& operator= (const DataPoint& other) {         // asignment should free old object
     if (this != &other) {
       if (_x != NULL) {
-        free(_x);
+        delete[] _x;
       }
       _D = other.dimensionality();
       _ind = other.index();
@@ -198,17 +198,19 @@ class VpTree {
    * @param k The number of nearest neighbors to seek
    * @param results Vector containing the nearest neighbors
    * @param distances Vector containing the distances to the nearest neighbors
+   *
+   * The search does not modify the tree, so several threads may search concurrently.
    */
   void search(const T& target, size_t k, std::vector<T>* results,
-    std::vector<double>* distances) {
+    std::vector<double>* distances) const {
     // Use a priority queue to store intermediate results on
     std::priority_queue<HeapItem> heap;
 
     // Variable that tracks the distance to the farthest point in our results
-    _tau = DBL_MAX;
+    double tau = DBL_MAX;
 
     // Perform the search
-    search(_root, target, k, heap);
+    search(_root, target, k, heap, tau);
 
     // Gather final results
     results->clear(); distances->clear();
@@ -229,11 +231,6 @@ class VpTree {
    */
   std::vector<T> _items;
 
-  /**
-   * Variable to store the distance of the currently found farthest nearest neighbor
-   */
-  double _tau;
-
   // Single node of a VP tree (has a point and radius;
   // left children are closer to point than the radius)
   struct Node {
@@ -330,8 +327,10 @@ class VpTree {
    * @param target Target whose nearest neighbors are to be found
    * @param k The number of nearest neighbors to seek
    * @param heap Priority queue which keeps track of the currently found nearest neighbors
+   * @param tau Distance of the currently found farthest nearest neighbor
    */
-  void search(Node* node, const T& target, size_t k, std::priority_queue<HeapItem>& heap) {
+  void search(Node* node, const T& target, size_t k, std::priority_queue<HeapItem>& heap,
+    double& tau) const {
     if (node == NULL) {
       return;     // indicates that we're done here
     }
@@ -339,13 +338,13 @@ class VpTree {
     double dist = distance(_items[node->index], target);
 
     // If current node within radius tau
-    if (dist < _tau) {
+    if (dist < tau) {
       if (heap.size() == k) {
         heap.pop();  // remove furthest node from result list (if we already have k results)
       }
       heap.push(HeapItem(node->index, dist));  // add current node to result list
       if (heap.size() == k) {
-        _tau = heap.top().dist;  // update value of tau (farthest point in result list)
+        tau = heap.top().dist;  // update value of tau (farthest point in result list)
       }
     }
 
@@ -356,25 +355,25 @@ class VpTree {
 
     // If the target lies within the radius of ball
     if (dist < node->threshold) {
-      if (dist - _tau <= node->threshold) {
+      if (dist - tau <= node->threshold) {
         // if there can still be neighbors inside the ball, recursively search left child first
-        search(node->left, target, k, heap);
+        search(node->left, target, k, heap, tau);
       }
 
-      if (dist + _tau >= node->threshold) {
+      if (dist + tau >= node->threshold) {
         // if there can still be neighbors outside the ball, recursively search right child
-        search(node->right, target, k, heap);
+        search(node->right, target, k, heap, tau);
       }
     // If the target lies outsize the radius of the ball
     } else {
-      if (dist + _tau >= node->threshold) {
+      if (dist + tau >= node->threshold) {
         // if there can still be neighbors outside the ball, recursively search right child first
-        search(node->right, target, k, heap);
+        search(node->right, target, k, heap, tau);
       }
 
-      if (dist - _tau <= node->threshold) {
+      if (dist - tau <= node->threshold) {
         // if there can still be neighbors inside the ball, recursively search left child
-        search(node->left, target, k, heap);
+        search(node->left, target, k, heap, tau);
       }
     }
 }
@@ -8,9 +8,11 @@
 #include <mpi.h>
 #include <omp.h>
 #include <algorithm>
+#include <cmath>
 // #include <chrono>
 // #include <thread>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalMPI/OperationMultiEvalMPI.hpp>
@@ -23,13 +25,16 @@ namespace datadriven {
 OperationMultiEvalMPI::OperationMultiEvalMPI(base::Grid& grid, base::DataMatrix& dataset,
                                              OperationMultipleEvalType nodeImplType,
                                              OperationMultipleEvalSubType nodeImplSubType,
-                                             bool verbose)
+                                             bool verbose, bool pipelined,
+                                             size_t chunksPerRank)
     : OperationMultipleEval(grid, dataset),
       nodeImplType(nodeImplType),
       nodeImplSubType(nodeImplSubType),
       dim(grid.getDimension()),
       verbose(verbose),
-      duration(-1.0) {
+      duration(-1.0),
+      pipelined(pipelined),
+      chunksPerRank(std::max<size_t>(chunksPerRank, 1)) {
   // create the kernel specific data structures for the current grid
   this->prepare();
 }
@@ -52,6 +57,15 @@ OperationMultiEvalMPI::OperationMultiEvalMPI(base::Grid& grid, base::DataMatrix&
 OperationMultiEvalMPI::~OperationMultiEvalMPI() {}
 
 void OperationMultiEvalMPI::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
+  if (pipelined) {
+    multPipelined(alpha, result);
+  } else {
+    multMasterSlave(alpha, result);
+  }
+}
+
+void OperationMultiEvalMPI::multMasterSlave(sgpp::base::DataVector& alpha,
+                                            sgpp::base::DataVector& result) {
   double start = MPI_Wtime();
 
   int rank, size;
@@ -166,6 +180,13 @@ void OperationMultiEvalMPI::mult(sgpp::base::DataVector& alpha, sgpp::base::Data
 }
 
 void OperationMultiEvalMPI::multSlave(sgpp::base::DataVector& alpha) {
+  // in the pipelined mode, every rank takes part in the computation and receives the result
+  if (pipelined) {
+    sgpp::base::DataVector result(dataset.getNrows());
+    multPipelined(alpha, result);
+    return;
+  }
+
   double start = MPI_Wtime();
 
   int rank, size;
@@ -241,32 +262,19 @@ void OperationMultiEvalMPI::multSlave(sgpp::base::DataVector& alpha) {
     }
 
     // filter the dataset according to the range to work on
-    base::DataMatrix datasetChunk(chunkRange, dataset.getNcols());
-    for (size_t i = 0; i < chunkRange; i++) {
-      for (size_t d = 0; d < dim; d++) {
-        datasetChunk.set(i, d, dataset.get(chunkStart + i, d));
-      }
-    }
+    base::DataMatrix datasetChunk;
+    getDatasetChunk(chunkStart, chunkEnd, datasetChunk);
 
     // resize the result vector to matchthe chunk
     result.resize(chunkRange);
 
     // create appropriate node level multi eval implementation
-    sgpp::base::OperationMultipleEval* nodeMultiEval;
-    if (nodeImplType == OperationMultipleEvalType::STREAMING &&
-        nodeImplSubType == OperationMultipleEvalSubType::DEFAULT) {
-      //      nodeMultiEval = new datadriven::OperationMultiEvalStreaming(level, index, dim,
-      //      datasetChunk);
-      nodeMultiEval = new datadriven::OperationMultiEvalStreaming(grid, datasetChunk);
-    } else {
-      throw base::not_implemented_exception();
-    }
+    std::unique_ptr<sgpp::base::OperationMultipleEval> nodeMultiEval(
+        createNodeMultiEval(datasetChunk));
 
     // calculate the result for the received range
     nodeMultiEval->mult(alpha, result);
 
-    delete nodeMultiEval;
-
     if (verbose) {
       std::cout << "rank = " << rank << ", calculations finished" << std::endl;
     }
@@ -281,6 +289,11 @@ void OperationMultiEvalMPI::multSlave(sgpp::base::DataVector& alpha) {
 
 void OperationMultiEvalMPI::multTranspose(sgpp::base::DataVector& source,
                                           sgpp::base::DataVector& result) {
+  if (pipelined) {
+    multTransposePipelined(source, result);
+    return;
+  }
+
   double start = MPI_Wtime();
 
   //  base::DataMatrix levelChunk(level);
@@ -300,8 +313,238 @@ void OperationMultiEvalMPI::multTranspose(sgpp::base::DataVector& source,
   this->duration = MPI_Wtime() - start;
 }
 
+void OperationMultiEvalMPI::multPipelined(sgpp::base::DataVector& alpha,
+                                          sgpp::base::DataVector& result) {
+  double start = MPI_Wtime();
+
+  int rank, size;
+
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  if (result.getSize() != dataset.getNrows()) {
+    throw base::operation_exception("OperationMultiEvalMPI: result has the wrong size");
+  }
+
+  std::vector<size_t> rankOffsets = getRankOffsets(size);
+  prepareChunks(rankOffsets, rank);
+
+  // counts and displacements have to stay valid until the non-blocking gathers are completed
+  std::vector<std::vector<int>> counts(chunksPerRank, std::vector<int>(size));
+  std::vector<std::vector<int>> displacements(chunksPerRank, std::vector<int>(size));
+  std::vector<MPI_Request> requests(chunksPerRank, MPI_REQUEST_NULL);
+  double computeTime = 0.0;
+
+  for (size_t chunk = 0; chunk < chunksPerRank; chunk++) {
+    // chunk number "chunk" of every rank is gathered by the same collective
+    for (int r = 0; r < size; r++) {
+      size_t share = rankOffsets[r + 1] - rankOffsets[r];
+      size_t chunkStart = rankOffsets[r] + (share * chunk) / chunksPerRank;
+      size_t chunkEnd = rankOffsets[r] + (share * (chunk + 1)) / chunksPerRank;
+      counts[chunk][r] = static_cast<int>(chunkEnd - chunkStart);
+      displacements[chunk][r] = static_cast<int>(chunkStart);
+    }
+
+    size_t chunkStart = displacements[chunk][rank];
+    size_t chunkRange = counts[chunk][rank];
+
+    double computeStart = MPI_Wtime();
+
+    if (chunkRange > 0) {
+      sgpp::base::DataVector resultChunk(chunkRange);
+      nodeMultiEvals[chunk]->mult(alpha, resultChunk);
+
+      // the own part is gathered in place, the gathers of the previous chunks don't touch it
+      std::copy(resultChunk.getPointer(), resultChunk.getPointer() + chunkRange,
+                result.getPointer() + chunkStart);
+    }
+
+    computeTime += MPI_Wtime() - computeStart;
+
+    MPI_Iallgatherv(MPI_IN_PLACE, 0, MPI_DATATYPE_NULL, result.getPointer(), &counts[chunk][0],
+                    &displacements[chunk][0], MPI_DOUBLE, MPI_COMM_WORLD, &requests[chunk]);
+
+    // give the MPI library the chance to progress the pending communication
+    int flag;
+    MPI_Testall(static_cast<int>(chunk + 1), &requests[0], &flag, MPI_STATUSES_IGNORE);
+
+    if (verbose) {
+      std::cout << "rank = " << rank << ", chunk " << chunk << " [" << chunkStart << ", "
+                << chunkStart + chunkRange << ") posted" << std::endl;
+    }
+  }
+
+  MPI_Waitall(static_cast<int>(chunksPerRank), &requests[0], MPI_STATUSES_IGNORE);
+
+  rebalance(size, rankOffsets[rank + 1] - rankOffsets[rank], computeTime);
+
+  this->duration = MPI_Wtime() - start;
+}
+
+void OperationMultiEvalMPI::multTransposePipelined(sgpp::base::DataVector& source,
+                                                   sgpp::base::DataVector& result) {
+  double start = MPI_Wtime();
+
+  int rank, size;
+
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  if (source.getSize() != dataset.getNrows()) {
+    throw base::operation_exception("OperationMultiEvalMPI: source has the wrong size");
+  }
+
+  std::vector<size_t> rankOffsets = getRankOffsets(size);
+  prepareChunks(rankOffsets, rank);
+  size_t share = rankOffsets[rank + 1] - rankOffsets[rank];
+  size_t gridSize = grid.getSize();
+
+  result.resize(gridSize);
+  result.setAll(0.0);
+
+  // all chunks contribute to the whole grid vector, so they are accumulated locally and reduced
+  // only once instead of reducing the grid vector per chunk
+  sgpp::base::DataVector partialResult(gridSize);
+  double computeStart = MPI_Wtime();
+
+  for (size_t chunk = 0; chunk < chunksPerRank; chunk++) {
+    size_t chunkStart = rankOffsets[rank] + (share * chunk) / chunksPerRank;
+    size_t chunkEnd = rankOffsets[rank] + (share * (chunk + 1)) / chunksPerRank;
+
+    if (chunkEnd > chunkStart) {
+      sgpp::base::DataVector sourceChunk(chunkEnd - chunkStart);
+      std::copy(source.getPointer() + chunkStart, source.getPointer() + chunkEnd,
+                sourceChunk.getPointer());
+
+      nodeMultiEvals[chunk]->multTranspose(sourceChunk, partialResult);
+      result.add(partialResult);
+    }
+  }
+
+  double computeTime = MPI_Wtime() - computeStart;
+
+  MPI_Allreduce(MPI_IN_PLACE, result.getPointer(), static_cast<int>(gridSize), MPI_DOUBLE,
+                MPI_SUM, MPI_COMM_WORLD);
+
+  rebalance(size, share, computeTime);
+
+  this->duration = MPI_Wtime() - start;
+}
+
+sgpp::base::OperationMultipleEval* OperationMultiEvalMPI::createNodeMultiEval(
+    base::DataMatrix& datasetChunk) {
+  if (nodeImplType == OperationMultipleEvalType::STREAMING &&
+      nodeImplSubType == OperationMultipleEvalSubType::DEFAULT) {
+    return new datadriven::OperationMultiEvalStreaming(grid, datasetChunk);
+  } else {
+    throw base::not_implemented_exception();
+  }
+}
+
+void OperationMultiEvalMPI::prepareChunks(const std::vector<size_t>& rankOffsets, int rank) {
+  if (rankOffsets == chunkRankOffsets) {
+    return;
+  }
+
+  // the operations keep references to the chunks, so they are discarded first
+  nodeMultiEvals.clear();
+  datasetChunks.clear();
+  datasetChunks.resize(chunksPerRank);
+  nodeMultiEvals.resize(chunksPerRank);
+
+  size_t share = rankOffsets[rank + 1] - rankOffsets[rank];
+
+  for (size_t chunk = 0; chunk < chunksPerRank; chunk++) {
+    size_t chunkStart = rankOffsets[rank] + (share * chunk) / chunksPerRank;
+    size_t chunkEnd = rankOffsets[rank] + (share * (chunk + 1)) / chunksPerRank;
+
+    if (chunkEnd > chunkStart) {
+      getDatasetChunk(chunkStart, chunkEnd, datasetChunks[chunk]);
+      nodeMultiEvals[chunk].reset(createNodeMultiEval(datasetChunks[chunk]));
+    }
+  }
+
+  chunkRankOffsets = rankOffsets;
+}
+
+void OperationMultiEvalMPI::getDatasetChunk(size_t chunkStart, size_t chunkEnd,
+                                            base::DataMatrix& datasetChunk) {
+  datasetChunk.resize(chunkEnd - chunkStart, dataset.getNcols());
+
+  for (size_t i = 0; i < chunkEnd - chunkStart; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      datasetChunk.set(i, d, dataset.get(chunkStart + i, d));
+    }
+  }
+}
+
+std::vector<size_t> OperationMultiEvalMPI::getRankOffsets(int size) {
+  if (rankWeights.size() != static_cast<size_t>(size)) {
+    rankWeights.assign(size, 1.0 / static_cast<double>(size));
+  }
+
+  size_t rows = dataset.getNrows();
+  std::vector<size_t> rankOffsets(size + 1, rows);
+  double cumulativeWeight = 0.0;
+
+  for (int r = 0; r < size; r++) {
+    rankOffsets[r] = std::min(
+        rows, static_cast<size_t>(cumulativeWeight * static_cast<double>(rows) + 0.5));
+    cumulativeWeight += rankWeights[r];
+  }
+
+  return rankOffsets;
+}
+
+void OperationMultiEvalMPI::rebalance(int size, size_t rows, double computeTime) {
+  // ranks without work don't have a throughput and keep their weight
+  double throughput =
+      (rows > 0 && computeTime > 0.0) ? static_cast<double>(rows) / computeTime : -1.0;
+  std::vector<double> throughputs(size);
+  MPI_Allgather(&throughput, 1, MPI_DOUBLE, &throughputs[0], 1, MPI_DOUBLE, MPI_COMM_WORLD);
+
+  double throughputSum = 0.0;
+  double measuredWeight = 0.0;
+
+  for (int r = 0; r < size; r++) {
+    if (throughputs[r] > 0.0) {
+      throughputSum += throughputs[r];
+      measuredWeight += rankWeights[r];
+    }
+  }
+
+  if (throughputSum <= 0.0) {
+    return;
+  }
+
+  // the shares move halfway towards the measured throughput to damp fluctuations
+  std::vector<double> newRankWeights(rankWeights);
+  bool significantChange = false;
+
+  for (int r = 0; r < size; r++) {
+    if (throughputs[r] > 0.0) {
+      newRankWeights[r] =
+          0.5 * rankWeights[r] + 0.5 * measuredWeight * throughputs[r] / throughputSum;
+      significantChange |= std::abs(newRankWeights[r] - rankWeights[r]) > 0.05 * rankWeights[r];
+    }
+  }
+
+  // changing the shares recreates the chunks, which is not worth it for small imbalances
+  if (significantChange) {
+    rankWeights = newRankWeights;
+  }
+}
+
 double OperationMultiEvalMPI::getDuration() { return this->duration; }
 
-void OperationMultiEvalMPI::prepare() {}
+const std::vector<double>& OperationMultiEvalMPI::getRankWeights() const {
+  return this->rankWeights;
+}
+
+void OperationMultiEvalMPI::prepare() {
+  nodeMultiEvals.clear();
+  datasetChunks.clear();
+  chunkRankOffsets.clear();
+}
 }  // namespace datadriven
 }  // namespace sgpp
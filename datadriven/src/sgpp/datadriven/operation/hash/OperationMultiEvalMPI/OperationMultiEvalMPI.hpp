@@ -11,12 +11,25 @@
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
 
+#include <memory>
+#include <vector>
+
 namespace sgpp {
 namespace datadriven {
 
 /**
  * This class is a MPI wrapper for other MultiEval-operations that uses a very simple master-slave
  * MPI parallelization.
+ *
+ * In the pipelined mode, all ranks call mult (or multTranspose) and every rank works on a
+ * contiguous share of the dataset. The share is split into chunks, in mult the (non-blocking)
+ * collective communication of a finished chunk overlaps with the computation of the next ones.
+ * In multTranspose, all chunks contribute to the same grid vector, hence they are accumulated
+ * locally and reduced once. After each call, the shares are rebalanced according to the measured
+ * throughput of the ranks.
+ *
+ * The chunks of the dataset and their node level operations are created once and only recreated
+ * if the shares change or prepare() is called, which is necessary after the grid was changed.
  */
 class OperationMultiEvalMPI : public sgpp::base::OperationMultipleEval {
  protected:
@@ -34,9 +47,74 @@ class OperationMultiEvalMPI : public sgpp::base::OperationMultipleEval {
 
   double duration;
 
+  /// use the pipelined mode instead of the master-slave mode
+  bool pipelined;
+
+  /// number of chunks the share of a rank is split into in the pipelined mode
+  size_t chunksPerRank;
+
+  /// relative share of the dataset of each rank in the pipelined mode (sums up to one)
+  std::vector<double> rankWeights;
+
+  /// shares the cached chunks were created for, empty if there are no cached chunks
+  std::vector<size_t> chunkRankOffsets;
+
+  /// rows of the chunks of the current rank's share
+  std::vector<base::DataMatrix> datasetChunks;
+
+  /// node level operations of the chunks, nullptr for empty chunks
+  std::vector<std::unique_ptr<sgpp::base::OperationMultipleEval>> nodeMultiEvals;
+
+  void multMasterSlave(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
+
+  void multPipelined(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
+
+  void multTransposePipelined(sgpp::base::DataVector& source, sgpp::base::DataVector& result);
+
+  /**
+   * Creates the node level multi eval implementation for a chunk of the dataset.
+   *
+   * @param datasetChunk rows of the dataset to work on
+   * @return node level operation
+   */
+  sgpp::base::OperationMultipleEval* createNodeMultiEval(base::DataMatrix& datasetChunk);
+
+  /**
+   * Creates the dataset chunks of the current rank and their node level operations, unless they
+   * were already created for the given shares.
+   *
+   * @param rankOffsets offsets of the shares, see getRankOffsets()
+   * @param rank current rank
+   */
+  void prepareChunks(const std::vector<size_t>& rankOffsets, int rank);
+
+  /**
+   * Copies the rows [chunkStart, chunkEnd) of the dataset.
+   */
+  void getDatasetChunk(size_t chunkStart, size_t chunkEnd, base::DataMatrix& datasetChunk);
+
+  /**
+   * Computes the first row of every rank's share from the current rank weights.
+   *
+   * @param size number of ranks
+   * @return offsets of the shares, size + 1 entries
+   */
+  std::vector<size_t> getRankOffsets(int size);
+
+  /**
+   * Exchanges the measured throughput of all ranks and adapts the rank weights accordingly.
+   * Small changes are ignored to keep the cached chunks.
+   *
+   * @param size number of ranks
+   * @param rows number of rows the current rank has computed
+   * @param computeTime time the current rank spent computing (without communication)
+   */
+  void rebalance(int size, size_t rows, double computeTime);
+
  public:
   OperationMultiEvalMPI(base::Grid& grid, base::DataMatrix& dataset, OperationMultipleEvalType type,
-                        OperationMultipleEvalSubType, bool verbose = false);
+                        OperationMultipleEvalSubType, bool verbose = false,
+                        bool pipelined = false, size_t chunksPerRank = 4);
 
   ~OperationMultiEvalMPI();
 
@@ -46,9 +124,18 @@ class OperationMultiEvalMPI : public sgpp::base::OperationMultipleEval {
 
   void multTranspose(sgpp::base::DataVector& source, sgpp::base::DataVector& result);
 
+  /**
+   * Discards the cached chunks and node level operations, has to be called after the grid was
+   * changed.
+   */
   void prepare();
 
   double getDuration();
+
+  /**
+   * @return relative shares of the dataset of the ranks used by the next pipelined call
+   */
+  const std::vector<double>& getRankWeights() const;
 };
 
 }  // namespace datadriven
@@ -3,6 +3,7 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalModMaskStreaming/OperationMultiEvalModMaskStreaming.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -92,6 +93,7 @@ size_t OperationMultiEvalModMaskStreaming::getChunkDataPoints() {
 
 void OperationMultiEvalModMaskStreaming::mult(sgpp::base::DataVector& alpha,
                                               sgpp::base::DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   this->myTimer_.start();
 
   size_t originalSize = result.getSize();
@@ -116,6 +118,7 @@ void OperationMultiEvalModMaskStreaming::mult(sgpp::base::DataVector& alpha,
 
 void OperationMultiEvalModMaskStreaming::multTranspose(sgpp::base::DataVector& source,
                                                        sgpp::base::DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   this->myTimer_.start();
 
   size_t originalSize = source.getSize();
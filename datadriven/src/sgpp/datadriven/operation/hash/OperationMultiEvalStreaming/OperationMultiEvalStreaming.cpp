@@ -3,10 +3,13 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/tools/Instrumentation.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -19,6 +22,7 @@ OperationMultiEvalStreaming::OperationMultiEvalStreaming(base::Grid& grid,
   this->storage = &grid.getStorage();
   this->padDataset(this->preparedDataset);
   this->preparedDataset.transpose();
+  this->calculateBlockBoundingBoxes();
 
   // create the kernel specific data structures for the current grid
   this->prepare();
@@ -91,6 +95,7 @@ size_t OperationMultiEvalStreaming::getChunkDataPoints() {
 
 void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
                                        sgpp::base::DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
   this->myTimer_.start();
 
   size_t originalSize = result.getSize();
@@ -115,6 +120,7 @@ void OperationMultiEvalStreaming::mult(sgpp::base::DataVector& alpha,
 
 void OperationMultiEvalStreaming::multTranspose(sgpp::base::DataVector& source,
                                                 sgpp::base::DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
   this->myTimer_.start();
 
   size_t originalSize = source.getSize();
@@ -176,6 +182,27 @@ size_t OperationMultiEvalStreaming::padDataset(sgpp::base::DataMatrix& dataset)
   return dataset.getNrows();
 }
 
+void OperationMultiEvalStreaming::calculateBlockBoundingBoxes() {
+  // the prepared dataset is transposed and padded to complete blocks
+  size_t dims = this->preparedDataset.getNrows();
+  size_t numDataPoints = this->preparedDataset.getNcols();
+  size_t blockSize = this->getChunkDataPoints();
+  size_t blockCount = numDataPoints / blockSize;
+
+  this->blockLower.assign(blockCount * dims, 0.0);
+  this->blockUpper.assign(blockCount * dims, 0.0);
+
+  for (size_t block = 0; block < blockCount; block++) {
+    for (size_t d = 0; d < dims; d++) {
+      const double* values = this->preparedDataset.getPointer() + d * numDataPoints;
+      auto range = std::minmax_element(values + block * blockSize,
+                                       values + (block + 1) * blockSize);
+      this->blockLower[block * dims + d] = *range.first;
+      this->blockUpper[block * dims + d] = *range.second;
+    }
+  }
+}
+
 double OperationMultiEvalStreaming::getDuration() { return this->duration; }
 
 void OperationMultiEvalStreaming::prepare() { this->recalculateLevelAndIndex(); }
@@ -14,6 +14,8 @@
 #include <sgpp/base/tools/SGppStopwatch.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <vector>
+
 #ifndef STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH
 // #define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 24
 #define STREAMING_LINEAR_MIC_AVX512_UNROLLING_WIDTH 96
@@ -36,6 +38,43 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   double duration;
 
+  /// Lower corners of the bounding boxes of all blocks of getChunkDataPoints() data points
+  std::vector<double> blockLower;
+  /// Upper corners of the bounding boxes of all blocks of getChunkDataPoints() data points
+  std::vector<double> blockUpper;
+
+  /**
+   * Checks whether the support of a grid point intersects the bounding box of a data block. If
+   * it does not, the basis function vanishes on all points of the block and the kernels skip
+   * the pair. As the check is exact, the results do not change, but only data ordered along a
+   * space filling curve has blocks small enough to be skipped frequently.
+   *
+   * @param ptrLevel levels of the grid points as returned by getLevelIndexArraysForEval
+   * @param ptrIndex indices of the grid points as returned by getLevelIndexArraysForEval
+   * @param gridPoint the grid point to check
+   * @param block the data block to check, i.e. the index of its first point divided by
+   * getChunkDataPoints()
+   * @param dims dimension of the grid
+   * @return whether the basis function can be non-zero in the block
+   */
+  inline bool isBlockInSupport(const double* ptrLevel, const double* ptrIndex, size_t gridPoint,
+                               size_t block, size_t dims) const {
+    const double* lower = &blockLower[block * dims];
+    const double* upper = &blockUpper[block * dims];
+
+    for (size_t d = 0; d < dims; d++) {
+      // the support is ]index - 1, index + 1[ after scaling by level
+      const double level = ptrLevel[gridPoint * dims + d];
+      const double index = ptrIndex[gridPoint * dims + d];
+
+      if (level * upper[d] - index <= -1.0 || level * lower[d] - index >= 1.0) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
  public:
   OperationMultiEvalStreaming(base::Grid& grid, base::DataMatrix& dataset);
 
@@ -59,6 +98,8 @@ class OperationMultiEvalStreaming : public base::OperationMultipleEval {
 
   size_t padDataset(sgpp::base::DataMatrix& dataset);
 
+  void calculateBlockBoundingBoxes();
+
   void getOpenMPPartitionSegment(size_t start, size_t end, size_t* segmentStart, size_t* segmentEnd,
                                  size_t blocksize);
 
@@ -53,8 +53,12 @@ void OperationMultiEvalStreaming::multImpl(
       uint64_t imask = 0x7FFFFFFFFFFFFFFF;
       double* fmask = reinterpret_cast<double*>(&imask);
 
+      const size_t block = c / getChunkDataPoints();
+
       for (size_t i = c; i < c + getChunkDataPoints(); i += 12) {
         for (size_t j = m; j < m + grid_inc; j++) {
+          if (!isBlockInSupport(ptrLevel, ptrIndex, j, block, dims)) continue;
+
           __m128d support_0 = _mm_loaddup_pd(&(ptrAlpha[j]));
           __m128d support_1 = _mm_loaddup_pd(&(ptrAlpha[j]));
           __m128d support_2 = _mm_loaddup_pd(&(ptrAlpha[j]));
@@ -174,8 +178,12 @@ void OperationMultiEvalStreaming::multImpl(
       int64_t imask = 0x7FFFFFFFFFFFFFFF;
       double* fmask = reinterpret_cast<double*>(&imask);
 
+      const size_t block = c / getChunkDataPoints();
+
       for (size_t i = c; i < c + getChunkDataPoints(); i += 24) {
         for (size_t j = m; j < m + grid_inc; j++) {
+          if (!isBlockInSupport(ptrLevel, ptrIndex, j, block, dims)) continue;
+
           __m256d support_0 = _mm256_broadcast_sd(&(ptrAlpha[j]));
           __m256d support_1 = _mm256_broadcast_sd(&(ptrAlpha[j]));
           __m256d support_2 = _mm256_broadcast_sd(&(ptrAlpha[j]));
@@ -301,7 +309,11 @@ void OperationMultiEvalStreaming::multImpl(
 #endif
 
   for (size_t i = start_index_data; i < end_index_data; i += getChunkDataPoints()) {
+    const size_t block = i / getChunkDataPoints();
+
     for (size_t j = start_index_grid; j < end_index_grid; j++) {
+      if (!isBlockInSupport(ptrLevel, ptrIndex, j, block, dims)) continue;
+
       _mm_prefetch((const char*)&(ptrAlpha[j + 1]), _MM_HINT_T0);
       _mm_prefetch((const char*)&(ptrLevel[((j + 1) * dims)]), _MM_HINT_T0);
       _mm_prefetch((const char*)&(ptrIndex[((j + 1) * dims)]), _MM_HINT_T0);
@@ -46,7 +46,11 @@ void OperationMultiEvalStreaming::multTransposeImpl(
     double* fmask = reinterpret_cast<double*>(&imask);
 
     for (size_t i = start_index_data; i < end_index_data; i += 12) {
+      const size_t block = i / getChunkDataPoints();
+
       for (size_t j = k; j < k + grid_inc; j++) {
+        if (!isBlockInSupport(ptrLevel, ptrIndex, j, block, dims)) continue;
+
         __m128d support_0 = _mm_load_pd(&(ptrSource[i]));
         __m128d support_1 = _mm_load_pd(&(ptrSource[i + 2]));
         __m128d support_2 = _mm_load_pd(&(ptrSource[i + 4]));
@@ -140,7 +144,11 @@ void OperationMultiEvalStreaming::multTransposeImpl(
     double* fmask = reinterpret_cast<double*>(&imask);
 
     for (size_t i = start_index_data; i < end_index_data; i += 24) {
+      const size_t block = i / getChunkDataPoints();
+
       for (size_t j = k; j < k + grid_inc; j++) {
+        if (!isBlockInSupport(ptrLevel, ptrIndex, j, block, dims)) continue;
+
         __m256d support_0 = _mm256_load_pd(&(ptrSource[i]));
         __m256d support_1 = _mm256_load_pd(&(ptrSource[i + 4]));
         __m256d support_2 = _mm256_load_pd(&(ptrSource[i + 8]));
@@ -256,7 +264,11 @@ void OperationMultiEvalStreaming::multTransposeImpl(
 #endif
 
   for (size_t i = start_index_data; i < end_index_data; i += getChunkDataPoints()) {
+    const size_t block = i / getChunkDataPoints();
+
     for (size_t j = start_index_grid; j < end_index_grid; j++) {
+      if (!isBlockInSupport(ptrLevel, ptrIndex, j, block, dims)) continue;
+
       __m512d support_0 = _mm512_load_pd(&(ptrSource[i + 0]));
       __m512d support_1 = _mm512_load_pd(&(ptrSource[i + 8]));
       __m512d support_2 = _mm512_load_pd(&(ptrSource[i + 16]));
@@ -0,0 +1,252 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/tools/Instrumentation.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationMultiEvalStreamingPoly::OperationMultiEvalStreamingPoly(base::Grid& grid,
+                                                                 base::DataMatrix& dataset)
+    : OperationMultipleEval(grid, dataset),
+      preparedDataset(dataset),
+      numFactors(0),
+      myTimer_(sgpp::base::SGppStopwatch()),
+      duration(-1.0),
+      degree(0) {
+  if ((grid.getType() != base::GridType::Poly) && (grid.getType() != base::GridType::ModPoly) &&
+      (grid.getType() != base::GridType::PolyBoundary)) {
+    throw base::operation_exception(
+        "OperationMultiEvalStreamingPoly: only Poly, ModPoly and PolyBoundary grids are "
+        "supported");
+  }
+
+  this->degree = grid.getBasis().getDegree();
+  this->numFactors = this->degree;
+  this->storage = &grid.getStorage();
+  this->padDataset(this->preparedDataset);
+  this->preparedDataset.transpose();
+
+  // create the kernel specific data structures for the current grid
+  this->prepare();
+}
+
+OperationMultiEvalStreamingPoly::~OperationMultiEvalStreamingPoly() {}
+
+void OperationMultiEvalStreamingPoly::getPartitionSegment(size_t start, size_t end,
+                                                          size_t segmentCount,
+                                                          size_t segmentNumber,
+                                                          size_t* segmentStart,
+                                                          size_t* segmentEnd, size_t blockSize) {
+  size_t totalSize = end - start;
+
+  // check for valid input
+  if (blockSize == 0) {
+    throw sgpp::base::operation_exception("blockSize must not be zero!");
+  }
+
+  if (totalSize % blockSize != 0) {
+    throw sgpp::base::operation_exception(
+        "totalSize must be divisible by blockSize without remainder, but it is not!");
+  }
+
+  // do all further calculations with complete blocks
+  size_t blockCount = totalSize / blockSize;
+
+  size_t blockSegmentSize = blockCount / segmentCount;
+  size_t remainder = blockCount - blockSegmentSize * segmentCount;
+  size_t blockSegmentOffset = 0;
+
+  if (segmentNumber < remainder) {
+    blockSegmentSize++;
+    blockSegmentOffset = blockSegmentSize * segmentNumber;
+  } else {
+    blockSegmentOffset =
+        remainder * (blockSegmentSize + 1) + (segmentNumber - remainder) * blockSegmentSize;
+  }
+
+  *segmentStart = start + blockSegmentOffset * blockSize;
+  *segmentEnd = *segmentStart + blockSegmentSize * blockSize;
+}
+
+void OperationMultiEvalStreamingPoly::getOpenMPPartitionSegment(size_t start, size_t end,
+                                                                size_t* segmentStart,
+                                                                size_t* segmentEnd,
+                                                                size_t blocksize) {
+  size_t threadCount = 1;
+  size_t myThreadNum = 0;
+#ifdef _OPENMP
+  threadCount = omp_get_num_threads();
+  myThreadNum = omp_get_thread_num();
+#endif
+  getPartitionSegment(start, end, threadCount, myThreadNum, segmentStart, segmentEnd, blocksize);
+}
+
+size_t OperationMultiEvalStreamingPoly::getChunkGridPoints() { return 12; }
+
+size_t OperationMultiEvalStreamingPoly::getChunkDataPoints() {
+  return STREAMING_POLY_UNROLLING_WIDTH;
+}
+
+void OperationMultiEvalStreamingPoly::mult(sgpp::base::DataVector& alpha,
+                                           sgpp::base::DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
+  this->myTimer_.start();
+
+  size_t originalSize = result.getSize();
+
+  result.resize(this->preparedDataset.getNcols());
+
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+    getOpenMPPartitionSegment(0, this->preparedDataset.getNcols(), &start, &end,
+                              getChunkDataPoints());
+
+    this->multImpl(&this->preparedDataset, alpha, result, 0, alpha.getSize(), start, end);
+  }
+  result.resize(originalSize);
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalStreamingPoly::multTranspose(sgpp::base::DataVector& source,
+                                                    sgpp::base::DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
+  this->myTimer_.start();
+
+  size_t originalSize = source.getSize();
+
+  source.resize(this->preparedDataset.getNcols());
+
+  // set padding area to zero
+  for (size_t i = originalSize; i < this->preparedDataset.getNcols(); i++) {
+    source[i] = 0.0;
+  }
+
+  result.setAll(0.0);
+
+#pragma omp parallel
+  {
+    size_t start;
+    size_t end;
+
+    getOpenMPPartitionSegment(0, this->storage->getSize(), &start, &end, 1);
+
+    this->multTransposeImpl(&this->preparedDataset, source, result, start, end, 0,
+                            this->preparedDataset.getNcols());
+  }
+  source.resize(originalSize);
+  this->duration = this->myTimer_.stop();
+}
+
+void OperationMultiEvalStreamingPoly::setPolyFactors(base::level_t l, base::index_t i,
+                                                     double* slope, double* offset) {
+  const size_t deg = std::min<size_t>(degree, l + 1);
+  const int64_t idxtable[4] = {1, 2, -2, -1};
+  const double base = static_cast<double>(i);
+  int64_t root = static_cast<int64_t>(i) + 1;
+  uint64_t id = i;
+
+  slope[0] = 1.0 / (base - static_cast<double>(root));
+  offset[0] = -static_cast<double>(root) * slope[0];
+  root -= 2;
+
+  size_t k = 1;
+
+  for (int64_t j = 2; j < (static_cast<int64_t>(1) << deg); j *= 2) {
+    slope[k] = 1.0 / (base - static_cast<double>(root));
+    offset[k] = -static_cast<double>(root) * slope[k];
+    root += idxtable[id & 3] * j;
+    id >>= 1;
+    k++;
+  }
+}
+
+void OperationMultiEvalStreamingPoly::recalculateLevelIndexFactors() {
+  const size_t gridSize = this->storage->getSize();
+  const size_t dims = this->storage->getDimension();
+  const base::GridType gridType = this->grid.getType();
+
+  this->level.resize(gridSize * dims);
+  this->index.resize(gridSize * dims);
+  // factors that are not needed are 0 * t + 1
+  this->factorSlope.assign(gridSize * dims * numFactors, 0.0);
+  this->factorOffset.assign(gridSize * dims * numFactors, 1.0);
+
+  for (size_t j = 0; j < gridSize; j++) {
+    base::GridPoint& gp = this->storage->getPoint(j);
+
+    for (size_t d = 0; d < dims; d++) {
+      const base::level_t l = gp.getLevel(d);
+      const base::index_t i = gp.getIndex(d);
+      const base::index_t hInv = static_cast<base::index_t>(1) << l;
+      const size_t pos = j * dims + d;
+      double* slope = &this->factorSlope[pos * numFactors];
+      double* offset = &this->factorOffset[pos * numFactors];
+
+      this->level[pos] = static_cast<double>(hInv);
+      this->index[pos] = static_cast<double>(i);
+
+      if (l == 0) {
+        // boundary functions of PolyBoundary grids: 1 - x and x
+        slope[0] = (i == 0) ? -1.0 : 1.0;
+        offset[0] = (i == 0) ? 1.0 : 0.0;
+      } else if (gridType == base::GridType::ModPoly) {
+        if (l == 1) {
+          // constant function, no factors
+        } else if (i == 1) {
+          // 2 - 2^l x
+          slope[0] = -1.0;
+          offset[0] = 2.0;
+        } else if (i == hInv - 1) {
+          // 2^l x - i + 1
+          slope[0] = 1.0;
+          offset[0] = 1.0 - static_cast<double>(i);
+        } else {
+          setPolyFactors(l, i, slope, offset);
+        }
+      } else {
+        setPolyFactors(l, i, slope, offset);
+      }
+    }
+  }
+}
+
+size_t OperationMultiEvalStreamingPoly::padDataset(sgpp::base::DataMatrix& dataset) {
+  size_t vecWidth = this->getChunkDataPoints();
+
+  // Assure that data has a even number of instances -> padding might be needed
+  size_t remainder = dataset.getNrows() % vecWidth;
+  size_t loopCount = vecWidth - remainder;
+
+  if (loopCount != vecWidth) {
+    sgpp::base::DataVector lastRow(dataset.getNcols());
+    size_t oldSize = dataset.getNrows();
+    dataset.getRow(dataset.getNrows() - 1, lastRow);
+    dataset.resize(dataset.getNrows() + loopCount);
+
+    for (size_t i = 0; i < loopCount; i++) {
+      dataset.setRow(oldSize + i, lastRow);
+    }
+  }
+
+  return dataset.getNrows();
+}
+
+double OperationMultiEvalStreamingPoly::getDuration() { return this->duration; }
+
+void OperationMultiEvalStreamingPoly::prepare() { this->recalculateLevelIndexFactors(); }
+
+}  // namespace datadriven
+}  // namespace sgpp
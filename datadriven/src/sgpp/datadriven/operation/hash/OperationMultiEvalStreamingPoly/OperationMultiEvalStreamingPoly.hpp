@@ -0,0 +1,124 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+#ifndef STREAMING_POLY_UNROLLING_WIDTH
+#define STREAMING_POLY_UNROLLING_WIDTH 24
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Streaming implementation of OperationMultipleEval for grids with polynomial basis
+ * functions (Poly, ModPoly and PolyBoundary grids) on CPUs.
+ *
+ * The data is blocked and partitioned among the OpenMP threads like in
+ * OperationMultiEvalStreaming. Every one-dimensional basis function is stored as its
+ * product of linear factors in the scaled coordinate t = 2^l x (the roots of the
+ * hierarchical polynomial), such that all basis types share a single branch-free
+ * kernel that is vectorized over the data points of a block with OpenMP SIMD.
+ * As every basis function vanishes at the bounds of its support [i - 1, i + 1] (in t),
+ * the support is enforced by clamping t to these bounds.
+ *
+ * The data points have to lie in the unit hypercube.
+ */
+class OperationMultiEvalStreamingPoly : public base::OperationMultipleEval {
+ protected:
+  sgpp::base::DataMatrix preparedDataset;
+  /// Member to store the sparse grid's levels (2^l) for better vectorization
+  std::vector<double> level;
+  /// Member to store the sparse grid's indices for better vectorization
+  std::vector<double> index;
+  /// slopes of the linear factors of the 1D basis functions (numFactors per grid point and dim)
+  std::vector<double> factorSlope;
+  /// offsets of the linear factors of the 1D basis functions
+  std::vector<double> factorOffset;
+  /// maximal number of linear factors of a 1D basis function (i.e., the degree)
+  size_t numFactors;
+  /// Timer object to handle time measurements
+  sgpp::base::SGppStopwatch myTimer_;
+
+  base::GridStorage* storage;
+
+  double duration;
+
+ public:
+  /**
+   * Constructor.
+   *
+   * @param grid Poly, ModPoly or PolyBoundary grid
+   * @param dataset data points (one per row)
+   */
+  OperationMultiEvalStreamingPoly(base::Grid& grid, base::DataMatrix& dataset);
+
+  ~OperationMultiEvalStreamingPoly() override;
+
+  size_t getChunkGridPoints();
+
+  size_t getChunkDataPoints();
+
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  void multTranspose(sgpp::base::DataVector& source, sgpp::base::DataVector& result) override;
+
+  void prepare() override;
+
+  double getDuration() override;
+
+ private:
+  void getPartitionSegment(size_t start, size_t end, size_t segmentCount, size_t segmentNumber,
+                           size_t* segmentStart, size_t* segmentEnd, size_t blockSize);
+
+  size_t padDataset(sgpp::base::DataMatrix& dataset);
+
+  void getOpenMPPartitionSegment(size_t start, size_t end, size_t* segmentStart, size_t* segmentEnd,
+                                 size_t blocksize);
+
+  void multImpl(sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& alpha,
+                sgpp::base::DataVector& result, const size_t start_index_grid,
+                const size_t end_index_grid, const size_t start_index_data,
+                const size_t end_index_data);
+
+  void multTransposeImpl(sgpp::base::DataMatrix* dataset, sgpp::base::DataVector& source,
+                         sgpp::base::DataVector& result, const size_t start_index_grid,
+                         const size_t end_index_grid, const size_t start_index_data,
+                         const size_t end_index_data);
+
+  /**
+   * Computes the levels, indices and linear factors of the 1D basis functions
+   * of all grid points.
+   */
+  void recalculateLevelIndexFactors();
+
+  /**
+   * Stores the roots of the polynomial 1D basis function (level l, index i)
+   * as linear factors (t - r) / (i - r) in t = 2^l x, see PolyBasis::evalBasis.
+   *
+   * @param l level
+   * @param i index
+   * @param slope pointer to the slopes of the factors of this basis function
+   * @param offset pointer to the offsets of the factors of this basis function
+   */
+  void setPolyFactors(base::level_t l, base::index_t i, double* slope, double* offset);
+
+  /// degree of the polynomials
+  size_t degree;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,89 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace datadriven {
+
+void OperationMultiEvalStreamingPoly::multImpl(sgpp::base::DataMatrix* dataset,
+                                               sgpp::base::DataVector& alpha,
+                                               sgpp::base::DataVector& result,
+                                               const size_t start_index_grid,
+                                               const size_t end_index_grid,
+                                               const size_t start_index_data,
+                                               const size_t end_index_data) {
+  const double* ptrLevel = this->level.data();
+  const double* ptrIndex = this->index.data();
+  const double* ptrSlope = this->factorSlope.data();
+  const double* ptrOffset = this->factorOffset.data();
+  const double* ptrAlpha = alpha.getPointer();
+  const double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  const size_t result_size = result.getSize();
+  const size_t dims = dataset->getNrows();
+  const size_t factors = this->numFactors;
+  const size_t chunkDataPoints = STREAMING_POLY_UNROLLING_WIDTH;
+
+  // the dataset is padded to a multiple of the chunk size
+  for (size_t c = start_index_data; c < end_index_data; c += chunkDataPoints) {
+    double chunkResult[STREAMING_POLY_UNROLLING_WIDTH] = {};
+
+    for (size_t m = start_index_grid; m < end_index_grid;
+         m += std::min<size_t>(getChunkGridPoints(), (end_index_grid - m))) {
+      size_t grid_end = std::min<size_t>(getChunkGridPoints() + m, end_index_grid);
+
+      for (size_t j = m; j < grid_end; j++) {
+        double curSupport[STREAMING_POLY_UNROLLING_WIDTH];
+        double t[STREAMING_POLY_UNROLLING_WIDTH];
+
+#pragma omp simd
+        for (size_t i = 0; i < chunkDataPoints; i++) {
+          curSupport[i] = ptrAlpha[j];
+        }
+
+        for (size_t d = 0; d < dims; d++) {
+          const double curLevel = ptrLevel[(j * dims) + d];
+          const double lowerBound = ptrIndex[(j * dims) + d] - 1.0;
+          const double upperBound = ptrIndex[(j * dims) + d] + 1.0;
+          const double* curSlope = &ptrSlope[((j * dims) + d) * factors];
+          const double* curOffset = &ptrOffset[((j * dims) + d) * factors];
+          const double* curData = &ptrData[(d * result_size) + c];
+
+#pragma omp simd
+          for (size_t i = 0; i < chunkDataPoints; i++) {
+            // the basis functions vanish at the bounds of their support
+            t[i] = std::min(std::max(curLevel * curData[i], lowerBound), upperBound);
+          }
+
+          for (size_t k = 0; k < factors; k++) {
+            const double slope = curSlope[k];
+            const double offset = curOffset[k];
+
+#pragma omp simd
+            for (size_t i = 0; i < chunkDataPoints; i++) {
+              curSupport[i] *= slope * t[i] + offset;
+            }
+          }
+        }
+
+#pragma omp simd
+        for (size_t i = 0; i < chunkDataPoints; i++) {
+          chunkResult[i] += curSupport[i];
+        }
+      }
+    }
+
+    for (size_t i = 0; i < chunkDataPoints; i++) {
+      ptrResult[c + i] += chunkResult[i];
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,87 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreamingPoly/OperationMultiEvalStreamingPoly.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+
+namespace sgpp {
+namespace datadriven {
+
+void OperationMultiEvalStreamingPoly::multTransposeImpl(sgpp::base::DataMatrix* dataset,
+                                                        sgpp::base::DataVector& source,
+                                                        sgpp::base::DataVector& result,
+                                                        const size_t start_index_grid,
+                                                        const size_t end_index_grid,
+                                                        const size_t start_index_data,
+                                                        const size_t end_index_data) {
+  const double* ptrLevel = this->level.data();
+  const double* ptrIndex = this->index.data();
+  const double* ptrSlope = this->factorSlope.data();
+  const double* ptrOffset = this->factorOffset.data();
+  const double* ptrSource = source.getPointer();
+  const double* ptrData = dataset->getPointer();
+  double* ptrResult = result.getPointer();
+  const size_t sourceSize = source.getSize();
+  const size_t dims = dataset->getNrows();
+  const size_t factors = this->numFactors;
+  const size_t chunkDataPoints = STREAMING_POLY_UNROLLING_WIDTH;
+
+  for (size_t k = start_index_grid; k < end_index_grid;
+       k += std::min<size_t>(getChunkGridPoints(), (end_index_grid - k))) {
+    size_t grid_end = std::min<size_t>(getChunkGridPoints() + k, end_index_grid);
+
+    // the dataset is padded to a multiple of the chunk size
+    for (size_t c = start_index_data; c < end_index_data; c += chunkDataPoints) {
+      for (size_t j = k; j < grid_end; j++) {
+        double curSupport[STREAMING_POLY_UNROLLING_WIDTH];
+        double t[STREAMING_POLY_UNROLLING_WIDTH];
+
+#pragma omp simd
+        for (size_t i = 0; i < chunkDataPoints; i++) {
+          curSupport[i] = ptrSource[c + i];
+        }
+
+        for (size_t d = 0; d < dims; d++) {
+          const double curLevel = ptrLevel[(j * dims) + d];
+          const double lowerBound = ptrIndex[(j * dims) + d] - 1.0;
+          const double upperBound = ptrIndex[(j * dims) + d] + 1.0;
+          const double* curSlope = &ptrSlope[((j * dims) + d) * factors];
+          const double* curOffset = &ptrOffset[((j * dims) + d) * factors];
+          const double* curData = &ptrData[(d * sourceSize) + c];
+
+#pragma omp simd
+          for (size_t i = 0; i < chunkDataPoints; i++) {
+            // the basis functions vanish at the bounds of their support
+            t[i] = std::min(std::max(curLevel * curData[i], lowerBound), upperBound);
+          }
+
+          for (size_t f = 0; f < factors; f++) {
+            const double slope = curSlope[f];
+            const double offset = curOffset[f];
+
+#pragma omp simd
+            for (size_t i = 0; i < chunkDataPoints; i++) {
+              curSupport[i] *= slope * t[i] + offset;
+            }
+          }
+        }
+
+        double sum = 0.0;
+
+#pragma omp simd reduction(+ : sum)
+        for (size_t i = 0; i < chunkDataPoints; i++) {
+          sum += curSupport[i];
+        }
+
+        ptrResult[j] += sum;
+      }
+    }
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,138 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalAdaptive/MultipleEvalTuningCache.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+MultipleEvalTuningCache::MultipleEvalTuningCache(const std::string& fileName)
+    : fileName(fileName) {}
+
+bool MultipleEvalTuningCache::lookup(const std::string& key, std::string& multBackend,
+                                     std::string& multTransposeBackend) const {
+  std::map<std::string, std::string> entries;
+  read(entries);
+
+  auto it = entries.find(key);
+
+  if (it == entries.end()) {
+    return false;
+  }
+
+  const size_t separator = it->second.find(';');
+  multBackend = it->second.substr(0, separator);
+  multTransposeBackend = it->second.substr(separator + 1);
+  return true;
+}
+
+void MultipleEvalTuningCache::store(const std::string& key, const std::string& multBackend,
+                                    const std::string& multTransposeBackend) const {
+  if (fileName.empty()) {
+    return;
+  }
+
+  std::map<std::string, std::string> entries;
+  read(entries);
+  entries[key] = multBackend + ";" + multTransposeBackend;
+
+  // write to a temporary file first and rename it, such that concurrent runs sharing the file
+  // never read a partially written cache
+  const std::string tempFileName = fileName + ".tmp" + std::to_string(std::random_device()());
+
+  {
+    std::ofstream file(tempFileName, std::ios::trunc);
+
+    for (auto& entry : entries) {
+      file << entry.first << ";" << entry.second << "\n";
+    }
+
+    file.close();
+
+    if (file.fail()) {
+      std::remove(tempFileName.c_str());
+      return;
+    }
+  }
+
+  if (std::rename(tempFileName.c_str(), fileName.c_str()) != 0) {
+    std::remove(tempFileName.c_str());
+  }
+}
+
+const std::string& MultipleEvalTuningCache::getFileName() const { return fileName; }
+
+std::string MultipleEvalTuningCache::createKey(const std::string& gridType, size_t dim,
+                                               size_t gridSize, size_t datasetSize) {
+  std::string cpuModel = getCPUModel();
+  std::replace(cpuModel.begin(), cpuModel.end(), ';', ' ');
+
+  std::stringstream key;
+  key << gridType << ";" << dim << ";" << gridSize << ";" << datasetSize << ";" << cpuModel;
+  return key.str();
+}
+
+std::string MultipleEvalTuningCache::getCPUModel() {
+  std::ifstream cpuInfo("/proc/cpuinfo");
+  std::string line;
+
+  while (std::getline(cpuInfo, line)) {
+    if (line.compare(0, 10, "model name") == 0) {
+      const size_t colon = line.find(':');
+
+      if (colon != std::string::npos) {
+        const size_t begin = line.find_first_not_of(" \t", colon + 1);
+        return (begin == std::string::npos) ? "unknown" : line.substr(begin);
+      }
+    }
+  }
+
+  return "unknown";
+}
+
+std::string MultipleEvalTuningCache::getDefaultFileName() {
+  const char* fileName = std::getenv("SGPP_MULTIEVAL_TUNING_CACHE");
+
+  return (fileName != nullptr) ? fileName : "";
+}
+
+void MultipleEvalTuningCache::read(std::map<std::string, std::string>& entries) const {
+  if (fileName.empty()) {
+    return;
+  }
+
+  std::ifstream file(fileName);
+  std::string line;
+
+  while (std::getline(file, line)) {
+    // the key consists of five fields, followed by the two backend names
+    size_t separator = 0;
+
+    for (size_t k = 0; (k < 5) && (separator != std::string::npos); k++) {
+      separator = line.find(';', (k == 0) ? 0 : separator + 1);
+    }
+
+    if ((separator == std::string::npos) ||
+        (line.find(';', separator + 1) == std::string::npos)) {
+      continue;
+    }
+
+    entries[line.substr(0, separator)] = line.substr(separator + 1);
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,100 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/globaldef.hpp>
+
+#include <map>
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * On-disk cache of the backends selected by OperationMultipleEvalAdaptive.
+ *
+ * Every line of the cache file contains a key (grid type, dimensionality, number of grid
+ * points, number of data points and CPU model) and the names of the backends selected for
+ * mult and multTranspose, separated by semicolons. The file is read on every lookup and
+ * replaced on every store, hence it can be shared by consecutive runs. The new contents are
+ * written to a temporary file, which is then renamed to the cache file, so readers never see
+ * a partially written file (if a store fails, the selection is just not cached).
+ *
+ * The cache is opt-in: without an explicit file name (see getDefaultFileName()), nothing is
+ * read from or written to the disk.
+ */
+class MultipleEvalTuningCache {
+ public:
+  /**
+   * Constructor.
+   *
+   * @param fileName path of the cache file, an empty string disables the cache
+   */
+  explicit MultipleEvalTuningCache(const std::string& fileName);
+
+  /**
+   * Looks up the backends selected for a key.
+   *
+   * @param key key of the tuning problem (see createKey())
+   * @param[out] multBackend name of the backend selected for mult
+   * @param[out] multTransposeBackend name of the backend selected for multTranspose
+   * @return whether the key was found
+   */
+  bool lookup(const std::string& key, std::string& multBackend,
+              std::string& multTransposeBackend) const;
+
+  /**
+   * Stores (or replaces) the backends selected for a key.
+   *
+   * @param key key of the tuning problem (see createKey())
+   * @param multBackend name of the backend selected for mult
+   * @param multTransposeBackend name of the backend selected for multTranspose
+   */
+  void store(const std::string& key, const std::string& multBackend,
+             const std::string& multTransposeBackend) const;
+
+  /**
+   * @return path of the cache file
+   */
+  const std::string& getFileName() const;
+
+  /**
+   * Creates the key of a tuning problem.
+   *
+   * @param gridType grid type as string
+   * @param dim dimensionality
+   * @param gridSize number of grid points
+   * @param datasetSize number of data points
+   * @return key
+   */
+  static std::string createKey(const std::string& gridType, size_t dim, size_t gridSize,
+                               size_t datasetSize);
+
+  /**
+   * @return model name of the CPU (from /proc/cpuinfo) or "unknown"
+   */
+  static std::string getCPUModel();
+
+  /**
+   * @return path of the default cache file: the environment variable
+   * SGPP_MULTIEVAL_TUNING_CACHE if set, otherwise an empty string (no cache)
+   */
+  static std::string getDefaultFileName();
+
+ private:
+  /// path of the cache file
+  std::string fileName;
+
+  /**
+   * Reads all entries of the cache file.
+   *
+   * @param[out] entries map from keys to the backend names (separated by a semicolon)
+   */
+  void read(std::map<std::string, std::string>& entries) const;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
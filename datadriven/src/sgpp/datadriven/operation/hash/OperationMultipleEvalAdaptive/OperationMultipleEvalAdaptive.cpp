@@ -0,0 +1,258 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalAdaptive/OperationMultipleEvalAdaptive.hpp>
+
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+
+#include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+OperationMultipleEvalAdaptive::OperationMultipleEvalAdaptive(
+    base::Grid& grid, base::DataMatrix& dataset,
+    OperationMultipleEvalConfiguration& configuration)
+    : base::OperationMultipleEval(grid, dataset),
+      cache(MultipleEvalTuningCache::getDefaultFileName()),
+      sampleSize(2048),
+      repetitions(3),
+      gridSize(0),
+      selectionCached(false),
+      duration(0.0) {
+  std::shared_ptr<base::OperationConfiguration> parameters = configuration.getParameters();
+
+  if (parameters != nullptr) {
+    if (parameters->contains("TUNING_CACHE_FILE")) {
+      cache = MultipleEvalTuningCache((*parameters)["TUNING_CACHE_FILE"].get());
+    }
+
+    if (parameters->contains("TUNING_SAMPLE_SIZE")) {
+      sampleSize = std::max<size_t>((*parameters)["TUNING_SAMPLE_SIZE"].getUInt(), 1);
+    }
+
+    if (parameters->contains("TUNING_REPETITIONS")) {
+      repetitions = std::max<size_t>((*parameters)["TUNING_REPETITIONS"].getUInt(), 1);
+    }
+  }
+
+  selectBackends();
+}
+
+OperationMultipleEvalAdaptive::~OperationMultipleEvalAdaptive() {}
+
+void OperationMultipleEvalAdaptive::mult(base::DataVector& alpha, base::DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::mult");
+  if (grid.getSize() != gridSize) {
+    selectBackends();
+  }
+
+  base::SGppStopwatch stopwatch;
+  stopwatch.start();
+  multOp->mult(alpha, result);
+  duration = stopwatch.stop();
+}
+
+void OperationMultipleEvalAdaptive::multTranspose(base::DataVector& source,
+                                                  base::DataVector& result) {
+  SGPP_INSTRUMENT_SCOPE("OperationMultipleEval::multTranspose");
+  if (grid.getSize() != gridSize) {
+    selectBackends();
+  }
+
+  base::OperationMultipleEval& op = (multTransposeOp != nullptr) ? *multTransposeOp : *multOp;
+  base::SGppStopwatch stopwatch;
+  stopwatch.start();
+  op.multTranspose(source, result);
+  duration = stopwatch.stop();
+}
+
+void OperationMultipleEvalAdaptive::prepare() {
+  if (grid.getSize() != gridSize) {
+    selectBackends();
+  }
+
+  multOp->prepare();
+
+  if (multTransposeOp != nullptr) {
+    multTransposeOp->prepare();
+  }
+}
+
+double OperationMultipleEvalAdaptive::getDuration() { return duration; }
+
+std::string OperationMultipleEvalAdaptive::getImplementationName() {
+  return "ADAPTIVE(mult: " + multBackend + ", multTranspose: " + multTransposeBackend + ")";
+}
+
+const std::string& OperationMultipleEvalAdaptive::getMultBackend() const { return multBackend; }
+
+const std::string& OperationMultipleEvalAdaptive::getMultTransposeBackend() const {
+  return multTransposeBackend;
+}
+
+bool OperationMultipleEvalAdaptive::isSelectionCached() const { return selectionCached; }
+
+std::vector<OperationMultipleEvalAdaptive::Backend>
+OperationMultipleEvalAdaptive::getCandidateBackends() {
+  return {{"DEFAULT", OperationMultipleEvalType::DEFAULT, OperationMultipleEvalSubType::DEFAULT},
+          {"STREAMING", OperationMultipleEvalType::STREAMING,
+           OperationMultipleEvalSubType::DEFAULT},
+          {"SUBSPACELINEAR_COMBINED", OperationMultipleEvalType::SUBSPACELINEAR,
+           OperationMultipleEvalSubType::COMBINED},
+          {"SUBSPACELINEAR_SIMPLE", OperationMultipleEvalType::SUBSPACELINEAR,
+           OperationMultipleEvalSubType::SIMPLE}};
+}
+
+void OperationMultipleEvalAdaptive::selectBackends() {
+  gridSize = grid.getSize();
+  multOp.reset();
+  multTransposeOp.reset();
+
+  const std::string key = MultipleEvalTuningCache::createKey(
+      grid.getTypeAsString(), grid.getDimension(), gridSize, dataset.getNrows());
+  selectionCached = cache.lookup(key, multBackend, multTransposeBackend);
+
+  if (selectionCached) {
+    multOp.reset(createBackend(multBackend, dataset));
+
+    if ((multTransposeBackend != multBackend) && (multOp != nullptr)) {
+      multTransposeOp.reset(createBackend(multTransposeBackend, dataset));
+
+      if (multTransposeOp == nullptr) {
+        multOp.reset();
+      }
+    }
+
+    // backends of the cache entry not available (anymore)
+    selectionCached = (multOp != nullptr);
+  }
+
+  if (!selectionCached) {
+    tuneBackends();
+    cache.store(key, multBackend, multTransposeBackend);
+
+    multOp.reset(createBackend(multBackend, dataset));
+
+    if (multTransposeBackend != multBackend) {
+      multTransposeOp.reset(createBackend(multTransposeBackend, dataset));
+    }
+  }
+}
+
+void OperationMultipleEvalAdaptive::tuneBackends() {
+  const size_t numDataPoints = dataset.getNrows();
+  const size_t numSamplePoints = std::max<size_t>(std::min(numDataPoints, sampleSize), 1);
+
+  // equidistant sample of the data points
+  base::DataMatrix sample(numSamplePoints, dataset.getNcols());
+  base::DataVector row(dataset.getNcols(), 0.0);
+
+  for (size_t k = 0; k < numSamplePoints; k++) {
+    if (numDataPoints > 0) {
+      dataset.getRow(k * numDataPoints / numSamplePoints, row);
+    }
+
+    sample.setRow(k, row);
+  }
+
+  base::DataVector alpha(gridSize);
+  base::DataVector source(numSamplePoints);
+
+  for (size_t i = 0; i < gridSize; i++) {
+    alpha[i] = 1.0 / static_cast<double>(i + 1);
+  }
+
+  for (size_t k = 0; k < numSamplePoints; k++) {
+    source[k] = 1.0 / static_cast<double>(k + 1);
+  }
+
+  base::DataVector result(numSamplePoints);
+  base::DataVector resultTranspose(gridSize);
+  base::SGppStopwatch stopwatch;
+  double bestMultTime = std::numeric_limits<double>::infinity();
+  double bestMultTransposeTime = std::numeric_limits<double>::infinity();
+
+  multBackend.clear();
+  multTransposeBackend.clear();
+
+  for (const Backend& backend : getCandidateBackends()) {
+    std::unique_ptr<base::OperationMultipleEval> op(createBackend(backend.name, sample));
+
+    if (op == nullptr) {
+      continue;
+    }
+
+    try {
+      // first run includes the preparation of the data structures
+      op->mult(alpha, result);
+      double multTime = std::numeric_limits<double>::infinity();
+
+      for (size_t r = 0; r < repetitions; r++) {
+        stopwatch.start();
+        op->mult(alpha, result);
+        multTime = std::min(multTime, stopwatch.stop());
+      }
+
+      if (multTime < bestMultTime) {
+        bestMultTime = multTime;
+        multBackend = backend.name;
+      }
+    } catch (base::operation_exception&) {
+    }
+
+    try {
+      op->multTranspose(source, resultTranspose);
+      double multTransposeTime = std::numeric_limits<double>::infinity();
+
+      for (size_t r = 0; r < repetitions; r++) {
+        stopwatch.start();
+        op->multTranspose(source, resultTranspose);
+        multTransposeTime = std::min(multTransposeTime, stopwatch.stop());
+      }
+
+      if (multTransposeTime < bestMultTransposeTime) {
+        bestMultTransposeTime = multTransposeTime;
+        multTransposeBackend = backend.name;
+      }
+    } catch (base::operation_exception&) {
+    }
+  }
+
+  if (multBackend.empty() || multTransposeBackend.empty()) {
+    throw base::operation_exception(
+        "OperationMultipleEvalAdaptive: no backend available for this grid type");
+  }
+}
+
+base::OperationMultipleEval* OperationMultipleEvalAdaptive::createBackend(
+    const std::string& name, base::DataMatrix& dataset) {
+  for (const Backend& backend : getCandidateBackends()) {
+    if (backend.name == name) {
+      OperationMultipleEvalConfiguration configuration(backend.type, backend.subType);
+
+      try {
+        return op_factory::createOperationMultipleEval(grid, dataset, configuration);
+      } catch (base::factory_exception&) {
+        return nullptr;
+      }
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,146 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalAdaptive/MultipleEvalTuningCache.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Autotuning implementation of OperationMultipleEval (OperationMultipleEvalType::ADAPTIVE).
+ *
+ * The available CPU backends (DEFAULT, STREAMING and the SUBSPACELINEAR variants, as far as
+ * they are supported for the grid type and compiled in) are benchmarked on a sample of the
+ * dataset with the actual grid. The fastest backend is selected for mult and for
+ * multTranspose separately. The selection is stored in a MultipleEvalTuningCache keyed by
+ * grid type, dimensionality, number of grid points, number of data points and CPU model,
+ * such that later runs with the same problem start with the tuned backends right away, if a
+ * cache file has been configured.
+ * If the number of grid points changes (e.g. due to refinement), the backends are selected
+ * again.
+ *
+ * The following parameters of the OperationMultipleEvalConfiguration are supported:
+ * - TUNING_CACHE_FILE: path of the cache file (empty: no cache, default:
+ *   MultipleEvalTuningCache::getDefaultFileName(), i.e., no cache unless the environment variable
+ *   SGPP_MULTIEVAL_TUNING_CACHE is set)
+ * - TUNING_SAMPLE_SIZE: maximum number of data points used for the benchmarks (default: 2048)
+ * - TUNING_REPETITIONS: number of timed runs per backend, the fastest counts (default: 3)
+ */
+class OperationMultipleEvalAdaptive : public base::OperationMultipleEval {
+ public:
+  /**
+   * Constructor, selects the backends.
+   *
+   * @param grid the sparse grid used for this operation
+   * @param dataset data set that should be evaluated on the sparse grid
+   * @param configuration configuration with optional tuning parameters (see class description)
+   */
+  OperationMultipleEvalAdaptive(base::Grid& grid, base::DataMatrix& dataset,
+                                OperationMultipleEvalConfiguration& configuration);
+
+  /**
+   * Destructor
+   */
+  ~OperationMultipleEvalAdaptive() override;
+
+  void mult(base::DataVector& alpha, base::DataVector& result) override;
+
+  void multTranspose(base::DataVector& source, base::DataVector& result) override;
+
+  void prepare() override;
+
+  double getDuration() override;
+
+  std::string getImplementationName() override;
+
+  /**
+   * @return name of the backend selected for mult
+   */
+  const std::string& getMultBackend() const;
+
+  /**
+   * @return name of the backend selected for multTranspose
+   */
+  const std::string& getMultTransposeBackend() const;
+
+  /**
+   * @return whether the selection was taken from the tuning cache
+   */
+  bool isSelectionCached() const;
+
+ protected:
+  /// candidate backend
+  struct Backend {
+    /// name of the backend (used in the tuning cache)
+    std::string name;
+    /// type of the backend
+    OperationMultipleEvalType type;
+    /// sub-type of the backend
+    OperationMultipleEvalSubType subType;
+  };
+
+  /**
+   * @return all CPU backends that may be selected
+   */
+  static std::vector<Backend> getCandidateBackends();
+
+  /**
+   * Selects the backends for mult and multTranspose (from the cache or by benchmarking)
+   * and creates the corresponding operations on the full dataset.
+   */
+  void selectBackends();
+
+  /**
+   * Benchmarks all candidate backends on a sample of the dataset.
+   */
+  void tuneBackends();
+
+  /**
+   * Creates the operation of a backend.
+   *
+   * @param name name of the backend
+   * @param dataset dataset of the operation
+   * @return operation (nullptr if the backend is not available for the grid)
+   */
+  base::OperationMultipleEval* createBackend(const std::string& name,
+                                              base::DataMatrix& dataset);
+
+  /// tuning cache
+  MultipleEvalTuningCache cache;
+  /// maximum number of data points used for the benchmarks
+  size_t sampleSize;
+  /// number of timed runs per backend
+  size_t repetitions;
+  /// number of grid points the backends were selected for
+  size_t gridSize;
+  /// whether the selection was taken from the tuning cache
+  bool selectionCached;
+  /// name of the backend selected for mult
+  std::string multBackend;
+  /// name of the backend selected for multTranspose
+  std::string multTransposeBackend;
+  /// operation used for mult
+  std::unique_ptr<base::OperationMultipleEval> multOp;
+  /// operation used for multTranspose (nullptr if it coincides with multOp)
+  std::unique_ptr<base::OperationMultipleEval> multTransposeOp;
+  /// duration of the last mult or multTranspose
+  double duration;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
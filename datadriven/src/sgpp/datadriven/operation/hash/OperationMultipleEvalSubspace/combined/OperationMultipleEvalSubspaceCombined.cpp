@@ -18,9 +18,12 @@ using sgpp::base::DataVector;
 namespace sgpp {
 namespace datadriven {
 
-OperationMultipleEvalSubspaceCombined::OperationMultipleEvalSubspaceCombined(Grid& grid,
-                                                                             DataMatrix& dataset)
-    : AbstractOperationMultipleEvalSubspace(grid, dataset) {
+OperationMultipleEvalSubspaceCombined::OperationMultipleEvalSubspaceCombined(
+    Grid& grid, DataMatrix& dataset, SubspaceKernelVariant kernelVariant)
+    : AbstractOperationMultipleEvalSubspace(grid, dataset),
+      kernelVariant(kernelVariant),
+      calculateIndex(OperationMultipleEvalSubspaceCombinedKernels::getKernel(kernelVariant)),
+      kernelWidth(OperationMultipleEvalSubspaceCombinedKernels::getKernelWidth(kernelVariant)) {
   this->paddedDataset = this->padDataset(dataset);
   this->storage = &grid.getStorage();
   // this->dataset = dataset;
@@ -201,7 +204,7 @@ DataMatrix* OperationMultipleEvalSubspaceCombined::padDataset(sgpp::base::DataMa
   // indices larger than size(dataset) (even though the dataset is divided by
   // X86COMBINED_PARALLEL_DATA_POINTS)
   // add X86COMBINED_VEC_PADDING dummy data points to avoid that problem
-  // add X86COMBINED_VEC_PADDING * 2 to also enable the calculateIndexCombined2() method
+  // add X86COMBINED_VEC_PADDING * 2 to also cover kernels that process several vectors at once
   // this works due to special semantics of "reserveAdditionalRows()", this function adds additional
   // unused (and uncounted) rows
   paddedDataset->reserveAdditionalRows(X86COMBINED_VEC_PADDING * 2);
@@ -226,5 +229,9 @@ size_t OperationMultipleEvalSubspaceCombined::getAlignment() {
 
 std::string OperationMultipleEvalSubspaceCombined::getImplementationName() { return "COMBINED"; }
 
+SubspaceKernelVariant OperationMultipleEvalSubspaceCombined::getKernelVariant() {
+  return this->kernelVariant;
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
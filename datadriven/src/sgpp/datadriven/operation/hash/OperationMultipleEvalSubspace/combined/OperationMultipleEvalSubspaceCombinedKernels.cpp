@@ -0,0 +1,281 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/combined/OperationMultipleEvalSubspaceCombinedKernels.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef X86COMBINED_RUNTIME_DISPATCH
+#include <immintrin.h>
+#endif
+
+#include <cmath>
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+bool OperationMultipleEvalSubspaceCombinedKernels::isSupported(SubspaceKernelVariant variant) {
+  switch (variant) {
+    case SubspaceKernelVariant::SCALAR:
+      return true;
+#ifdef X86COMBINED_RUNTIME_DISPATCH
+    case SubspaceKernelVariant::AVX2:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2");
+    case SubspaceKernelVariant::AVX512:
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2");
+#endif
+    default:
+      return false;
+  }
+}
+
+SubspaceKernelVariant OperationMultipleEvalSubspaceCombinedKernels::getBestSupportedVariant() {
+  if (isSupported(SubspaceKernelVariant::AVX512)) {
+    return SubspaceKernelVariant::AVX512;
+  } else if (isSupported(SubspaceKernelVariant::AVX2)) {
+    return SubspaceKernelVariant::AVX2;
+  } else {
+    return SubspaceKernelVariant::SCALAR;
+  }
+}
+
+OperationMultipleEvalSubspaceCombinedKernels::CalculateIndexFunction
+OperationMultipleEvalSubspaceCombinedKernels::getKernel(SubspaceKernelVariant variant) {
+  if (!isSupported(variant)) {
+    throw sgpp::base::operation_exception(
+        "OperationMultipleEvalSubspaceCombinedKernels: kernel variant " + toString(variant) +
+        " is not supported by this CPU or compiler");
+  }
+
+  switch (variant) {
+#ifdef X86COMBINED_RUNTIME_DISPATCH
+    case SubspaceKernelVariant::AVX2:
+      return &calculateIndexAVX2;
+    case SubspaceKernelVariant::AVX512:
+      return &calculateIndexAVX512;
+#endif
+    default:
+      return &calculateIndexScalar;
+  }
+}
+
+size_t OperationMultipleEvalSubspaceCombinedKernels::getKernelWidth(SubspaceKernelVariant variant) {
+  return (variant == SubspaceKernelVariant::AVX512) ? 8 : 4;
+}
+
+std::string OperationMultipleEvalSubspaceCombinedKernels::toString(SubspaceKernelVariant variant) {
+  switch (variant) {
+    case SubspaceKernelVariant::AVX2:
+      return "AVX2";
+    case SubspaceKernelVariant::AVX512:
+      return "AVX512";
+    default:
+      return "SCALAR";
+  }
+}
+
+void OperationMultipleEvalSubspaceCombinedKernels::calculateIndexScalar(
+    size_t dim, size_t nextIterationToRecalc, const double* const* dataTuplePtr,
+    const uint32_t* hInverse, uint32_t* const* intermediates, double* const* evalIndexValues,
+    uint32_t* indexFlat, double* phiEval) {
+  // local copies, the output arrays might alias the partial results
+  uint32_t indexFlatReg[4];
+  double phiEvalReg[4];
+
+  for (size_t j = 0; j < 4; j++) {
+    indexFlatReg[j] = intermediates[j][nextIterationToRecalc];
+    phiEvalReg[j] = evalIndexValues[j][nextIterationToRecalc];
+  }
+
+  for (size_t i = nextIterationToRecalc; i < dim; i++) {
+    const double hInverseDouble = static_cast<double>(hInverse[i]);
+    const uint32_t actualDirectionGridPoints = hInverse[i] >> 1;
+
+    // independent iterations, vectorized by the compiler for the baseline instruction set
+    for (size_t j = 0; j < 4; j++) {
+      const double unadjusted = dataTuplePtr[j][i] * hInverseDouble;
+      // implies flooring, next odd index
+      const int32_t rounded = static_cast<int32_t>(unadjusted);
+      const int32_t index = rounded + (1 ^ (rounded & 1));
+
+      indexFlatReg[j] =
+          indexFlatReg[j] * actualDirectionGridPoints + (static_cast<uint32_t>(index) >> 1);
+      phiEvalReg[j] *= 1.0 - std::fabs(unadjusted - static_cast<double>(index));
+    }
+
+    for (size_t j = 0; j < 4; j++) {
+      intermediates[j][i + 1] = indexFlatReg[j];
+      evalIndexValues[j][i + 1] = phiEvalReg[j];
+    }
+  }
+
+  for (size_t j = 0; j < 4; j++) {
+    indexFlat[j] = indexFlatReg[j];
+    phiEval[j] = phiEvalReg[j];
+  }
+}
+
+#ifdef X86COMBINED_RUNTIME_DISPATCH
+
+__attribute__((target("avx2"))) void OperationMultipleEvalSubspaceCombinedKernels::
+    calculateIndexAVX2(size_t dim, size_t nextIterationToRecalc,
+                       const double* const* dataTuplePtr, const uint32_t* hInverse,
+                       uint32_t* const* intermediates, double* const* evalIndexValues,
+                       uint32_t* indexFlat, double* phiEval) {
+  __m128i oneIntegerReg = _mm_set1_epi32(1);
+
+  union {
+    __m128i integerRegister;
+    uint32_t uint32Value[4];
+  } sseUnion;
+
+  union {
+    __m256d doubleRegister;
+    double doubleValue[4];
+  } avxUnion;
+
+  // flatten only
+  __m128i indexFlatReg = _mm_set_epi32(
+      intermediates[3][nextIterationToRecalc], intermediates[2][nextIterationToRecalc],
+      intermediates[1][nextIterationToRecalc], intermediates[0][nextIterationToRecalc]);
+
+  // evaluate only
+  __m256d absMask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFF));
+  __m256d one = _mm256_set1_pd(1.0);
+
+  __m256d phiEvalReg = _mm256_set_pd(
+      evalIndexValues[3][nextIterationToRecalc], evalIndexValues[2][nextIterationToRecalc],
+      evalIndexValues[1][nextIterationToRecalc], evalIndexValues[0][nextIterationToRecalc]);
+
+  for (size_t i = nextIterationToRecalc; i < dim; i++) {
+    __m256d dataTupleReg = _mm256_set_pd(dataTuplePtr[3][i], dataTuplePtr[2][i],
+                                         dataTuplePtr[1][i], dataTuplePtr[0][i]);
+
+    __m256d hInverseReg = _mm256_set1_pd(static_cast<double>(hInverse[i]));
+    __m256d unadjustedReg = _mm256_mul_pd(dataTupleReg, hInverseReg);
+
+    // implies flooring
+    __m128i roundedReg = _mm256_cvttpd_epi32(unadjustedReg);
+    __m128i andedReg = _mm_and_si128(oneIntegerReg, roundedReg);
+    __m128i signReg = _mm_xor_si128(oneIntegerReg, andedReg);
+    __m128i indexReg = _mm_add_epi32(roundedReg, signReg);
+
+    // flatten index
+    __m128i actualDirectionGridPointsReg = _mm_set1_epi32(hInverse[i] >> 1);
+    indexFlatReg = _mm_mullo_epi32(indexFlatReg, actualDirectionGridPointsReg);
+    indexFlatReg = _mm_add_epi32(indexFlatReg, _mm_srli_epi32(indexReg, 1));
+
+    sseUnion.integerRegister = indexFlatReg;
+
+    for (size_t j = 0; j < 4; j++) {
+      intermediates[j][i + 1] = sseUnion.uint32Value[j];
+    }
+
+    // evaluate
+    __m256d indexDoubleReg = _mm256_cvtepi32_pd(indexReg);
+    __m256d phi1DEvalReg = _mm256_sub_pd(unadjustedReg, indexDoubleReg);
+    phi1DEvalReg = _mm256_and_pd(phi1DEvalReg, absMask);
+    phi1DEvalReg = _mm256_sub_pd(one, phi1DEvalReg);
+
+    phiEvalReg = _mm256_mul_pd(phiEvalReg, phi1DEvalReg);
+
+    avxUnion.doubleRegister = phiEvalReg;
+
+    for (size_t j = 0; j < 4; j++) {
+      evalIndexValues[j][i + 1] = avxUnion.doubleValue[j];
+    }
+  }
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(indexFlat), indexFlatReg);
+  _mm256_storeu_pd(phiEval, phiEvalReg);
+}
+
+__attribute__((target("avx2,avx512f"))) void OperationMultipleEvalSubspaceCombinedKernels::
+    calculateIndexAVX512(size_t dim, size_t nextIterationToRecalc,
+                         const double* const* dataTuplePtr, const uint32_t* hInverse,
+                         uint32_t* const* intermediates, double* const* evalIndexValues,
+                         uint32_t* indexFlat, double* phiEval) {
+  __m256i oneIntegerReg = _mm256_set1_epi32(1);
+
+  union {
+    __m256i integerRegister;
+    uint32_t uint32Value[8];
+  } avxUnion;
+
+  union {
+    __m512d doubleRegister;
+    double doubleValue[8];
+  } avx512Union;
+
+  // flatten only
+  __m256i indexFlatReg = _mm256_set_epi32(
+      intermediates[7][nextIterationToRecalc], intermediates[6][nextIterationToRecalc],
+      intermediates[5][nextIterationToRecalc], intermediates[4][nextIterationToRecalc],
+      intermediates[3][nextIterationToRecalc], intermediates[2][nextIterationToRecalc],
+      intermediates[1][nextIterationToRecalc], intermediates[0][nextIterationToRecalc]);
+
+  // evaluate only
+  __m512d one = _mm512_set1_pd(1.0);
+
+  __m512d phiEvalReg = _mm512_set_pd(
+      evalIndexValues[7][nextIterationToRecalc], evalIndexValues[6][nextIterationToRecalc],
+      evalIndexValues[5][nextIterationToRecalc], evalIndexValues[4][nextIterationToRecalc],
+      evalIndexValues[3][nextIterationToRecalc], evalIndexValues[2][nextIterationToRecalc],
+      evalIndexValues[1][nextIterationToRecalc], evalIndexValues[0][nextIterationToRecalc]);
+
+  for (size_t i = nextIterationToRecalc; i < dim; i++) {
+    __m512d dataTupleReg =
+        _mm512_set_pd(dataTuplePtr[7][i], dataTuplePtr[6][i], dataTuplePtr[5][i],
+                      dataTuplePtr[4][i], dataTuplePtr[3][i], dataTuplePtr[2][i],
+                      dataTuplePtr[1][i], dataTuplePtr[0][i]);
+
+    __m512d hInverseReg = _mm512_set1_pd(static_cast<double>(hInverse[i]));
+    __m512d unadjustedReg = _mm512_mul_pd(dataTupleReg, hInverseReg);
+
+    // implies flooring
+    __m256i roundedReg = _mm512_cvttpd_epi32(unadjustedReg);
+    __m256i andedReg = _mm256_and_si256(oneIntegerReg, roundedReg);
+    __m256i signReg = _mm256_xor_si256(oneIntegerReg, andedReg);
+    __m256i indexReg = _mm256_add_epi32(roundedReg, signReg);
+
+    // flatten index
+    __m256i actualDirectionGridPointsReg = _mm256_set1_epi32(hInverse[i] >> 1);
+    indexFlatReg = _mm256_mullo_epi32(indexFlatReg, actualDirectionGridPointsReg);
+    indexFlatReg = _mm256_add_epi32(indexFlatReg, _mm256_srli_epi32(indexReg, 1));
+
+    avxUnion.integerRegister = indexFlatReg;
+
+    for (size_t j = 0; j < 8; j++) {
+      intermediates[j][i + 1] = avxUnion.uint32Value[j];
+    }
+
+    // evaluate
+    __m512d indexDoubleReg = _mm512_cvtepi32_pd(indexReg);
+    __m512d phi1DEvalReg = _mm512_sub_pd(unadjustedReg, indexDoubleReg);
+    phi1DEvalReg = _mm512_abs_pd(phi1DEvalReg);
+    phi1DEvalReg = _mm512_sub_pd(one, phi1DEvalReg);
+
+    phiEvalReg = _mm512_mul_pd(phiEvalReg, phi1DEvalReg);
+
+    avx512Union.doubleRegister = phiEvalReg;
+
+    for (size_t j = 0; j < 8; j++) {
+      evalIndexValues[j][i + 1] = avx512Union.doubleValue[j];
+    }
+  }
+
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(indexFlat), indexFlatReg);
+  _mm512_storeu_pd(phiEval, phiEvalReg);
+}
+
+#endif
+
+}  // namespace datadriven
+}  // namespace sgpp
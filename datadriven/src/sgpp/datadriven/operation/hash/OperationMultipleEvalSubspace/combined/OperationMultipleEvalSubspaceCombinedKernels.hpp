@@ -0,0 +1,128 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/combined/OperationMultipleEvalSubspaceCombinedParameters.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// the vectorized variants are compiled with function-level target attributes and selected at
+// runtime, therefore the library itself can be compiled for the baseline instruction set
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define X86COMBINED_RUNTIME_DISPATCH 1
+#endif
+
+// largest number of data points processed by a single kernel call
+#define X86COMBINED_MAX_KERNEL_WIDTH 8
+
+static_assert(X86COMBINED_VEC_PADDING >= X86COMBINED_MAX_KERNEL_WIDTH,
+              "X86COMBINED_VEC_PADDING has to be at least as large as the widest kernel");
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Instruction set variants of the index calculation and evaluation kernel of
+ * OperationMultipleEvalSubspaceCombined.
+ */
+enum class SubspaceKernelVariant {
+  /// portable implementation, vectorized by the compiler for the baseline instruction set
+  SCALAR,
+  /// AVX2 intrinsics, processes 4 data points per call
+  AVX2,
+  /// AVX-512 intrinsics, processes 8 data points per call
+  AVX512
+};
+
+/**
+ * Kernels that calculate, for a block of data points, the flattened index of the
+ * grid point of the current subspace whose support contains the data point and
+ * the value of its basis function. They are the only instruction-set specific part
+ * of OperationMultipleEvalSubspaceCombined::listMultInner and
+ * OperationMultipleEvalSubspaceCombined::uncachedMultTransposeInner, everything else
+ * (in particular the subspace node preprocessing) is shared by all variants.
+ *
+ * The variant is chosen at runtime with the help of the CPUID flags, so the
+ * subspace-based evaluation is available even if SG++ is compiled without AVX.
+ */
+class OperationMultipleEvalSubspaceCombinedKernels {
+ public:
+  /**
+   * Signature of the kernels.
+   *
+   * @param dim dimensionality of the data
+   * @param nextIterationToRecalc first dimension whose partial results have to be recomputed
+   * @param dataTuplePtr pointers to the data points of the block
+   * @param hInverse inverse mesh width of the subspace in every dimension
+   * @param intermediates partially flattened indices of the data points, entry i + 1 is
+   * updated for every recomputed dimension i
+   * @param evalIndexValues partial products of the basis functions, entry i + 1 is
+   * updated for every recomputed dimension i
+   * @param indexFlat will contain the flattened indices
+   * @param phiEval will contain the values of the basis functions
+   */
+  typedef void (*CalculateIndexFunction)(size_t dim, size_t nextIterationToRecalc,
+                                         const double* const* dataTuplePtr,
+                                         const uint32_t* hInverse, uint32_t* const* intermediates,
+                                         double* const* evalIndexValues, uint32_t* indexFlat,
+                                         double* phiEval);
+
+  /**
+   * @param variant instruction set variant
+   * @return true if the variant was compiled into the library and is supported by the CPU
+   */
+  static bool isSupported(SubspaceKernelVariant variant);
+
+  /**
+   * @return fastest variant supported by the CPU
+   */
+  static SubspaceKernelVariant getBestSupportedVariant();
+
+  /**
+   * @param variant instruction set variant
+   * @return kernel of the variant
+   */
+  static CalculateIndexFunction getKernel(SubspaceKernelVariant variant);
+
+  /**
+   * @param variant instruction set variant
+   * @return number of data points processed by one call of the kernel
+   */
+  static size_t getKernelWidth(SubspaceKernelVariant variant);
+
+  /**
+   * @param variant instruction set variant
+   * @return name of the variant
+   */
+  static std::string toString(SubspaceKernelVariant variant);
+
+  /// portable kernel for 4 data points
+  static void calculateIndexScalar(size_t dim, size_t nextIterationToRecalc,
+                                   const double* const* dataTuplePtr, const uint32_t* hInverse,
+                                   uint32_t* const* intermediates, double* const* evalIndexValues,
+                                   uint32_t* indexFlat, double* phiEval);
+
+#ifdef X86COMBINED_RUNTIME_DISPATCH
+  /// AVX2 kernel for 4 data points
+  static void calculateIndexAVX2(size_t dim, size_t nextIterationToRecalc,
+                                 const double* const* dataTuplePtr, const uint32_t* hInverse,
+                                 uint32_t* const* intermediates, double* const* evalIndexValues,
+                                 uint32_t* indexFlat, double* phiEval);
+
+  /// AVX-512 kernel for 8 data points
+  static void calculateIndexAVX512(size_t dim, size_t nextIterationToRecalc,
+                                   const double* const* dataTuplePtr, const uint32_t* hInverse,
+                                   uint32_t* const* intermediates, double* const* evalIndexValues,
+                                   uint32_t* indexFlat, double* phiEval);
+#endif
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -23,14 +23,9 @@
 #define X86COMBINED_ENABLE_SUBSPACE_SKIPPING 1
 #endif
 
-#ifndef X86COMBINED_UNROLL
-#define X86COMBINED_UNROLL 0
-// implies X86COMBINED_VEC_PADDING == 8
-#endif
-
+// has to be at least the largest kernel width (8 for the AVX-512 kernel)
 #ifndef X86COMBINED_VEC_PADDING
-#define X86COMBINED_VEC_PADDING 4
-//#define X86COMBINED_VEC_PADDING 8
+#define X86COMBINED_VEC_PADDING 8
 //#define X86COMBINED_VEC_PADDING 24
 #endif
 
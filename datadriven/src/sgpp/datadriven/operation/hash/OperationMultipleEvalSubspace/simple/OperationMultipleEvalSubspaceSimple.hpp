@@ -3,8 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#ifdef __AVX__
-
 #pragma once
 
 #include <iostream>
@@ -141,5 +139,3 @@ class OperationMultipleEvalSubspaceSimple : public AbstractOperationMultipleEval
 };
 }
 }
-
-#endif
@@ -0,0 +1,235 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/OperationDensitySamplingCDFTableLinear.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/tools/RandomNumberGenerator.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+OperationDensitySamplingCDFTableLinear::OperationDensitySamplingCDFTableLinear(base::Grid* grid)
+    : grid(grid), hasNegativeSurpluses(false) {}
+
+void OperationDensitySamplingCDFTableLinear::prepare(base::DataVector& alpha) {
+  base::GridStorage& storage = grid->getStorage();
+  const size_t numDims = storage.getDimension();
+  const size_t gridSize = storage.getSize();
+
+  if (alpha.getSize() != gridSize) {
+    throw base::operation_exception(
+        "Error: size of coefficient vector does not match the grid size. Operation aborted!");
+  }
+
+  // group the grid points by subspaces
+  std::map<std::vector<base::level_t>, std::vector<size_t>> subspaces;
+  std::vector<base::level_t> level(numDims);
+
+  centers.resize(gridSize * numDims);
+  halfWidths.resize(gridSize * numDims);
+
+  for (size_t seqNr = 0; seqNr < gridSize; seqNr++) {
+    base::GridPoint& gp = storage.getPoint(seqNr);
+
+    for (size_t d = 0; d < numDims; d++) {
+      level[d] = gp.getLevel(d);
+      halfWidths[seqNr * numDims + d] = 1.0 / static_cast<double>(1 << gp.getLevel(d));
+      centers[seqNr * numDims + d] =
+          static_cast<double>(gp.getIndex(d)) * halfWidths[seqNr * numDims + d];
+    }
+
+    subspaces[level].push_back(seqNr);
+  }
+
+  // weight of a grid point: positive part of its surplus times the integral of its basis
+  // function
+  positiveAlpha.resize(gridSize);
+  hasNegativeSurpluses = false;
+
+  for (size_t seqNr = 0; seqNr < gridSize; seqNr++) {
+    positiveAlpha[seqNr] = std::max(alpha[seqNr], 0.0);
+    hasNegativeSurpluses |= (alpha[seqNr] < 0.0);
+  }
+
+  subspaceCDF.clear();
+  subspaceOffsets.clear();
+  pointCDF.clear();
+  pointSeqNr.clear();
+  double subspaceSum = 0.0;
+
+  for (auto& subspace : subspaces) {
+    double integral = 1.0;
+
+    for (size_t d = 0; d < numDims; d++) {
+      integral *= 1.0 / static_cast<double>(1 << subspace.first[d]);
+    }
+
+    subspaceOffsets.push_back(pointSeqNr.size());
+    double pointSum = 0.0;
+
+    for (size_t seqNr : subspace.second) {
+      pointSum += positiveAlpha[seqNr] * integral;
+      pointCDF.push_back(pointSum);
+      pointSeqNr.push_back(seqNr);
+    }
+
+    subspaceSum += pointSum;
+    subspaceCDF.push_back(subspaceSum);
+  }
+
+  subspaceOffsets.push_back(pointSeqNr.size());
+
+  if (!(subspaceSum > 0.0)) {
+    throw base::operation_exception(
+        "Error: density has no positive surpluses. Operation aborted!");
+  }
+
+  preparedAlpha = alpha;
+}
+
+size_t OperationDensitySamplingCDFTableLinear::drawGridPoint(std::mt19937& generator) const {
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  // 1. subspace
+  double u = distribution(generator) * subspaceCDF.back();
+  size_t subspace = std::upper_bound(subspaceCDF.begin(), subspaceCDF.end(), u) -
+                    subspaceCDF.begin();
+  subspace = std::min(subspace, subspaceCDF.size() - 1);
+
+  // 2. grid point within the subspace
+  auto first = pointCDF.begin() + subspaceOffsets[subspace];
+  auto last = pointCDF.begin() + subspaceOffsets[subspace + 1];
+  u = distribution(generator) * *(last - 1);
+  size_t point = std::upper_bound(first, last, u) - pointCDF.begin();
+  point = std::min(point, subspaceOffsets[subspace + 1] - 1);
+
+  return pointSeqNr[point];
+}
+
+void OperationDensitySamplingCDFTableLinear::drawFromBasisFunction(
+    size_t seqNr, size_t startDim, std::mt19937& generator, base::DataVector& sample) const {
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  const size_t numDims = sample.getSize();
+
+  // inversion of the CDF of the triangular distribution on [center - h, center + h]
+  for (size_t k = 0; k < numDims; k++) {
+    const size_t d = (startDim + k) % numDims;
+    double center = centers[seqNr * numDims + d];
+    double h = halfWidths[seqNr * numDims + d];
+    double u = distribution(generator);
+
+    if (u < 0.5) {
+      sample[d] = center - h + h * std::sqrt(2.0 * u);
+    } else {
+      sample[d] = center + h - h * std::sqrt(2.0 * (1.0 - u));
+    }
+  }
+}
+
+void OperationDensitySamplingCDFTableLinear::doSampling(base::DataVector* alpha,
+                                                        base::DataMatrix*& samples,
+                                                        size_t num_samples) {
+  doSampling(alpha, samples, num_samples, 0);
+}
+
+void OperationDensitySamplingCDFTableLinear::doSampling(base::DataVector* alpha,
+                                                        base::DataMatrix*& samples,
+                                                        size_t num_samples, size_t dim_x) {
+  if (dim_x >= grid->getDimension())
+    throw base::operation_exception("Error: starting dimension out of range. Operation aborted!");
+
+  base::DataVector& a = *alpha;
+  bool prepared = (preparedAlpha.getSize() == a.getSize()) &&
+                  (centers.size() == grid->getSize() * grid->getDimension());
+
+  for (size_t i = 0; prepared && i < a.getSize(); i++) {
+    prepared = (preparedAlpha[i] == a[i]);
+  }
+
+  if (!prepared) {
+    prepare(a);
+  }
+
+  const size_t numDims = grid->getDimension();
+  const size_t numBlocks = (num_samples + blockSize - 1) / blockSize;
+
+  // output matrix
+  samples = new base::DataMatrix(num_samples, numDims);
+
+  // seed of the random number streams of the blocks
+  std::mt19937::result_type seed = static_cast<std::mt19937::result_type>(
+      base::RandomNumberGenerator::getInstance().getUniformIndexRN(
+          std::numeric_limits<std::mt19937::result_type>::max()));
+  bool trialMaxReached = false;
+
+#pragma omp parallel
+  {
+    base::DataVector sample(numDims);
+    std::unique_ptr<base::OperationEval> opEval;
+
+    if (hasNegativeSurpluses) {
+      opEval.reset(op_factory::createOperationEval(*grid));
+    }
+
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+#pragma omp for schedule(dynamic)
+    for (size_t block = 0; block < numBlocks; block++) {
+      std::seed_seq seedSequence{seed, static_cast<std::mt19937::result_type>(block)};
+      std::mt19937 generator(seedSequence);
+      const size_t end = std::min((block + 1) * blockSize, num_samples);
+
+      for (size_t i = block * blockSize; i < end; i++) {
+        size_t trial = 0;
+
+        for (; trial < trialMax; trial++) {
+          drawFromBasisFunction(drawGridPoint(generator), dim_x, generator, sample);
+
+          if (!hasNegativeSurpluses) {
+            break;
+          }
+
+          // accept with probability f(x) / f_+(x)
+          double fhat = opEval->eval(a, sample);
+          double fhatPositive = opEval->eval(positiveAlpha, sample);
+
+          if (distribution(generator) * fhatPositive < fhat) {
+            break;
+          }
+        }
+
+        if (trial == trialMax) {
+#pragma omp atomic write
+          trialMaxReached = true;
+        }
+
+        samples->setRow(i, sample);
+      }
+    }
+  }
+
+  if (trialMaxReached) {
+    delete samples;
+    samples = nullptr;
+    throw base::operation_exception("Error: maximum # of trials reached. Operation aborted!");
+  }
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
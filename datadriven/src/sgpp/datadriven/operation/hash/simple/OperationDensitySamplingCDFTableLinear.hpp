@@ -0,0 +1,128 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONDENSITYSAMPLINGCDFTABLELINEAR_HPP
+#define OPERATIONDENSITYSAMPLINGCDFTABLELINEAR_HPP
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationDensitySampling.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Sampling of sparse grid densities on linear grids with precomputed CDF tables.
+ *
+ * Every basis function of a linear grid is, up to its integral \f$2^{-|l|_1}\f$, the density
+ * of a product of independent triangular distributions. A sparse grid density with
+ * nonnegative surpluses is therefore a mixture whose weights are the surpluses times the
+ * integrals of the basis functions. The operation builds a two-level CDF table of these
+ * weights once per coefficient vector, one level over the subspaces and one over the grid
+ * points within each subspace. A sample is drawn by two binary searches in the tables and
+ * the inversion of a triangular CDF in every dimension, i.e., in
+ * \f$\mathcal{O}(d + \log N)\f$.
+ *
+ * If some surpluses are negative, the mixture of the positive part of the density is used as
+ * proposal of a rejection sampling, which requires an evaluation of the density for every
+ * proposal.
+ *
+ * The samples are distributed to blocks of fixed size, each block draws from its own
+ * std::mt19937 stream. The streams are seeded with a seed taken from
+ * base::RandomNumberGenerator, hence the samples are reproducible with
+ * base::RandomNumberGenerator::setSeed and independent of the number of threads.
+ */
+class OperationDensitySamplingCDFTableLinear : public OperationDensitySampling {
+ public:
+  explicit OperationDensitySamplingCDFTableLinear(base::Grid* grid);
+  virtual ~OperationDensitySamplingCDFTableLinear() {}
+
+  /**
+   * Sampling of the whole density, the dimensions are drawn in ascending order.
+   *
+   * @param alpha Coefficient vector for current grid
+   * @param samples Output DataMatrix (rows: # of samples, columns: # of dims)
+   * @param num_samples # of samples to draw
+   */
+  void doSampling(base::DataVector* alpha, base::DataMatrix*& samples,
+                  size_t num_samples) override;
+
+  /**
+   * Sampling of the whole density, the dimensions of every sample are drawn from the
+   * selected basis function starting with dimension dim_x (and wrapping around), as in the
+   * conditional sampling of OperationDensitySamplingLinear. The distribution of the samples
+   * does not depend on dim_x, but the random numbers are used in this order.
+   *
+   * @param alpha Coefficient vector for current grid
+   * @param samples Output DataMatrix (rows: # of samples, columns: # of dims)
+   * @param num_samples # of samples to draw
+   * @param dim_x Starting dimension
+   */
+  void doSampling(base::DataVector* alpha, base::DataMatrix*& samples, size_t num_samples,
+                  size_t dim_x) override;
+
+  /**
+   * Builds the CDF tables for the coefficient vector. This is done automatically by
+   * doSampling if the coefficients changed since the last call.
+   *
+   * @param alpha Coefficient vector for current grid
+   */
+  void prepare(base::DataVector& alpha);
+
+ protected:
+  /**
+   * Draws a grid point with probability proportional to its (positive) weight.
+   *
+   * @param generator random number generator
+   * @return sequence number of the grid point
+   */
+  size_t drawGridPoint(std::mt19937& generator) const;
+
+  /**
+   * Draws a sample from the normalized basis function of a grid point.
+   *
+   * @param seqNr sequence number of the grid point
+   * @param startDim dimension that is drawn first, the others follow cyclically
+   * @param generator random number generator
+   * @param sample will contain the sample
+   */
+  void drawFromBasisFunction(size_t seqNr, size_t startDim, std::mt19937& generator,
+                             base::DataVector& sample) const;
+
+  /// number of samples that are drawn from the same random number stream
+  static const size_t blockSize = 1024;
+  /// maximum number of proposals per sample if there are negative surpluses
+  static const size_t trialMax = 10000;
+
+  base::Grid* grid;
+  /// coefficients the tables were built for
+  base::DataVector preparedAlpha;
+  /// true if the density has negative surpluses
+  bool hasNegativeSurpluses;
+  /// coefficients of the positive part of the density (proposal of the rejection sampling)
+  base::DataVector positiveAlpha;
+  /// cumulative weights of the subspaces (positive part of the density)
+  std::vector<double> subspaceCDF;
+  /// for every subspace the offset of its grid points in pointCDF and pointSeqNr
+  std::vector<size_t> subspaceOffsets;
+  /// cumulative weights of the grid points within their subspace
+  std::vector<double> pointCDF;
+  /// sequence numbers of the grid points, ordered by subspace
+  std::vector<size_t> pointSeqNr;
+  /// centers of the basis functions (row major, one row per grid point)
+  std::vector<double> centers;
+  /// half widths of the supports of the basis functions (row major, one row per grid point)
+  std::vector<double> halfWidths;
+};
+}  // namespace datadriven
+}  // namespace sgpp
+#endif /* OPERATIONDENSITYSAMPLINGCDFTABLELINEAR_HPP */
@@ -0,0 +1,333 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationLinearBatched.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace sgpp {
+namespace datadriven {
+
+OperationInverseRosenblattTransformationLinearBatched::
+    OperationInverseRosenblattTransformationLinearBatched(base::Grid* grid)
+    : OperationInverseRosenblattTransformationLinear(grid), numDims(0), numPoints(0) {}
+
+void OperationInverseRosenblattTransformationLinearBatched::doTransformation(
+    base::DataVector* alpha, base::DataMatrix* pointscdf, base::DataMatrix* points) {
+  prepare();
+
+  size_t num_samples = pointscdf->getNrows();
+  size_t bucket_size = num_samples / numDims + 1;
+
+  // the starting dimension changes when the bucket_size is arrived (as in
+  // OperationInverseRosenblattTransformationLinear), hence the samples with the same
+  // starting dimension form contiguous batches
+  size_t dim_start = 0;
+  size_t batch_start = 0;
+
+  for (size_t i = 0; i < num_samples; i++) {
+    if (((i + 1) % bucket_size) == 0 && (i + 1) < num_samples) {
+      transformBatch(*alpha, *pointscdf, *points, dim_start, batch_start, i);
+      batch_start = i;
+      ++dim_start;
+    }
+  }
+
+  transformBatch(*alpha, *pointscdf, *points, dim_start, batch_start, num_samples);
+}
+
+void OperationInverseRosenblattTransformationLinearBatched::doTransformation(
+    base::DataVector* alpha, base::DataMatrix* pointscdf, base::DataMatrix* points,
+    size_t dim_start) {
+  prepare();
+
+  if (dim_start >= numDims) {
+    throw base::operation_exception("Error: dimension out of range. Operation aborted!");
+  }
+
+  transformBatch(*alpha, *pointscdf, *points, dim_start, 0, pointscdf->getNrows());
+}
+
+void OperationInverseRosenblattTransformationLinearBatched::prepare() {
+  base::GridStorage& storage = this->grid->getStorage();
+  numDims = storage.getDimension();
+  numPoints = storage.getSize();
+
+  if (numDims <= 1) {
+    throw base::operation_exception(
+        "Error: grid dimension is not greater than one. Operation aborted!");
+  }
+
+  levels.resize(numPoints * numDims);
+  indices.resize(numPoints * numDims);
+  integrals.resize(numPoints * numDims);
+
+  for (size_t j = 0; j < numPoints; j++) {
+    base::GridPoint& gp = storage.getPoint(j);
+
+    for (size_t d = 0; d < numDims; d++) {
+      levels[j * numDims + d] = static_cast<double>(1 << gp.getLevel(d));
+      indices[j * numDims + d] = static_cast<double>(gp.getIndex(d));
+      integrals[j * numDims + d] = 1.0 / levels[j * numDims + d];
+    }
+  }
+
+  nodes.assign(numDims, std::vector<double>());
+  nodeOfPoint.assign(numDims, std::vector<size_t>(numPoints));
+  nodeSupport.assign(numDims, std::vector<std::vector<std::pair<size_t, double>>>());
+
+  for (size_t d = 0; d < numDims; d++) {
+    // distinct 1D nodes sorted by their coordinates, given by 2^level and index
+    std::map<double, std::pair<double, double>> coordinates;
+
+    for (size_t j = 0; j < numPoints; j++) {
+      double level = levels[j * numDims + d];
+      double index = indices[j * numDims + d];
+      coordinates.insert(std::make_pair(index / level, std::make_pair(level, index)));
+    }
+
+    std::vector<double>& nodesDim = nodes[d];
+    std::vector<std::pair<double, double>> levelIndex;
+
+    // include the boundary [0,1]
+    nodesDim.push_back(0.0);
+    levelIndex.push_back(std::make_pair(0.0, 0.0));
+
+    for (auto& coordinate : coordinates) {
+      nodesDim.push_back(coordinate.first);
+      levelIndex.push_back(coordinate.second);
+    }
+
+    nodesDim.push_back(1.0);
+    levelIndex.push_back(std::make_pair(0.0, 0.0));
+
+    for (size_t j = 0; j < numPoints; j++) {
+      double coordinate = indices[j * numDims + d] / levels[j * numDims + d];
+      nodeOfPoint[d][j] = std::lower_bound(nodesDim.begin(), nodesDim.end(), coordinate) -
+                          nodesDim.begin();
+    }
+
+    // values of the 1D basis functions at the nodes, the boundary values are zero
+    nodeSupport[d].resize(nodesDim.size());
+
+    for (size_t n = 1; n + 1 < nodesDim.size(); n++) {
+      for (size_t m = 1; m + 1 < nodesDim.size(); m++) {
+        double phi = std::max(
+            1.0 - std::fabs(nodesDim[n] * levelIndex[m].first - levelIndex[m].second), 0.0);
+
+        if (phi > 0.0) {
+          nodeSupport[d][n].push_back(std::make_pair(m, phi));
+        }
+      }
+    }
+  }
+}
+
+void OperationInverseRosenblattTransformationLinearBatched::transformBatch(
+    base::DataVector& alpha, base::DataMatrix& pointscdf, base::DataMatrix& points,
+    size_t dim_start, size_t start, size_t end) {
+  if (start >= end) {
+    return;
+  }
+
+  // order in which the dimensions are sampled, the k-th sample is written to column
+  // (dim_start + k) % numDims (as in OperationInverseRosenblattTransformationLinear)
+  std::vector<size_t> order;
+  std::vector<size_t> remaining(numDims);
+
+  for (size_t d = 0; d < numDims; d++) {
+    remaining[d] = d;
+  }
+
+  size_t op_dim = dim_start;
+  order.push_back(remaining[op_dim]);
+
+  while (remaining.size() > 1) {
+    remaining.erase(remaining.begin() + op_dim);
+    op_dim = (op_dim + 1) % remaining.size();
+    order.push_back(remaining[op_dim]);
+  }
+
+  // integrals of the basis functions over the dimensions that are sampled after the k-th one
+  std::vector<double> marginalFactors(numDims * numPoints, 1.0);
+
+  for (size_t k = numDims - 1; k > 0; k--) {
+    for (size_t j = 0; j < numPoints; j++) {
+      marginalFactors[(k - 1) * numPoints + j] =
+          marginalFactors[k * numPoints + j] * integrals[j * numDims + order[k]];
+    }
+  }
+
+  // marginal CDF of the starting dimension, the same for all samples of the batch
+  size_t maxNodes = 0;
+
+  for (size_t d = 0; d < numDims; d++) {
+    maxNodes = std::max(maxNodes, nodes[d].size());
+  }
+
+  std::vector<double> startCDF(nodes[order[0]].size());
+  {
+    std::vector<double> coefficients(nodes[order[0]].size(), 0.0);
+    std::vector<double> pdf(nodes[order[0]].size(), 0.0);
+
+    for (size_t j = 0; j < numPoints; j++) {
+      coefficients[nodeOfPoint[order[0]][j]] += alpha[j] * marginalFactors[j];
+    }
+
+    for (size_t n = 0; n < pdf.size(); n++) {
+      for (auto& support : nodeSupport[order[0]][n]) {
+        pdf[n] += coefficients[support.first] * support.second;
+      }
+    }
+
+    computeCDF(nodes[order[0]], pdf, startCDF);
+  }
+
+#pragma omp parallel
+  {
+    std::vector<double> weights(numPoints);
+    std::vector<size_t> active;
+    std::vector<size_t> nextActive;
+    std::vector<double> coefficients(maxNodes);
+    std::vector<double> pdf(maxNodes);
+    std::vector<double> cdf(maxNodes);
+
+    active.reserve(numPoints);
+    nextActive.reserve(numPoints);
+
+#pragma omp for schedule(static)
+    for (size_t i = start; i < end; i++) {
+      size_t column = dim_start;
+      double x = invertCDF(nodes[order[0]], startCDF, pointscdf.get(i, column));
+      points.set(i, column, x);
+
+      active.resize(numPoints);
+
+      for (size_t j = 0; j < numPoints; j++) {
+        active[j] = j;
+        weights[j] = alpha[j];
+      }
+
+      for (size_t k = 1; k < numDims; k++) {
+        // condition on the last sampled dimension, drop the grid points whose basis
+        // function vanishes at the sampled coordinate
+        const size_t condDim = order[k - 1];
+        const double* condFactors = &marginalFactors[(k - 1) * numPoints];
+        double theta = 0.0;
+        nextActive.clear();
+
+        for (size_t j : active) {
+          double zeta = std::max(
+              1. - std::fabs(x * levels[j * numDims + condDim] - indices[j * numDims + condDim]),
+              0.);
+
+          if (zeta > 0.0) {
+            weights[j] *= zeta;
+            theta += weights[j] * condFactors[j];
+            nextActive.push_back(j);
+          }
+        }
+
+        if (theta != 0) {
+          for (size_t j : nextActive) {
+            weights[j] *= 1. / theta;
+          }
+        }
+
+        std::swap(active, nextActive);
+
+        // marginalize to the next dimension and evaluate at the 1D nodes
+        const size_t dim = order[k];
+        const double* margFactors = &marginalFactors[k * numPoints];
+        const size_t numNodes = nodes[dim].size();
+        std::fill(coefficients.begin(), coefficients.begin() + numNodes, 0.0);
+
+        for (size_t j : active) {
+          coefficients[nodeOfPoint[dim][j]] += weights[j] * margFactors[j];
+        }
+
+        pdf.resize(numNodes);
+        cdf.resize(numNodes);
+
+        for (size_t n = 0; n < numNodes; n++) {
+          pdf[n] = 0.0;
+
+          for (auto& support : nodeSupport[dim][n]) {
+            pdf[n] += coefficients[support.first] * support.second;
+          }
+        }
+
+        computeCDF(nodes[dim], pdf, cdf);
+
+        column = (column + 1) % numDims;
+        x = invertCDF(nodes[dim], cdf, pointscdf.get(i, column));
+        points.set(i, column, x);
+      }
+    }
+  }
+}
+
+void OperationInverseRosenblattTransformationLinearBatched::computeCDF(
+    const std::vector<double>& nodes, std::vector<double>& pdf, std::vector<double>& cdf) {
+  const size_t numNodes = nodes.size();
+
+  // make sure that all the pdf values are positive
+  // if not, interpolate between the closest positive neighbors
+  pdf[0] = std::max(pdf[0], 0.0);
+
+  for (size_t n = 1; n < numNodes; n++) {
+    if (pdf[n] < 0.0) {
+      // search for next right neighbor that has a positive function value
+      size_t m = n;
+
+      while (m < numNodes && pdf[m] <= 0.0) {
+        m++;
+      }
+
+      pdf[n] = (pdf[n - 1] + ((m < numNodes) ? pdf[m] : 0.0)) / 2.0;
+    }
+  }
+
+  // Composite rule: trapezoidal (b-a)/2 * (f(a)+f(b))
+  cdf[0] = 0.0;
+  double sum = 0.0;
+
+  for (size_t n = 1; n < numNodes; n++) {
+    double area = (nodes[n] - nodes[n - 1]) / 2 * (pdf[n - 1] + pdf[n]);
+    sum += std::max(area, 0.0);
+    cdf[n] = sum;
+  }
+
+  for (size_t n = 0; n < numNodes; n++) {
+    cdf[n] /= sum;
+  }
+}
+
+double OperationInverseRosenblattTransformationLinearBatched::invertCDF(
+    const std::vector<double>& nodes, const std::vector<double>& cdf, double coord1d) {
+  // find cdf interval
+  size_t n = std::lower_bound(cdf.begin(), cdf.begin() + nodes.size(), coord1d) - cdf.begin();
+  n = std::min(std::max(n, static_cast<size_t>(1)), nodes.size() - 1);
+
+  double x1 = nodes[n - 1], x2 = nodes[n];
+  double y1 = cdf[n - 1], y2 = cdf[n];
+  // find x (linear interpolation): (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
+  return (x2 - x1) / (y2 - y1) * (coord1d - y1) + x1;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
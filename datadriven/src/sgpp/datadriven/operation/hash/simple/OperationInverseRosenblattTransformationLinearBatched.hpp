@@ -0,0 +1,127 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONINVERSEROSENBLATTTRANSFORMATIONLINEARBATCHED_HPP
+#define OPERATIONINVERSEROSENBLATTTRANSFORMATIONLINEARBATCHED_HPP
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationLinear.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Inverse Rosenblatt transformation for linear grids that processes all samples
+ * with the same starting dimension as one batch.
+ *
+ * OperationInverseRosenblattTransformationLinear creates a conditioned grid and a
+ * marginalized 1D grid for every sample and every dimension. However, all these grids
+ * contain the projections of the points of the d-dimensional grid, only their
+ * coefficients depend on the sample. This class therefore evaluates the conditional
+ * 1D densities directly from the d-dimensional surpluses: conditioning multiplies the
+ * surplus of every grid point with the value of its basis function at the sampled
+ * coordinate (which is zero for most grid points, those are dropped), marginalization
+ * multiplies it with the integrals of its basis functions in the remaining dimensions.
+ *
+ * The marginal CDF of the starting dimension is computed once per batch and inverted for
+ * all samples of the batch by binary search. The dimensions are processed in the same
+ * order as by OperationInverseRosenblattTransformationLinear, hence the results are
+ * the same up to rounding errors.
+ */
+class OperationInverseRosenblattTransformationLinearBatched
+    : public OperationInverseRosenblattTransformationLinear {
+ public:
+  explicit OperationInverseRosenblattTransformationLinearBatched(base::Grid* grid);
+  virtual ~OperationInverseRosenblattTransformationLinearBatched() {}
+
+  /**
+   * Transformation with mixed starting dimensions
+   *
+   * @param alpha Coefficient vector for current grid
+   * @param pointscdf Input Matrix
+   * @param points Output Matrix
+   */
+  void doTransformation(base::DataVector* alpha, base::DataMatrix* pointscdf,
+                        base::DataMatrix* points) override;
+
+  /**
+   * Transformation with specified starting dimension
+   *
+   * @param alpha Coefficient vector for current grid
+   * @param pointscdf Input Matrix
+   * @param points Output Matrix
+   * @param dim_start Starting dimension
+   */
+  void doTransformation(base::DataVector* alpha, base::DataMatrix* pointscdf,
+                        base::DataMatrix* points, size_t dim_start) override;
+
+ protected:
+  /**
+   * Collects the 1D nodes of every dimension and the hierarchical structure
+   * between them.
+   */
+  void prepare();
+
+  /**
+   * Transforms the samples with indices [start, end) with the given starting dimension.
+   *
+   * @param alpha Coefficient vector for current grid
+   * @param pointscdf Input Matrix
+   * @param points Output Matrix
+   * @param dim_start Starting dimension
+   * @param start first sample
+   * @param end one past the last sample
+   */
+  void transformBatch(base::DataVector& alpha, base::DataMatrix& pointscdf,
+                      base::DataMatrix& points, size_t dim_start, size_t start, size_t end);
+
+  /**
+   * Computes the CDF of a piecewise linear 1D density given by its values at the nodes
+   * (including the boundary nodes 0 and 1) with the trapezoidal rule. Negative density
+   * values are replaced like in OperationInverseRosenblattTransformationLinear.
+   *
+   * @param nodes sorted coordinates of the nodes
+   * @param pdf density values at the nodes, negative values get replaced
+   * @param cdf will contain the normalized CDF at the nodes
+   */
+  static void computeCDF(const std::vector<double>& nodes, std::vector<double>& pdf,
+                         std::vector<double>& cdf);
+
+  /**
+   * Inverts a piecewise linear CDF.
+   *
+   * @param nodes sorted coordinates of the nodes
+   * @param cdf CDF at the nodes
+   * @param coord1d value of the CDF
+   * @return coordinate at which the CDF takes the given value
+   */
+  static double invertCDF(const std::vector<double>& nodes, const std::vector<double>& cdf,
+                          double coord1d);
+
+  /// number of dimensions
+  size_t numDims;
+  /// number of grid points
+  size_t numPoints;
+  /// 2^level of every grid point in every dimension (row major, one row per grid point)
+  std::vector<double> levels;
+  /// index of every grid point in every dimension (row major, one row per grid point)
+  std::vector<double> indices;
+  /// integral of the 1D basis function of every grid point in every dimension (row major)
+  std::vector<double> integrals;
+  /// for every dimension the sorted coordinates of the distinct 1D nodes, including 0 and 1
+  std::vector<std::vector<double>> nodes;
+  /// for every dimension and grid point the position of its 1D node in nodes
+  std::vector<std::vector<size_t>> nodeOfPoint;
+  /// for every dimension and 1D node the nodes whose basis function does not vanish there
+  std::vector<std::vector<std::vector<std::pair<size_t, double>>>> nodeSupport;
+};
+}  // namespace datadriven
+}  // namespace sgpp
+#endif /* OPERATIONINVERSEROSENBLATTTRANSFORMATIONLINEARBATCHED_HPP */
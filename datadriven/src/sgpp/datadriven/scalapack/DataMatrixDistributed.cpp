@@ -13,6 +13,8 @@
 
 #include <algorithm>
 #include <iostream>
+#include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -380,6 +382,171 @@ void DataMatrixDistributed::solveCholesky(const DataMatrixDistributed& l, DataVe
 #endif /* USE_SCALAPACK */
 }
 
+void DataMatrixDistributed::choleskyUpdateDiagonal(DataMatrixDistributed& l, double shift) {
+#ifdef USE_SCALAPACK
+  if (l.getGlobalRows() != l.getGlobalCols()) {
+    throw sgpp::base::algorithm_exception(
+        "DataMatrixDistributed::choleskyUpdateDiagonal(): matrix has to be quadratic");
+  }
+
+  if (l.isProcessMapped() && l.getGlobalRows() > 0) {
+    size_t n = l.getGlobalRows();
+    l.setStrictUpperTriangularZero();
+
+    // the internal storage contains L^T, hence A = L * L^T = (L^T)^T * L^T, the result is
+    // written to the upper triangular part of the internal storage (lower part of A)
+    DataMatrixDistributed a(l.grid, n, n, l.getRowBlockSize(), l.getColumnBlockSize());
+    pdsyrk_(upperTriangular, pblasTranspose, n, n, 1.0, l.getLocalPointer(), 1, 1,
+            l.getDescriptor(), 0.0, a.getLocalPointer(), 1, 1, a.getDescriptor());
+
+    a.addToDiagonal(shift);
+    choleskyFactorize(a);
+
+    l = std::move(a);
+  }
+#else
+  throw sgpp::base::application_exception("Build without USE_SCALAPACK");
+#endif /* USE_SCALAPACK */
+}
+
+void DataMatrixDistributed::choleskyRemoveRowsColumns(DataMatrixDistributed& l,
+                                                      const std::vector<size_t>& indices) {
+#ifdef USE_SCALAPACK
+  size_t n = l.getGlobalRows();
+
+  if (l.getGlobalCols() != n) {
+    throw sgpp::base::algorithm_exception(
+        "DataMatrixDistributed::choleskyRemoveRowsColumns(): matrix has to be quadratic");
+  }
+
+  std::vector<size_t> removed(indices);
+  std::sort(removed.begin(), removed.end());
+  removed.erase(std::unique(removed.begin(), removed.end()), removed.end());
+
+  if (removed.empty() || !l.isProcessMapped()) {
+    return;
+  } else if (removed.back() >= n) {
+    throw sgpp::base::algorithm_exception(
+        "DataMatrixDistributed::choleskyRemoveRowsColumns(): index out of range");
+  }
+
+  size_t newSize = n - removed.size();
+  size_t first = removed.front();
+  int context = l.grid->getContextHandle();
+  l.setStrictUpperTriangularZero();
+
+  // copy the remaining rows of L, rows are columns of the internal storage
+  DataMatrixDistributed remainingRows(l.grid, newSize, n, l.getRowBlockSize(),
+                                      l.getColumnBlockSize());
+  size_t row = 0;
+  size_t target = 0;
+
+  for (size_t i = 0; i <= removed.size(); i++) {
+    size_t end = (i < removed.size()) ? removed[i] : n;
+
+    if (end > row) {
+      pdgemr2d_(n, end - row, l.getLocalPointer(), 1, row + 1, l.getDescriptor(),
+                remainingRows.getLocalPointer(), 1, target + 1, remainingRows.getDescriptor(),
+                context);
+      target += end - row;
+    }
+
+    row = end + 1;
+  }
+
+  DataMatrixDistributed result(l.grid, newSize, newSize, l.getRowBlockSize(),
+                               l.getColumnBlockSize());
+
+  // the columns before the first removed index are not affected
+  if (first > 0) {
+    pdgemr2d_(first, newSize, remainingRows.getLocalPointer(), 1, 1,
+              remainingRows.getDescriptor(), result.getLocalPointer(), 1, 1, result.getDescriptor(),
+              context);
+  }
+
+  // the trailing block B of the remaining rows is no longer triangular, its factor is the
+  // Cholesky factor of B * B^T (computed in a separate matrix, as pdpotrf requires block aligned
+  // submatrices)
+  if (first < newSize) {
+    size_t trailingSize = newSize - first;
+    DataMatrixDistributed trailing(l.grid, trailingSize, trailingSize, l.getRowBlockSize(),
+                                   l.getColumnBlockSize());
+    pdsyrk_(upperTriangular, pblasTranspose, trailingSize, n - first, 1.0,
+            remainingRows.getLocalPointer(), first + 1, first + 1, remainingRows.getDescriptor(),
+            0.0, trailing.getLocalPointer(), 1, 1, trailing.getDescriptor());
+    choleskyFactorize(trailing);
+
+    pdgemr2d_(trailingSize, trailingSize, trailing.getLocalPointer(), 1, 1,
+              trailing.getDescriptor(), result.getLocalPointer(), first + 1, first + 1,
+              result.getDescriptor(), context);
+  }
+
+  l = std::move(result);
+#else
+  throw sgpp::base::application_exception("Build without USE_SCALAPACK");
+#endif /* USE_SCALAPACK */
+}
+
+void DataMatrixDistributed::choleskyAddRowsColumns(DataMatrixDistributed& l,
+                                                   const DataMatrixDistributed& newRows) {
+#ifdef USE_SCALAPACK
+  size_t n = l.getGlobalRows();
+  size_t m = newRows.getGlobalRows();
+
+  if (l.getGlobalCols() != n || newRows.getGlobalCols() != n + m) {
+    throw sgpp::base::algorithm_exception(
+        "DataMatrixDistributed::choleskyAddRowsColumns(): sizes of the matrices don't match");
+  }
+
+  if (m == 0 || !l.isProcessMapped()) {
+    return;
+  }
+
+  int context = l.grid->getContextHandle();
+  DataMatrixDistributed result(l.grid, n + m, n + m, l.getRowBlockSize(),
+                               l.getColumnBlockSize());
+
+  // copy L and the new rows, rows are columns of the internal storage
+  if (n > 0) {
+    l.setStrictUpperTriangularZero();
+    pdgemr2d_(n, n, l.getLocalPointer(), 1, 1, l.getDescriptor(), result.getLocalPointer(), 1, 1,
+              result.getDescriptor(), context);
+  }
+
+  pdgemr2d_(n, m, newRows.getLocalPointer(), 1, 1, newRows.getDescriptor(),
+            result.getLocalPointer(), 1, n + 1, result.getDescriptor(), context);
+
+  // diagonal block, factorized in a separate matrix, as pdpotrf requires block aligned
+  // submatrices
+  DataMatrixDistributed diagonalBlock(l.grid, m, m, l.getRowBlockSize(), l.getColumnBlockSize());
+  pdgemr2d_(m, m, newRows.getLocalPointer(), n + 1, 1, newRows.getDescriptor(),
+            diagonalBlock.getLocalPointer(), 1, 1, diagonalBlock.getDescriptor(), context);
+
+  if (n > 0) {
+    // new rows C of the factor: L * C^T = B, where B^T are the first n columns of the new rows.
+    // Internally, C^T is stored below L^T, so L * C^T = (L^T)^T * C^T is solved for C^T
+    pdtrsm_(pblasLeft, upperTriangular, pblasTranspose, pblasNonUnit, n, m, 1.0,
+            result.getLocalPointer(), 1, 1, result.getDescriptor(), result.getLocalPointer(), 1,
+            n + 1, result.getDescriptor());
+
+    // Schur complement of the diagonal block: D - C * C^T
+    pdsyrk_(upperTriangular, pblasTranspose, m, n, -1.0, result.getLocalPointer(), 1, n + 1,
+            result.getDescriptor(), 1.0, diagonalBlock.getLocalPointer(), 1, 1,
+            diagonalBlock.getDescriptor());
+  }
+
+  choleskyFactorize(diagonalBlock);
+  diagonalBlock.setStrictUpperTriangularZero();
+
+  pdgemr2d_(m, m, diagonalBlock.getLocalPointer(), 1, 1, diagonalBlock.getDescriptor(),
+            result.getLocalPointer(), n + 1, n + 1, result.getDescriptor(), context);
+
+  l = std::move(result);
+#else
+  throw sgpp::base::application_exception("Build without USE_SCALAPACK");
+#endif /* USE_SCALAPACK */
+}
+
 void DataMatrixDistributed::resize(size_t rows, size_t cols) {
 #ifdef USE_SCALAPACK
   if (getGlobalRows() == rows && getGlobalCols() == cols) {
@@ -619,6 +786,52 @@ DataMatrix DataMatrixDistributed::broadcast() const {
   return localMatrix;
 }
 
+void DataMatrixDistributed::addToDiagonal(double value) {
+  // diagonal elements have the same global row and column index in the internal storage
+  for (size_t localColumn = 0; localColumn < localColumns; localColumn++) {
+    size_t globalColumn = localToGlobalIndex(localColumn, grid->getCurrentColumn(),
+                                             grid->getTotalColumns(), columnBlockSize);
+
+    for (size_t localRow = 0; localRow < localRows; localRow++) {
+      if (localToGlobalIndex(localRow, grid->getCurrentRow(), grid->getTotalRows(),
+                             rowBlockSize) == globalColumn) {
+        localData[(localColumn * localRows) + localRow] += value;
+      }
+    }
+  }
+}
+
+void DataMatrixDistributed::setStrictUpperTriangularZero() {
+  // internal storage is transposed, the upper triangular part is below the internal diagonal
+  for (size_t localColumn = 0; localColumn < localColumns; localColumn++) {
+    size_t globalColumn = localToGlobalIndex(localColumn, grid->getCurrentColumn(),
+                                             grid->getTotalColumns(), columnBlockSize);
+
+    for (size_t localRow = 0; localRow < localRows; localRow++) {
+      if (localToGlobalIndex(localRow, grid->getCurrentRow(), grid->getTotalRows(),
+                             rowBlockSize) > globalColumn) {
+        localData[(localColumn * localRows) + localRow] = 0.0;
+      }
+    }
+  }
+}
+
+void DataMatrixDistributed::choleskyFactorize(DataMatrixDistributed& a) {
+#ifdef USE_SCALAPACK
+  // values of upper and lower are switched, as the internal storage is transposed
+  int info = 0;
+  pdpotrf_(upperTriangular, a.getGlobalRows(), a.getLocalPointer(), 1, 1, a.getDescriptor(),
+           info);
+
+  if (info != 0) {
+    throw sgpp::base::algorithm_exception(
+        "DataMatrixDistributed::choleskyFactorize(): matrix is not positive definite");
+  }
+#else
+  throw sgpp::base::application_exception("Build without USE_SCALAPACK");
+#endif /* USE_SCALAPACK */
+}
+
 size_t DataMatrixDistributed::globalToLocalIndex(size_t globalIndex, size_t numberOfProcesses,
                                                  size_t blockSize) const {
   // note that the division is rounded down
@@ -266,6 +266,43 @@ class DataMatrixDistributed {
   static void solveCholesky(const DataMatrixDistributed& l, DataVectorDistributed& b,
                             TRIANGULAR uplo = TRIANGULAR::LOWER);
 
+  /**
+   * Updates the lower triangular Cholesky factor L of A=LL^T to the factor of A + shift * I,
+   * e.g. after a change of the regularization parameter. Instead of n distributed rank-one
+   * updates, A is recomputed with PBLAS (pdsyrk) and refactorized with ScaLAPACK (pdpotrf), so
+   * all work is done with Level-3 routines on the block-cyclic data of all processes.
+   * The strictly upper triangular part of L is ignored and set to zero.
+   *
+   * @param[in,out] l lower triangular Cholesky factor, overwritten with the updated factor
+   * @param[in] shift value that is added to the diagonal of A, may be negative as long as the
+   * resulting matrix is positive definite
+   */
+  static void choleskyUpdateDiagonal(DataMatrixDistributed& l, double shift);
+
+  /**
+   * Updates the lower triangular Cholesky factor L of A=LL^T to the factor of the matrix that
+   * results from removing some rows and the corresponding columns of A, e.g. after coarsening.
+   * The leading columns of L before the first removed index remain unchanged, only the trailing
+   * block is recomputed from the remaining rows of L with pdsyrk and pdpotrf.
+   *
+   * @param[in,out] l lower triangular Cholesky factor, overwritten with the updated factor
+   * @param[in] indices indices of the rows/columns of A that are removed
+   */
+  static void choleskyRemoveRowsColumns(DataMatrixDistributed& l,
+                                        const std::vector<size_t>& indices);
+
+  /**
+   * Updates the lower triangular Cholesky factor L of the n x n matrix A=LL^T to the factor of
+   * the matrix that results from appending m rows and columns to A, e.g. after refinement.
+   * The new rows of the factor are computed blockwise with pdtrsm, pdsyrk and pdpotrf.
+   *
+   * @param[in,out] l lower triangular Cholesky factor, overwritten with the updated factor
+   * @param[in] newRows m x (n+m) matrix with the rows that are appended to A, the last m columns
+   * contain the (symmetric) diagonal block
+   */
+  static void choleskyAddRowsColumns(DataMatrixDistributed& l,
+                                     const DataMatrixDistributed& newRows);
+
   /**
    * Resizes the matrix to rows and cols, data is discarded.
    * @param rows
@@ -447,6 +484,25 @@ class DataMatrixDistributed {
    */
   void broadcast(DataMatrix& localMatrix) const;
 
+  /**
+   * Adds a value to the diagonal elements of the local part of the matrix.
+   * @param value value to add
+   */
+  void addToDiagonal(double value);
+
+  /**
+   * Sets the elements above the diagonal of the local part of the matrix to zero.
+   */
+  void setStrictUpperTriangularZero();
+
+  /**
+   * Computes the lower triangular Cholesky factor of a symmetric positive definite matrix.
+   * Only the lower triangular part of the matrix is referenced and overwritten.
+   *
+   * @param a matrix to factorize
+   */
+  static void choleskyFactorize(DataMatrixDistributed& a);
+
   /**
    * Calculates the row or column index of the element in the local process.
    * @param globalIndex global index of the element
@@ -28,6 +28,9 @@ const char *const pblasConjugate = "C";
 const char *const lowerTriangular = "L";
 const char *const upperTriangular = "U";
 
+const char *const pblasLeft = "L";
+const char *const pblasNonUnit = "N";
+
 #ifdef USE_SCALAPACK
 
 extern "C" {
@@ -117,6 +120,18 @@ void pdgemm_(const char *transa, const char *transb, const size_t &m, const size
              const size_t &jb, const int *descb, const double &beta, double *c, const size_t &ic,
              const size_t &jc, const int *descc);
 
+// sub(C) := alpha*sub(A)*sub(A)' + beta*sub(C) or sub(C) := alpha*sub(A)'*sub(A) + beta*sub(C)
+void pdsyrk_(const char *uplo, const char *trans, const size_t &n, const size_t &k,
+             const double &alpha, const double *a, const size_t &ia, const size_t &ja,
+             const int *desca, const double &beta, double *c, const size_t &ic, const size_t &jc,
+             const int *descc);
+
+// solves op(sub(A))*X = alpha*sub(B) or X*op(sub(A)) = alpha*sub(B), sub(B) is overwritten by X
+void pdtrsm_(const char *side, const char *uplo, const char *transa, const char *diag,
+             const size_t &m, const size_t &n, const double &alpha, const double *a,
+             const size_t &ia, const size_t &ja, const int *desca, double *b, const size_t &ib,
+             const size_t &jb, const int *descb);
+
 // sub(C):=beta*sub(C) + alpha*op(sub(A))
 void pdgeadd_(const char *trans, const size_t &m, const size_t &n, const double &alpha,
               const double *a, const size_t &ia, const size_t &ja, const int *desca,
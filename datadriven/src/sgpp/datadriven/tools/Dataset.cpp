@@ -10,13 +10,15 @@
 namespace sgpp {
 namespace datadriven {
 
-Dataset::Dataset() : numberInstances(0), dimension(0), targets(0), data(0, 0) {}
+Dataset::Dataset()
+    : numberInstances(0), dimension(0), targets(0), data(0, 0), permutation() {}
 
 Dataset::Dataset(size_t numberInstances, size_t dimension)
     : numberInstances(numberInstances),
       dimension(dimension),
       targets(numberInstances),
-      data(numberInstances, dimension) {}
+      data(numberInstances, dimension),
+      permutation() {}
 
 size_t Dataset::getNumberInstances() const { return numberInstances; }
 
@@ -34,5 +36,9 @@ const sgpp::base::DataVector& Dataset::getTargets() const { return targets; }
 
 const sgpp::base::DataMatrix& Dataset::getData() const { return data; }
 
+std::vector<size_t>& Dataset::getPermutation() { return permutation; }
+
+const std::vector<size_t>& Dataset::getPermutation() const { return permutation; }
+
 }  // namespace datadriven
 }  // namespace sgpp
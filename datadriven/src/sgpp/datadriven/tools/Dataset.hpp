@@ -12,6 +12,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cstddef>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -61,11 +62,24 @@ class Dataset {
    */
   const sgpp::base::DataMatrix& getData() const;
 
+  /**
+   * @return permutation of a reordered dataset, the i-th instance is the permutation[i]-th
+   * instance of the original dataset. Empty if the dataset is in its original order.
+   */
+  std::vector<size_t>& getPermutation();
+
+  /**
+   * @return permutation of a reordered dataset, the i-th instance is the permutation[i]-th
+   * instance of the original dataset. Empty if the dataset is in its original order.
+   */
+  const std::vector<size_t>& getPermutation() const;
+
  protected:
   size_t numberInstances;
   size_t dimension;
   sgpp::base::DataVector targets;
   sgpp::base::DataMatrix data;
+  std::vector<size_t> permutation;
 };
 
 }  // namespace datadriven
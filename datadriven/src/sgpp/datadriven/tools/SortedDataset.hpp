@@ -17,7 +17,7 @@ namespace datadriven {
 class SortedDataset : public Dataset {
  public:
   /// Available permutations
-  enum OrderType { None, External, Random, Morton, Invalid };
+  enum OrderType { None, External, Random, Morton, Hilbert, Invalid };
 
   /**
    * Constructs an empty dataset (zero size).
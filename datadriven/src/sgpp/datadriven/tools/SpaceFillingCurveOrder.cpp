@@ -0,0 +1,276 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/tools/SpaceFillingCurveOrder.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+///@cond DOXY_IGNORE // NOLINT()
+namespace SpaceFillingCurveOrderDetail {
+
+union ext_double_t {
+  double val;  // Value
+  struct {
+    uint64_t dig : 52;  // Digits
+    uint32_t exp : 11;  // Exponent
+    uint8_t sig : 1;    // Sign
+  } bit;
+};
+
+/// Returns most significant bit from a integer value
+int MSB(size_t value) {
+  int ret = 0;
+  while (value > 1) {
+    value >>= 1;
+    ++ret;
+  }
+  return ret;
+}
+
+struct data_perm_t {
+  size_t idx;
+  std::vector<ext_double_t> pos;
+};
+
+/// Returns MSB from 2 double values
+int XOR_MSB(ext_double_t a, ext_double_t b) {
+  int ret;
+  if (a.bit.exp == b.bit.exp) {
+    ret = a.bit.exp + MSB(a.bit.dig ^ b.bit.dig);
+  } else if (a.bit.exp > b.bit.exp) {
+    ret = a.bit.exp + 52;
+  } else {
+    ret = b.bit.exp + 52;
+  }
+  return ret;
+}
+
+bool operator<(const data_perm_t &a, const data_perm_t &b) {
+  size_t d = 0;
+  size_t y, tmp;
+  tmp = 0;
+  // search the most differing dimension
+  for (size_t i = 0; i < a.pos.size(); i++) {
+    if ((a.pos[i].val < 0) != (b.pos[i].val < 0)) return a.pos[i].val < b.pos[i].val;
+
+    y = XOR_MSB(a.pos[i], b.pos[i]);
+    if (tmp < y) {
+      tmp = y;
+      d = i;
+    }
+  }
+  // compare values in this dimension
+  return a.pos[d].val < b.pos[d].val;
+}
+
+/// Number of bits per dimension of the quantized coordinates of the Hilbert order
+const int HILBERT_BITS = 32;
+
+/// Returns whether the most significant bit of a is lower than the one of b
+inline bool lessMSB(uint32_t a, uint32_t b) { return a < b && a < (a ^ b); }
+
+/**
+ * Converts quantized coordinates in place to the transposed Hilbert index (J. Skilling, Programming
+ * the Hilbert curve, AIP Conf. Proc. 707, 2004). The index consists of the bits of the
+ * coordinates interleaved from the most significant bit downwards, starting with dimension 0.
+ */
+void axesToTranspose(uint32_t *x, size_t dims) {
+  const uint32_t m = static_cast<uint32_t>(1) << (HILBERT_BITS - 1);
+
+  // inverse undo
+  for (uint32_t q = m; q > 1; q >>= 1) {
+    uint32_t p = q - 1;
+    for (size_t i = 0; i < dims; i++) {
+      if (x[i] & q) {
+        x[0] ^= p;
+      } else {
+        uint32_t t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // gray encode
+  for (size_t i = 1; i < dims; i++) {
+    x[i] ^= x[i - 1];
+  }
+
+  uint32_t t = 0;
+  for (uint32_t q = m; q > 1; q >>= 1) {
+    if (x[dims - 1] & q) {
+      t ^= q - 1;
+    }
+  }
+
+  for (size_t i = 0; i < dims; i++) {
+    x[i] ^= t;
+  }
+}
+
+/// Compares two transposed Hilbert indices without interleaving their bits explicitly
+bool hilbertLess(const uint32_t *a, const uint32_t *b, size_t dims) {
+  size_t maxDim = 0;
+  uint32_t maxXor = 0;
+
+  // the most significant differing bit decides, ties go to the lower dimension
+  for (size_t d = 0; d < dims; d++) {
+    uint32_t y = a[d] ^ b[d];
+    if (lessMSB(maxXor, y)) {
+      maxXor = y;
+      maxDim = d;
+    }
+  }
+
+  return a[maxDim] < b[maxDim];
+}
+
+}  // namespace SpaceFillingCurveOrderDetail
+///@endcond // NOLINT()
+
+void SpaceFillingCurveOrder::computePermutation(const base::DataMatrix &data,
+                                                SpaceFillingCurveType curve,
+                                                std::vector<size_t> &permutation) {
+  switch (curve) {
+    case SpaceFillingCurveType::Morton:
+      mortonOrder(data, permutation);
+      break;
+    case SpaceFillingCurveType::Hilbert:
+      hilbertOrder(data, permutation);
+      break;
+    case SpaceFillingCurveType::None:
+      permutation.resize(data.getNrows());
+      for (size_t i = 0; i < permutation.size(); ++i) permutation[i] = i;
+      break;
+  }
+}
+
+void SpaceFillingCurveOrder::orderDataset(Dataset &dataset, SpaceFillingCurveType curve) {
+  if (curve == SpaceFillingCurveType::None) return;
+
+  std::vector<size_t> permutation;
+  computePermutation(dataset.getData(), curve, permutation);
+
+  base::DataMatrix &data = dataset.getData();
+  base::DataVector &targets = dataset.getTargets();
+  base::DataMatrix matrix(data);
+  base::DataVector vector(targets);
+  for (size_t i = 0; i < permutation.size(); ++i) {
+    targets[i] = vector[permutation[i]];
+    for (size_t d = 0; d < matrix.getNcols(); ++d) {
+      data(i, d) = matrix(permutation[i], d);
+    }
+  }
+
+  // refer to the original order if the dataset has been reordered before
+  std::vector<size_t> &datasetPermutation = dataset.getPermutation();
+  if (!datasetPermutation.empty()) {
+    for (size_t i = 0; i < permutation.size(); ++i) {
+      permutation[i] = datasetPermutation[permutation[i]];
+    }
+  }
+  datasetPermutation = permutation;
+}
+
+void SpaceFillingCurveOrder::restoreDataset(Dataset &dataset) {
+  std::vector<size_t> &permutation = dataset.getPermutation();
+  if (permutation.empty()) return;
+
+  base::DataMatrix &data = dataset.getData();
+  base::DataVector &targets = dataset.getTargets();
+  base::DataMatrix matrix(data);
+  base::DataVector vector(targets);
+  for (size_t i = 0; i < permutation.size(); ++i) {
+    targets[permutation[i]] = vector[i];
+    for (size_t d = 0; d < matrix.getNcols(); ++d) {
+      data(permutation[i], d) = matrix(i, d);
+    }
+  }
+  permutation.clear();
+}
+
+void SpaceFillingCurveOrder::restoreOrder(const std::vector<size_t> &permutation,
+                                          base::DataVector &values) {
+  if (permutation.empty()) return;
+  if (permutation.size() != values.getSize()) {
+    throw base::data_exception(
+        "SpaceFillingCurveOrder::restoreOrder: permutation and values differ in size");
+  }
+
+  base::DataVector vector(values);
+  for (size_t i = 0; i < permutation.size(); ++i) {
+    values[permutation[i]] = vector[i];
+  }
+}
+
+void SpaceFillingCurveOrder::mortonOrder(const base::DataMatrix &data,
+                                         std::vector<size_t> &permutation) {
+  using SpaceFillingCurveOrderDetail::data_perm_t;
+
+  permutation.clear();
+  permutation.resize(data.getNrows());
+  std::vector<data_perm_t> workdata(permutation.size());
+  // initialize permutation as identity
+  for (size_t i = 0; i < workdata.size(); ++i) {
+    workdata[i].idx = i;
+    workdata[i].pos.resize(data.getNcols());
+    for (size_t d = 0; d < data.getNcols(); ++d) {
+      workdata[i].pos[d].val = data(i, d);
+    }
+  }
+  std::stable_sort(workdata.begin(), workdata.end());
+  for (size_t i = 0; i < workdata.size(); ++i) {
+    permutation[i] = workdata[i].idx;
+  }
+}
+
+void SpaceFillingCurveOrder::hilbertOrder(const base::DataMatrix &data,
+                                          std::vector<size_t> &permutation) {
+  const size_t numPoints = data.getNrows();
+  const size_t dims = data.getNcols();
+
+  permutation.resize(numPoints);
+  for (size_t i = 0; i < numPoints; ++i) permutation[i] = i;
+  if (numPoints == 0 || dims == 0) return;
+
+  // quantize the coordinates relative to the bounding box of the data
+  std::vector<double> lower(dims, std::numeric_limits<double>::infinity());
+  std::vector<double> upper(dims, -std::numeric_limits<double>::infinity());
+  for (size_t i = 0; i < numPoints; ++i) {
+    for (size_t d = 0; d < dims; ++d) {
+      lower[d] = std::min(lower[d], data(i, d));
+      upper[d] = std::max(upper[d], data(i, d));
+    }
+  }
+
+  const double maxKey = static_cast<double>(std::numeric_limits<uint32_t>::max());
+  std::vector<uint32_t> keys(numPoints * dims);
+  for (size_t i = 0; i < numPoints; ++i) {
+    uint32_t *key = &keys[i * dims];
+    for (size_t d = 0; d < dims; ++d) {
+      double width = upper[d] - lower[d];
+      double scaled = (width > 0.0) ? (data(i, d) - lower[d]) / width * maxKey : 0.0;
+      key[d] = static_cast<uint32_t>(std::min(maxKey, std::max(0.0, scaled)));
+    }
+    SpaceFillingCurveOrderDetail::axesToTranspose(key, dims);
+  }
+
+  std::stable_sort(permutation.begin(), permutation.end(), [&keys, dims](size_t a, size_t b) {
+    return SpaceFillingCurveOrderDetail::hilbertLess(&keys[a * dims], &keys[b * dims], dims);
+  });
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
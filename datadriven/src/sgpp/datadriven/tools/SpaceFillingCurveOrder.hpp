@@ -0,0 +1,83 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SPACEFILLINGCURVEORDER_HPP
+#define SPACEFILLINGCURVEORDER_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/// Space filling curves along which the instances of a dataset can be ordered
+enum class SpaceFillingCurveType { None, Morton, Hilbert };
+
+/**
+ * Orders data points along a space filling curve, so that points that are close in the sequence
+ * are close in space as well. Blocks of consecutive points then have small bounding boxes, which
+ * improves the cache locality of the evaluation kernels and allows them to skip grid points whose
+ * support does not intersect a block.
+ *
+ * The Morton order compares the coordinates bitwise without quantization. The Hilbert order
+ * quantizes the coordinates to 32 bit per dimension relative to the bounding box of the data and
+ * avoids the jumps of the Morton curve, so the blocks are a bit more compact.
+ */
+class SpaceFillingCurveOrder {
+ public:
+  /**
+   * Computes the permutation that orders the rows of a matrix along a curve.
+   *
+   * @param data the data points, one per row
+   * @param curve the space filling curve, SpaceFillingCurveType::None gives the identity
+   * @param permutation is set to the permutation, the i-th point of the ordered data is the
+   * permutation[i]-th row of data
+   */
+  static void computePermutation(const base::DataMatrix& data, SpaceFillingCurveType curve,
+                                 std::vector<size_t>& permutation);
+
+  /**
+   * Reorders the data points and targets of a dataset along a curve. The permutation is combined
+   * with the one the dataset already carries, so Dataset::getPermutation() always refers to the
+   * original order.
+   *
+   * @param dataset the dataset to reorder in place
+   * @param curve the space filling curve, nothing is done for SpaceFillingCurveType::None
+   */
+  static void orderDataset(Dataset& dataset, SpaceFillingCurveType curve);
+
+  /**
+   * Restores the original order of a dataset reordered by orderDataset and clears its
+   * permutation.
+   *
+   * @param dataset the dataset to restore in place
+   */
+  static void restoreDataset(Dataset& dataset);
+
+  /**
+   * Moves the entries of a vector given in the order of a reordered dataset back to the original
+   * order, e.g. the results of an evaluation on the reordered points.
+   *
+   * @param permutation the permutation of the dataset
+   * @param values values in the order of the reordered dataset, restored in place
+   */
+  static void restoreOrder(const std::vector<size_t>& permutation, base::DataVector& values);
+
+ protected:
+  /// Computes the Morton (Z-curve) permutation
+  static void mortonOrder(const base::DataMatrix& data, std::vector<size_t>& permutation);
+
+  /// Computes the Hilbert curve permutation
+  static void hilbertOrder(const base::DataMatrix& data, std::vector<size_t>& permutation);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* SPACEFILLINGCURVEORDER_HPP */
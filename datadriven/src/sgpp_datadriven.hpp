@@ -99,6 +99,9 @@
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include "sgpp/datadriven/datamining/tools/Graph.hpp"
 
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalAdaptive/MultipleEvalTuningCache.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalAdaptive/OperationMultipleEvalAdaptive.hpp>
+
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalScalapack/OperationMultipleEvalDistributed.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalScalapack/OperationMultipleEvalLinearDistributed.hpp>
 #include <sgpp/datadriven/operation/hash/OperationMultipleEvalScalapack/OperationMultipleEvalModLinearDistributed.hpp>
@@ -0,0 +1,175 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalStreaming/OperationMultiEvalStreaming.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+#include <sgpp/datadriven/tools/SpaceFillingCurveOrder.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::SpaceFillingCurveOrder;
+using sgpp::datadriven::SpaceFillingCurveType;
+
+namespace {
+Dataset createRandomDataset(size_t numberInstances, size_t dimension) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  Dataset dataset(numberInstances, dimension);
+
+  for (size_t i = 0; i < numberInstances; i++) {
+    for (size_t d = 0; d < dimension; d++) {
+      dataset.getData().set(i, d, distribution(generator));
+    }
+    dataset.getTargets()[i] = static_cast<double>(i);
+  }
+
+  return dataset;
+}
+
+bool isPermutation(const std::vector<size_t>& permutation, size_t size) {
+  std::vector<size_t> sorted(permutation);
+  std::sort(sorted.begin(), sorted.end());
+
+  for (size_t i = 0; i < sorted.size(); i++) {
+    if (sorted[i] != i) return false;
+  }
+
+  return sorted.size() == size;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(SpaceFillingCurveOrderTest)
+
+BOOST_AUTO_TEST_CASE(PermutationTest) {
+  Dataset dataset = createRandomDataset(1000, 3);
+
+  for (auto curve : {SpaceFillingCurveType::None, SpaceFillingCurveType::Morton,
+                     SpaceFillingCurveType::Hilbert}) {
+    std::vector<size_t> permutation;
+    SpaceFillingCurveOrder::computePermutation(dataset.getData(), curve, permutation);
+    BOOST_CHECK(isPermutation(permutation, dataset.getNumberInstances()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(HilbertNeighborsTest) {
+  // consecutive points of the Hilbert curve through a regular grid are neighbors
+  const size_t pointsPerDim = 16;
+  DataMatrix data(pointsPerDim * pointsPerDim, 2);
+
+  for (size_t i = 0; i < pointsPerDim; i++) {
+    for (size_t j = 0; j < pointsPerDim; j++) {
+      data.set(i * pointsPerDim + j, 0, static_cast<double>(j) / (pointsPerDim - 1));
+      data.set(i * pointsPerDim + j, 1, static_cast<double>(i) / (pointsPerDim - 1));
+    }
+  }
+
+  std::vector<size_t> permutation;
+  SpaceFillingCurveOrder::computePermutation(data, SpaceFillingCurveType::Hilbert, permutation);
+  BOOST_CHECK(isPermutation(permutation, data.getNrows()));
+
+  for (size_t k = 1; k < permutation.size(); k++) {
+    double distance = std::abs(data.get(permutation[k], 0) - data.get(permutation[k - 1], 0)) +
+                      std::abs(data.get(permutation[k], 1) - data.get(permutation[k - 1], 1));
+    BOOST_CHECK_CLOSE(distance, 1.0 / (pointsPerDim - 1), 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(OrderAndRestoreTest) {
+  Dataset original = createRandomDataset(500, 4);
+  Dataset dataset(original);
+
+  SpaceFillingCurveOrder::orderDataset(dataset, SpaceFillingCurveType::Morton);
+  SpaceFillingCurveOrder::orderDataset(dataset, SpaceFillingCurveType::Hilbert);
+
+  // the permutation refers to the original order after ordering twice
+  const std::vector<size_t>& permutation = dataset.getPermutation();
+  BOOST_CHECK(isPermutation(permutation, original.getNumberInstances()));
+
+  for (size_t i = 0; i < dataset.getNumberInstances(); i++) {
+    BOOST_CHECK_EQUAL(dataset.getTargets()[i], original.getTargets()[permutation[i]]);
+
+    for (size_t d = 0; d < dataset.getDimension(); d++) {
+      BOOST_CHECK_EQUAL(dataset.getData().get(i, d), original.getData().get(permutation[i], d));
+    }
+  }
+
+  DataVector values(dataset.getTargets());
+  SpaceFillingCurveOrder::restoreOrder(permutation, values);
+
+  for (size_t i = 0; i < values.getSize(); i++) {
+    BOOST_CHECK_EQUAL(values[i], original.getTargets()[i]);
+  }
+
+  SpaceFillingCurveOrder::restoreDataset(dataset);
+  BOOST_CHECK(dataset.getPermutation().empty());
+
+  for (size_t i = 0; i < dataset.getNumberInstances(); i++) {
+    BOOST_CHECK_EQUAL(dataset.getTargets()[i], original.getTargets()[i]);
+
+    for (size_t d = 0; d < dataset.getDimension(); d++) {
+      BOOST_CHECK_EQUAL(dataset.getData().get(i, d), original.getData().get(i, d));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(StreamingBlockSkippingTest) {
+  // ordered data lets the streaming kernels skip blocks, the results must not change
+  const size_t dim = 3;
+  Dataset dataset = createRandomDataset(2000, dim);
+  SpaceFillingCurveOrder::orderDataset(dataset, SpaceFillingCurveType::Hilbert);
+
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(5);
+
+  DataVector alpha(grid->getSize());
+  DataVector source(dataset.getNumberInstances());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i % 7) - 3.0;
+  }
+
+  for (size_t i = 0; i < source.getSize(); i++) {
+    source[i] = static_cast<double>(i % 5) - 2.0;
+  }
+
+  sgpp::datadriven::OperationMultiEvalStreaming opStreaming(*grid, dataset.getData());
+  std::unique_ptr<sgpp::base::OperationMultipleEval> opReference(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset.getData()));
+
+  DataVector result(dataset.getNumberInstances());
+  DataVector resultReference(dataset.getNumberInstances());
+  opStreaming.mult(alpha, result);
+  opReference->mult(alpha, resultReference);
+
+  for (size_t i = 0; i < result.getSize(); i++) {
+    BOOST_CHECK_SMALL(result[i] - resultReference[i], 1e-12);
+  }
+
+  DataVector resultTranspose(grid->getSize());
+  DataVector resultTransposeReference(grid->getSize());
+  opStreaming.multTranspose(source, resultTranspose);
+  opReference->multTranspose(source, resultTransposeReference);
+
+  for (size_t i = 0; i < resultTranspose.getSize(); i++) {
+    BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeReference[i], 1e-10);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,162 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/base/tools/OperationConfiguration.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalAdaptive/OperationMultipleEvalAdaptive.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_datadrivenCommon.hpp"
+
+namespace TestAdaptiveMultFixture {
+struct FilesNamesAndErrorFixture {
+  FilesNamesAndErrorFixture() {}
+  ~FilesNamesAndErrorFixture() {}
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDouble = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-24),
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman1_10d_2000.arff.gz", 1E-21)};
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDoubleTranspose = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-18),
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman1_10d_2000.arff.gz", 1E-21)};
+
+  uint32_t level = 5;
+
+  /// configuration that tunes on every construction without touching the user's cache file
+  sgpp::datadriven::OperationMultipleEvalConfiguration getUncachedConfiguration() {
+    sgpp::base::OperationConfiguration parameters;
+    parameters.addTextAttr("TUNING_CACHE_FILE", "");
+    return sgpp::datadriven::OperationMultipleEvalConfiguration(
+        sgpp::datadriven::OperationMultipleEvalType::ADAPTIVE,
+        sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT, parameters);
+  }
+};
+}  // namespace TestAdaptiveMultFixture
+
+BOOST_FIXTURE_TEST_SUITE(TestAdaptiveMult, TestAdaptiveMultFixture::FilesNamesAndErrorFixture)
+
+#ifdef ZLIB
+
+BOOST_AUTO_TEST_CASE(Simple) {
+  compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::Linear, level,
+                  getUncachedConfiguration());
+}
+
+BOOST_AUTO_TEST_CASE(SimpleTranspose) {
+  compareDatasetsTranspose(fileNamesErrorDoubleTranspose, sgpp::base::GridType::Linear, level,
+                           getUncachedConfiguration());
+}
+
+#endif
+
+BOOST_AUTO_TEST_CASE(TuningCache) {
+  const size_t dim = 4;
+  const size_t numDataPoints = 500;
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  sgpp::base::DataMatrix dataset(numDataPoints, dim);
+  sgpp::base::DataVector alpha(grid->getSize());
+  sgpp::base::DataVector source(numDataPoints);
+
+  for (size_t i = 0; i < numDataPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, distribution(generator));
+    }
+
+    source[i] = distribution(generator);
+  }
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = distribution(generator);
+  }
+
+  const std::string cacheFileName = "adaptiveMultTest_tuning_cache.txt";
+  std::remove(cacheFileName.c_str());
+
+  sgpp::base::OperationConfiguration parameters;
+  parameters.addTextAttr("TUNING_CACHE_FILE", cacheFileName);
+  parameters.addIDAttr("TUNING_SAMPLE_SIZE", UINT64_C(200));
+  parameters.addIDAttr("TUNING_REPETITIONS", UINT64_C(1));
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::ADAPTIVE,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT, parameters);
+
+  // first construction tunes and writes the cache
+  std::unique_ptr<sgpp::datadriven::OperationMultipleEvalAdaptive> opTuned(
+      new sgpp::datadriven::OperationMultipleEvalAdaptive(*grid, dataset, configuration));
+  BOOST_CHECK(!opTuned->isSelectionCached());
+
+  // second construction reads the selection from the cache
+  std::unique_ptr<sgpp::datadriven::OperationMultipleEvalAdaptive> opCached(
+      new sgpp::datadriven::OperationMultipleEvalAdaptive(*grid, dataset, configuration));
+  BOOST_CHECK(opCached->isSelectionCached());
+  BOOST_CHECK_EQUAL(opCached->getMultBackend(), opTuned->getMultBackend());
+  BOOST_CHECK_EQUAL(opCached->getMultTransposeBackend(), opTuned->getMultTransposeBackend());
+
+  // results coincide with the default implementation
+  std::unique_ptr<sgpp::base::OperationMultipleEval> opReference(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+  sgpp::base::DataVector result(numDataPoints);
+  sgpp::base::DataVector resultReference(numDataPoints);
+  opCached->mult(alpha, result);
+  opReference->mult(alpha, resultReference);
+
+  for (size_t i = 0; i < numDataPoints; i++) {
+    BOOST_CHECK_SMALL(result[i] - resultReference[i], 1e-10);
+  }
+
+  sgpp::base::DataVector resultTranspose(grid->getSize());
+  sgpp::base::DataVector resultTransposeReference(grid->getSize());
+  opCached->multTranspose(source, resultTranspose);
+  opReference->multTranspose(source, resultTransposeReference);
+
+  for (size_t i = 0; i < grid->getSize(); i++) {
+    BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeReference[i], 1e-10);
+  }
+
+  // stores replace the cache file and keep the other entries
+  sgpp::datadriven::MultipleEvalTuningCache cache(cacheFileName);
+  cache.store("key;1;2;3;cpu", "multBackend", "multTransposeBackend");
+  std::string multBackend, multTransposeBackend;
+  BOOST_CHECK(cache.lookup("key;1;2;3;cpu", multBackend, multTransposeBackend));
+  BOOST_CHECK_EQUAL(multBackend, "multBackend");
+  BOOST_CHECK_EQUAL(multTransposeBackend, "multTransposeBackend");
+  const std::string key = sgpp::datadriven::MultipleEvalTuningCache::createKey(
+      grid->getTypeAsString(), dim, grid->getSize(), numDataPoints);
+  BOOST_CHECK(cache.lookup(key, multBackend, multTransposeBackend));
+  BOOST_CHECK_EQUAL(multBackend, opTuned->getMultBackend());
+
+  std::remove(cacheFileName.c_str());
+
+  // without an explicit file name, nothing is cached on disk
+  if (std::getenv("SGPP_MULTIEVAL_TUNING_CACHE") == nullptr) {
+    BOOST_CHECK(sgpp::datadriven::MultipleEvalTuningCache::getDefaultFileName().empty());
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
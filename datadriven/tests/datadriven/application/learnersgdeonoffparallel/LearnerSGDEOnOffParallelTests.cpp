@@ -12,17 +12,30 @@
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/base/exception/application_exception.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/LearnerSGDEOnOffParallel.hpp>
+#include <sgpp/datadriven/application/learnersgdeonoffparallel/LeastLoadedScheduler.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/MPIMethods.hpp>
 #include <sgpp/datadriven/application/learnersgdeonoffparallel/RoundRobinScheduler.hpp>
 
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <map>
+#include <vector>
+
 #define SCHEDULER_BATCH_SIZE 1337
 #define TEST_DIMENSION 3
 #define TEST_DATASET_SIZE 3
+// Number of grid points of the regular level 3 grid in 3 dimensions
+#define TEST_GRID_SIZE 31
 
 BOOST_AUTO_TEST_SUITE(MPIMethods_Test)
 
+using sgpp::base::DataVector;
+using sgpp::datadriven::ADDED_GRID_POINTS_LIST;
 using sgpp::datadriven::AssignTaskResult;
 using sgpp::datadriven::DataMatrix;
+using sgpp::datadriven::DELETED_GRID_POINTS_LIST;
+using sgpp::datadriven::LeastLoadedScheduler;
 using sgpp::datadriven::LearnerSGDEOnOffParallel;
 using sgpp::datadriven::LevelIndexPair;
 using sgpp::datadriven::LevelIndexVector;
@@ -38,7 +51,33 @@ using sgpp::datadriven::RoundRobinScheduler;
 using sgpp::datadriven::TRAIN_FROM_BATCH;
 using sgpp::datadriven::UPDATE_GRID;
 
-sgpp::datadriven::LearnerSGDEOnOffParallel *learnerInstance;
+/**
+ * Learner that exposes its alpha vectors to check merged alpha values.
+ */
+class TestLearnerSGDEOnOffParallel : public LearnerSGDEOnOffParallel {
+ public:
+  using LearnerSGDEOnOffParallel::LearnerSGDEOnOffParallel;
+
+  DataVector &getAlpha(size_t classIndex) { return *alphas[classIndex]; }
+};
+
+/**
+ * Scheduler that schedules for a fixed number of processes, independent of the MPI world size.
+ */
+class TestLeastLoadedScheduler : public LeastLoadedScheduler {
+ public:
+  TestLeastLoadedScheduler(size_t batchSize, size_t maxOutstandingBatchesPerWorker,
+                           size_t numberOfProcesses)
+      : LeastLoadedScheduler(batchSize, maxOutstandingBatchesPerWorker),
+        numberOfProcesses(numberOfProcesses) {}
+
+ protected:
+  size_t getNumberOfProcesses() override { return numberOfProcesses; }
+
+  size_t numberOfProcesses;
+};
+
+TestLearnerSGDEOnOffParallel *learnerInstance;
 sgpp::datadriven::RoundRobinScheduler *scheduler;
 
 /**
@@ -77,13 +116,14 @@ void createInstance() {
     adaptConfig.numRefinementPoints_ = 7;
     adaptConfig.refinementThreshold_ = 0.0;  // only required for surplus refinement
 
-    sgpp::datadriven::Dataset trainData(TEST_DATASET_SIZE, TEST_DIMENSION);
-    sgpp::datadriven::Dataset testData(TEST_DATASET_SIZE, TEST_DIMENSION);
+    // The learner keeps references to the datasets
+    static sgpp::datadriven::Dataset trainData(TEST_DATASET_SIZE, TEST_DIMENSION);
+    static sgpp::datadriven::Dataset testData(TEST_DATASET_SIZE, TEST_DIMENSION);
     sgpp::base::DataVector classLabels(2);
     classLabels[0] = -1;
     classLabels[1] = 1;
     scheduler = new RoundRobinScheduler(SCHEDULER_BATCH_SIZE);
-    learnerInstance = new sgpp::datadriven::LearnerSGDEOnOffParallel(
+    learnerInstance = new TestLearnerSGDEOnOffParallel(
         gridConfig, adaptConfig, regularizationConfig, densityEstimationConfig, trainData, testData,
         nullptr, classLabels, 2, false, 0.0, *scheduler);
 
@@ -92,22 +132,47 @@ void createInstance() {
 }
 
 void sendMergeGridPacket(size_t batchSize, size_t batchOffset, size_t gridversion,
-                         size_t classIndex, size_t alphaTotalSize, size_t payloadOffset,
-                         size_t payloadLength) {
-  auto *mpiPacket = new MPI_Packet;
+                         size_t classIndex, const DataVector &alpha) {
+  auto *mpiPacket = new MPI_Packet();
   mpiPacket->commandID = MERGE_GRID;
 
   auto *message = static_cast<MergeGridNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
 
   message->batchOffset = batchOffset;
   message->gridversion = gridversion;
+  message->assignedGridversion = gridversion;
   message->classIndex = classIndex;
   message->batchSize = batchSize;
-  message->alphaTotalSize = alphaTotalSize;
-  message->payloadOffset = payloadOffset;
-  message->payloadLength = payloadLength;
+  message->alphaTotalSize = alpha.size();
+
+  std::vector<unsigned char> frame(alpha.size() * sizeof(double));
+  std::memcpy(frame.data(), alpha.getPointer(), frame.size());
 
-  MPIMethods::sendISend(0, mpiPacket);
+  MPIMethods::sendPacketWithFrame(0, mpiPacket, frame);
+}
+
+void sendGridUpdatePacket(sgpp::datadriven::RefinementResultsUpdateType updateType,
+                          size_t listLength, std::vector<unsigned char> &frame) {
+  auto *mpiPacket = new MPI_Packet();
+  mpiPacket->commandID = UPDATE_GRID;
+
+  auto *message =
+      static_cast<RefinementResultNetworkMessage *>(static_cast<void *>(mpiPacket->payload));
+
+  message->classIndex = 0;
+  message->updateType = updateType;
+  message->listLength = listLength;
+  message->gridversion = learnerInstance->getLocalGridVersion(0);
+
+  MPIMethods::sendPacketWithFrame(0, mpiPacket, frame);
+}
+
+DataVector createAlphaVector(size_t size, double offset) {
+  DataVector alpha(size);
+  for (size_t i = 0; i < size; i++) {
+    alpha[i] = offset + 0.25 * static_cast<double>(i);
+  }
+  return alpha;
 }
 
 BOOST_AUTO_TEST_CASE(RoundRobinSchedulerTest) {
@@ -127,16 +192,104 @@ BOOST_AUTO_TEST_CASE(RoundRobinSchedulerTest) {
   BOOST_CHECK(!scheduler->isReadyForRefinement());
   BOOST_CHECK_THROW(scheduler->onRefinementStarted(), sgpp::base::algorithm_exception);
 
-  BOOST_CHECK_THROW(scheduler->onMergeRequestIncoming(0, SCHEDULER_BATCH_SIZE, 10, 12),
+  BOOST_CHECK_THROW(scheduler->onMergeRequestIncoming(1, 0, SCHEDULER_BATCH_SIZE, 10, 12),
                     sgpp::base::algorithm_exception);
 
   // Once for each class
-  scheduler->onMergeRequestIncoming(0, SCHEDULER_BATCH_SIZE, 10, 11);
+  scheduler->onMergeRequestIncoming(1, 0, SCHEDULER_BATCH_SIZE, 10, 11);
   BOOST_CHECK(!scheduler->isReadyForRefinement());
-  scheduler->onMergeRequestIncoming(0, SCHEDULER_BATCH_SIZE, 10, 11);
+  scheduler->onMergeRequestIncoming(1, 0, SCHEDULER_BATCH_SIZE, 10, 11);
   BOOST_CHECK(scheduler->isReadyForRefinement());
 }
 
+BOOST_AUTO_TEST_CASE(LeastLoadedSchedulerTest) {
+  createInstance();
+
+  // Rank 0 is the master, hence there are no workers in a single process
+  LeastLoadedScheduler singleProcessScheduler(SCHEDULER_BATCH_SIZE);
+  singleProcessScheduler.setLearnerInstance(learnerInstance);
+  AssignTaskResult result{};
+  BOOST_CHECK_THROW(singleProcessScheduler.assignTaskStaticTaskSize(TRAIN_FROM_BATCH, result),
+                    sgpp::base::algorithm_exception);
+
+  // Three workers with up to two outstanding batches each
+  TestLeastLoadedScheduler leastLoadedScheduler(SCHEDULER_BATCH_SIZE, 2, 4);
+  leastLoadedScheduler.setLearnerInstance(learnerInstance);
+  const size_t numClasses = learnerInstance->getNumClasses();
+
+  BOOST_CHECK(leastLoadedScheduler.isReadyForRefinement());
+  BOOST_CHECK(leastLoadedScheduler.isWorkerAvailable());
+  BOOST_CHECK(!leastLoadedScheduler.hasOutstandingTasks());
+
+  std::map<size_t, int> batchWorkers;
+  auto assignBatch = [&leastLoadedScheduler, &batchWorkers](size_t batchNumber) {
+    AssignTaskResult assignTaskResult{};
+    leastLoadedScheduler.assignTaskVariableTaskSize(TRAIN_FROM_BATCH, assignTaskResult);
+    BOOST_CHECK_EQUAL(assignTaskResult.taskSize, SCHEDULER_BATCH_SIZE);
+    leastLoadedScheduler.onTaskAssigned(assignTaskResult.workerID,
+                                        batchNumber * SCHEDULER_BATCH_SIZE, SCHEDULER_BATCH_SIZE);
+    batchWorkers[batchNumber] = assignTaskResult.workerID;
+    return assignTaskResult.workerID;
+  };
+  auto mergeBatch = [&leastLoadedScheduler, &batchWorkers, numClasses](size_t batchNumber) {
+    // The batch is complete once the alpha vectors of all classes have been merged
+    for (size_t classIndex = 0; classIndex < numClasses; classIndex++) {
+      BOOST_CHECK(leastLoadedScheduler.hasOutstandingTasks());
+      leastLoadedScheduler.onMergeRequestIncoming(batchWorkers[batchNumber],
+                                                  batchNumber * SCHEDULER_BATCH_SIZE,
+                                                  SCHEDULER_BATCH_SIZE, 10, 10);
+    }
+  };
+
+  // Equally loaded workers are assigned in the order of their ranks
+  BOOST_CHECK_EQUAL(assignBatch(0), 1);
+  BOOST_CHECK_EQUAL(assignBatch(1), 2);
+  BOOST_CHECK_EQUAL(assignBatch(2), 3);
+  BOOST_CHECK_EQUAL(assignBatch(3), 1);
+  BOOST_CHECK(leastLoadedScheduler.hasOutstandingTasks());
+
+  // Worker 2 is done after its results for all classes have been merged
+  mergeBatch(1);
+  BOOST_CHECK_EQUAL(assignBatch(4), 2);
+
+  // Workers 2 and 3 have one outstanding batch, but worker 2 has completed more batches
+  BOOST_CHECK_EQUAL(assignBatch(5), 2);
+  BOOST_CHECK(leastLoadedScheduler.isWorkerAvailable());
+  BOOST_CHECK_EQUAL(assignBatch(6), 3);
+  BOOST_CHECK(!leastLoadedScheduler.isWorkerAvailable());
+
+  BOOST_CHECK_THROW(leastLoadedScheduler.onMergeRequestIncoming(
+                        1, 100 * SCHEDULER_BATCH_SIZE, SCHEDULER_BATCH_SIZE, 10, 10),
+                    sgpp::base::algorithm_exception);
+
+  // Batch 6 has been assigned to worker 3, a merge request from another worker does not match
+  BOOST_CHECK_THROW(leastLoadedScheduler.onMergeRequestIncoming(
+                        1, 6 * SCHEDULER_BATCH_SIZE, SCHEDULER_BATCH_SIZE, 10, 10),
+                    sgpp::base::algorithm_exception);
+
+  // Batches assigned before the refinement block the next refinement until they are merged
+  BOOST_CHECK(leastLoadedScheduler.isReadyForRefinement());
+  leastLoadedScheduler.onRefinementStarted();
+  BOOST_CHECK(!leastLoadedScheduler.isReadyForRefinement());
+  BOOST_CHECK_THROW(leastLoadedScheduler.onRefinementStarted(), sgpp::base::algorithm_exception);
+
+  mergeBatch(2);
+  BOOST_CHECK(leastLoadedScheduler.isWorkerAvailable());
+  BOOST_CHECK_EQUAL(assignBatch(7), 3);
+
+  for (size_t batchNumber : std::vector<size_t>{0, 3, 4, 5, 6}) {
+    BOOST_CHECK(!leastLoadedScheduler.isReadyForRefinement());
+    mergeBatch(batchNumber);
+  }
+
+  // Batch 7 was assigned after the refinement started
+  BOOST_CHECK(leastLoadedScheduler.isReadyForRefinement());
+  BOOST_CHECK(leastLoadedScheduler.hasOutstandingTasks());
+  mergeBatch(7);
+  BOOST_CHECK(!leastLoadedScheduler.hasOutstandingTasks());
+  BOOST_CHECK(leastLoadedScheduler.isWorkerAvailable());
+}
+
 BOOST_AUTO_TEST_CASE(AssignBatchTest) {
   createInstance();
 
@@ -191,9 +344,84 @@ BOOST_AUTO_TEST_CASE(SendRefinementResultsTest) {
   MPIMethods::waitForAnyMPIRequestsToComplete();
 }
 
+BOOST_AUTO_TEST_CASE(ReceiveRefinementResultsTest) {
+  createInstance();
+
+  BOOST_REQUIRE(MPIMethods::isMaster());
+  BOOST_REQUIRE(MPIMethods::getWorldSize() == 1);
+
+  RefinementResult &refinementResult =
+      learnerInstance->getRefinementHandler().getRefinementResult(0);
+  refinementResult.deletedGridPointsIndices.clear();
+  refinementResult.addedGridPoints.clear();
+
+  // The lists do not fit into a packet, they have to be reassembled from the frame
+  std::list<size_t> deletedGridPointsIndices;
+  for (size_t i = 0; i < MPI_PACKET_MAX_PAYLOAD_SIZE; i++) {
+    deletedGridPointsIndices.push_back(3 * i + 1);
+  }
+  std::vector<unsigned char> deletedFrame(deletedGridPointsIndices.size() * sizeof(size_t));
+  std::copy(deletedGridPointsIndices.begin(), deletedGridPointsIndices.end(),
+            static_cast<size_t *>(static_cast<void *>(deletedFrame.data())));
+
+  sendGridUpdatePacket(DELETED_GRID_POINTS_LIST, deletedGridPointsIndices.size(), deletedFrame);
+  BOOST_CHECK(deletedFrame.empty());
+  MPIMethods::waitForIncomingMessageType(UPDATE_GRID);
+
+  BOOST_CHECK(refinementResult.deletedGridPointsIndices == deletedGridPointsIndices);
+
+  std::list<LevelIndexVector> addedGridPoints;
+  for (size_t point = 0; point < MPI_PACKET_MAX_PAYLOAD_SIZE; point++) {
+    LevelIndexVector levelIndexVector;
+    for (size_t d = 0; d < TEST_DIMENSION; d++) {
+      sgpp::base::HashGridPoint::level_type level =
+          static_cast<sgpp::base::HashGridPoint::level_type>(1 + (point + d) % 5);
+      sgpp::base::HashGridPoint::index_type index =
+          static_cast<sgpp::base::HashGridPoint::index_type>(2 * point + 1);
+      levelIndexVector.push_back(LevelIndexPair{level, index});
+    }
+    addedGridPoints.push_back(levelIndexVector);
+  }
+  std::vector<unsigned char> addedFrame(addedGridPoints.size() * TEST_DIMENSION *
+                                        sizeof(LevelIndexPair));
+  auto *framePointer = static_cast<LevelIndexPair *>(static_cast<void *>(addedFrame.data()));
+  for (LevelIndexVector &levelIndexVector : addedGridPoints) {
+    framePointer = std::copy(levelIndexVector.begin(), levelIndexVector.end(), framePointer);
+  }
+
+  sendGridUpdatePacket(ADDED_GRID_POINTS_LIST, addedGridPoints.size(), addedFrame);
+  MPIMethods::waitForIncomingMessageType(UPDATE_GRID);
+
+  BOOST_REQUIRE_EQUAL(refinementResult.addedGridPoints.size(), addedGridPoints.size());
+  auto receivedPoint = refinementResult.addedGridPoints.begin();
+  for (LevelIndexVector &levelIndexVector : addedGridPoints) {
+    BOOST_REQUIRE_EQUAL(receivedPoint->size(), levelIndexVector.size());
+    for (size_t d = 0; d < TEST_DIMENSION; d++) {
+      BOOST_CHECK_EQUAL((*receivedPoint)[d].level, levelIndexVector[d].level);
+      BOOST_CHECK_EQUAL((*receivedPoint)[d].index, levelIndexVector[d].index);
+    }
+    receivedPoint++;
+  }
+
+  // Packets without a frame are not followed by a frame message
+  std::vector<unsigned char> emptyFrame;
+  sendGridUpdatePacket(DELETED_GRID_POINTS_LIST, 0, emptyFrame);
+  MPIMethods::waitForIncomingMessageType(UPDATE_GRID);
+  BOOST_CHECK(refinementResult.deletedGridPointsIndices.empty());
+
+  // Clean up
+  refinementResult.addedGridPoints.clear();
+  learnerInstance->setPendingGridVersion(0, 0);
+}
+
 BOOST_AUTO_TEST_CASE(SendSystemMatrixDecompositionTest) {
+  createInstance();
+
   size_t classIndex = 0;
-  DataMatrix systemMatrix(2, 2, -1.0);
+  DataMatrix systemMatrix(TEST_GRID_SIZE, TEST_GRID_SIZE);
+  for (size_t i = 0; i < systemMatrix.size(); i++) {
+    systemMatrix[i] = -1.0 + 0.5 * static_cast<double>(i);
+  }
 
   MPIMethods::sendSystemMatrixDecomposition(classIndex, systemMatrix, 0);
   BOOST_CHECK(MPIMethods::hasPendingOutgoingRequests());
@@ -202,8 +430,11 @@ BOOST_AUTO_TEST_CASE(SendSystemMatrixDecompositionTest) {
   DataMatrix &installedMatrix = learnerInstance->getDensityFunctions()[classIndex]
                                     .first->getOfflineObject()
                                     .getDecomposedMatrix();
-  BOOST_CHECK(installedMatrix.size() == systemMatrix.size());
-  BOOST_CHECK(installedMatrix[0] == systemMatrix[0]);
+  BOOST_CHECK_EQUAL(installedMatrix.getNrows(), systemMatrix.getNrows());
+  BOOST_CHECK_EQUAL(installedMatrix.getNcols(), systemMatrix.getNcols());
+  for (size_t i = 0; i < systemMatrix.size(); i++) {
+    BOOST_CHECK_EQUAL(installedMatrix[i], systemMatrix[i]);
+  }
 }
 
 BOOST_AUTO_TEST_CASE(MergeAlphaValuesTest) {
@@ -212,46 +443,46 @@ BOOST_AUTO_TEST_CASE(MergeAlphaValuesTest) {
   BOOST_REQUIRE(MPIMethods::isMaster());
   BOOST_REQUIRE(MPIMethods::getWorldSize() == 1);
 
-  // Test for correct message current version
+  // Test for correct message current version, the alpha vector is added to the local one
   learnerInstance->setLocalGridVersion(0, 10);
-  sendMergeGridPacket(1, 50, 10, 0, 31, 0, 3);
+  DataVector &localAlpha = learnerInstance->getAlpha(0);
+  BOOST_REQUIRE_EQUAL(localAlpha.size(), TEST_GRID_SIZE);
+  DataVector expectedAlpha(localAlpha);
+  DataVector remoteAlpha = createAlphaVector(TEST_GRID_SIZE, 1.0);
+  expectedAlpha.add(remoteAlpha);
+  sendMergeGridPacket(1, 50, 10, 0, remoteAlpha);
 
   MPIMethods::waitForIncomingMessageType(MERGE_GRID);
+  for (size_t i = 0; i < TEST_GRID_SIZE; i++) {
+    BOOST_CHECK_EQUAL(localAlpha[i], expectedAlpha[i]);
+  }
 
   // Test for correct message last version, no ref data
   learnerInstance->setLocalGridVersion(0, 11);
-  sendMergeGridPacket(1, 50, 10, 0, 31, 0, 3);
+  sendMergeGridPacket(1, 50, 10, 0, remoteAlpha);
 
   BOOST_CHECK_THROW(MPIMethods::waitForIncomingMessageType(MERGE_GRID),
                     sgpp::base::algorithm_exception);
-  // Clean up
+  // Clean up, the packet is processed again with the frame that was received before
   learnerInstance->setLocalGridVersion(0, 10);
   MPIMethods::processCompletedMPIRequests();
 
-  // Test for correct message last version, with ref data
-  learnerInstance->setLocalGridVersion(0, 11);
-  LevelIndexVector levelIndexVector{};
-  LevelIndexPair levelIndexPair{3, 3};
-  levelIndexVector.emplace_back(levelIndexPair);
-  RefinementResult &refinementResult =
-      learnerInstance->getRefinementHandler().getRefinementResult(0);
-  refinementResult.addedGridPoints.clear();
-  refinementResult.deletedGridPointsIndices.clear();
-  refinementResult.addedGridPoints.emplace_back(levelIndexVector);
-  sendMergeGridPacket(1, 50, 10, 0, 30, 0, 3);
-
-  MPIMethods::waitForIncomingMessageType(MERGE_GRID);
-  refinementResult.addedGridPoints.clear();
-
   // Test for correct message version -2 should end in error
   learnerInstance->setLocalGridVersion(0, 12);
-  sendMergeGridPacket(1, 50, 10, 0, 31, 0, 3);
+  sendMergeGridPacket(1, 50, 10, 0, remoteAlpha);
 
   BOOST_CHECK_THROW(MPIMethods::waitForIncomingMessageType(MERGE_GRID),
                     sgpp::base::algorithm_exception);
   // Clean up
   learnerInstance->setLocalGridVersion(0, 10);
   MPIMethods::processCompletedMPIRequests();
+
+  // Both requests have been merged during the clean up
+  expectedAlpha.add(remoteAlpha);
+  expectedAlpha.add(remoteAlpha);
+  for (size_t i = 0; i < TEST_GRID_SIZE; i++) {
+    BOOST_CHECK_EQUAL(localAlpha[i], expectedAlpha[i]);
+  }
 }
 
 BOOST_AUTO_TEST_CASE(MPIRequestPool_Test) {
@@ -113,6 +113,108 @@ struct FixtureDataMatrixDistributed {
     }
   }
 
+  /**
+   * @returns symmetric positive definite test matrix of size n x n
+   */
+  static DataMatrix createSPDMatrix(size_t n) {
+    DataMatrix a(n, n);
+
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        a.set(i, j, 1.0 / (1.0 + std::abs(static_cast<double>(i) - static_cast<double>(j))));
+      }
+      a.set(i, i, a.get(i, i) + static_cast<double>(n));
+    }
+
+    return a;
+  }
+
+  /**
+   * @returns lower triangular cholesky factor of a, reference implementation
+   */
+  static DataMatrix choleskyFactor(const DataMatrix& a) {
+    size_t n = a.getNrows();
+    DataMatrix l(n, n, 0.0);
+
+    for (size_t j = 0; j < n; j++) {
+      double diagonal = a.get(j, j);
+      for (size_t k = 0; k < j; k++) {
+        diagonal -= l.get(j, k) * l.get(j, k);
+      }
+      l.set(j, j, std::sqrt(diagonal));
+
+      for (size_t i = j + 1; i < n; i++) {
+        double value = a.get(i, j);
+        for (size_t k = 0; k < j; k++) {
+          value -= l.get(i, k) * l.get(j, k);
+        }
+        l.set(i, j, value / l.get(j, j));
+      }
+    }
+
+    return l;
+  }
+
+  /**
+   * Checks the distributed cholesky modifications against refactorizations of the modified
+   * matrices.
+   */
+  static void checkCholeskyModifications(std::shared_ptr<BlacsProcessGrid> grid) {
+    size_t n = 9;
+    size_t blockSize = 2;
+    DataMatrix a = createSPDMatrix(n);
+    DataMatrix l = choleskyFactor(a);
+
+    // diagonal update
+    DataMatrixDistributed lDistributed =
+        DataMatrixDistributed::fromSharedData(l.data(), grid, n, n, blockSize, blockSize);
+    DataMatrix shifted(a);
+    for (size_t i = 0; i < n; i++) {
+      shifted.set(i, i, shifted.get(i, i) + 0.5);
+    }
+
+    DataMatrixDistributed::choleskyUpdateDiagonal(lDistributed, 0.5);
+    assertMatrixClose(choleskyFactor(shifted), lDistributed);
+
+    // removing rows and columns
+    std::vector<size_t> removed{3, 6, 7};
+    std::vector<size_t> remaining{0, 1, 2, 4, 5, 8};
+    DataMatrix reduced(remaining.size(), remaining.size());
+    for (size_t i = 0; i < remaining.size(); i++) {
+      for (size_t j = 0; j < remaining.size(); j++) {
+        reduced.set(i, j, a.get(remaining[i], remaining[j]));
+      }
+    }
+
+    lDistributed =
+        DataMatrixDistributed::fromSharedData(l.data(), grid, n, n, blockSize, blockSize);
+    DataMatrixDistributed::choleskyRemoveRowsColumns(lDistributed, removed);
+    assertMatrixClose(choleskyFactor(reduced), lDistributed);
+
+    // appending rows and columns
+    size_t m = 4;
+    DataMatrix extended = createSPDMatrix(n + m);
+    DataMatrix newRows(m, n + m);
+    DataMatrix leading(n, n);
+    for (size_t i = 0; i < n + m; i++) {
+      for (size_t j = 0; j < n + m; j++) {
+        if (i >= n) {
+          newRows.set(i - n, j, extended.get(i, j));
+        } else if (j < n) {
+          leading.set(i, j, extended.get(i, j));
+        }
+      }
+    }
+
+    DataMatrix leadingFactor = choleskyFactor(leading);
+    lDistributed = DataMatrixDistributed::fromSharedData(leadingFactor.data(), grid, n, n,
+                                                         blockSize, blockSize);
+    DataMatrixDistributed newRowsDistributed =
+        DataMatrixDistributed::fromSharedData(newRows.data(), grid, m, n + m, blockSize, blockSize);
+    DataMatrixDistributed::choleskyAddRowsColumns(lDistributed, newRowsDistributed);
+    assertMatrixClose(choleskyFactor(extended), lDistributed);
+  }
+
   int nrows, ncols, N;
   std::shared_ptr<BlacsProcessGrid> localGrid;
   std::shared_ptr<BlacsProcessGrid> processGrid;
@@ -394,6 +496,14 @@ BOOST_AUTO_TEST_CASE(testPgdeadd) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testCholeskyModifications) {
+  checkCholeskyModifications(localGrid);
+
+  if (processGrid) {
+    checkCholeskyModifications(processGrid);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testResize) {
   d_rand.resize(nrows * 2, ncols * 2);
 
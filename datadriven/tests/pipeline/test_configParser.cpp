@@ -406,6 +406,10 @@ BOOST_AUTO_TEST_CASE(testVisualizationParameters) {
   BOOST_CHECK_EQUAL(config.theta, 0.5);
   BOOST_CHECK_EQUAL(config.seed, 150);
   BOOST_CHECK_EQUAL(config.maxNumberIterations, 500);
+  BOOST_CHECK_EQUAL(config.earlyExaggeration, 8);
+  BOOST_CHECK_EQUAL(config.exaggerationIterations, 100);
+  BOOST_CHECK_EQUAL(config.progressInterval, 25);
+  BOOST_CHECK_EQUAL(config.runAsynchronously, false);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
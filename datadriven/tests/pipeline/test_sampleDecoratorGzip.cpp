@@ -9,21 +9,63 @@
 #include <boost/test/unit_test.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/file_exception.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/ArffFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/GzipBlockReader.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/GzipFileSampleDecorator.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
 #include <string>
+#include <vector>
 
 BOOST_AUTO_TEST_SUITE(dataminingGzipSampleDecoratorTest)
 
 using sgpp::datadriven::GzipFileSampleDecorator;
+using sgpp::datadriven::GzipBlockReader;
 using sgpp::datadriven::ArffFileSampleProvider;
+using sgpp::datadriven::CSVFileSampleProvider;
 using sgpp::base::DataMatrix;
 using sgpp::base::DataVector;
 using sgpp::datadriven::Dataset;
 
+namespace {
+/**
+ * Writes the header and the samples i = begin, ..., end - 1 with the values (i, i / 1000, i % 3)
+ * into one gzip member, which is appended to the file.
+ */
+void writeGzipMember(const std::string& fileName, const std::string& header, size_t begin,
+                     size_t end, bool append) {
+  gzFile file = gzopen(fileName.c_str(), append ? "ab" : "wb");
+  std::string content = header;
+
+  for (size_t i = begin; i < end; i++) {
+    content += std::to_string(i) + "," + std::to_string(static_cast<double>(i) / 1000.0) + "," +
+               std::to_string(i % 3) + "\n";
+  }
+
+  gzwrite(file, content.data(), static_cast<unsigned int>(content.size()));
+  gzclose(file);
+}
+
+void checkSamples(Dataset& dataset, size_t begin, size_t end) {
+  BOOST_CHECK_EQUAL(dataset.getNumberInstances(), end - begin);
+  BOOST_CHECK_EQUAL(dataset.getDimension(), 2);
+
+  for (size_t i = begin; i < end; i++) {
+    BOOST_CHECK_EQUAL(dataset.getData().get(i - begin, 0), static_cast<double>(i));
+    BOOST_CHECK_CLOSE(dataset.getData().get(i - begin, 1), static_cast<double>(i) / 1000.0, 1e-4);
+    BOOST_CHECK_EQUAL(dataset.getTargets()[i - begin], static_cast<double>(i % 3));
+  }
+}
+}  // namespace
+
 BOOST_AUTO_TEST_CASE(gzipTestReadFile) {
   double testPoints[10][3] = {{0.307143, 0.130137, 0.050000}, {0.365584, 0.105479, 0.050000},
                               {0.178571, 0.201027, 0.050000}, {0.272078, 0.145548, 0.050000},
@@ -66,5 +108,103 @@ BOOST_AUTO_TEST_CASE(gzipTestReadFile) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(gzipTestBlockReader) {
+  // a file of two members, read in small blocks, has to be split at line breaks only
+  const std::string fileName = "gzipTestBlockReader.csv.gz";
+  writeGzipMember(fileName, "x,y,class\n", 0, 3000, false);
+  writeGzipMember(fileName, "", 3000, 5000, true);
+
+  GzipBlockReader reader(fileName, 1000, 2);
+  GzipBlockReader::Block block;
+  std::string content;
+  size_t numBlocks = 0;
+  size_t numLines = 0;
+
+  while (reader.next(block)) {
+    BOOST_CHECK_EQUAL(block.index, numBlocks);
+    BOOST_CHECK_EQUAL(block.firstLine, numLines);
+    BOOST_CHECK_EQUAL(block.text.back(), '\n');
+    numLines += std::count(block.text.begin(), block.text.end(), '\n');
+    content += block.text;
+    numBlocks++;
+  }
+
+  BOOST_CHECK_GT(numBlocks, 10);
+  BOOST_CHECK_EQUAL(numLines, 5001);
+  BOOST_CHECK_EQUAL(content.substr(0, 10), "x,y,class\n");
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(gzipTestReadCSV) {
+  const std::string fileName = "gzipTestReadCSV.csv.gz";
+  writeGzipMember(fileName, "x,y,class\n", 0, 3000, false);
+  writeGzipMember(fileName, "", 3000, 5000, true);
+
+  for (size_t numThreads : {1, 3}) {
+    GzipFileSampleDecorator sampleProvider(new CSVFileSampleProvider(), false, numThreads);
+    sampleProvider.readFile(fileName, true);
+    BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), 5000);
+    std::unique_ptr<Dataset> dataset(sampleProvider.getAllSamples());
+    checkSamples(*dataset, 0, 5000);
+  }
+
+  // cutoff, column and class selection
+  GzipFileSampleDecorator sampleProvider(new CSVFileSampleProvider());
+  sampleProvider.readFile(fileName, true, 100, std::vector<size_t>{1}, std::vector<double>{2.0});
+  std::unique_ptr<Dataset> dataset(sampleProvider.getAllSamples());
+  BOOST_CHECK_EQUAL(dataset->getNumberInstances(), 100);
+  BOOST_CHECK_EQUAL(dataset->getDimension(), 1);
+
+  for (size_t i = 0; i < 100; i++) {
+    BOOST_CHECK_CLOSE(dataset->getData().get(i, 0), static_cast<double>(3 * i + 2) / 1000.0,
+                      1e-4);
+    BOOST_CHECK_EQUAL(dataset->getTargets()[i], 2.0);
+  }
+
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(gzipTestStreamSamples) {
+  const std::string fileName = "gzipTestStreamSamples.arff.gz";
+  writeGzipMember(fileName, "@RELATION test\n@ATTRIBUTE x NUMERIC\n@ATTRIBUTE y NUMERIC\n"
+                  "@ATTRIBUTE class NUMERIC\n% comment\n@DATA\n", 0, 50000, false);
+
+  GzipFileSampleDecorator sampleProvider(new ArffFileSampleProvider(), true, 2);
+  sampleProvider.readFile(fileName, true);
+  BOOST_CHECK_EQUAL(sampleProvider.getDim(), 2);
+
+  // two epochs, the second one after a reset
+  for (size_t epoch = 0; epoch < 2; epoch++) {
+    size_t begin = 0;
+
+    while (true) {
+      std::unique_ptr<Dataset> batch(sampleProvider.getNextSamples(7000));
+
+      if (batch->getNumberInstances() == 0) {
+        break;
+      }
+
+      checkSamples(*batch, begin, begin + batch->getNumberInstances());
+      begin += batch->getNumberInstances();
+      BOOST_CHECK_EQUAL(sampleProvider.getNumSamples(), begin);
+    }
+
+    BOOST_CHECK_EQUAL(begin, 50000);
+    sampleProvider.reset();
+  }
+
+  // stop in the middle of the file
+  std::unique_ptr<Dataset> batch(sampleProvider.getNextSamples(10));
+  checkSamples(*batch, 0, 10);
+  sampleProvider.reset();
+  std::remove(fileName.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(gzipTestMissingFile) {
+  GzipFileSampleDecorator sampleProvider(new ArffFileSampleProvider());
+  BOOST_CHECK_THROW(sampleProvider.readFile("doesNotExist.arff.gz", true),
+                    sgpp::base::file_exception);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 #endif
@@ -39,7 +39,13 @@ struct FilesNamesAndErrorFixture {
       std::tuple<std::string, double>(
           "datadriven/datasets/friedman/friedman1_10d_2000.arff.gz", 1E-26)};
 
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDoubleBoundary = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-17)};
+
   uint32_t level = 5;
+
+  uint32_t levelBoundary = 4;
 };
 }  // namespace TestStreamingMultTransposeFixture
 
@@ -56,6 +62,15 @@ BOOST_AUTO_TEST_CASE(Simple) {
                            level, configuration);
 }
 
+BOOST_AUTO_TEST_CASE(Boundary) {
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration(
+      sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+      sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+
+  compareDatasetsTranspose(fileNamesErrorDoubleBoundary, sgpp::base::GridType::LinearBoundary,
+                           levelBoundary, configuration);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
@@ -0,0 +1,66 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_datadrivenCommon.hpp"
+
+namespace TestStreamingPolyMultFixture {
+struct FilesNamesAndErrorFixture {
+  FilesNamesAndErrorFixture() {}
+  ~FilesNamesAndErrorFixture() {}
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDouble = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-20),
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman1_10d_2000.arff.gz", 1E-15)};
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDoubleBoundary = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-20)};
+
+  uint32_t level = 5;
+
+  uint32_t levelBoundary = 4;
+
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration =
+      sgpp::datadriven::OperationMultipleEvalConfiguration(
+          sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+          sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+};
+}  // namespace TestStreamingPolyMultFixture
+
+BOOST_FIXTURE_TEST_SUITE(TestStreamingPolyMult,
+                         TestStreamingPolyMultFixture::FilesNamesAndErrorFixture)
+
+BOOST_AUTO_TEST_CASE(Poly) {
+  compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::Poly, level, configuration);
+}
+
+BOOST_AUTO_TEST_CASE(ModPoly) {
+  compareDatasets(fileNamesErrorDouble, sgpp::base::GridType::ModPoly, level, configuration);
+}
+
+BOOST_AUTO_TEST_CASE(PolyBoundary) {
+  compareDatasets(fileNamesErrorDoubleBoundary, sgpp::base::GridType::PolyBoundary,
+                  levelBoundary, configuration);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
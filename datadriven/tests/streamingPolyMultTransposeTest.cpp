@@ -0,0 +1,66 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifdef ZLIB
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "test_datadrivenCommon.hpp"
+
+namespace TestStreamingPolyMultTransposeFixture {
+struct FilesNamesAndErrorFixture {
+  FilesNamesAndErrorFixture() {}
+  ~FilesNamesAndErrorFixture() {}
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDouble = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-16),
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman1_10d_2000.arff.gz", 1E-20)};
+
+  std::vector<std::tuple<std::string, double>> fileNamesErrorDoubleBoundary = {
+      std::tuple<std::string, double>(
+          "datadriven/datasets/friedman/friedman2_4d_10000.arff.gz", 1E-16)};
+
+  uint32_t level = 5;
+
+  uint32_t levelBoundary = 4;
+
+  sgpp::datadriven::OperationMultipleEvalConfiguration configuration =
+      sgpp::datadriven::OperationMultipleEvalConfiguration(
+          sgpp::datadriven::OperationMultipleEvalType::STREAMING,
+          sgpp::datadriven::OperationMultipleEvalSubType::DEFAULT);
+};
+}  // namespace TestStreamingPolyMultTransposeFixture
+
+BOOST_FIXTURE_TEST_SUITE(TestStreamingPolyMultTranspose,
+                         TestStreamingPolyMultTransposeFixture::FilesNamesAndErrorFixture)
+
+BOOST_AUTO_TEST_CASE(Poly) {
+  compareDatasetsTranspose(fileNamesErrorDouble, sgpp::base::GridType::Poly, level, configuration);
+}
+
+BOOST_AUTO_TEST_CASE(ModPoly) {
+  compareDatasetsTranspose(fileNamesErrorDouble, sgpp::base::GridType::ModPoly, level, configuration);
+}
+
+BOOST_AUTO_TEST_CASE(PolyBoundary) {
+  compareDatasetsTranspose(fileNamesErrorDoubleBoundary, sgpp::base::GridType::PolyBoundary,
+                           levelBoundary, configuration);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif
@@ -4,17 +4,17 @@
 // sgpp.sparsegrids.org
 
 #ifdef ZLIB
-#if USE_OCL == 1
-#ifdef __AVX__
 
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/base/exception/operation_exception.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
 #include <sgpp/base/tools/ConfigurationParameters.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultipleEvalSubspace/combined/OperationMultipleEvalSubspaceCombined.hpp>
 #include <sgpp/datadriven/tools/ARFFTools.hpp>
 #include <sgpp/globaldef.hpp>
 
@@ -22,6 +22,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <random>
 #include <string>
 #include <tuple>
@@ -57,8 +58,53 @@ BOOST_AUTO_TEST_CASE(Simple) {
                   configuration);
 }
 
+BOOST_AUTO_TEST_CASE(KernelVariants) {
+  // all kernel variants supported by the CPU have to agree with the portable one
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(4));
+  grid->getGenerator().regular(level);
+
+  std::mt19937 mt(42);
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  sgpp::base::DataMatrix dataset(1000, 4);
+
+  for (size_t i = 0; i < dataset.getNrows(); i++) {
+    for (size_t d = 0; d < dataset.getNcols(); d++) {
+      dataset.set(i, d, dist(mt));
+    }
+  }
+
+  sgpp::base::DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = dist(mt);
+  }
+
+  sgpp::base::DataVector resultReference(dataset.getNrows());
+  sgpp::datadriven::OperationMultipleEvalSubspaceCombined opReference(
+      *grid, dataset, sgpp::datadriven::SubspaceKernelVariant::SCALAR);
+  opReference.mult(alpha, resultReference);
+
+  for (auto variant : {sgpp::datadriven::SubspaceKernelVariant::AVX2,
+                       sgpp::datadriven::SubspaceKernelVariant::AVX512}) {
+    if (!sgpp::datadriven::OperationMultipleEvalSubspaceCombinedKernels::isSupported(variant)) {
+      BOOST_CHECK_THROW(sgpp::datadriven::OperationMultipleEvalSubspaceCombined(*grid, dataset,
+                                                                                 variant),
+                        sgpp::base::operation_exception);
+      continue;
+    }
+
+    sgpp::datadriven::OperationMultipleEvalSubspaceCombined op(*grid, dataset, variant);
+    BOOST_CHECK(op.getKernelVariant() == variant);
+
+    sgpp::base::DataVector result(dataset.getNrows());
+    op.mult(alpha, result);
+
+    for (size_t i = 0; i < result.getSize(); i++) {
+      BOOST_CHECK_CLOSE(result[i], resultReference[i], 1e-10);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
-#endif
-#endif
@@ -0,0 +1,168 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/operation/hash/OperationHierarchisation.hpp>
+#include <sgpp/base/tools/RandomNumberGenerator.hpp>
+#include <sgpp/datadriven/DatadrivenOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationDensitySampling.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+
+/**
+ * Interpolates the function on a regular linear grid and draws samples of the resulting
+ * density, the sample mean has to coincide with the mean of the density.
+ */
+void checkSampleMean(size_t dim, double (*func)(DataVector&), size_t numSamples) {
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(4);
+
+  DataVector alpha(grid->getSize());
+  DataVector coords(dim);
+
+  for (size_t i = 0; i < grid->getSize(); i++) {
+    grid->getStorage().getPoint(i).getStandardCoordinates(coords);
+    alpha[i] = func(coords);
+  }
+
+  std::unique_ptr<sgpp::base::OperationHierarchisation>(
+      sgpp::op_factory::createOperationHierarchisation(*grid))
+      ->doHierarchisation(alpha);
+
+  // mean of the density: the normalized basis functions are symmetric around the grid points
+  DataVector mean(dim, 0.0);
+  double integral = 0.0;
+
+  for (size_t i = 0; i < grid->getSize(); i++) {
+    grid->getStorage().getPoint(i).getStandardCoordinates(coords);
+    double weight = alpha[i] * std::pow(2.0, -static_cast<double>(
+                                                   grid->getStorage().getPoint(i).getLevelSum()));
+    integral += weight;
+
+    for (size_t d = 0; d < dim; d++) {
+      mean[d] += weight * coords[d];
+    }
+  }
+
+  mean.mult(1.0 / integral);
+
+  std::unique_ptr<sgpp::datadriven::OperationDensitySampling> opSampling(
+      sgpp::op_factory::createOperationDensitySamplingCDFTable(*grid));
+  std::unique_ptr<sgpp::base::OperationEval> opEval(
+      sgpp::op_factory::createOperationEval(*grid));
+
+  sgpp::base::RandomNumberGenerator::getInstance().setSeed(42);
+  DataMatrix* samples = nullptr;
+  opSampling->doSampling(&alpha, samples, numSamples);
+  BOOST_REQUIRE(samples != nullptr);
+  BOOST_CHECK_EQUAL(samples->getNrows(), numSamples);
+  BOOST_CHECK_EQUAL(samples->getNcols(), dim);
+
+  DataVector sampleMean(dim, 0.0);
+  DataVector sample(dim);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    samples->getRow(i, sample);
+    sampleMean.add(sample);
+
+    for (size_t d = 0; d < dim; d++) {
+      BOOST_CHECK(sample[d] >= 0.0 && sample[d] <= 1.0);
+    }
+
+    BOOST_CHECK(opEval->eval(alpha, sample) > 0.0);
+  }
+
+  sampleMean.mult(1.0 / static_cast<double>(numSamples));
+
+  for (size_t d = 0; d < dim; d++) {
+    BOOST_CHECK_SMALL(sampleMean[d] - mean[d], 5e-3);
+  }
+
+  // the samples are reproducible with the seed of the random number generator,
+  // by default the dimensions are drawn starting with the first one
+  sgpp::base::RandomNumberGenerator::getInstance().setSeed(42);
+  DataMatrix* samplesReproduced = nullptr;
+  opSampling->doSampling(&alpha, samplesReproduced, numSamples, 0);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      BOOST_CHECK_EQUAL(samples->get(i, d), samplesReproduced->get(i, d));
+    }
+  }
+
+  // another starting dimension changes the order of the draws, but not the distribution
+  sgpp::base::RandomNumberGenerator::getInstance().setSeed(42);
+  DataMatrix* samplesLastDim = nullptr;
+  opSampling->doSampling(&alpha, samplesLastDim, numSamples, dim - 1);
+  BOOST_REQUIRE(samplesLastDim != nullptr);
+  sampleMean.setAll(0.0);
+
+  for (size_t i = 0; i < numSamples; i++) {
+    samplesLastDim->getRow(i, sample);
+    sampleMean.add(sample);
+  }
+
+  sampleMean.mult(1.0 / static_cast<double>(numSamples));
+
+  for (size_t d = 0; d < dim; d++) {
+    BOOST_CHECK_SMALL(sampleMean[d] - mean[d], 5e-3);
+  }
+
+  DataMatrix* samplesInvalid = nullptr;
+  BOOST_CHECK_THROW(opSampling->doSampling(&alpha, samplesInvalid, numSamples, dim),
+                    sgpp::base::operation_exception);
+
+  delete samples;
+  delete samplesReproduced;
+  delete samplesLastDim;
+}
+
+double skewedParabola(DataVector& input) {
+  double result = 1.0;
+
+  for (size_t d = 0; d < input.getSize(); d++) {
+    result *= 4.0 * input[d] * (1.0 - input[d]) * (1.0 + input[d]);
+  }
+
+  return result;
+}
+
+double convexFunction(DataVector& input) {
+  double result = 1.0;
+
+  for (size_t d = 0; d < input.getSize(); d++) {
+    result *= 0.2 + input[d] * input[d];
+  }
+
+  return result;
+}
+
+BOOST_AUTO_TEST_SUITE(testDensitySampling)
+
+BOOST_AUTO_TEST_CASE(testDensitySamplingCDFTablePositiveSurpluses) {
+  checkSampleMean(1, &skewedParabola, 100000);
+  checkSampleMean(3, &skewedParabola, 100000);
+}
+
+BOOST_AUTO_TEST_CASE(testDensitySamplingCDFTableNegativeSurpluses) {
+  // convex functions have negative surpluses, the samples are drawn by rejection
+  checkSampleMean(2, &convexFunction, 20000);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,193 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+// MPI is initialized by the global BLACS fixture of the ScaLAPACK tests
+#if defined(USE_MPI) && defined(USE_SCALAPACK)
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
+#include <sgpp/datadriven/operation/hash/OperationMultiEvalMPI/OperationMultiEvalMPI.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMultipleEval;
+using sgpp::datadriven::OperationMultiEvalMPI;
+using sgpp::datadriven::OperationMultipleEvalSubType;
+using sgpp::datadriven::OperationMultipleEvalType;
+
+namespace TestOperationMultiEvalMPIFixture {
+/*
+ * Compares the pipelined MPI operation with the single-process operation.
+ * All ranks use the same seed, hence they share the dataset and the coefficients.
+ */
+void comparePipelinedToSingleProcess(size_t dim, size_t level, size_t numberOfPoints,
+                                     size_t chunksPerRank, size_t numberOfCalls) {
+  int size;
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+  std::normal_distribution<double> normalDistribution(0.0, 1.0);
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(level);
+  const size_t gridSize = grid->getSize();
+
+  DataMatrix dataset(numberOfPoints, dim);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, uniformDistribution(generator));
+    }
+  }
+
+  std::unique_ptr<OperationMultipleEval> opReference(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+  OperationMultiEvalMPI opMPI(*grid, dataset, OperationMultipleEvalType::STREAMING,
+                              OperationMultipleEvalSubType::DEFAULT, false, true, chunksPerRank);
+
+  DataVector alpha(gridSize);
+  DataVector source(numberOfPoints);
+
+  // the shares of the ranks are rebalanced after every call, the results must not change
+  for (size_t call = 0; call < numberOfCalls; call++) {
+    for (size_t i = 0; i < gridSize; i++) {
+      alpha[i] = normalDistribution(generator);
+    }
+
+    for (size_t i = 0; i < numberOfPoints; i++) {
+      source[i] = normalDistribution(generator);
+    }
+
+    DataVector result(numberOfPoints);
+    DataVector resultReference(numberOfPoints);
+    opMPI.mult(alpha, result);
+    opReference->mult(alpha, resultReference);
+
+    for (size_t i = 0; i < numberOfPoints; i++) {
+      BOOST_CHECK_SMALL(result[i] - resultReference[i],
+                        1e-10 * std::max(std::abs(resultReference[i]), 1.0));
+    }
+
+    DataVector resultTranspose(gridSize);
+    DataVector resultTransposeReference(gridSize);
+    opMPI.multTranspose(source, resultTranspose);
+    opReference->multTranspose(source, resultTransposeReference);
+
+    BOOST_CHECK_EQUAL(resultTranspose.getSize(), gridSize);
+
+    for (size_t i = 0; i < gridSize; i++) {
+      BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeReference[i],
+                        1e-10 * std::max(std::abs(resultTransposeReference[i]), 1.0));
+    }
+
+    // the rebalanced shares stay a partition of the dataset
+    const std::vector<double>& rankWeights = opMPI.getRankWeights();
+    BOOST_CHECK_EQUAL(rankWeights.size(), static_cast<size_t>(size));
+
+    double weightSum = 0.0;
+
+    for (double weight : rankWeights) {
+      BOOST_CHECK_GT(weight, 0.0);
+      weightSum += weight;
+    }
+
+    BOOST_CHECK_CLOSE(weightSum, 1.0, 1e-10);
+  }
+}
+}  // namespace TestOperationMultiEvalMPIFixture
+
+BOOST_AUTO_TEST_SUITE(testOperationMultiEvalMPI)
+
+BOOST_AUTO_TEST_CASE(multPipelined) {
+  // the number of rows is not divisible by the number of chunks
+  TestOperationMultiEvalMPIFixture::comparePipelinedToSingleProcess(3, 4, 1013, 3, 3);
+}
+
+BOOST_AUTO_TEST_CASE(multPipelinedFewRows) {
+  // some ranks and chunks do not get any rows
+  TestOperationMultiEvalMPIFixture::comparePipelinedToSingleProcess(2, 3, 5, 4, 2);
+}
+
+BOOST_AUTO_TEST_CASE(multPipelinedAfterRefinement) {
+  // the cached chunk operations have to be recreated by prepare() after the grid was refined
+  const size_t dim = 2;
+  const size_t numberOfPoints = 301;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> uniformDistribution(0.0, 1.0);
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+  grid->getGenerator().regular(3);
+
+  DataMatrix dataset(numberOfPoints, dim);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      dataset.set(i, d, uniformDistribution(generator));
+    }
+  }
+
+  OperationMultiEvalMPI opMPI(*grid, dataset, OperationMultipleEvalType::STREAMING,
+                              OperationMultipleEvalSubType::DEFAULT, false, true, 2);
+
+  DataVector alpha(grid->getSize(), 1.0);
+  DataVector result(numberOfPoints);
+  opMPI.mult(alpha, result);
+
+  sgpp::base::SurplusRefinementFunctor functor(alpha, 4);
+  grid->getGenerator().refine(functor);
+  opMPI.prepare();
+
+  const size_t gridSize = grid->getSize();
+  alpha.resize(gridSize);
+
+  for (size_t i = 0; i < gridSize; i++) {
+    alpha[i] = uniformDistribution(generator);
+  }
+
+  std::unique_ptr<OperationMultipleEval> opReference(
+      sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+  DataVector resultReference(numberOfPoints);
+  opMPI.mult(alpha, result);
+  opReference->mult(alpha, resultReference);
+
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    BOOST_CHECK_SMALL(result[i] - resultReference[i],
+                      1e-10 * std::max(std::abs(resultReference[i]), 1.0));
+  }
+
+  DataVector source(numberOfPoints, 1.0);
+  DataVector resultTranspose(gridSize);
+  DataVector resultTransposeReference(gridSize);
+  opMPI.multTranspose(source, resultTranspose);
+  opReference->multTranspose(source, resultTransposeReference);
+
+  for (size_t i = 0; i < gridSize; i++) {
+    BOOST_CHECK_SMALL(resultTranspose[i] - resultTransposeReference[i],
+                      1e-10 * std::max(std::abs(resultTransposeReference[i]), 1.0));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* defined(USE_MPI) && defined(USE_SCALAPACK) */
@@ -17,7 +17,11 @@
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/optimization/operation/OptimizationOpFactory.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationLinear.hpp>
+#include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationLinearBatched.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 
+#include <memory>
 #include <vector>
 #include <random>
 #include <iostream>
@@ -242,6 +246,56 @@ BOOST_AUTO_TEST_CASE(testRosenblattLinearDD) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testInverseRosenblattLinearBatched) {
+  // the batched transformation has to coincide with the transformation that constructs
+  // the conditioned and marginalized grids for every sample
+  size_t numSamples = 50;
+
+  for (size_t dim = 2; dim < 5; dim++) {
+    std::unique_ptr<Grid> grid(Grid::createLinearGrid(dim));
+    DataVector alpha;
+    hierarchize(grid.get(), 3, alpha, &parabola);
+
+    // asymmetric density on an adaptive grid
+    for (size_t i = 0; i < alpha.getSize(); i++) {
+      alpha[i] *= 1. + 0.5 * static_cast<double>(i % 3);
+    }
+
+    sgpp::base::SurplusRefinementFunctor functor(alpha, 3);
+    grid->getGenerator().refine(functor);
+    alpha.resizeZero(grid->getSize());
+
+    DataMatrix u_vars(numSamples, dim);
+    randu(u_vars);
+
+    sgpp::datadriven::OperationInverseRosenblattTransformationLinear opReference(grid.get());
+    sgpp::datadriven::OperationInverseRosenblattTransformationLinearBatched opBatched(grid.get());
+
+    DataMatrix x_reference(numSamples, dim);
+    DataMatrix x_batched(numSamples, dim);
+
+    opReference.doTransformation(&alpha, &u_vars, &x_reference);
+    opBatched.doTransformation(&alpha, &u_vars, &x_batched);
+
+    for (size_t i = 0; i < numSamples; i++) {
+      for (size_t d = 0; d < dim; d++) {
+        BOOST_CHECK_SMALL(x_reference.get(i, d) - x_batched.get(i, d), 1e-10);
+      }
+    }
+
+    for (size_t dimStart = 0; dimStart < dim; dimStart++) {
+      opReference.doTransformation(&alpha, &u_vars, &x_reference, dimStart);
+      opBatched.doTransformation(&alpha, &u_vars, &x_batched, dimStart);
+
+      for (size_t i = 0; i < numSamples; i++) {
+        for (size_t d = 0; d < dim; d++) {
+          BOOST_CHECK_SMALL(x_reference.get(i, d) - x_batched.get(i, d), 1e-10);
+        }
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testRosenblattPoly1D) {
   Grid* grid = Grid::createPolyGrid(1, 3);
   DataVector alpha(20);
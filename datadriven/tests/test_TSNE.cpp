@@ -0,0 +1,76 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/datadriven/datamining/modules/visualization/algorithms/bhtsne/tsne.hpp>
+
+#include <omp.h>
+
+#include <cmath>
+#include <memory>
+#include <random>
+
+using sgpp::datadriven::TSNE;
+
+namespace {
+/**
+ * Runs tsne on two well separated clusters and returns the ratio of the distance between the
+ * centers of the embedded clusters to the mean distance of the embedded points to their center.
+ */
+double separationOfClusters(int numThreads, double exaggeration, size_t stopLyingIter,
+                            size_t& numCheckpoints) {
+  const size_t N = 300;
+  const size_t D = 5;
+  std::mt19937 generator(7);
+  std::normal_distribution<double> normal(0.0, 0.05);
+
+  std::unique_ptr<double[]> X(new double[N * D]);
+  for (size_t n = 0; n < N; n++) {
+    double center = (n % 2 == 0) ? 0.25 : 0.75;
+    for (size_t d = 0; d < D; d++) {
+      X[n * D + d] = center + normal(generator);
+    }
+  }
+  std::unique_ptr<double[]> Y(new double[N * 2]);
+
+  omp_set_num_threads(numThreads);
+  TSNE tsne;
+  tsne.run(X, N, D, Y, 2, 20.0, 0.5, 42, false, 300, 250, exaggeration, stopLyingIter, 50);
+  numCheckpoints = tsne.getCheckpoints().size();
+
+  double centers[2][2] = {{0.0, 0.0}, {0.0, 0.0}};
+  for (size_t n = 0; n < N; n++) {
+    centers[n % 2][0] += Y[n * 2] / static_cast<double>(N / 2);
+    centers[n % 2][1] += Y[n * 2 + 1] / static_cast<double>(N / 2);
+  }
+
+  double spread = 0.0;
+  for (size_t n = 0; n < N; n++) {
+    spread += std::hypot(Y[n * 2] - centers[n % 2][0], Y[n * 2 + 1] - centers[n % 2][1]) /
+              static_cast<double>(N);
+  }
+
+  return std::hypot(centers[0][0] - centers[1][0], centers[0][1] - centers[1][1]) / spread;
+}
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestTSNE)
+
+BOOST_AUTO_TEST_CASE(testSeparatesClusters) {
+  size_t numCheckpoints = 0;
+  BOOST_CHECK_GT(separationOfClusters(1, 1.0, 0, numCheckpoints), 2.0);
+  // iterations 50, 100, ..., 250 and the last one
+  BOOST_CHECK_EQUAL(numCheckpoints, 6);
+}
+
+BOOST_AUTO_TEST_CASE(testParallelEarlyExaggeration) {
+  size_t numCheckpoints = 0;
+  BOOST_CHECK_GT(separationOfClusters(4, 12.0, 100, numCheckpoints), 2.0);
+  BOOST_CHECK_EQUAL(numCheckpoints, 6);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -238,6 +238,18 @@ double compareToReference(
   } else if (gridType == sgpp::base::GridType::ModLinear) {
     grid = std::shared_ptr<sgpp::base::Grid>(
         sgpp::base::Grid::createModLinearGrid(dim));
+  } else if (gridType == sgpp::base::GridType::LinearBoundary) {
+    grid = std::shared_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createLinearBoundaryGrid(dim));
+  } else if (gridType == sgpp::base::GridType::Poly) {
+    grid = std::shared_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createPolyGrid(dim, 3));
+  } else if (gridType == sgpp::base::GridType::ModPoly) {
+    grid = std::shared_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createModPolyGrid(dim, 3));
+  } else if (gridType == sgpp::base::GridType::PolyBoundary) {
+    grid = std::shared_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createPolyBoundaryGrid(dim, 3));
   }
 
   sgpp::base::GridStorage& gridStorage = grid->getStorage();
@@ -320,6 +332,18 @@ double compareToReferenceTranspose(
   } else if (gridType == sgpp::base::GridType::ModLinear) {
     grid = std::shared_ptr<sgpp::base::Grid>(
         sgpp::base::Grid::createModLinearGrid(dim));
+  } else if (gridType == sgpp::base::GridType::LinearBoundary) {
+    grid = std::shared_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createLinearBoundaryGrid(dim));
+  } else if (gridType == sgpp::base::GridType::Poly) {
+    grid = std::shared_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createPolyGrid(dim, 3));
+  } else if (gridType == sgpp::base::GridType::ModPoly) {
+    grid = std::shared_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createModPolyGrid(dim, 3));
+  } else if (gridType == sgpp::base::GridType::PolyBoundary) {
+    grid = std::shared_ptr<sgpp::base::Grid>(
+        sgpp::base::Grid::createPolyBoundaryGrid(dim, 3));
   }
 
   sgpp::base::GridStorage& gridStorage = grid->getStorage();
@@ -10,6 +10,10 @@
 #include <boost/test/unit_test_suite.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 #include <sgpp/datadriven/datamining/builder/DensityEstimationMinerFactory.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
@@ -23,14 +27,24 @@
 #include <fstream>
 #include <iostream>
 #include <random>
+#include <memory>
 #include <string>
+#include <vector>
 
+using sgpp::base::data_exception;
+using sgpp::base::DataMatrix;
+using sgpp::base::Grid;
+using sgpp::base::SurplusRefinementFunctor;
 using sgpp::datadriven::BlacsProcessGrid;
 using sgpp::datadriven::CSVFileSampleProvider;
 using sgpp::datadriven::DataVector;
+using sgpp::datadriven::DBMatOfflineChol;
+using sgpp::datadriven::DensityEstimationConfiguration;
 using sgpp::datadriven::DensityEstimationMinerFactory;
 using sgpp::datadriven::ModelFittingBase;
 using sgpp::datadriven::ModelFittingDensityEstimationOnOffParallel;
+using sgpp::datadriven::ParallelConfiguration;
+using sgpp::datadriven::RegularizationConfiguration;
 using sgpp::datadriven::SparseGridMiner;
 
 // adapted sgde test for ScaLAPACK version
@@ -250,6 +264,55 @@ BOOST_AUTO_TEST_CASE(Test_3D_KurB4B1Parallel) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(Test_CholeskyModificationParallelLocalSync) {
+  auto processGrid = std::make_shared<BlacsProcessGrid>();
+  ParallelConfiguration parallelConfig;
+  parallelConfig.rowBlockSize_ = 2;
+  parallelConfig.columnBlockSize_ = 2;
+  RegularizationConfiguration regularizationConfig;
+  regularizationConfig.lambda_ = 0.1;
+  DensityEstimationConfiguration densityEstimationConfig;
+
+  std::unique_ptr<Grid> grid(Grid::createLinearGrid(2));
+  grid->getGenerator().regular(3);
+
+  DBMatOfflineChol offline;
+  offline.buildMatrix(grid.get(), regularizationConfig);
+  offline.decomposeMatrixParallel(regularizationConfig, densityEstimationConfig, processGrid,
+                                  parallelConfig);
+
+  // refine and update the distributed factorization only
+  size_t oldSize = grid->getSize();
+  DataVector alpha(oldSize, 1.0);
+  SurplusRefinementFunctor functor(alpha, 3);
+  grid->getGenerator().refine(functor);
+  size_t newPoints = grid->getSize() - oldSize;
+  std::vector<size_t> deletedPoints;
+  offline.choleskyModificationParallel(*grid, densityEstimationConfig, newPoints, deletedPoints,
+                                       regularizationConfig.lambda_, processGrid, parallelConfig);
+
+  BOOST_CHECK_THROW(offline.getDecomposedMatrix(), data_exception);
+  BOOST_CHECK_EQUAL(offline.getGridSize(), grid->getSize());
+
+  offline.syncLocalDecomposition();
+  DataMatrix& synced = offline.getDecomposedMatrix();
+
+  // compare with a factorization of the refined system
+  DBMatOfflineChol reference;
+  reference.buildMatrix(grid.get(), regularizationConfig);
+  reference.decomposeMatrixParallel(regularizationConfig, densityEstimationConfig, processGrid,
+                                    parallelConfig);
+  DataMatrix& expected = reference.getDecomposedMatrix();
+
+  BOOST_CHECK_EQUAL(synced.getNrows(), expected.getNrows());
+  BOOST_CHECK_EQUAL(synced.getNcols(), expected.getNcols());
+  for (size_t i = 0; i < expected.getNrows(); i++) {
+    for (size_t j = 0; j <= i; j++) {
+      BOOST_CHECK_SMALL(synced.get(i, j) - expected.get(i, j), 1e-10);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif /* USE_SCALAPACK */
@@ -0,0 +1,201 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE SGppOptimizationBenchmarks
+#include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/function/scalar/InterpolantScalarFunction.hpp>
+#include <sgpp/base/function/scalar/InterpolantScalarFunctionGradient.hpp>
+#include <sgpp/base/grid/type/ModBsplineGrid.hpp>
+#include <sgpp/base/tools/BenchmarkRunner.hpp>
+#include <sgpp/base/tools/Printer.hpp>
+#include <sgpp/base/tools/RandomNumberGenerator.hpp>
+#include <sgpp/base/tools/sle/solver/Auto.hpp>
+#include <sgpp/base/tools/sle/system/HierarchisationSLE.hpp>
+#include <sgpp/optimization/gridgen/IterativeGridGenerator.hpp>
+#include <sgpp/optimization/gridgen/IterativeGridGeneratorLinearSurplus.hpp>
+#include <sgpp/optimization/gridgen/IterativeGridGeneratorRitterNovak.hpp>
+#include <sgpp/optimization/optimizer/unconstrained/BFGS.hpp>
+#include <sgpp/optimization/optimizer/unconstrained/GradientDescent.hpp>
+#include <sgpp/optimization/optimizer/unconstrained/NelderMead.hpp>
+#include <sgpp/optimization/optimizer/unconstrained/UnconstrainedOptimizer.hpp>
+#include <sgpp/optimization/test_problems/unconstrained/Rosenbrock.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::base::BenchmarkRunner;
+using sgpp::base::DataVector;
+using sgpp::base::ModBsplineGrid;
+using sgpp::optimization::IterativeGridGenerator;
+using sgpp::optimization::test_problems::Rosenbrock;
+
+namespace {
+
+BenchmarkRunner& getBenchmarkRunner() {
+  static BenchmarkRunner runner;
+  return runner;
+}
+
+/// B-spline degree of the grids
+const size_t DEGREE = 3;
+/// number of grid points generated by the iterative grid generators
+const size_t NUMBER_OF_GRID_POINTS = 200;
+
+std::vector<size_t> getBenchmarkDimensions() { return std::vector<size_t>{2, 4, 8}; }
+
+/**
+ * @return iterative grid generator of the given type ("ritterNovak" or "linearSurplus")
+ */
+std::unique_ptr<IterativeGridGenerator> createGridGenerator(const std::string& type,
+                                                            sgpp::base::ScalarFunction& f,
+                                                            sgpp::base::Grid& grid) {
+  if (type == "ritterNovak") {
+    return std::unique_ptr<IterativeGridGenerator>(
+        new sgpp::optimization::IterativeGridGeneratorRitterNovak(f, grid,
+                                                                  NUMBER_OF_GRID_POINTS));
+  } else {
+    return std::unique_ptr<IterativeGridGenerator>(
+        new sgpp::optimization::IterativeGridGeneratorLinearSurplus(f, grid,
+                                                                    NUMBER_OF_GRID_POINTS));
+  }
+}
+
+}  // namespace
+
+/**
+ * Silences the output of the optimization module, reads the settings from the environment at
+ * the start and writes the results to benchmarks_optimization.json in the directory given by
+ * SGPP_BENCHMARK_OUTPUT_DIR (default: working directory) at the end.
+ */
+struct BenchmarkFixture {
+  BenchmarkFixture() {
+    sgpp::base::Printer::getInstance().setVerbosity(-1);
+    getBenchmarkRunner().configureFromEnvironment();
+  }
+
+  ~BenchmarkFixture() {
+    const char* outputDirectory = std::getenv("SGPP_BENCHMARK_OUTPUT_DIR");
+    getBenchmarkRunner().writeJSON(
+        ((outputDirectory != nullptr) ? std::string(outputDirectory) + "/" : std::string()) +
+        "benchmarks_optimization.json");
+  }
+};
+
+#if BOOST_VERSION >= 105900
+BOOST_GLOBAL_FIXTURE(BenchmarkFixture);
+#else
+BOOST_GLOBAL_FIXTURE(BenchmarkFixture)
+#endif /* BOOST_VERSION >= 105900 */
+
+BOOST_AUTO_TEST_CASE(benchmarkIterativeGridGeneration) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+
+  for (const std::string type : {"ritterNovak", "linearSurplus"}) {
+    for (size_t d : getBenchmarkDimensions()) {
+      sgpp::base::RandomNumberGenerator::getInstance().setSeed(42);
+      Rosenbrock testProblem(d);
+      testProblem.generateDisplacement();
+      sgpp::base::ScalarFunction& f = testProblem.getObjectiveFunction();
+      const BenchmarkRunner::Parameters parameters{{"gridGenerator", type},
+                                                   {"gridType", "modBspline"},
+                                                   {"dim", std::to_string(d)},
+                                                   {"gridSize",
+                                                    std::to_string(NUMBER_OF_GRID_POINTS)}};
+
+      for (size_t numberOfThreads : runner.getNumbersOfThreads()) {
+        runner.run("IterativeGridGeneration", parameters, numberOfThreads,
+                   static_cast<double>(NUMBER_OF_GRID_POINTS), [&type, &f, d]() {
+                     ModBsplineGrid grid(d, DEGREE);
+                     std::unique_ptr<IterativeGridGenerator> gridGen =
+                         createGridGenerator(type, f, grid);
+                     BOOST_CHECK(gridGen->generate());
+                   });
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkOptimizers) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+
+  for (size_t d : getBenchmarkDimensions()) {
+    sgpp::base::RandomNumberGenerator::getInstance().setSeed(42);
+    Rosenbrock testProblem(d);
+    testProblem.generateDisplacement();
+    sgpp::base::ScalarFunction& f = testProblem.getObjectiveFunction();
+
+    // B-spline interpolant of the objective function on an adaptively generated grid
+    ModBsplineGrid grid(d, DEGREE);
+    std::unique_ptr<IterativeGridGenerator> gridGen = createGridGenerator("ritterNovak", f, grid);
+    BOOST_REQUIRE(gridGen->generate());
+    DataVector functionValues(gridGen->getFunctionValues());
+    DataVector coefficients(functionValues.getSize());
+    const BenchmarkRunner::Parameters hierarchisationParameters{
+        {"gridType", "modBspline"},
+        {"dim", std::to_string(d)},
+        {"gridSize", std::to_string(grid.getSize())}};
+
+    // the SLE solvers of sgpp::base choose the solver depending on the size of the system
+    runner.run("HierarchisationSLE::solve", hierarchisationParameters, 1,
+               static_cast<double>(grid.getSize()), [&grid, &functionValues, &coefficients]() {
+                 sgpp::base::HierarchisationSLE hierSLE(grid);
+                 sgpp::base::sle_solver::Auto sleSolver;
+                 BOOST_CHECK(sleSolver.solve(hierSLE, functionValues, coefficients));
+               });
+
+    sgpp::base::InterpolantScalarFunction ft(grid, coefficients);
+    sgpp::base::InterpolantScalarFunctionGradient ftGradient(grid, coefficients);
+    std::vector<std::unique_ptr<sgpp::optimization::optimizer::UnconstrainedOptimizer>>
+        optimizers;
+    optimizers.emplace_back(new sgpp::optimization::optimizer::GradientDescent(ft, ftGradient));
+    optimizers.emplace_back(new sgpp::optimization::optimizer::NelderMead(ft));
+    optimizers.emplace_back(new sgpp::optimization::optimizer::BFGS(ft, ftGradient));
+    const std::vector<std::string> optimizerNames = {"gradientDescent", "nelderMead", "bfgs"};
+
+    // start at the grid point with the smallest function value
+    const size_t x0Index = std::distance(
+        functionValues.getPointer(),
+        std::min_element(functionValues.getPointer(),
+                         functionValues.getPointer() + functionValues.getSize()));
+    const DataVector x0 = grid.getStorage().getCoordinates(grid.getStorage()[x0Index]);
+
+    for (size_t i = 0; i < optimizers.size(); i++) {
+      sgpp::optimization::optimizer::UnconstrainedOptimizer& optimizer = *optimizers[i];
+      optimizer.setStartingPoint(x0);
+      BenchmarkRunner::Parameters parameters = hierarchisationParameters;
+      parameters["optimizer"] = optimizerNames[i];
+
+      // one item corresponds to one optimization run on the interpolant
+      runner.run("UnconstrainedOptimizer::optimize", parameters, 1, 1.0, [&optimizer]() {
+        optimizer.optimize();
+        BOOST_CHECK(std::isfinite(optimizer.getOptimalValue()));
+      });
+    }
+  }
+}
+
+// fix for clang (from https://stackoverflow.com/a/33755176)
+#ifdef __clang__
+namespace boost {
+namespace unit_test {
+namespace ut_detail {
+
+std::string normalize_test_case_name(const_string name) {
+    return ((name[0] == '&') ? std::string(name.begin() + 1, name.size() - 1) :
+                               std::string(name.begin(), name.size()));
+}
+
+}  // namespace ut_detail
+}  // namespace unit_test
+}  // namespace boost
+#endif
@@ -5,6 +5,7 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/optimization/fuzzy/FuzzyExtensionPrinciple.hpp>
 #include <sgpp/optimization/fuzzy/InterpolatedFuzzyInterval.hpp>
@@ -74,15 +75,13 @@ FuzzyInterval* FuzzyExtensionPrinciple::apply(
   }
 
   // current optimal points/values
-  std::vector<std::unique_ptr<base::DataVector>> curMinimumPoints;
+  std::vector<base::DataVector> curMinimumPoints(m + 1, base::DataVector(d));
   base::DataVector curMinimumValues(m + 1);
-  std::vector<std::unique_ptr<base::DataVector>> curMaximumPoints;
+  std::vector<base::DataVector> curMaximumPoints(m + 1, base::DataVector(d));
   base::DataVector curMaximumValues(m + 1);
 
-  for (size_t j = 0; j <= m; j++) {
-    curMinimumPoints.emplace_back(new base::DataVector(d));
-    curMaximumPoints.emplace_back(new base::DataVector(d));
-  }
+  optimizeForAllAlphaLevels(curMinimumPoints, curMinimumValues,
+                            curMaximumPoints, curMaximumValues);
 
   // save last optimal min/max value and corresponding argmin/argmax point
   // to make sure that the optimum for a smaller alpha (hence for a larger optimization domain)
@@ -92,6 +91,44 @@ FuzzyInterval* FuzzyExtensionPrinciple::apply(
   base::DataVector lastOptimalPointMin(d);
   base::DataVector lastOptimalPointMax(d);
 
+  // iterate through alphas from 1 to 0
+  for (size_t j = m + 1; j-- > 0;) {
+    // check if optimal value is indeed smaller than the last minimum
+    if (curMinimumValues[j] < lastOptimalValueMin) {
+      xData[j] = curMinimumValues[j];
+      lastOptimalValueMin = curMinimumValues[j];
+      lastOptimalPointMin = curMinimumPoints[j];
+    } else {
+      xData[j] = lastOptimalValueMin;
+    }
+
+    minimumPoints[j] = lastOptimalPointMin;
+    minimumValues[j] = lastOptimalValueMin;
+    alphaData[j] = alphaLevels[j];
+
+    // check if optimal value is indeed larger than the last maximum
+    if (curMaximumValues[j] > lastOptimalValueMax) {
+      xData[2*m+1-j] = curMaximumValues[j];
+      lastOptimalValueMax = curMaximumValues[j];
+      lastOptimalPointMax = curMaximumPoints[j];
+    } else {
+      xData[2*m+1-j] = lastOptimalValueMax;
+    }
+
+    maximumPoints[j] = lastOptimalPointMax;
+    maximumValues[j] = lastOptimalValueMax;
+    alphaData[2*m+1-j] = alphaLevels[j];
+  }
+
+  base::Printer::getInstance().printStatusEnd();
+
+  // interpolate between alpha data points
+  return new InterpolatedFuzzyInterval(xData, alphaData);
+}
+
+void FuzzyExtensionPrinciple::optimizeForAllAlphaLevels(
+    std::vector<base::DataVector>& curMinimumPoints, base::DataVector& curMinimumValues,
+    std::vector<base::DataVector>& curMaximumPoints, base::DataVector& curMaximumValues) {
   const bool statusPrintingEnabled = base::Printer::getInstance().isStatusPrintingEnabled();
 
   if (statusPrintingEnabled) {
@@ -100,8 +137,11 @@ FuzzyInterval* FuzzyExtensionPrinciple::apply(
 
   size_t alphaLevelsDone = 0;
 
+  const size_t numberOfThreads =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(m + 1);
+
 #pragma omp parallel shared(curMinimumPoints, curMinimumValues, \
-    alphaLevelsDone, curMaximumPoints, curMaximumValues)
+    alphaLevelsDone, curMaximumPoints, curMaximumValues) num_threads(numberOfThreads)
   {
     std::unique_ptr<FuzzyExtensionPrinciple> curFuzzyExtensionPrinciple;
     clone(curFuzzyExtensionPrinciple);
@@ -112,8 +152,8 @@ FuzzyInterval* FuzzyExtensionPrinciple::apply(
 #pragma omp for schedule(static)
     for (size_t j = 0; j <= m; j++) {
       curFuzzyExtensionPrinciple->optimizeForSingleAlphaLevel(
-          j, *curMinimumPoints[j], curMinimumValues[j],
-          *curMaximumPoints[j], curMaximumValues[j]);
+          j, curMinimumPoints[j], curMinimumValues[j],
+          curMaximumPoints[j], curMaximumValues[j]);
 
 #pragma omp atomic
       alphaLevelsDone++;
@@ -139,40 +179,6 @@ FuzzyInterval* FuzzyExtensionPrinciple::apply(
 
   base::Printer::getInstance().printStatusUpdate("optimizing (100.0%)");
   base::Printer::getInstance().printStatusNewLine();
-
-  // iterate through alphas from 1 to 0
-  for (size_t j = m + 1; j-- > 0;) {
-    // check if optimal value is indeed smaller than the last minimum
-    if (curMinimumValues[j] < lastOptimalValueMin) {
-      xData[j] = curMinimumValues[j];
-      lastOptimalValueMin = curMinimumValues[j];
-      lastOptimalPointMin = *curMinimumPoints[j];
-    } else {
-      xData[j] = lastOptimalValueMin;
-    }
-
-    minimumPoints[j] = lastOptimalPointMin;
-    minimumValues[j] = lastOptimalValueMin;
-    alphaData[j] = alphaLevels[j];
-
-    // check if optimal value is indeed larger than the last maximum
-    if (curMaximumValues[j] > lastOptimalValueMax) {
-      xData[2*m+1-j] = curMaximumValues[j];
-      lastOptimalValueMax = curMaximumValues[j];
-      lastOptimalPointMax = *curMaximumPoints[j];
-    } else {
-      xData[2*m+1-j] = lastOptimalValueMax;
-    }
-
-    maximumPoints[j] = lastOptimalPointMax;
-    maximumValues[j] = lastOptimalValueMax;
-    alphaData[2*m+1-j] = alphaLevels[j];
-  }
-
-  base::Printer::getInstance().printStatusEnd();
-
-  // interpolate between alpha data points
-  return new InterpolatedFuzzyInterval(xData, alphaData);
 }
 
 size_t FuzzyExtensionPrinciple::getNumberOfAlphaSegments() const {
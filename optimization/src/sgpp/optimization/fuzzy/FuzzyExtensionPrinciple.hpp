@@ -11,6 +11,7 @@
 #include <sgpp/base/function/scalar/ScalarFunction.hpp>
 #include <sgpp/optimization/fuzzy/FuzzyInterval.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace sgpp {
@@ -143,6 +144,24 @@ class FuzzyExtensionPrinciple {
    */
   virtual void prepareApply();
 
+  /**
+   * Solve the minimization/maximization problems for all \f$\alpha\f$ levels.
+   * By default, the \f$\alpha\f$ levels are distributed among the threads, each of which
+   * calls prepareApply() and optimizeForSingleAlphaLevel() on its own clone.
+   * Subclasses can override this method if the work can be distributed in a better way
+   * (e.g., if the problems of different \f$\alpha\f$ levels share function evaluations).
+   *
+   * @param[out]  curMinimumPoints  vector of minimum points
+   *                                (one for each \f$\alpha\f$ level, already correctly sized)
+   * @param[out]  curMinimumValues  vector of minimum function values
+   * @param[out]  curMaximumPoints  vector of maximum points
+   *                                (one for each \f$\alpha\f$ level, already correctly sized)
+   * @param[out]  curMaximumValues  vector of maximum function values
+   */
+  virtual void optimizeForAllAlphaLevels(
+      std::vector<base::DataVector>& curMinimumPoints, base::DataVector& curMinimumValues,
+      std::vector<base::DataVector>& curMaximumPoints, base::DataVector& curMaximumValues);
+
   /**
    * Pure virtual method for solving the minimization/maximization problem
    * for a single \f$\alpha\f$ level.
@@ -5,11 +5,17 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/tools/ExecutionContext.hpp>
+#include <sgpp/base/tools/Printer.hpp>
+#include <sgpp/base/tools/ThreadLocalClones.hpp>
 #include <sgpp/optimization/fuzzy/FuzzyExtensionPrincipleViaVertexMethod.hpp>
 #include <sgpp/optimization/fuzzy/InterpolatedFuzzyInterval.hpp>
 
 #include <algorithm>
 #include <limits>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace sgpp {
@@ -70,6 +76,98 @@ void FuzzyExtensionPrincipleViaVertexMethod::optimizeForSingleAlphaLevel(
   }
 }
 
+void FuzzyExtensionPrincipleViaVertexMethod::optimizeForAllAlphaLevels(
+    std::vector<base::DataVector>& curMinimumPoints, base::DataVector& curMinimumValues,
+    std::vector<base::DataVector>& curMaximumPoints, base::DataVector& curMaximumValues) {
+  prepareApply();
+
+  const size_t d = f->getNumberOfParameters();
+
+  // map from distinct vertices to their row indices in the vertex matrix and
+  // row indices of the vertices of every alpha level (in the same order as in
+  // optimizeForSingleAlphaLevel, such that ties are resolved in the same way)
+  std::map<std::vector<double>, size_t> vertexIndices;
+  std::vector<std::vector<size_t>> alphaLevelVertexIndices(m + 1);
+  std::vector<double> vertex(d);
+
+  for (size_t j = 0; j <= m; j++) {
+    const base::DataVector& lowerBounds = optimizationDomainsLowerBounds[j];
+    const base::DataVector& upperBounds = optimizationDomainsUpperBounds[j];
+    alphaLevelVertexIndices[j].reserve(powersOfTwo[d]);
+
+    for (size_t k = 0; k < powersOfTwo[d]; k++) {
+      for (size_t t = 0; t < d; t++) {
+        vertex[t] = ((k & powersOfTwo[t]) ? lowerBounds[t] : upperBounds[t]);
+      }
+
+      const size_t newIndex = vertexIndices.size();
+      alphaLevelVertexIndices[j].push_back(vertexIndices.emplace(vertex, newIndex).first->second);
+    }
+  }
+
+  const size_t numberOfVertices = vertexIndices.size();
+  base::DataMatrix vertices(numberOfVertices, d);
+
+  for (const auto& entry : vertexIndices) {
+    for (size_t t = 0; t < d; t++) {
+      vertices(entry.second, t) = entry.first[t];
+    }
+  }
+
+  base::Printer::getInstance().printStatusUpdate(
+      "evaluating function at " + std::to_string(numberOfVertices) + " distinct vertices");
+  base::Printer::getInstance().printStatusNewLine();
+
+  // evaluate the function at all vertices, one block of vertices per thread
+  base::DataVector values(numberOfVertices);
+  const size_t numberOfThreads =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(numberOfVertices);
+  base::ThreadLocalClones<base::ScalarFunction> fClones(*f);
+  fClones.reserve(numberOfThreads);
+
+#pragma omp parallel shared(vertices, values, fClones) num_threads(numberOfThreads)
+  {
+    base::ScalarFunction& curF = fClones.get();
+    base::DataVector curValues(0);
+
+#pragma omp for schedule(static)
+    for (size_t b = 0; b < numberOfThreads; b++) {
+      const size_t begin = b * numberOfVertices / numberOfThreads;
+      const size_t end = (b + 1) * numberOfVertices / numberOfThreads;
+      const base::DataMatrix curVertices(vertices.getPointer() + begin * d, end - begin, d);
+
+      curF.eval(curVertices, curValues);
+
+      for (size_t k = begin; k < end; k++) {
+        values[k] = curValues[k - begin];
+      }
+    }
+  }
+
+  // calculate minimum and maximum on all vertices of the interval boxes
+  for (size_t j = 0; j <= m; j++) {
+    curMinimumValues[j] = std::numeric_limits<double>::infinity();
+    curMaximumValues[j] = -std::numeric_limits<double>::infinity();
+
+    for (size_t k : alphaLevelVertexIndices[j]) {
+      const double fx = values[k];
+
+      if (fx < curMinimumValues[j]) {
+        curMinimumValues[j] = fx;
+        vertices.getRow(k, curMinimumPoints[j]);
+      }
+
+      if (fx > curMaximumValues[j]) {
+        curMaximumValues[j] = fx;
+        vertices.getRow(k, curMaximumPoints[j]);
+      }
+    }
+  }
+
+  base::Printer::getInstance().printStatusUpdate("optimizing (100.0%)");
+  base::Printer::getInstance().printStatusNewLine();
+}
+
 void FuzzyExtensionPrincipleViaVertexMethod::clone(
     std::unique_ptr<FuzzyExtensionPrinciple>& clone) const {
   clone = std::unique_ptr<FuzzyExtensionPrinciple>(
@@ -18,6 +18,14 @@ namespace optimization {
 /**
  * Zadeh's fuzzy extension principle by the vertex method, where the optimization
  * problems are solved by simply taking the best corners of the confidence intervals.
+ *
+ * The vertices of all \f$\alpha\f$ levels are collected in one matrix before evaluating
+ * the function. Vertices that are shared by multiple \f$\alpha\f$ levels (or that coincide
+ * within one level, as lower and upper bound of a confidence interval might be equal) are
+ * evaluated only once. The matrix is split into blocks, which are evaluated in parallel via
+ * the batched evaluation method base::ScalarFunction::eval(const base::DataMatrix&,
+ * base::DataVector&), such that functions that can evaluate multiple points efficiently
+ * (e.g., surrogates) should override this method.
  */
 class FuzzyExtensionPrincipleViaVertexMethod : public FuzzyExtensionPrincipleViaOptimization {
  public:
@@ -60,6 +68,20 @@ class FuzzyExtensionPrincipleViaVertexMethod : public FuzzyExtensionPrincipleVia
    */
   void prepareApply() override;
 
+  /**
+   * Solve the minimization/maximization problems for all \f$\alpha\f$ levels
+   * by evaluating the function at the distinct vertices of all levels in parallel.
+   *
+   * @param[out]  curMinimumPoints  vector of minimum points
+   * @param[out]  curMinimumValues  vector of minimum function values
+   * @param[out]  curMaximumPoints  vector of maximum points
+   * @param[out]  curMaximumValues  vector of maximum function values
+   */
+  void optimizeForAllAlphaLevels(
+      std::vector<base::DataVector>& curMinimumPoints, base::DataVector& curMinimumValues,
+      std::vector<base::DataVector>& curMaximumPoints,
+      base::DataVector& curMaximumValues) override;
+
   /**
    * Solve the minimization/maximization problem for a single \f$\alpha\f$ level.
    *
@@ -3,11 +3,8 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/ExecutionContext.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/optimization/gridgen/IterativeGridGenerator.hpp>
 
@@ -18,7 +15,7 @@ namespace sgpp {
 namespace optimization {
 
 IterativeGridGenerator::IterativeGridGenerator(base::ScalarFunction& f, base::Grid& grid, size_t N)
-    : f(f), grid(grid), N(N), functionValues(0) {}
+    : f(f), grid(grid), N(N), functionValues(0), fClones(f) {}
 
 IterativeGridGenerator::~IterativeGridGenerator() {}
 
@@ -56,19 +53,14 @@ void IterativeGridGenerator::evalFunction(size_t oldGridSize) {
   const size_t curGridSize = gridStorage.getSize();
   base::DataVector& fX = functionValues;
 
-#pragma omp parallel shared(fX, oldGridSize, gridStorage)
+  const size_t numberOfThreads =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(curGridSize - oldGridSize);
+  fClones.reserve(numberOfThreads);
+
+#pragma omp parallel shared(fX, oldGridSize, gridStorage) num_threads(numberOfThreads)
   {
     base::DataVector x(d);
-    base::ScalarFunction* curFPtr = &f;
-#ifdef _OPENMP
-    std::unique_ptr<base::ScalarFunction> curF;
-
-    if (omp_get_max_threads() > 1) {
-      f.clone(curF);
-      curFPtr = curF.get();
-    }
-
-#endif /* _OPENMP */
+    base::ScalarFunction& curF = fClones.get();
 
 #pragma omp for
 
@@ -80,7 +72,7 @@ void IterativeGridGenerator::evalFunction(size_t oldGridSize) {
         x[t] = gridStorage.getCoordinate(gp, t);
       }
 
-      const double fx = curFPtr->eval(x);
+      const double fx = curF.eval(x);
       fX[i] = fx;
     }
   }
@@ -10,6 +10,7 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/function/scalar/ScalarFunction.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/tools/ThreadLocalClones.hpp>
 
 #include <cstddef>
 namespace sgpp {
@@ -66,6 +67,8 @@ class IterativeGridGenerator {
   size_t N;
   /// vector of function values at the grid points
   base::DataVector functionValues;
+  /// per-thread clones of the objective function (kept over the calls of evalFunction)
+  base::ThreadLocalClones<base::ScalarFunction> fClones;
 
   /**
    * Removes grid points with indices
@@ -5,8 +5,10 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
+#include <sgpp/base/tools/ThreadLocalClones.hpp>
 #include <sgpp/optimization/optimizer/unconstrained/DifferentialEvolution.hpp>
 
 #include <algorithm>
@@ -122,6 +124,12 @@ void DifferentialEvolution::optimize() {
     }
   }
 
+  // the clones of the objective function are reused in all iterations
+  const size_t numberOfThreads =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(populationSize);
+  base::ThreadLocalClones<base::ScalarFunction> fClones(*f);
+  fClones.reserve(numberOfThreads);
+
   // "real" algorithm loop
   for (size_t k = 0; k < maxK; k++) {
     // abbreviations
@@ -129,19 +137,11 @@ void DifferentialEvolution::optimize() {
     const std::vector<size_t>& j_k = j[k];
     const std::vector<base::DataVector>& prob_k = prob[k];
 
-#pragma omp parallel shared(k, a_k, b_k, c_k, j_k, prob_k, xOld, fx, fCurrentOpt, xOptIndex, xNew)
+#pragma omp parallel shared(k, a_k, b_k, c_k, j_k, prob_k, xOld, fx, fCurrentOpt, xOptIndex, \
+                             xNew) num_threads(numberOfThreads)
     {  // NOLINT(whitespace/braces)
       base::DataVector y(d);
-      base::ScalarFunction* curFPtr = f.get();
-#ifdef _OPENMP
-      std::unique_ptr<base::ScalarFunction> curF;
-
-      if (omp_get_max_threads() > 1) {
-        f->clone(curF);
-        curFPtr = curF.get();
-      }
-
-#endif /* _OPENMP */
+      base::ScalarFunction& curF = fClones.get();
 
 // for each point in the population
 #pragma omp for schedule(dynamic)
@@ -172,7 +172,7 @@ void DifferentialEvolution::optimize() {
         }
 
         // evaluate mutated point (if not out of bounds)
-        const double fy = (inDomain ? curFPtr->eval(y) : std::numeric_limits<double>::infinity());
+        const double fy = (inDomain ? curF.eval(y) : std::numeric_limits<double>::infinity());
 
         if (fy < fx[i]) {
 // function_value is better ==> replace point with mutated one
@@ -5,8 +5,10 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
 #include <sgpp/base/tools/Printer.hpp>
 #include <sgpp/base/tools/RandomNumberGenerator.hpp>
+#include <sgpp/base/tools/ThreadLocalClones.hpp>
 #include <sgpp/optimization/optimizer/unconstrained/MultiStart.hpp>
 
 #include <algorithm>
@@ -108,18 +110,17 @@ void MultiStart::optimize() {
 
   size_t pointsDone = 0;
 
-#pragma omp parallel shared(x0, roundN, xCurrentOpt, fCurrentOpt, pointsDone)
-  {
-    UnconstrainedOptimizer* curOptimizerPtr = optimizer.get();
-#ifdef _OPENMP
-    std::unique_ptr<UnconstrainedOptimizer> curOptimizer;
-
-    if (omp_get_max_threads() > 1) {
-      optimizer->clone(curOptimizer);
-      curOptimizerPtr = curOptimizer.get();
-    }
+  // parallel regions of the optimizers are run sequentially or get their share of the
+  // thread budget, depending on the nesting policy of the execution context
+  const size_t numberOfThreads =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(populationSize);
+  base::ThreadLocalClones<UnconstrainedOptimizer> optimizerClones(*optimizer);
+  optimizerClones.reserve(numberOfThreads);
 
-#endif /* _OPENMP */
+#pragma omp parallel shared(x0, roundN, xCurrentOpt, fCurrentOpt, pointsDone) \
+    num_threads(numberOfThreads)
+  {
+    UnconstrainedOptimizer* curOptimizerPtr = &optimizerClones.get();
 
     base::DataVector xLocalOpt(d);
     double fLocalOpt;
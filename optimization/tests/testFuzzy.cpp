@@ -23,6 +23,8 @@
 #include <sgpp/optimization/fuzzy/TriangularFuzzyInterval.hpp>
 #include <sgpp/optimization/optimizer/unconstrained/AdaptiveGradientDescent.hpp>
 
+#include <atomic>
+#include <cmath>
 #include <vector>
 
 using sgpp::optimization::FuzzyExtensionPrinciple;
@@ -99,6 +101,54 @@ class BilinearFunctionGradient : public sgpp::base::ScalarFunctionGradient {
   }
 };
 
+class CountingFunction : public sgpp::base::ScalarFunction {
+ public:
+  CountingFunction(size_t d, std::atomic<size_t>& numberOfEvaluations)
+      : ScalarFunction(d), numberOfEvaluations(numberOfEvaluations) {}
+  ~CountingFunction() override {}
+
+  inline double eval(const sgpp::base::DataVector& x) override {
+    numberOfEvaluations++;
+    double result = 0.0;
+
+    for (size_t t = 0; t < d; t++) {
+      result += std::sin(3.0 * static_cast<double>(t + 1) * x[t]) * x[(t + 1) % d];
+    }
+
+    return result;
+  }
+
+  void clone(std::unique_ptr<ScalarFunction>& clone) const override {
+    clone = std::unique_ptr<ScalarFunction>(new CountingFunction(d, numberOfEvaluations));
+  }
+
+ protected:
+  std::atomic<size_t>& numberOfEvaluations;
+};
+
+/**
+ * Vertex method that solves the problems of the alpha levels independently
+ * (like all other fuzzy extension principles).
+ */
+class VertexMethodPerAlphaLevel : public FuzzyExtensionPrincipleViaVertexMethod {
+ public:
+  VertexMethodPerAlphaLevel(const sgpp::base::ScalarFunction& f, size_t numberOfAlphaSegments)
+      : FuzzyExtensionPrincipleViaVertexMethod(f, numberOfAlphaSegments) {}
+
+  void clone(std::unique_ptr<FuzzyExtensionPrinciple>& clone) const override {
+    clone = std::unique_ptr<FuzzyExtensionPrinciple>(new VertexMethodPerAlphaLevel(*this));
+  }
+
+ protected:
+  void optimizeForAllAlphaLevels(std::vector<sgpp::base::DataVector>& curMinimumPoints,
+                                 sgpp::base::DataVector& curMinimumValues,
+                                 std::vector<sgpp::base::DataVector>& curMaximumPoints,
+                                 sgpp::base::DataVector& curMaximumValues) override {
+    FuzzyExtensionPrinciple::optimizeForAllAlphaLevels(curMinimumPoints, curMinimumValues,
+                                                       curMaximumPoints, curMaximumValues);
+  }
+};
+
 BOOST_AUTO_TEST_CASE(TestFuzzyIntervalBinarySearch) {
   TestFuzzyInterval1 interval1;
   TestFuzzyInterval2 interval2;
@@ -371,3 +421,50 @@ BOOST_AUTO_TEST_CASE(TestFuzzyExtensionPrinciple) {
     BOOST_CHECK_CLOSE(maximumValues[m/2], 3.9, 5e0);
   }
 }
+
+BOOST_AUTO_TEST_CASE(TestFuzzyExtensionPrincipleViaVertexMethod) {
+  sgpp::base::Printer::getInstance().setVerbosity(-1);
+
+  const size_t d = 4;
+  const size_t m = 8;
+  std::atomic<size_t> numberOfEvaluations(0);
+  const CountingFunction f(d, numberOfEvaluations);
+
+  // fuzzy numbers ==> the confidence intervals of alpha = 1 are single points
+  const TriangularFuzzyInterval xFuzzy1(0.3, 0.2, 0.1);
+  const TriangularFuzzyInterval xFuzzy2(0.5, 0.1, 0.3);
+  const TriangularFuzzyInterval xFuzzy3(0.6, 0.4);
+  const TriangularFuzzyInterval xFuzzy4(0.7, 0.2, 0.2);
+  std::vector<const FuzzyInterval*> xFuzzy = {&xFuzzy1, &xFuzzy2, &xFuzzy3, &xFuzzy4};
+
+  VertexMethodPerAlphaLevel principlePerAlphaLevel(f, m);
+  std::unique_ptr<FuzzyInterval> yFuzzyPerAlphaLevel(principlePerAlphaLevel.apply(xFuzzy));
+  BOOST_CHECK_EQUAL(numberOfEvaluations, (m + 1) * (size_t{1} << d));
+
+  // batched evaluation evaluates every distinct vertex exactly once
+  numberOfEvaluations = 0;
+  FuzzyExtensionPrincipleViaVertexMethod principle(f, m);
+  std::unique_ptr<FuzzyInterval> yFuzzy(principle.apply(xFuzzy));
+  BOOST_CHECK_EQUAL(numberOfEvaluations, m * (size_t{1} << d) + 1);
+
+  for (size_t j = 0; j <= m; j++) {
+    BOOST_CHECK_EQUAL(principle.getMinimumValues()[j],
+                      principlePerAlphaLevel.getMinimumValues()[j]);
+    BOOST_CHECK_EQUAL(principle.getMaximumValues()[j],
+                      principlePerAlphaLevel.getMaximumValues()[j]);
+
+    for (size_t t = 0; t < d; t++) {
+      BOOST_CHECK_EQUAL(principle.getMinimumPoints()[j][t],
+                        principlePerAlphaLevel.getMinimumPoints()[j][t]);
+      BOOST_CHECK_EQUAL(principle.getMaximumPoints()[j][t],
+                        principlePerAlphaLevel.getMaximumPoints()[j][t]);
+    }
+  }
+
+  for (double alpha : {0.0, 0.3, 0.5, 1.0}) {
+    BOOST_CHECK_EQUAL(yFuzzy->evaluateConfidenceIntervalLowerBound(alpha),
+                      yFuzzyPerAlphaLevel->evaluateConfidenceIntervalLowerBound(alpha));
+    BOOST_CHECK_EQUAL(yFuzzy->evaluateConfidenceIntervalUpperBound(alpha),
+                      yFuzzyPerAlphaLevel->evaluateConfidenceIntervalUpperBound(alpha));
+  }
+}
@@ -0,0 +1,193 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#define BOOST_TEST_MODULE SGppPdeBenchmarks
+#include <boost/test/unit_test.hpp>
+#include <boost/version.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/tools/BenchmarkRunner.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+using sgpp::base::BenchmarkRunner;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::GridType;
+using sgpp::base::OperationMatrix;
+
+namespace {
+
+BenchmarkRunner& getBenchmarkRunner() {
+  static BenchmarkRunner runner;
+  return runner;
+}
+
+/**
+ * Grid type, dimensionality and level of a benchmark case.
+ */
+struct BenchmarkConfiguration {
+  GridType type;
+  size_t dim;
+  sgpp::base::level_t level;
+};
+
+std::vector<BenchmarkConfiguration> getBenchmarkConfigurations() {
+  // the boundary basis functions overlap almost all other basis functions, which makes the
+  // Laplace matrix of boundary grids dense in higher dimensions
+  return std::vector<BenchmarkConfiguration>{
+      {GridType::Linear, 2, 10},        {GridType::Linear, 4, 6},
+      {GridType::Linear, 8, 4},         {GridType::LinearBoundary, 2, 8},
+      {GridType::LinearBoundary, 4, 4}};
+}
+
+std::unique_ptr<Grid> createBenchmarkGrid(const BenchmarkConfiguration& configuration) {
+  std::unique_ptr<Grid> grid((configuration.type == GridType::Linear)
+                                 ? Grid::createLinearGrid(configuration.dim)
+                                 : Grid::createLinearBoundaryGrid(configuration.dim));
+  grid->getGenerator().regular(configuration.level);
+  return grid;
+}
+
+BenchmarkRunner::Parameters getBenchmarkParameters(const BenchmarkConfiguration& configuration,
+                                                   Grid& grid) {
+  return BenchmarkRunner::Parameters{{"gridType", grid.getTypeAsString()},
+                                     {"dim", std::to_string(configuration.dim)},
+                                     {"level", std::to_string(configuration.level)},
+                                     {"gridSize", std::to_string(grid.getSize())}};
+}
+
+/**
+ * @param grid          grid
+ * @param useSparse     whether to use the assembled sparse operator instead of up/down
+ * @return Laplace operator for the grid
+ */
+std::unique_ptr<OperationMatrix> createLaplace(Grid& grid, bool useSparse) {
+  return std::unique_ptr<OperationMatrix>(
+      useSparse ? sgpp::op_factory::createOperationLaplaceSparse(grid)
+                : sgpp::op_factory::createOperationLaplace(grid));
+}
+
+}  // namespace
+
+/**
+ * Reads the settings from the environment at the start and writes the results to
+ * benchmarks_pde.json in the directory given by SGPP_BENCHMARK_OUTPUT_DIR
+ * (default: working directory) at the end.
+ */
+struct BenchmarkFixture {
+  BenchmarkFixture() { getBenchmarkRunner().configureFromEnvironment(); }
+
+  ~BenchmarkFixture() {
+    const char* outputDirectory = std::getenv("SGPP_BENCHMARK_OUTPUT_DIR");
+    getBenchmarkRunner().writeJSON(
+        ((outputDirectory != nullptr) ? std::string(outputDirectory) + "/" : std::string()) +
+        "benchmarks_pde.json");
+  }
+};
+
+#if BOOST_VERSION >= 105900
+BOOST_GLOBAL_FIXTURE(BenchmarkFixture);
+#else
+BOOST_GLOBAL_FIXTURE(BenchmarkFixture)
+#endif /* BOOST_VERSION >= 105900 */
+
+BOOST_AUTO_TEST_CASE(benchmarkLaplaceSparseAssembly) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+
+  for (const BenchmarkConfiguration& configuration : getBenchmarkConfigurations()) {
+    std::unique_ptr<Grid> grid = createBenchmarkGrid(configuration);
+
+    for (size_t numberOfThreads : runner.getNumbersOfThreads()) {
+      runner.run("LaplaceSparse::assemble", getBenchmarkParameters(configuration, *grid),
+                 numberOfThreads, static_cast<double>(grid->getSize()), [&grid]() {
+                   std::unique_ptr<OperationMatrix> op = createLaplace(*grid, true);
+                   BOOST_CHECK(op != nullptr);
+                 });
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkLaplaceMult) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+
+  for (bool useSparse : {false, true}) {
+    for (const BenchmarkConfiguration& configuration : getBenchmarkConfigurations()) {
+      std::unique_ptr<Grid> grid = createBenchmarkGrid(configuration);
+      std::unique_ptr<OperationMatrix> op = createLaplace(*grid, useSparse);
+      DataVector alpha(grid->getSize(), 1.0);
+      DataVector result(grid->getSize());
+      BenchmarkRunner::Parameters parameters = getBenchmarkParameters(configuration, *grid);
+      parameters["operator"] = (useSparse ? "sparse" : "upDown");
+
+      for (size_t numberOfThreads : runner.getNumbersOfThreads()) {
+        runner.run("Laplace::mult", parameters, numberOfThreads,
+                   static_cast<double>(grid->getSize()), [&op, &alpha, &result]() {
+                     op->mult(alpha, result);
+                     BOOST_CHECK(std::isfinite(result[0]));
+                   });
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(benchmarkPoissonSolve) {
+  BenchmarkRunner& runner = getBenchmarkRunner();
+  // fixed number of iterations (the tolerance is never reached) to compare the runs
+  const size_t numberOfIterations = 20;
+
+  for (bool useSparse : {false, true}) {
+    for (const BenchmarkConfiguration& configuration : getBenchmarkConfigurations()) {
+      // the Laplace matrix is singular for boundary grids without Dirichlet conditions
+      if (configuration.type != GridType::Linear) {
+        continue;
+      }
+
+      std::unique_ptr<Grid> grid = createBenchmarkGrid(configuration);
+      std::unique_ptr<OperationMatrix> op = createLaplace(*grid, useSparse);
+      const DataVector rhs(grid->getSize(), 1.0);
+      BenchmarkRunner::Parameters parameters = getBenchmarkParameters(configuration, *grid);
+      parameters["operator"] = (useSparse ? "sparse" : "upDown");
+      parameters["iterations"] = std::to_string(numberOfIterations);
+
+      for (size_t numberOfThreads : runner.getNumbersOfThreads()) {
+        // one item corresponds to one CG iteration
+        runner.run("ConjugateGradients::solve", parameters, numberOfThreads,
+                   static_cast<double>(numberOfIterations), [&op, &rhs, numberOfIterations]() {
+                     sgpp::solver::ConjugateGradients solver(numberOfIterations, 0.0);
+                     DataVector alpha(rhs.getSize(), 0.0);
+                     DataVector b(rhs);
+                     solver.solve(*op, alpha, b, false, false);
+                     BOOST_CHECK(std::isfinite(alpha[0]));
+                   });
+      }
+    }
+  }
+}
+
+// fix for clang (from https://stackoverflow.com/a/33755176)
+#ifdef __clang__
+namespace boost {
+namespace unit_test {
+namespace ut_detail {
+
+std::string normalize_test_case_name(const_string name) {
+    return ((name[0] == '&') ? std::string(name.begin() + 1, name.size() - 1) :
+                               std::string(name.begin(), name.size()));
+}
+
+}  // namespace ut_detail
+}  // namespace unit_test
+}  // namespace boost
+#endif
@@ -0,0 +1,91 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * \page example_heatEquationScaling_cpp Parallel Scaling of the Heat Equation Solver
+ *
+ * This example solves the heat equation on regular sparse grids with boundaries
+ * in 4 to 8 dimensions with the implicit Euler method and reports the speedup
+ * of the OpenMP-parallel up/down operators (parallel in the dimensions of the
+ * up/down recursion and in the poles of each one-dimensional sweep) compared
+ * to a single thread.
+ *
+ * Since the number of grid points of regular sparse grids with boundaries grows
+ * quickly with the dimensionality, small levels are used by default.
+ *
+ * Usage: heatEquationScaling [level] [number of timesteps] [max. dimensionality]
+ */
+
+#include <sgpp_base.hpp>
+#include <sgpp_pde.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+/**
+ * Solves the heat equation and returns the needed time in seconds.
+ */
+double solveHeatEquation(size_t dim, size_t level, size_t numTimesteps) {
+  std::vector<sgpp::base::BoundingBox1D> boundaries(
+      dim, sgpp::base::BoundingBox1D(0.0, 3.0, true, true));
+  sgpp::base::BoundingBox boundingBox(boundaries);
+
+  sgpp::pde::HeatEquationSolver solver;
+  solver.constructGrid(boundingBox, level);
+  solver.setHeatCoefficient(1.0);
+  solver.initScreen();
+
+  sgpp::base::DataVector alpha(solver.getNumberGridPoints());
+  solver.initGridWithSmoothHeat(alpha, 1.5, 0.5, 2.0);
+
+  sgpp::base::SGppStopwatch stopwatch;
+  stopwatch.start();
+  solver.solveImplicitEuler(numTimesteps, 0.001, 400, 1e-6, alpha);
+  return stopwatch.stop();
+}
+
+int main(int argc, char** argv) {
+  size_t level = (argc > 1) ? std::atoi(argv[1]) : 2;
+  size_t numTimesteps = (argc > 2) ? std::atoi(argv[2]) : 1;
+  size_t maxDim = (argc > 3) ? std::atoi(argv[3]) : 8;
+
+  int maxThreads = 1;
+#ifdef _OPENMP
+  maxThreads = omp_get_max_threads();
+#endif
+
+  std::vector<double> sequentialTimes;
+  std::vector<double> parallelTimes;
+
+  for (size_t dim = 4; dim <= maxDim; dim++) {
+#ifdef _OPENMP
+    omp_set_num_threads(1);
+#endif
+    sequentialTimes.push_back(solveHeatEquation(dim, level, numTimesteps));
+
+#ifdef _OPENMP
+    omp_set_num_threads(maxThreads);
+#endif
+    parallelTimes.push_back(solveHeatEquation(dim, level, numTimesteps));
+  }
+
+  std::cout << "level " << level << ", " << numTimesteps << " timesteps, " << maxThreads
+            << " threads" << std::endl;
+
+  for (size_t dim = 4; dim <= maxDim; dim++) {
+    const double sequentialTime = sequentialTimes[dim - 4];
+    const double parallelTime = parallelTimes[dim - 4];
+    std::cout << "dim " << dim << ": " << sequentialTime << " s (1 thread), " << parallelTime
+              << " s (" << maxThreads << " threads), speedup " << sequentialTime / parallelTime
+              << std::endl;
+  }
+
+  return 0;
+}
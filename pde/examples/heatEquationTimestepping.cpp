@@ -0,0 +1,158 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * \page example_heatEquationTimestepping_cpp Time to Solution of the Heat Equation
+ *
+ * This example compares the time to solution and the total number of CG iterations
+ * of the implicit Euler method for the heat equation for
+ * - the matrix-free operators and the standard Euler driver,
+ * - the assembled sparse operators (the system matrix is assembled once and reused
+ *   in every timestep) and the WarmStartTimestepping driver, which extrapolates the
+ *   initial guess of the CG method from the last two timesteps,
+ * - several initial conditions, each solved separately, and all advanced together
+ *   with one system by WarmStartTimestepping::solveBatch.
+ *
+ * Usage: heatEquationTimestepping [dimensionality] [level] [number of timesteps]
+ * [number of initial conditions]
+ */
+
+#include <sgpp_base.hpp>
+#include <sgpp_pde.hpp>
+#include <sgpp_solver.hpp>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+const double timestepSize = 0.001;
+const double heatCoefficient = 1.0;
+
+/**
+ * Sets alpha to the hierarchised coefficients of a smooth heat distribution
+ * centered at center.
+ */
+void initSmoothHeat(sgpp::base::Grid& grid, sgpp::base::DataVector& alpha, double center) {
+  sgpp::base::GridStorage& storage = grid.getStorage();
+  sgpp::base::BoundingBox& boundingBox = grid.getBoundingBox();
+  sgpp::base::DataVector point(storage.getDimension());
+
+  for (size_t i = 0; i < storage.getSize(); i++) {
+    storage.getCoordinates(storage[i], point);
+    double value = 1.0;
+
+    for (size_t d = 0; d < storage.getDimension(); d++) {
+      const double width = boundingBox.getIntervalWidth(d);
+      value *= std::sin(M_PI * (point[d] - boundingBox.getIntervalOffset(d)) / width) *
+               std::exp(-(point[d] - center) * (point[d] - center));
+    }
+
+    alpha[i] = value;
+  }
+
+  std::unique_ptr<sgpp::base::OperationHierarchisation> hierarchisation(
+      sgpp::op_factory::createOperationHierarchisation(grid));
+  hierarchisation->doHierarchisation(alpha);
+}
+
+int main(int argc, char** argv) {
+  size_t dim = (argc > 1) ? std::atoi(argv[1]) : 3;
+  size_t level = (argc > 2) ? std::atoi(argv[2]) : 5;
+  size_t numTimesteps = (argc > 3) ? std::atoi(argv[3]) : 20;
+  size_t numInitialConditions = (argc > 4) ? std::atoi(argv[4]) : 4;
+
+  sgpp::base::BoundingBox boundingBox(
+      std::vector<sgpp::base::BoundingBox1D>(dim, sgpp::base::BoundingBox1D(0.0, 3.0, true, true)));
+  sgpp::base::LinearBoundaryGrid grid(boundingBox);
+  grid.getGenerator().regular(level);
+
+  std::vector<sgpp::base::DataVector> initialConditions(
+      numInitialConditions, sgpp::base::DataVector(grid.getSize()));
+
+  for (size_t k = 0; k < numInitialConditions; k++) {
+    initSmoothHeat(grid, initialConditions[k],
+                   1.0 + static_cast<double>(k) / static_cast<double>(numInitialConditions));
+  }
+
+  sgpp::solver::ConjugateGradients cg(400, 1e-8);
+  sgpp::base::SGppStopwatch stopwatch;
+
+  std::cout << "dim " << dim << ", level " << level << ", " << grid.getSize() << " grid points, "
+            << numTimesteps << " timesteps" << std::endl;
+
+  // matrix-free operators, standard implicit Euler
+  sgpp::base::DataVector alphaMatrixFree(initialConditions[0]);
+  stopwatch.start();
+  {
+    sgpp::pde::HeatEquationParabolicPDESolverSystem system(grid, alphaMatrixFree, heatCoefficient,
+                                                           timestepSize, "ImEul");
+    sgpp::solver::Euler euler("ImEul", numTimesteps, timestepSize, false);
+    euler.solve(cg, system);
+    std::cout << "matrix-free, Euler:                  " << stopwatch.stop() << " s, "
+              << euler.getNumberIterations() << " CG iterations" << std::endl;
+  }
+
+  // assembled sparse operators, warm-started implicit Euler
+  sgpp::base::DataVector alphaSparse(initialConditions[0]);
+  stopwatch.start();
+  {
+    sgpp::pde::HeatEquationParabolicPDESolverSystem system(grid, alphaSparse, heatCoefficient,
+                                                           timestepSize, "ImEul", true);
+    sgpp::solver::WarmStartTimestepping timestepping(numTimesteps, timestepSize);
+    timestepping.solve(cg, system);
+    std::cout << "sparse, WarmStartTimestepping:       " << stopwatch.stop() << " s, "
+              << timestepping.getNumberIterations() << " CG iterations" << std::endl;
+  }
+
+  alphaSparse.sub(alphaMatrixFree);
+  std::cout << "max. difference of the solutions:    " << alphaSparse.maxNorm() << std::endl;
+
+  // several initial conditions, one system each
+  std::vector<sgpp::base::DataVector> alphasSeparate(initialConditions);
+  size_t separateIterations = 0;
+  stopwatch.start();
+
+  for (size_t k = 0; k < numInitialConditions; k++) {
+    sgpp::pde::HeatEquationParabolicPDESolverSystem system(grid, alphasSeparate[k], heatCoefficient,
+                                                           timestepSize, "ImEul", true);
+    sgpp::solver::WarmStartTimestepping timestepping(numTimesteps, timestepSize);
+    timestepping.solve(cg, system);
+    separateIterations += timestepping.getNumberIterations();
+  }
+
+  std::cout << numInitialConditions << " initial conditions, separately: " << stopwatch.stop()
+            << " s, " << separateIterations << " CG iterations" << std::endl;
+
+  // several initial conditions, one system for all
+  std::vector<sgpp::base::DataVector> alphasBatch(initialConditions);
+  std::vector<sgpp::base::DataVector*> alphasBatchPointers;
+
+  for (auto& alpha : alphasBatch) {
+    alphasBatchPointers.push_back(&alpha);
+  }
+
+  stopwatch.start();
+  {
+    sgpp::pde::HeatEquationParabolicPDESolverSystem system(grid, alphasBatch[0], heatCoefficient,
+                                                           timestepSize, "ImEul", true);
+    sgpp::solver::WarmStartTimestepping timestepping(numTimesteps, timestepSize);
+    timestepping.solveBatch(cg, system, alphasBatchPointers);
+    std::cout << numInitialConditions << " initial conditions, batched:    " << stopwatch.stop()
+              << " s, " << timestepping.getNumberIterations() << " CG iterations" << std::endl;
+  }
+
+  double maxDifference = 0.0;
+
+  for (size_t k = 0; k < numInitialConditions; k++) {
+    alphasBatch[k].sub(alphasSeparate[k]);
+    maxDifference = std::max(maxDifference, alphasBatch[k].maxNorm());
+  }
+
+  std::cout << "max. difference of the solutions:    " << maxDifference << std::endl;
+
+  return 0;
+}
@@ -16,7 +16,8 @@ namespace pde {
 
 HeatEquationParabolicPDESolverSystem::HeatEquationParabolicPDESolverSystem(
     sgpp::base::Grid& SparseGrid, sgpp::base::DataVector& alpha, double a, double TimestepSize,
-    std::string OperationMode) {
+    std::string OperationMode, bool useSparseOperators)
+    : useSparseOperators(useSparseOperators), systemTimestepSize(0.0) {
   this->a = a;
   this->tOperationMode = OperationMode;
   this->TimestepSize = TimestepSize;
@@ -28,16 +29,23 @@ HeatEquationParabolicPDESolverSystem::HeatEquationParabolicPDESolverSystem(
   this->BoundaryUpdate = new sgpp::base::DirichletUpdateVector(SparseGrid.getStorage());
   this->GridConverter = new sgpp::base::DirichletGridConverter();
 
-  this->OpLaplaceBound = op_factory::createOperationLaplace(SparseGrid);
-  this->OpMassBound = sgpp::op_factory::createOperationLTwoDotProduct(SparseGrid);
-
   // create the inner grid
   this->GridConverter->buildInnerGridWithCoefs(*this->BoundGrid, *this->alpha_complete,
                                                &this->InnerGrid, &this->alpha_inner);
 
-  // Create needed operations, on inner grid
-  this->OpLaplaceInner = op_factory::createOperationLaplace(*this->InnerGrid);
-  this->OpMassInner = sgpp::op_factory::createOperationLTwoDotProduct(*this->InnerGrid);
+  if (useSparseOperators) {
+    this->OpLaplaceBound = op_factory::createOperationLaplaceSparse(SparseGrid);
+    this->OpMassBound = sgpp::op_factory::createOperationLTwoDotProductSparse(SparseGrid);
+    this->OpLaplaceInner = op_factory::createOperationLaplaceSparse(*this->InnerGrid);
+    this->OpMassInner = sgpp::op_factory::createOperationLTwoDotProductSparse(*this->InnerGrid);
+  } else {
+    this->OpLaplaceBound = op_factory::createOperationLaplace(SparseGrid);
+    this->OpMassBound = sgpp::op_factory::createOperationLTwoDotProduct(SparseGrid);
+
+    // Create needed operations, on inner grid
+    this->OpLaplaceInner = op_factory::createOperationLaplace(*this->InnerGrid);
+    this->OpMassInner = sgpp::op_factory::createOperationLTwoDotProduct(*this->InnerGrid);
+  }
 
   // right hand side if System
   this->rhs = new sgpp::base::DataVector(1);
@@ -109,6 +117,37 @@ void HeatEquationParabolicPDESolverSystem::applyLOperatorInner(sgpp::base::DataV
   result.axpy((-1.0) * this->a, temp);
 }
 
+void HeatEquationParabolicPDESolverSystem::mult(sgpp::base::DataVector& alpha,
+                                                sgpp::base::DataVector& result) {
+  double factor;
+
+  if (this->tOperationMode == "ImEul") {
+    factor = 1.0;
+  } else if (this->tOperationMode == "CrNic") {
+    factor = 0.5;
+  } else {
+    factor = 0.0;
+  }
+
+  if (!this->useSparseOperators || (factor == 0.0)) {
+    OperationParabolicPDESolverSystemDirichlet::mult(alpha, result);
+    return;
+  }
+
+  // (re-)assemble M + factor * dt * a * L if the timestep size has changed
+  if ((this->OpSystemInner == nullptr) || (this->systemTimestepSize != this->TimestepSize) ||
+      (this->systemOperationMode != this->tOperationMode)) {
+    this->OpSystemInner.reset(
+        new OperationMatrixSparseLinear(*dynamic_cast<OperationMatrixSparseLinear*>(OpMassInner)));
+    this->OpSystemInner->addScaled(factor * this->TimestepSize * this->a,
+                                   *dynamic_cast<OperationMatrixSparseLinear*>(OpLaplaceInner));
+    this->systemTimestepSize = this->TimestepSize;
+    this->systemOperationMode = this->tOperationMode;
+  }
+
+  this->OpSystemInner->mult(alpha, result);
+}
+
 void HeatEquationParabolicPDESolverSystem::finishTimestep() {
   // Replace the inner coefficients on the boundary grid
   this->GridConverter->updateBoundaryCoefs(*this->alpha_complete, *this->alpha_inner);
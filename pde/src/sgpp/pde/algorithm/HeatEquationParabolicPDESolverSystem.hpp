@@ -9,9 +9,11 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/pde/operation/hash/OperationParabolicPDESolverSystemDirichlet.hpp>
+#include <sgpp/pde/operation/hash/OperationMatrixSparseLinear.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -33,6 +35,14 @@ class HeatEquationParabolicPDESolverSystem : public OperationParabolicPDESolverS
   sgpp::base::OperationMatrix* OpLaplaceInner;
   /// the LTwoDotProduct Operation (Mass Matrix), on inner grid
   sgpp::base::OperationMatrix* OpMassInner;
+  /// whether the operators are assembled sparse matrices
+  bool useSparseOperators;
+  /// assembled system matrix of the implicit schemes, on inner grid (sparse operators only)
+  std::unique_ptr<OperationMatrixSparseLinear> OpSystemInner;
+  /// timestep size for which OpSystemInner has been assembled
+  double systemTimestepSize;
+  /// operation mode for which OpSystemInner has been assembled
+  std::string systemOperationMode;
 
   void applyMassMatrixComplete(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
@@ -53,16 +63,29 @@ class HeatEquationParabolicPDESolverSystem : public OperationParabolicPDESolverS
    * @param OperationMode specifies in which solver this matrix is used, valid values are: ExEul for
    * explicit Euler,
    *                ImEul for implicit Euler, CrNic for Crank Nicolson solver
+   * @param useSparseOperators assemble the Laplace and mass matrices once into sparse matrices
+   * instead of applying them matrix-free (only for linear grids)
    */
   HeatEquationParabolicPDESolverSystem(sgpp::base::Grid& SparseGrid, sgpp::base::DataVector& alpha,
                                        double a, double TimestepSize,
-                                       std::string OperationMode = "ExEul");
+                                       std::string OperationMode = "ExEul",
+                                       bool useSparseOperators = false);
 
   /**
    * Std-Destructor
    */
   virtual ~HeatEquationParabolicPDESolverSystem();
 
+  /**
+   * Multiplicates a vector with the system matrix. If sparse operators are used,
+   * the system matrix of the implicit Euler and the Crank-Nicolson scheme is assembled
+   * once and reused as long as the timestep size does not change.
+   *
+   * @param alpha the coefficients of the sparse grid's ansatzfunctions (inner grid)
+   * @param result reference to the sgpp::base::DataVector into which the result is written
+   */
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
   virtual void finishTimestep();
 
   virtual void coarsenAndRefine(bool isLastTimestep = false);
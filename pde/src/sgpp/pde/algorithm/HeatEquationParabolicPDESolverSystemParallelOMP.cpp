@@ -8,13 +8,10 @@
 
 #include <sgpp/pde/algorithm/StdUpDown.hpp>
 #include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
+#include <sgpp/pde/algorithm/UpDownResultReduction.hpp>
 
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 #include <sgpp/globaldef.hpp>
 
 #include <vector>
@@ -94,14 +91,11 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorComplete(
 
   std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
   size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
+  UpDownResultReduction reduction(result.getSize());
 
   // Apply Laplace, parallel in Dimensions
   for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
+#pragma omp task firstprivate(i) shared(alpha, result, algoDims, reduction)
     {
       sgpp::base::DataVector myResult(result.getSize());
 
@@ -109,22 +103,13 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorComplete(
       reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceBound)
           ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
 
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
+      reduction.add(myResult);
     }
   }
 
 #pragma omp taskwait
 
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
+  reduction.reduce(temp);
 
   result.axpy((-1.0) * this->a, temp);
 }
@@ -148,14 +133,11 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorInner(
 
   std::vector<size_t> algoDims = this->InnerGrid->getStorage().getAlgorithmicDimensions();
   size_t nDims = algoDims.size();
-#ifdef _OPENMP
-  omp_lock_t Mutex;
-  omp_init_lock(&Mutex);
-#endif
+  UpDownResultReduction reduction(result.getSize());
 
   // Apply Laplace, parallel in Dimensions
   for (size_t i = 0; i < nDims; i++) {
-#pragma omp task firstprivate(i) shared(alpha, temp, result, algoDims)
+#pragma omp task firstprivate(i) shared(alpha, result, algoDims, reduction)
     {
       sgpp::base::DataVector myResult(result.getSize());
 
@@ -163,22 +145,13 @@ void HeatEquationParabolicPDESolverSystemParallelOMP::applyLOperatorInner(
       reinterpret_cast<UpDownOneOpDim*>(this->OpLaplaceInner)
           ->multParallelBuildingBlock(alpha, myResult, algoDims[i]);
 
-// semaphore
-#ifdef _OPENMP
-      omp_set_lock(&Mutex);
-#endif
-      temp.add(myResult);
-#ifdef _OPENMP
-      omp_unset_lock(&Mutex);
-#endif
+      reduction.add(myResult);
     }
   }
 
 #pragma omp taskwait
 
-#ifdef _OPENMP
-  omp_destroy_lock(&Mutex);
-#endif
+  reduction.reduce(temp);
 
   result.axpy((-1.0) * this->a, temp);
 }
@@ -13,10 +13,15 @@ namespace sgpp {
 namespace pde {
 
 PoissonEquationEllipticPDESolverSystemDirichlet::PoissonEquationEllipticPDESolverSystemDirichlet(
-    sgpp::base::Grid& SparseGrid, sgpp::base::DataVector& rhs)
+    sgpp::base::Grid& SparseGrid, sgpp::base::DataVector& rhs, bool useSparseOperators)
     : OperationEllipticPDESolverSystemDirichlet(SparseGrid, rhs) {
-  this->Laplace_Complete = op_factory::createOperationLaplace(*this->BoundGrid);
-  this->Laplace_Inner = op_factory::createOperationLaplace(*this->InnerGrid);
+  if (useSparseOperators) {
+    this->Laplace_Complete = op_factory::createOperationLaplaceSparse(*this->BoundGrid);
+    this->Laplace_Inner = op_factory::createOperationLaplaceSparse(*this->InnerGrid);
+  } else {
+    this->Laplace_Complete = op_factory::createOperationLaplace(*this->BoundGrid);
+    this->Laplace_Inner = op_factory::createOperationLaplace(*this->InnerGrid);
+  }
 }
 
 PoissonEquationEllipticPDESolverSystemDirichlet::
@@ -35,9 +35,12 @@ class PoissonEquationEllipticPDESolverSystemDirichlet
    *
    * @param SparseGrid reference to a sparse grid on which the Poisson Equation should be solved
    * @param rhs the right hand side for solving the elliptic PDE
+   * @param useSparseOperators assemble the Laplace matrices once into sparse matrices
+   * instead of applying them matrix-free (only for linear grids)
    */
   PoissonEquationEllipticPDESolverSystemDirichlet(sgpp::base::Grid& SparseGrid,
-                                                  sgpp::base::DataVector& rhs);
+                                                  sgpp::base::DataVector& rhs,
+                                                  bool useSparseOperators = false);
 
   /**
    * Destructor
@@ -5,6 +5,7 @@
 
 #include <sgpp/pde/algorithm/StdUpDown.hpp>
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
@@ -20,7 +21,10 @@ StdUpDown::~StdUpDown() {}
 void StdUpDown::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   sgpp::base::DataVector beta(result.getSize());
   result.setAll(0.0);
-#pragma omp parallel
+  const size_t numberOfThreads =
+      sgpp::base::ExecutionContext::getInstance().getNumberOfThreadsForRegion();
+
+#pragma omp parallel num_threads(numberOfThreads)
   {
 #pragma omp single nowait
     { this->updown(alpha, beta, this->numAlgoDims_ - 1); }
@@ -4,7 +4,9 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/pde/algorithm/UpDownFourOpDims.hpp>
+#include <sgpp/pde/algorithm/UpDownResultReduction.hpp>
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
@@ -80,7 +82,12 @@ void UpDownFourOpDims::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVec
 void UpDownFourOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
-#pragma omp parallel
+  const size_t numberOfThreads =
+      sgpp::base::ExecutionContext::getInstance().getNumberOfThreadsForRegion();
+
+  UpDownResultReduction reduction(result.getSize(), numberOfThreads);
+
+#pragma omp parallel shared(alpha, result, reduction) num_threads(numberOfThreads)
   {
 #pragma omp single nowait
     {
@@ -88,22 +95,18 @@ void UpDownFourOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVecto
         for (size_t j = 0; j < this->numAlgoDims_; j++) {
           for (size_t k = 0; k < this->numAlgoDims_; k++) {
             for (size_t l = 0; l < this->numAlgoDims_; l++) {
-#pragma omp task firstprivate(i, j) shared(alpha, result)
+#pragma omp task firstprivate(i, j, k, l) shared(alpha, result, reduction)
               {
                 sgpp::base::DataVector beta(result.getSize());
 
                 if (this->coefs != nullptr) {
                   if (this->coefs[i][j][k][l] != 0.0) {
                     this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j, k, l);
-
-#pragma omp critical
-                    { result.axpy(this->coefs[i][j][k][l], beta); }
+                    reduction.axpy(this->coefs[i][j][k][l], beta);
                   }
                 } else {
                   this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j, k, l);
-
-#pragma omp critical
-                  { result.add(beta); }
+                  reduction.add(beta);
                 }
               }
             }
@@ -112,6 +115,8 @@ void UpDownFourOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVecto
       }
 
 #pragma omp taskwait
+
+      reduction.reduce(result);
     }
   }
 }
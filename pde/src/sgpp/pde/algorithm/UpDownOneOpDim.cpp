@@ -4,7 +4,9 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/pde/algorithm/UpDownOneOpDim.hpp>
+#include <sgpp/pde/algorithm/UpDownResultReduction.hpp>
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
@@ -27,32 +29,35 @@ UpDownOneOpDim::~UpDownOneOpDim() {}
 void UpDownOneOpDim::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
-#pragma omp parallel
+  const size_t numberOfThreads =
+      sgpp::base::ExecutionContext::getInstance().getNumberOfThreadsForRegion();
+
+  UpDownResultReduction reduction(result.getSize(), numberOfThreads);
+
+#pragma omp parallel shared(alpha, result, reduction) num_threads(numberOfThreads)
   {
 #pragma omp single nowait
     {
       for (size_t i = 0; i < this->numAlgoDims_; i++) {
-#pragma omp task firstprivate(i) shared(alpha, result)
+#pragma omp task firstprivate(i) shared(alpha, result, reduction)
         {
           sgpp::base::DataVector beta(result.getSize());
 
           if (this->coefs != nullptr) {
             if (this->coefs->get(i) != 0.0) {
               this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-              { result.axpy(this->coefs->get(i), beta); }
+              reduction.axpy(this->coefs->get(i), beta);
             }
           } else {
             this->updown(alpha, beta, this->numAlgoDims_ - 1, i);
-
-#pragma omp critical
-            { result.add(beta); }
+            reduction.add(beta);
           }
         }
       }
 
 #pragma omp taskwait
+
+      reduction.reduce(result);
     }
   }
 }
@@ -5,6 +5,7 @@
 
 #include <sgpp/pde/algorithm/UpDownOneOpDimEnhanced.hpp>
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
@@ -32,7 +33,10 @@ void UpDownOneOpDimEnhanced::mult(sgpp::base::DataVector& alpha, sgpp::base::Dat
   result.setAll(0.0);
   maAlpha.expand(alpha);
 
-#pragma omp parallel
+  const size_t numberOfThreads =
+      sgpp::base::ExecutionContext::getInstance().getNumberOfThreadsForRegion();
+
+#pragma omp parallel num_threads(numberOfThreads)
   {
 #pragma omp single nowait
     { this->updown(maAlpha, beta, this->numAlgoDims_ - 1); }
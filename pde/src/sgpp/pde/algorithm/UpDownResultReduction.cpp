@@ -0,0 +1,92 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/algorithm/UpDownResultReduction.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <sgpp/base/tools/ExecutionContext.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+const size_t UpDownResultReduction::chunkSize;
+
+UpDownResultReduction::UpDownResultReduction(size_t size, size_t numberOfThreads) : size(size) {
+  size_t numThreads = std::max(
+      numberOfThreads, sgpp::base::ExecutionContext::getInstance().getNumberOfThreads());
+#ifdef _OPENMP
+  numThreads = std::max(numThreads, std::max(static_cast<size_t>(omp_get_max_threads()),
+                                             static_cast<size_t>(omp_get_num_threads())));
+#endif
+  buffers.resize(std::max(numThreads, static_cast<size_t>(1)));
+}
+
+UpDownResultReduction::~UpDownResultReduction() {}
+
+sgpp::base::DataVector& UpDownResultReduction::getBuffer() {
+  size_t threadNum = 0;
+#ifdef _OPENMP
+  threadNum = static_cast<size_t>(omp_get_thread_num());
+#endif
+
+  if (buffers[threadNum] == nullptr) {
+    buffers[threadNum].reset(new sgpp::base::DataVector(size, 0.0));
+  }
+
+  return *buffers[threadNum];
+}
+
+void UpDownResultReduction::axpy(double a, sgpp::base::DataVector& x) { getBuffer().axpy(a, x); }
+
+void UpDownResultReduction::add(sgpp::base::DataVector& x) { getBuffer().add(x); }
+
+void UpDownResultReduction::reduce(sgpp::base::DataVector& result) {
+  std::vector<double*> partialResults;
+
+  for (auto& buffer : buffers) {
+    if (buffer != nullptr) {
+      partialResults.push_back(buffer->getPointer());
+    }
+  }
+
+  const size_t numPartialResults = partialResults.size();
+
+  for (size_t stride = 1; stride < numPartialResults; stride *= 2) {
+    for (size_t i = 0; i + stride < numPartialResults; i += 2 * stride) {
+      for (size_t start = 0; start < size; start += chunkSize) {
+#pragma omp task firstprivate(i, stride, start) shared(partialResults)
+        {
+          double* x = partialResults[i];
+          const double* y = partialResults[i + stride];
+          const size_t end = std::min(start + chunkSize, size);
+
+          for (size_t k = start; k < end; k++) {
+            x[k] += y[k];
+          }
+        }
+      }
+    }
+
+#pragma omp taskwait
+  }
+
+  if (numPartialResults > 0) {
+    double* resultData = result.getPointer();
+
+    for (size_t k = 0; k < size; k++) {
+      resultData[k] += partialResults[0][k];
+    }
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,86 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef UPDOWNRESULTREDUCTION_HPP
+#define UPDOWNRESULTREDUCTION_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Accumulates the partial results of the OpenMP tasks of the up/down schemes
+ * (one task per operation dimension) without critical sections or locks.
+ *
+ * Every thread of the current team adds the results of its tasks to its own
+ * buffer, which is allocated on first use. Since OpenMP tasks are tied by default,
+ * a task is always resumed by the thread that started it, hence no two threads ever
+ * write to the same buffer. Finally, the buffers are summed up pairwise in a
+ * binary tree, whose levels are again processed by OpenMP tasks.
+ */
+class UpDownResultReduction {
+ public:
+  /**
+   * Constructor, has to be called by the thread that creates the tasks
+   * (i.e., within the parallel region or right before it).
+   *
+   * @param size            size of the result vectors
+   * @param numberOfThreads number of threads of the team that executes the tasks
+   *                        (0 to use the maximum of the execution context and OpenMP settings)
+   */
+  explicit UpDownResultReduction(size_t size, size_t numberOfThreads = 0);
+
+  /**
+   * Destructor
+   */
+  ~UpDownResultReduction();
+
+  /**
+   * Adds a scaled partial result to the buffer of the calling thread.
+   *
+   * @param a scalar factor
+   * @param x partial result
+   */
+  void axpy(double a, sgpp::base::DataVector& x);
+
+  /**
+   * Adds a partial result to the buffer of the calling thread.
+   *
+   * @param x partial result
+   */
+  void add(sgpp::base::DataVector& x);
+
+  /**
+   * Sums up the buffers of all threads in a binary tree and adds the sum to result.
+   * Has to be called after all tasks have finished (i.e., after a taskwait).
+   *
+   * @param result vector to which the sum of all partial results is added
+   */
+  void reduce(sgpp::base::DataVector& result);
+
+ protected:
+  /**
+   * @return buffer of the calling thread, allocated on first use
+   */
+  sgpp::base::DataVector& getBuffer();
+
+  /// size of the result vectors
+  size_t size;
+  /// one buffer per thread, nullptr if the thread did not contribute
+  std::vector<std::unique_ptr<sgpp::base::DataVector>> buffers;
+  /// number of vector entries per task in the tree reduction
+  static const size_t chunkSize = 16384;
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* UPDOWNRESULTREDUCTION_HPP */
@@ -4,7 +4,9 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/pde/algorithm/UpDownTwoOpDims.hpp>
+#include <sgpp/pde/algorithm/UpDownResultReduction.hpp>
 
+#include <sgpp/base/tools/ExecutionContext.hpp>
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
@@ -27,7 +29,12 @@ UpDownTwoOpDims::~UpDownTwoOpDims() {}
 void UpDownTwoOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
   result.setAll(0.0);
 
-#pragma omp parallel
+  const size_t numberOfThreads =
+      sgpp::base::ExecutionContext::getInstance().getNumberOfThreadsForRegion();
+
+  UpDownResultReduction reduction(result.getSize(), numberOfThreads);
+
+#pragma omp parallel shared(alpha, result, reduction) num_threads(numberOfThreads)
   {
 #pragma omp single nowait
     {
@@ -35,22 +42,18 @@ void UpDownTwoOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector
         for (size_t j = 0; j < this->numAlgoDims_; j++) {
           // use the operator's symmetry
           if (j <= i) {
-#pragma omp task firstprivate(i, j) shared(alpha, result)
+#pragma omp task firstprivate(i, j) shared(alpha, result, reduction)
             {
               sgpp::base::DataVector beta(result.getSize());
 
               if (this->coefs != nullptr) {
                 if (this->coefs->get(i, j) != 0.0) {
                   this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j);
-
-#pragma omp critical
-                  { result.axpy(this->coefs->get(i, j), beta); }
+                  reduction.axpy(this->coefs->get(i, j), beta);
                 }
               } else {
                 this->updown(alpha, beta, this->numAlgoDims_ - 1, i, j);
-
-#pragma omp critical
-                { result.add(beta); }
+                reduction.add(beta);
               }
             }
           }
@@ -58,6 +61,8 @@ void UpDownTwoOpDims::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector
       }
 
 #pragma omp taskwait
+
+      reduction.reduce(result);
     }
   }
 }
@@ -50,6 +50,18 @@ void HeatEquationSolver::constructGrid(base::BoundingBox& BoundingBox, size_t le
 
 void HeatEquationSolver::setHeatCoefficient(double a) { this->a = a; }
 
+OperationParabolicPDESolverSystemDirichlet* HeatEquationSolver::createSolverSystem(
+    base::DataVector& alpha, double timestepsize, std::string operationMode) {
+#ifdef _OPENMP
+  if (!this->useSparseOperators) {
+    return new HeatEquationParabolicPDESolverSystemParallelOMP(*this->myGrid, alpha, this->a,
+                                                               timestepsize, operationMode);
+  }
+#endif
+  return new HeatEquationParabolicPDESolverSystem(*this->myGrid, alpha, this->a, timestepsize,
+                                                  operationMode, this->useSparseOperators);
+}
+
 void HeatEquationSolver::solveExplicitEuler(size_t numTimesteps, double timestepsize,
                                             size_t maxCGIterations, double epsilonCG,
                                             base::DataVector& alpha, bool verbose,
@@ -60,14 +72,8 @@ void HeatEquationSolver::solveExplicitEuler(size_t numTimesteps, double timestep
     solver::Euler* myEuler = new solver::Euler(
         "ExEul", numTimesteps, timestepsize, generateAnimation, this->myScreen);
     solver::ConjugateGradients* myCG = new solver::ConjugateGradients(maxCGIterations, epsilonCG);
-#ifdef _OPENMP
-    HeatEquationParabolicPDESolverSystemParallelOMP* myHESolver =
-        new HeatEquationParabolicPDESolverSystemParallelOMP(*this->myGrid, alpha, this->a,
-                                                            timestepsize, "ExEul");
-#else
-    HeatEquationParabolicPDESolverSystem* myHESolver = new HeatEquationParabolicPDESolverSystem(
-        *this->myGrid, alpha, this->a, timestepsize, "ExEul");
-#endif
+    OperationParabolicPDESolverSystemDirichlet* myHESolver =
+        createSolverSystem(alpha, timestepsize, "ExEul");
     base::SGppStopwatch* myStopwatch = new base::SGppStopwatch();
 
     myStopwatch->start();
@@ -98,14 +104,8 @@ void HeatEquationSolver::solveImplicitEuler(size_t numTimesteps, double timestep
     solver::Euler* myEuler = new solver::Euler(
         "ImEul", numTimesteps, timestepsize, generateAnimation, this->myScreen);
     solver::ConjugateGradients* myCG = new solver::ConjugateGradients(maxCGIterations, epsilonCG);
-#ifdef _OPENMP
-    HeatEquationParabolicPDESolverSystemParallelOMP* myHESolver =
-        new HeatEquationParabolicPDESolverSystemParallelOMP(*this->myGrid, alpha, this->a,
-                                                            timestepsize, "ImEul");
-#else
-    HeatEquationParabolicPDESolverSystem* myHESolver = new HeatEquationParabolicPDESolverSystem(
-        *this->myGrid, alpha, this->a, timestepsize, "ImEul");
-#endif
+    OperationParabolicPDESolverSystemDirichlet* myHESolver =
+        createSolverSystem(alpha, timestepsize, "ImEul");
     base::SGppStopwatch* myStopwatch = new base::SGppStopwatch();
 
     myStopwatch->start();
@@ -134,14 +134,8 @@ void HeatEquationSolver::solveCrankNicolson(size_t numTimesteps, double timestep
     this->myScreen->writeStartSolve("Multidimensional Heat Equation Solver");
     double dNeededTime;
     solver::ConjugateGradients* myCG = new solver::ConjugateGradients(maxCGIterations, epsilonCG);
-#ifdef _OPENMP
-    HeatEquationParabolicPDESolverSystemParallelOMP* myHESolver =
-        new HeatEquationParabolicPDESolverSystemParallelOMP(*this->myGrid, alpha, this->a,
-                                                            timestepsize, "CrNic");
-#else
-    HeatEquationParabolicPDESolverSystem* myHESolver = new HeatEquationParabolicPDESolverSystem(
-        *this->myGrid, alpha, this->a, timestepsize, "CrNic");
-#endif
+    OperationParabolicPDESolverSystemDirichlet* myHESolver =
+        createSolverSystem(alpha, timestepsize, "CrNic");
     base::SGppStopwatch* myStopwatch = new base::SGppStopwatch();
 
     size_t numCNSteps;
@@ -231,7 +225,7 @@ void HeatEquationSolver::storeInnerRHS(base::DataVector& alpha, std::string tFil
                                        double timestepsize) {
   if (this->bGridConstructed) {
     HeatEquationParabolicPDESolverSystem* myHESolver = new HeatEquationParabolicPDESolverSystem(
-        *this->myGrid, alpha, this->a, timestepsize, "ImEul");
+        *this->myGrid, alpha, this->a, timestepsize, "ImEul", this->useSparseOperators);
     base::SGppStopwatch* myStopwatch = new base::SGppStopwatch();
 
     myStopwatch->start();
@@ -266,7 +260,7 @@ void HeatEquationSolver::storeInnerSolution(base::DataVector& alpha, size_t numT
         new solver::Euler("ImEul", numTimesteps, timestepsize, false, this->myScreen);
     solver::ConjugateGradients* myCG = new solver::ConjugateGradients(maxCGIterations, epsilonCG);
     HeatEquationParabolicPDESolverSystem* myHESolver = new HeatEquationParabolicPDESolverSystem(
-        *this->myGrid, alpha, this->a, timestepsize, "ImEul");
+        *this->myGrid, alpha, this->a, timestepsize, "ImEul", this->useSparseOperators);
     base::SGppStopwatch* myStopwatch = new base::SGppStopwatch();
 
     myStopwatch->start();
@@ -7,6 +7,7 @@
 #define HEATEQUATIONSOLVER_HPP
 
 #include <sgpp/pde/application/ParabolicPDESolver.hpp>
+#include <sgpp/pde/operation/hash/OperationParabolicPDESolverSystemDirichlet.hpp>
 
 #include <sgpp/base/grid/type/LinearGrid.hpp>
 #include <sgpp/base/grid/common/BoundingBox.hpp>
@@ -43,6 +44,20 @@ class HeatEquationSolver : public ParabolicPDESolver {
   /// screen object used in this solver
   sgpp::base::ScreenOutput* myScreen;
 
+  /**
+   * Creates the solver system for the time stepping. Without sparse operators, the
+   * OpenMP-parallel system is used if available; the sparse operators are applied by a
+   * parallel sparse matrix-vector product and thus use the sequential system.
+   *
+   * @param alpha the coefficients of the Sparse Gird's basis functions
+   * @param timestepsize the size of the interval one timestep moves forward
+   * @param operationMode ExEul, ImEul or CrNic
+   * @return new solver system, has to be freed after use
+   */
+  OperationParabolicPDESolverSystemDirichlet* createSolverSystem(sgpp::base::DataVector& alpha,
+                                                                 double timestepsize,
+                                                                 std::string operationMode);
+
  public:
   /**
    * Std-Constructor of the solver
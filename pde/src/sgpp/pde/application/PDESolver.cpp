@@ -28,7 +28,8 @@ PDESolver::PDESolver()
       dim(0),
       myBoundingBox(nullptr),
       myGridStorage(nullptr),
-      myGrid(nullptr) {
+      myGrid(nullptr),
+      useSparseOperators(false) {
   // initializers may be wrong - David
   bGridConstructed = false;
 }
@@ -331,5 +332,11 @@ size_t PDESolver::getNumberDimensions() const {
         "PDESolver::getNumberDimensions : A grid wasn't constructed before!");
   }
 }
+
+void PDESolver::setUseSparseOperators(bool useSparseOperators) {
+  this->useSparseOperators = useSparseOperators;
+}
+
+bool PDESolver::getUseSparseOperators() const { return useSparseOperators; }
 }  // namespace pde
 }  // namespace sgpp
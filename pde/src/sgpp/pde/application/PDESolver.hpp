@@ -40,6 +40,8 @@ class PDESolver {
   sgpp::base::GridStorage* myGridStorage;
   /// The Sparse sgpp::base::Grid needed in this classificator
   sgpp::base::Grid* myGrid;
+  /// stores if the PDE operators are assembled into sparse matrices
+  bool useSparseOperators;
   /**
    * This function calculates for every grid point the value
    * of a normal distribution given by norm_mu and norm_sigma.
@@ -282,6 +284,22 @@ class PDESolver {
    * returns 0
    */
   size_t getNumberDimensions() const;
+
+  /**
+   * Selects whether the PDE operators (e.g., Laplace and mass matrix) are assembled once
+   * into sparse matrices, such that each application is a sparse matrix-vector product,
+   * or applied matrix-free by up/down sweeps (default). The sparse operators need more
+   * memory, but pay off if the operators are applied many times (e.g., in implicit
+   * time stepping). They are only available for linear grids.
+   *
+   * @param useSparseOperators true to use sparse operators
+   */
+  void setUseSparseOperators(bool useSparseOperators);
+
+  /**
+   * @return whether the PDE operators are assembled into sparse matrices
+   */
+  bool getUseSparseOperators() const;
 };
 }  // namespace pde
 }  // namespace sgpp
@@ -55,7 +55,8 @@ void PoissonEquationSolver::solvePDE(base::DataVector& alpha, base::DataVector&
   base::SGppStopwatch* myStopwatch = new base::SGppStopwatch();
   solver::ConjugateGradients* myCG = new solver::ConjugateGradients(maxCGIterations, epsilonCG);
   PoissonEquationEllipticPDESolverSystemDirichlet* mySystem =
-      new PoissonEquationEllipticPDESolverSystemDirichlet(*(this->myGrid), rhs);
+      new PoissonEquationEllipticPDESolverSystemDirichlet(*(this->myGrid), rhs,
+                                                          this->useSparseOperators);
 
   std::cout << "Gridpoints (complete grid): " << mySystem->getNumGridPointsComplete() << std::endl;
   std::cout << "Gridpoints (inner grid): " << mySystem->getNumGridPointsInner() << std::endl
@@ -287,7 +288,8 @@ void PoissonEquationSolver::initGridWithExpHeatFullDomain(base::DataVector& alph
 void PoissonEquationSolver::storeInnerRHS(base::DataVector& alpha, std::string tFilename) {
   base::SGppStopwatch* myStopwatch = new base::SGppStopwatch();
   PoissonEquationEllipticPDESolverSystemDirichlet* mySystem =
-      new PoissonEquationEllipticPDESolverSystemDirichlet(*(this->myGrid), alpha);
+      new PoissonEquationEllipticPDESolverSystemDirichlet(*(this->myGrid), alpha,
+                                                          this->useSparseOperators);
 
   std::cout << "Exporting inner right-hand-side..." << std::endl;
   myStopwatch->start();
@@ -314,7 +316,8 @@ void PoissonEquationSolver::storeInnerSolution(base::DataVector& alpha, size_t m
                                                double epsilonCG, std::string tFilename) {
   solver::ConjugateGradients* myCG = new solver::ConjugateGradients(maxCGIterations, epsilonCG);
   PoissonEquationEllipticPDESolverSystemDirichlet* mySystem =
-      new PoissonEquationEllipticPDESolverSystemDirichlet(*(this->myGrid), alpha);
+      new PoissonEquationEllipticPDESolverSystemDirichlet(*(this->myGrid), alpha,
+                                                          this->useSparseOperators);
 
   std::cout << "Exporting inner solution..." << std::endl;
 
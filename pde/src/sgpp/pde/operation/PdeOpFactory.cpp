@@ -68,6 +68,8 @@
 #include <sgpp/pde/operation/hash/OperationLaplaceEnhancedLinear.hpp>
 #include <sgpp/pde/operation/hash/OperationLaplaceEnhancedLinearBoundary.hpp>
 
+#include <sgpp/pde/operation/hash/OperationMatrixSparseLinear.hpp>
+
 #include <sgpp/globaldef.hpp>
 
 #include <cstring>
@@ -296,5 +298,27 @@ base::OperationMatrix* createOperationLaplaceEnhanced(base::Grid& grid,
         "OperationLaplaceEnhanced is not implemented for this grid type.");
   }
 }
+
+base::OperationMatrix* createOperationLaplaceSparse(base::Grid& grid) {
+  if (grid.getType() == base::GridType::Linear ||
+      grid.getType() == base::GridType::LinearL0Boundary ||
+      grid.getType() == base::GridType::LinearBoundary) {
+    return new pde::OperationMatrixSparseLinear(&grid, pde::SparseOperatorType::Laplace);
+  } else {
+    throw base::factory_exception(
+        "OperationLaplaceSparse is not implemented for this grid type.");
+  }
+}
+
+base::OperationMatrix* createOperationLTwoDotProductSparse(base::Grid& grid) {
+  if (grid.getType() == base::GridType::Linear ||
+      grid.getType() == base::GridType::LinearL0Boundary ||
+      grid.getType() == base::GridType::LinearBoundary) {
+    return new pde::OperationMatrixSparseLinear(&grid, pde::SparseOperatorType::LTwoDotProduct);
+  } else {
+    throw base::factory_exception(
+        "OperationLTwoDotProductSparse is not implemented for this grid type.");
+  }
+}
 }  // namespace op_factory
 }  // namespace sgpp
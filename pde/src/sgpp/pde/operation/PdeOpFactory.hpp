@@ -112,6 +112,32 @@ base::OperationMatrix* createOperationLaplaceEnhanced(base::Grid& grid);
  */
 base::OperationMatrix* createOperationLaplaceEnhanced(
     base::Grid& grid, sgpp::base::DataVector& coef);
+
+/**
+ * Factory method, returning an OperationLaplace (OperationMatrix) for the grid at hand,
+ * which is assembled once into a sparse matrix.
+ * Note: object has to be freed after use.
+ *
+ * Applying this operator is a sparse matrix-vector product, which is faster than
+ * the matrix-free up/down implementation if the operator is applied many times.
+ *
+ * @param grid Grid which is to be used
+ * @return Pointer to the new OperationMatrix object for the Grid grid
+ */
+base::OperationMatrix* createOperationLaplaceSparse(base::Grid& grid);
+
+/**
+ * Factory method, returning an OperationLTwoDotProduct (OperationMatrix) for the grid at hand,
+ * which is assembled once into a sparse matrix.
+ * Note: object has to be freed after use.
+ *
+ * Applying this operator is a sparse matrix-vector product, which is faster than
+ * the matrix-free up/down implementation if the operator is applied many times.
+ *
+ * @param grid Grid which is to be used
+ * @return Pointer to the new OperationMatrix object for the Grid grid
+ */
+base::OperationMatrix* createOperationLTwoDotProductSparse(base::Grid& grid);
 }  // namespace op_factory
 }  // namespace sgpp
 
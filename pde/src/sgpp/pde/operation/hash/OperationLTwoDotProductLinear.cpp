@@ -26,7 +26,7 @@ void OperationLTwoDotProductLinear::up(sgpp::base::DataVector& alpha,
   PhiPhiUpBBLinear func(this->storage);
   sgpp::base::sweep<PhiPhiUpBBLinear> s(func, *this->storage);
 
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLTwoDotProductLinear::down(sgpp::base::DataVector& alpha,
@@ -35,7 +35,7 @@ void OperationLTwoDotProductLinear::down(sgpp::base::DataVector& alpha,
   PhiPhiDownBBLinear func(this->storage);
   sgpp::base::sweep<PhiPhiDownBBLinear> s(func, *this->storage);
 
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 }  // namespace pde
 }  // namespace sgpp
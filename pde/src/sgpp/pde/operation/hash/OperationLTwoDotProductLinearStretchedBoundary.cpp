@@ -28,7 +28,7 @@ void OperationLTwoDotProductLinearStretchedBoundary::up(sgpp::base::DataVector&
   PhiPhiUpBBLinearStretchedBoundary func(this->storage);
   sgpp::base::sweep<PhiPhiUpBBLinearStretchedBoundary> s(func, *this->storage);
 
-  s.sweep1D_Boundary(alpha, result, dim);
+  s.sweep1D_BoundaryParallel(alpha, result, dim);
 }
 
 void OperationLTwoDotProductLinearStretchedBoundary::down(sgpp::base::DataVector& alpha,
@@ -38,7 +38,7 @@ void OperationLTwoDotProductLinearStretchedBoundary::down(sgpp::base::DataVector
   PhiPhiDownBBLinearStretchedBoundary func(this->storage);
   sgpp::base::sweep<PhiPhiDownBBLinearStretchedBoundary> s(func, *this->storage);
 
-  s.sweep1D_Boundary(alpha, result, dim);
+  s.sweep1D_BoundaryParallel(alpha, result, dim);
 }
 }  // namespace pde
 }  // namespace sgpp
@@ -103,14 +103,14 @@ void OperationLaplaceExplicitLinear::up(sgpp::base::DataVector& alpha,
                                         sgpp::base::DataVector& result, size_t dim) {
   PhiPhiUpBBLinear func(this->storage);
   sgpp::base::sweep<PhiPhiUpBBLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceExplicitLinear::down(sgpp::base::DataVector& alpha,
                                           sgpp::base::DataVector& result, size_t dim) {
   PhiPhiDownBBLinear func(this->storage);
   sgpp::base::sweep<PhiPhiDownBBLinear> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceExplicitLinear::downOpDim(sgpp::base::DataVector& alpha,
@@ -41,14 +41,14 @@ void OperationLaplaceLinearStretched::up(sgpp::base::DataVector& alpha,
                                          sgpp::base::DataVector& result, size_t dim) {
   PhiPhiUpBBLinearStretched func(this->storage);
   sgpp::base::sweep<PhiPhiUpBBLinearStretched> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinearStretched::down(sgpp::base::DataVector& alpha,
                                            sgpp::base::DataVector& result, size_t dim) {
   PhiPhiDownBBLinearStretched func(this->storage);
   sgpp::base::sweep<PhiPhiDownBBLinearStretched> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplaceLinearStretched::downOpDim(sgpp::base::DataVector& alpha,
@@ -23,7 +23,7 @@ void OperationLaplacePrewavelet::up(sgpp::base::DataVector& alpha, sgpp::base::D
                                     size_t dim) {
   LaplaceUpPrewavelet func(this->storage);
   sgpp::base::sweep<LaplaceUpPrewavelet> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplacePrewavelet::down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
@@ -33,14 +33,14 @@ void OperationLaplacePrewavelet::downOpDim(sgpp::base::DataVector& alpha,
                                            sgpp::base::DataVector& result, size_t dim) {
   LaplaceDownGradientPrewavelet func(this->storage);
   sgpp::base::sweep<LaplaceDownGradientPrewavelet> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 
 void OperationLaplacePrewavelet::upOpDim(sgpp::base::DataVector& alpha,
                                          sgpp::base::DataVector& result, size_t dim) {
   LaplaceUpGradientPrewavelet func(this->storage);
   sgpp::base::sweep<LaplaceUpGradientPrewavelet> s(func, *this->storage);
-  s.sweep1D(alpha, result, dim);
+  s.sweep1DParallel(alpha, result, dim);
 }
 }  // namespace pde
 }  // namespace sgpp
@@ -0,0 +1,371 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/operation/hash/OperationMatrixSparseLinear.hpp>
+
+#include <sgpp/base/exception/data_exception.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
+#include <sgpp/base/tools/ExecutionContext.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+OperationMatrixSparseLinear::OperationMatrixSparseLinear(sgpp::base::Grid* grid,
+                                                         SparseOperatorType type)
+    : storage(grid->getStorage()), type(type) {
+  if (grid->getType() == sgpp::base::GridType::Linear) {
+    hasBoundary = false;
+  } else if ((grid->getType() == sgpp::base::GridType::LinearBoundary) ||
+             (grid->getType() == sgpp::base::GridType::LinearL0Boundary)) {
+    hasBoundary = true;
+  } else {
+    throw sgpp::base::factory_exception(
+        "OperationMatrixSparseLinear: grid type is not supported.");
+  }
+
+  assemble();
+}
+
+OperationMatrixSparseLinear::~OperationMatrixSparseLinear() {}
+
+void OperationMatrixSparseLinear::integrate1D(sgpp::base::level_t l1, sgpp::base::index_t i1,
+                                              sgpp::base::level_t l2, sgpp::base::index_t i2,
+                                              double& mass, double& stiffness) {
+  const double h1 = 1.0 / static_cast<double>(static_cast<sgpp::base::index_t>(1) << l1);
+  const double h2 = 1.0 / static_cast<double>(static_cast<sgpp::base::index_t>(1) << l2);
+  const double x1 = static_cast<double>(i1) * h1;
+  const double x2 = static_cast<double>(i2) * h2;
+
+  mass = 0.0;
+  stiffness = 0.0;
+
+  // intersection of the supports (clipped to the unit interval)
+  const double a = std::max(std::max(x1 - h1, x2 - h2), 0.0);
+  const double b = std::min(std::min(x1 + h1, x2 + h2), 1.0);
+
+  if (b <= a) {
+    return;
+  }
+
+  // both functions are linear between these break points
+  double breakPoints[4] = {a, b, b, b};
+  size_t numBreakPoints = 2;
+
+  if ((x1 > a) && (x1 < b)) breakPoints[numBreakPoints++] = x1;
+  if ((x2 > a) && (x2 < b) && (x2 != x1)) breakPoints[numBreakPoints++] = x2;
+
+  std::sort(breakPoints, breakPoints + numBreakPoints);
+
+  auto phi = [](double x, double xk, double hk) {
+    return std::max(1.0 - std::abs(x - xk) / hk, 0.0);
+  };
+  auto dPhi = [](double x, double xk, double hk) { return ((x < xk) ? 1.0 : -1.0) / hk; };
+
+  for (size_t k = 0; k + 1 < numBreakPoints; k++) {
+    const double left = breakPoints[k];
+    const double right = breakPoints[k + 1];
+    const double mid = 0.5 * (left + right);
+    const double length = right - left;
+
+    // Simpson's rule is exact for the quadratic product of two linear functions
+    mass += length / 6.0 *
+            (phi(left, x1, h1) * phi(left, x2, h2) + 4.0 * phi(mid, x1, h1) * phi(mid, x2, h2) +
+             phi(right, x1, h1) * phi(right, x2, h2));
+    stiffness += length * dPhi(mid, x1, h1) * dPhi(mid, x2, h2);
+  }
+}
+
+void OperationMatrixSparseLinear::findOverlappingPoints(const sgpp::base::GridPoint& rowPoint,
+                                                        sgpp::base::GridPoint& point,
+                                                        size_t startDim,
+                                                        std::vector<size_t>& columns) const {
+  const size_t seq = storage.getSequenceNumber(point);
+
+  if (storage.isInvalidSequenceNumber(seq)) {
+    return;
+  }
+
+  columns.push_back(seq);
+
+  sgpp::base::level_t l, rowL;
+  sgpp::base::index_t i, rowI;
+
+  for (size_t d = startDim; d < storage.getDimension(); d++) {
+    point.get(d, l, i);
+    rowPoint.get(d, rowL, rowI);
+
+    // the supports of the children are nested in the support of the parent,
+    // hence descend only into children whose support overlaps the one of the row
+    const double rowH = 1.0 / static_cast<double>(static_cast<sgpp::base::index_t>(1) << rowL);
+    const double rowX = static_cast<double>(rowI) * rowH;
+
+    if (l == 0) {
+      // boundary basis functions have no children
+      continue;
+    }
+
+    if (hasBoundary && (l == 1)) {
+      // in the hierarchy used for the descent, the boundary functions
+      // are the children of the level one function
+      for (sgpp::base::index_t childI = 0; childI <= 1; childI++) {
+        point.set(d, 0, childI);
+        findOverlappingPoints(rowPoint, point, d, columns);
+      }
+    }
+
+    const double childH = 1.0 / static_cast<double>(static_cast<sgpp::base::index_t>(1) << (l + 1));
+
+    for (sgpp::base::index_t childI = 2 * i - 1; childI <= 2 * i + 1; childI += 2) {
+      const double childX = static_cast<double>(childI) * childH;
+
+      if (std::abs(childX - rowX) < childH + rowH) {
+        point.set(d, l + 1, childI);
+        findOverlappingPoints(rowPoint, point, d, columns);
+      }
+    }
+
+    point.set(d, l, i);
+  }
+}
+
+void OperationMatrixSparseLinear::assemble() {
+  const size_t gridSize = storage.getSize();
+  const size_t dim = storage.getDimension();
+
+  // interval widths of the bounding box scale the one-dimensional integrals
+  std::vector<double> widths(dim, 1.0);
+  sgpp::base::BoundingBox* boundingBox = storage.getBoundingBox();
+
+  if (boundingBox != nullptr) {
+    for (size_t d = 0; d < dim; d++) {
+      widths[d] = boundingBox->getIntervalWidth(d);
+    }
+  }
+
+  // The descent starts at the point with level one in all dimensions and refines
+  // the dimensions in ascending order. Every point is found if the parent of each
+  // point w.r.t. this order is contained in the grid, otherwise we fall back
+  // to testing all pairs of grid points.
+  sgpp::base::GridPoint root(dim);
+
+  for (size_t d = 0; d < dim; d++) {
+    root.set(d, 1, 1);
+  }
+
+  bool isHierarchicallyClosed = (gridSize == 0) || storage.isContaining(root);
+
+  for (size_t k = 0; (k < gridSize) && isHierarchicallyClosed; k++) {
+    sgpp::base::GridPoint parent(storage[k]);
+    sgpp::base::level_t l;
+    sgpp::base::index_t i;
+
+    for (size_t d = dim; d-- > 0;) {
+      parent.get(d, l, i);
+
+      if (l == 0) {
+        parent.set(d, 1, 1);
+      } else if (l > 1) {
+        parent.set(d, l - 1, (i >> 1) | 1);
+      } else {
+        continue;
+      }
+
+      isHierarchicallyClosed = storage.isContaining(parent);
+      break;
+    }
+  }
+
+  std::vector<std::vector<size_t>> rowColumns(gridSize);
+  std::vector<std::vector<double>> rowValues(gridSize);
+
+  const size_t numberOfThreads =
+      sgpp::base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(gridSize);
+
+#pragma omp parallel num_threads(numberOfThreads)
+  {
+    std::vector<size_t> candidates;
+    std::vector<double> mass(dim);
+    std::vector<double> stiffness(dim);
+    sgpp::base::GridPoint point(dim);
+
+#pragma omp for schedule(dynamic, 64)
+    for (size_t k = 0; k < gridSize; k++) {
+      const sgpp::base::GridPoint& rowPoint = storage[k];
+      candidates.clear();
+
+      if (isHierarchicallyClosed) {
+        point = root;
+        findOverlappingPoints(rowPoint, point, 0, candidates);
+        std::sort(candidates.begin(), candidates.end());
+      } else {
+        for (size_t j = 0; j < gridSize; j++) {
+          candidates.push_back(j);
+        }
+      }
+
+      for (size_t j : candidates) {
+        const sgpp::base::GridPoint& columnPoint = storage[j];
+        bool isZero = false;
+
+        for (size_t d = 0; d < dim; d++) {
+          sgpp::base::level_t l1, l2;
+          sgpp::base::index_t i1, i2;
+          rowPoint.get(d, l1, i1);
+          columnPoint.get(d, l2, i2);
+          integrate1D(l1, i1, l2, i2, mass[d], stiffness[d]);
+          mass[d] *= widths[d];
+          stiffness[d] /= widths[d];
+
+          if (mass[d] == 0.0) {
+            isZero = true;
+            break;
+          }
+        }
+
+        if (isZero) {
+          continue;
+        }
+
+        double value = 0.0;
+
+        if (type == SparseOperatorType::LTwoDotProduct) {
+          value = 1.0;
+
+          for (size_t d = 0; d < dim; d++) {
+            value *= mass[d];
+          }
+        } else {
+          for (size_t dLaplace = 0; dLaplace < dim; dLaplace++) {
+            double summand = stiffness[dLaplace];
+
+            for (size_t d = 0; d < dim; d++) {
+              if (d != dLaplace) {
+                summand *= mass[d];
+              }
+            }
+
+            value += summand;
+          }
+        }
+
+        if (value != 0.0) {
+          rowColumns[k].push_back(j);
+          rowValues[k].push_back(value);
+        }
+      }
+    }
+  }
+
+  // concatenate the rows
+  rowPointers.assign(gridSize + 1, 0);
+
+  for (size_t k = 0; k < gridSize; k++) {
+    rowPointers[k + 1] = rowPointers[k] + rowColumns[k].size();
+  }
+
+  columnIndices.resize(rowPointers[gridSize]);
+  values.resize(rowPointers[gridSize]);
+
+#pragma omp parallel for schedule(static) num_threads(numberOfThreads)
+  for (size_t k = 0; k < gridSize; k++) {
+    std::copy(rowColumns[k].begin(), rowColumns[k].end(),
+              columnIndices.begin() + rowPointers[k]);
+    std::copy(rowValues[k].begin(), rowValues[k].end(), values.begin() + rowPointers[k]);
+  }
+}
+
+void OperationMatrixSparseLinear::mult(sgpp::base::DataVector& alpha,
+                                       sgpp::base::DataVector& result) {
+  const size_t gridSize = rowPointers.size() - 1;
+
+  if ((alpha.getSize() != gridSize) || (result.getSize() != gridSize)) {
+    throw sgpp::base::data_exception("Dimensions do not match!");
+  }
+
+  const double* alphaData = alpha.getPointer();
+  double* resultData = result.getPointer();
+
+  const size_t numberOfThreads =
+      sgpp::base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(gridSize);
+
+#pragma omp parallel for schedule(static) num_threads(numberOfThreads)
+  for (size_t k = 0; k < gridSize; k++) {
+    double temp = 0.0;
+
+    for (size_t p = rowPointers[k]; p < rowPointers[k + 1]; p++) {
+      temp += values[p] * alphaData[columnIndices[p]];
+    }
+
+    resultData[k] = temp;
+  }
+}
+
+size_t OperationMatrixSparseLinear::getNumberOfNonZeros() const { return values.size(); }
+
+double OperationMatrixSparseLinear::getEntry(size_t i, size_t j) const {
+  auto first = columnIndices.begin() + rowPointers[i];
+  auto last = columnIndices.begin() + rowPointers[i + 1];
+  auto it = std::lower_bound(first, last, j);
+
+  if ((it != last) && (*it == j)) {
+    return values[it - columnIndices.begin()];
+  } else {
+    return 0.0;
+  }
+}
+
+void OperationMatrixSparseLinear::addScaled(double a, const OperationMatrixSparseLinear& other) {
+  const size_t gridSize = rowPointers.size() - 1;
+
+  if (other.rowPointers.size() != rowPointers.size()) {
+    throw sgpp::base::data_exception("Dimensions do not match!");
+  }
+
+  std::vector<size_t> newRowPointers(gridSize + 1, 0);
+  std::vector<size_t> newColumnIndices;
+  std::vector<double> newValues;
+  newColumnIndices.reserve(std::max(columnIndices.size(), other.columnIndices.size()));
+  newValues.reserve(newColumnIndices.capacity());
+
+  // merge the sorted rows
+  for (size_t k = 0; k < gridSize; k++) {
+    size_t p = rowPointers[k];
+    size_t q = other.rowPointers[k];
+
+    while ((p < rowPointers[k + 1]) || (q < other.rowPointers[k + 1])) {
+      if ((q == other.rowPointers[k + 1]) ||
+          ((p < rowPointers[k + 1]) && (columnIndices[p] < other.columnIndices[q]))) {
+        newColumnIndices.push_back(columnIndices[p]);
+        newValues.push_back(values[p]);
+        p++;
+      } else if ((p == rowPointers[k + 1]) || (other.columnIndices[q] < columnIndices[p])) {
+        newColumnIndices.push_back(other.columnIndices[q]);
+        newValues.push_back(a * other.values[q]);
+        q++;
+      } else {
+        newColumnIndices.push_back(columnIndices[p]);
+        newValues.push_back(values[p] + a * other.values[q]);
+        p++;
+        q++;
+      }
+    }
+
+    newRowPointers[k + 1] = newColumnIndices.size();
+  }
+
+  rowPointers.swap(newRowPointers);
+  columnIndices.swap(newColumnIndices);
+  values.swap(newValues);
+}
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,141 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONMATRIXSPARSELINEAR_HPP
+#define OPERATIONMATRIXSPARSELINEAR_HPP
+
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Type of the bilinear form assembled by OperationMatrixSparseLinear.
+ */
+enum class SparseOperatorType {
+  /// mass matrix \f$(\phi_i, \phi_j)_{L_2}\f$
+  LTwoDotProduct,
+  /// stiffness matrix \f$(\nabla \phi_i, \nabla \phi_j)_{L_2}\f$
+  Laplace
+};
+
+/**
+ * Mass or stiffness matrix of linear grids (with or without boundaries),
+ * assembled once into the compressed sparse row (CSR) format.
+ *
+ * In contrast to the matrix-free up/down implementations, each application of
+ * the operator is a single (OpenMP-parallel) sparse matrix-vector product, which
+ * pays off if the operator is applied many times on a fixed grid (e.g., in
+ * implicit time stepping). In contrast to the explicit operators, only the
+ * non-zero entries are stored: two hierarchical basis functions interact only if
+ * their supports overlap in every dimension, i.e., if they are hierarchical
+ * ancestors or descendants of each other in each dimension. The non-zero
+ * pattern of each row is found by a descent through the hierarchy that prunes
+ * all subtrees whose supports are disjoint from the support of the row's basis
+ * function; the entries are products of exact one-dimensional integrals.
+ */
+class OperationMatrixSparseLinear : public sgpp::base::OperationMatrix {
+ public:
+  /**
+   * Constructor, assembles the matrix.
+   *
+   * @param grid  the linear grid (Linear, LinearBoundary or LinearL0Boundary)
+   * @param type  the bilinear form to assemble
+   */
+  OperationMatrixSparseLinear(sgpp::base::Grid* grid, SparseOperatorType type);
+
+  /**
+   * Destructor
+   */
+  ~OperationMatrixSparseLinear() override;
+
+  /**
+   * Sparse matrix-vector product.
+   *
+   * @param alpha DataVector that is multiplied to the matrix
+   * @param result DataVector into which the result of multiplication is stored
+   */
+  void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) override;
+
+  /**
+   * @return number of stored non-zero entries
+   */
+  size_t getNumberOfNonZeros() const;
+
+  /**
+   * @param i row index
+   * @param j column index
+   * @return entry of the assembled matrix (zero if not stored)
+   */
+  double getEntry(size_t i, size_t j) const;
+
+  /**
+   * Adds a multiple of another assembled matrix of the same grid, i.e.,
+   * this = this + a * other. The sparsity patterns are merged, hence this can be used
+   * to assemble system matrices of time stepping schemes like M + dt * L once.
+   * The type of this operator remains unchanged.
+   *
+   * @param a     scalar factor
+   * @param other matrix to be added, must have the same size
+   */
+  void addScaled(double a, const OperationMatrixSparseLinear& other);
+
+ protected:
+  /**
+   * Assembles the matrix.
+   */
+  void assemble();
+
+  /**
+   * Appends the sequence numbers of all grid points whose basis functions
+   * overlap with the one of the given row point, starting the hierarchical
+   * descent at the given point and refining only in dimensions >= startDim.
+   *
+   * @param rowPoint  grid point of the current row
+   * @param point     current point of the descent (is restored on return)
+   * @param startDim  first dimension in which point may be refined
+   * @param columns   sequence numbers of the overlapping grid points
+   */
+  void findOverlappingPoints(const sgpp::base::GridPoint& rowPoint, sgpp::base::GridPoint& point,
+                             size_t startDim, std::vector<size_t>& columns) const;
+
+  /**
+   * Computes the one-dimensional integrals of two hat functions on [0, 1].
+   *
+   * @param l1        level of the first hat function
+   * @param i1        index of the first hat function
+   * @param l2        level of the second hat function
+   * @param i2        index of the second hat function
+   * @param mass      \f$\int \phi_1 \phi_2\f$
+   * @param stiffness \f$\int \phi_1' \phi_2'\f$
+   */
+  static void integrate1D(sgpp::base::level_t l1, sgpp::base::index_t i1, sgpp::base::level_t l2,
+                          sgpp::base::index_t i2, double& mass, double& stiffness);
+
+  /// the grid's storage
+  sgpp::base::GridStorage& storage;
+  /// assembled bilinear form
+  SparseOperatorType type;
+  /// whether the grid contains boundary points
+  bool hasBoundary;
+  /// row pointers (CSR)
+  std::vector<size_t> rowPointers;
+  /// column indices (CSR)
+  std::vector<size_t> columnIndices;
+  /// non-zero values (CSR)
+  std::vector<double> values;
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* OPERATIONMATRIXSPARSELINEAR_HPP */
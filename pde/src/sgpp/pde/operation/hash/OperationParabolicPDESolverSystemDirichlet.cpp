@@ -448,5 +448,11 @@ sgpp::base::DataVector* OperationParabolicPDESolverSystemDirichlet::getGridCoeff
 
   return this->alpha_inner;
 }
+
+void OperationParabolicPDESolverSystemDirichlet::setGridCoefficients(
+    sgpp::base::DataVector& alpha) {
+  sgpp::solver::OperationParabolicPDESolverSystem::setGridCoefficients(alpha);
+  this->GridConverter->calcInnerCoefs(*this->alpha_complete, *this->alpha_inner);
+}
 }  // namespace pde
 }  // namespace sgpp
@@ -110,6 +110,15 @@ class OperationParabolicPDESolverSystemDirichlet
   virtual sgpp::base::DataVector* generateRHS();
 
   virtual sgpp::base::DataVector* getGridCoefficientsForCG();
+
+  /**
+   * replaces the sparse grid's coefficients (with boundaries) the system works on and
+   * recomputes the inner coefficients from them, such that no coefficients of the
+   * previous vector are left in the system
+   *
+   * @param alpha alpha vector of complete grid
+   */
+  virtual void setGridCoefficients(sgpp::base::DataVector& alpha);
 };
 }  // namespace pde
 }  // namespace sgpp
@@ -0,0 +1,190 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp_base.hpp>
+#include <sgpp_pde.hpp>
+#include <sgpp_solver.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+/*
+ * The sparse assembled operators have to coincide with the matrix-free operators
+ * for random coefficient vectors.
+ */
+void compareSparseToMatrixFree(sgpp::base::Grid& grid) {
+  std::unique_ptr<sgpp::base::OperationMatrix> opLaplace(
+      sgpp::op_factory::createOperationLaplace(grid));
+  std::unique_ptr<sgpp::base::OperationMatrix> opLaplaceSparse(
+      sgpp::op_factory::createOperationLaplaceSparse(grid));
+  std::unique_ptr<sgpp::base::OperationMatrix> opMass(
+      sgpp::op_factory::createOperationLTwoDotProduct(grid));
+  std::unique_ptr<sgpp::base::OperationMatrix> opMassSparse(
+      sgpp::op_factory::createOperationLTwoDotProductSparse(grid));
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  sgpp::base::DataVector alpha(grid.getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = distribution(generator);
+  }
+
+  sgpp::base::DataVector result(grid.getSize());
+  sgpp::base::DataVector resultSparse(grid.getSize());
+
+  opLaplace->mult(alpha, result);
+  opLaplaceSparse->mult(alpha, resultSparse);
+
+  for (size_t i = 0; i < grid.getSize(); i++) {
+    BOOST_CHECK_SMALL(result[i] - resultSparse[i], 1e-10);
+  }
+
+  opMass->mult(alpha, result);
+  opMassSparse->mult(alpha, resultSparse);
+
+  for (size_t i = 0; i < grid.getSize(); i++) {
+    BOOST_CHECK_SMALL(result[i] - resultSparse[i], 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(testOperationMatrixSparse)
+
+BOOST_AUTO_TEST_CASE(testOperationMatrixSparseLinear) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(3));
+  grid->getGenerator().regular(5);
+  compareSparseToMatrixFree(*grid);
+
+  // adaptive grid
+  sgpp::base::DataVector alpha(grid->getSize());
+
+  for (size_t i = 0; i < alpha.getSize(); i++) {
+    alpha[i] = static_cast<double>(i % 7);
+  }
+
+  sgpp::base::SurplusRefinementFunctor functor(alpha, 10);
+  grid->getGenerator().refine(functor);
+  compareSparseToMatrixFree(*grid);
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMatrixSparseLinearBoundary) {
+  sgpp::base::BoundingBox boundingBox(
+      {sgpp::base::BoundingBox1D(0.0, 2.0), sgpp::base::BoundingBox1D(-1.0, 0.5),
+       sgpp::base::BoundingBox1D(0.0, 1.0)});
+  std::unique_ptr<sgpp::base::Grid> grid(new sgpp::base::LinearBoundaryGrid(boundingBox));
+  grid->getGenerator().regular(4);
+  compareSparseToMatrixFree(*grid);
+
+  std::unique_ptr<sgpp::base::Grid> gridL0(sgpp::base::Grid::createLinearBoundaryGrid(3, 0));
+  gridL0->getGenerator().regular(3);
+  compareSparseToMatrixFree(*gridL0);
+}
+
+BOOST_AUTO_TEST_CASE(testHeatEquationWarmStartTimestepping) {
+  sgpp::base::BoundingBox boundingBox(
+      std::vector<sgpp::base::BoundingBox1D>(2, sgpp::base::BoundingBox1D(0.0, 1.0, true, true)));
+  sgpp::base::LinearBoundaryGrid grid(boundingBox);
+  grid.getGenerator().regular(4);
+  sgpp::base::GridStorage& storage = grid.getStorage();
+
+  const size_t numberOfTimesteps = 10;
+  const double timestepSize = 1e-4;
+
+  // smooth initial conditions with homogeneous Dirichlet boundary values (the extrapolated
+  // initial guess only pays off for solutions that are smooth in time)
+  std::unique_ptr<sgpp::base::OperationHierarchisation> opHierarchisation(
+      sgpp::op_factory::createOperationHierarchisation(grid));
+  std::vector<sgpp::base::DataVector> alphas(3, sgpp::base::DataVector(grid.getSize()));
+
+  for (size_t k = 0; k < alphas.size(); k++) {
+    for (size_t i = 0; i < grid.getSize(); i++) {
+      const sgpp::base::DataVector x = storage.getCoordinates(storage[i]);
+      alphas[k][i] = std::sin(static_cast<double>(k + 1) * M_PI * x[0]) * std::sin(M_PI * x[1]);
+    }
+
+    opHierarchisation->doHierarchisation(alphas[k]);
+  }
+
+  // reference: matrix-free operators, standard implicit Euler, solved accurately
+  sgpp::solver::ConjugateGradients cgReference(1000, 1e-12);
+  std::vector<sgpp::base::DataVector> alphasReference(alphas);
+
+  for (auto& alpha : alphasReference) {
+    sgpp::pde::HeatEquationParabolicPDESolverSystem system(grid, alpha, 0.5, timestepSize,
+                                                           "ImEul");
+    sgpp::solver::Euler euler("ImEul", numberOfTimesteps, timestepSize, false);
+    euler.solve(cgReference, system);
+  }
+
+  // sparse operators and a realistic (relative) tolerance: the warm start has to need
+  // fewer CG iterations than the standard implicit Euler, which starts CG with the
+  // solution of the last timestep
+  sgpp::solver::ConjugateGradients cg(1000, 1e-6);
+  std::vector<size_t> numbersOfIterationsWarmStart;
+
+  for (size_t k = 0; k < alphas.size(); k++) {
+    sgpp::base::DataVector alphaEuler(alphas[k]);
+    size_t numberOfIterationsEuler;
+    {
+      sgpp::pde::HeatEquationParabolicPDESolverSystem system(grid, alphaEuler, 0.5, timestepSize,
+                                                             "ImEul", true);
+      sgpp::solver::Euler euler("ImEul", numberOfTimesteps, timestepSize, false);
+      euler.solve(cg, system);
+      numberOfIterationsEuler = euler.getNumberIterations();
+    }
+
+    sgpp::base::DataVector alpha(alphas[k]);
+    {
+      sgpp::pde::HeatEquationParabolicPDESolverSystem system(grid, alpha, 0.5, timestepSize,
+                                                             "ImEul", true);
+      sgpp::solver::WarmStartTimestepping timestepping(numberOfTimesteps, timestepSize);
+      timestepping.solve(cg, system);
+      numbersOfIterationsWarmStart.push_back(timestepping.getNumberIterations());
+    }
+
+    BOOST_CHECK_LT(numbersOfIterationsWarmStart[k], numberOfIterationsEuler);
+
+    for (size_t i = 0; i < grid.getSize(); i++) {
+      BOOST_CHECK_SMALL(alpha[i] - alphasReference[k][i], 1e-4);
+    }
+  }
+
+  // sparse operators, all initial conditions with one system; every initial condition
+  // has to get exactly the same initial guesses (and thus numbers of iterations) as on
+  // its own, i.e., no coefficients of another initial condition may be left in the system
+  std::vector<sgpp::base::DataVector*> alphaPointers;
+
+  for (auto& alpha : alphas) {
+    alphaPointers.push_back(&alpha);
+  }
+
+  sgpp::base::DataVector alphaSystem(alphas[0]);
+  {
+    sgpp::pde::HeatEquationParabolicPDESolverSystem system(grid, alphaSystem, 0.5, timestepSize,
+                                                           "ImEul", true);
+    sgpp::solver::WarmStartTimestepping timestepping(numberOfTimesteps, timestepSize);
+    timestepping.solveBatch(cg, system, alphaPointers);
+    BOOST_CHECK_EQUAL(system.getGridCoefficients(), &alphaSystem);
+    BOOST_CHECK_EQUAL(timestepping.getNumberIterations(),
+                      std::accumulate(numbersOfIterationsWarmStart.begin(),
+                                      numbersOfIterationsWarmStart.end(), size_t{0}));
+  }
+
+  for (size_t k = 0; k < alphas.size(); k++) {
+    for (size_t i = 0; i < grid.getSize(); i++) {
+      BOOST_CHECK_SMALL(alphas[k][i] - alphasReference[k][i], 1e-4);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
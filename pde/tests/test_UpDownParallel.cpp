@@ -0,0 +1,353 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp_base.hpp>
+#include <sgpp_pde.hpp>
+#include <sgpp/base/algorithm/sweep.hpp>
+#include <sgpp/base/tools/ExecutionContext.hpp>
+#include <sgpp/pde/algorithm/UpDownFourOpDims.hpp>
+#include <sgpp/pde/algorithm/UpDownResultReduction.hpp>
+#include <sgpp/pde/algorithm/UpDownTwoOpDims.hpp>
+#include <sgpp/pde/basis/linear/noboundary/DowndPhidPhiBBIterativeLinear.hpp>
+#include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiDownBBLinear.hpp>
+#include <sgpp/pde/basis/linear/noboundary/algorithm_sweep/PhiPhiUpBBLinear.hpp>
+#include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::ExecutionContext;
+using sgpp::base::GridStorage;
+
+/// number of threads of the parallel runs (the sequential runs use a single thread)
+const size_t NUMBER_OF_THREADS = 4;
+/// number of grid points from which on the sweeps spawn tasks (see sweep::minTaskGridSize_)
+const size_t MIN_TASK_GRID_SIZE = 4096;
+
+/*
+ * Up/down building blocks of the linear basis without boundaries, the up and down parts
+ * use the task-parallel sweeps.
+ */
+void upTest(GridStorage& storage, DataVector& alpha, DataVector& result, size_t dim) {
+  sgpp::pde::PhiPhiUpBBLinear func(&storage);
+  sgpp::base::sweep<sgpp::pde::PhiPhiUpBBLinear> s(func, storage);
+  s.sweep1DParallel(alpha, result, dim);
+}
+
+void downTest(GridStorage& storage, DataVector& alpha, DataVector& result, size_t dim) {
+  sgpp::pde::PhiPhiDownBBLinear func(&storage);
+  sgpp::base::sweep<sgpp::pde::PhiPhiDownBBLinear> s(func, storage);
+  s.sweep1DParallel(alpha, result, dim);
+}
+
+void downOpDimTest(GridStorage& storage, DataVector& alpha, DataVector& result, size_t dim) {
+  sgpp::pde::DowndPhidPhiBBIterativeLinear myDown(&storage);
+  myDown(alpha, result, dim);
+}
+
+/*
+ * Operator with two operation dimensions, which is the sum of all mixed products of
+ * first derivatives (weighted by the coefficients).
+ */
+class TestUpDownTwoOpDims : public sgpp::pde::UpDownTwoOpDims {
+ public:
+  TestUpDownTwoOpDims(GridStorage* storage, DataMatrix& coef) : UpDownTwoOpDims(storage, coef) {}
+
+ protected:
+  void up(DataVector& alpha, DataVector& result, size_t dim) override {
+    upTest(*this->storage, alpha, result, dim);
+  }
+
+  void down(DataVector& alpha, DataVector& result, size_t dim) override {
+    downTest(*this->storage, alpha, result, dim);
+  }
+
+  void downOpDimOne(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimOne(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimTwo(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimTwo(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimOneAndOpDimTwo(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimOneAndOpDimTwo(DataVector& alpha, DataVector& result, size_t dim) override {}
+};
+
+/*
+ * Operator with four operation dimensions, which is the (unweighted) sum of all
+ * mixed products of first derivatives.
+ */
+class TestUpDownFourOpDims : public sgpp::pde::UpDownFourOpDims {
+ public:
+  explicit TestUpDownFourOpDims(GridStorage* storage) : UpDownFourOpDims(storage) {}
+
+ protected:
+  void up(DataVector& alpha, DataVector& result, size_t dim) override {
+    upTest(*this->storage, alpha, result, dim);
+  }
+
+  void down(DataVector& alpha, DataVector& result, size_t dim) override {
+    downTest(*this->storage, alpha, result, dim);
+  }
+
+  void downOpDimOne(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimOne(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimTwo(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimTwo(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimThree(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimThree(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimFour(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimFour(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimOneAndOpDimTwo(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimOneAndOpDimTwo(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimOneAndOpDimThree(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimOneAndOpDimThree(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimOneAndOpDimFour(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimOneAndOpDimFour(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimTwoAndOpDimThree(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimTwoAndOpDimThree(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimTwoAndOpDimFour(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimTwoAndOpDimFour(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimThreeAndOpDimFour(DataVector& alpha, DataVector& result, size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimThreeAndOpDimFour(DataVector& alpha, DataVector& result, size_t dim) override {}
+
+  void downOpDimOneAndOpDimTwoAndOpDimThree(DataVector& alpha, DataVector& result,
+                                            size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimOneAndOpDimTwoAndOpDimThree(DataVector& alpha, DataVector& result,
+                                          size_t dim) override {}
+
+  void downOpDimOneAndOpDimTwoAndOpDimFour(DataVector& alpha, DataVector& result,
+                                           size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimOneAndOpDimTwoAndOpDimFour(DataVector& alpha, DataVector& result,
+                                         size_t dim) override {}
+
+  void downOpDimOneAndOpDimThreeAndOpDimFour(DataVector& alpha, DataVector& result,
+                                             size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimOneAndOpDimThreeAndOpDimFour(DataVector& alpha, DataVector& result,
+                                           size_t dim) override {}
+
+  void downOpDimTwoAndOpDimThreeAndOpDimFour(DataVector& alpha, DataVector& result,
+                                             size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimTwoAndOpDimThreeAndOpDimFour(DataVector& alpha, DataVector& result,
+                                           size_t dim) override {}
+
+  void downOpDimOneAndOpDimTwoAndOpDimThreeAndOpDimFour(DataVector& alpha, DataVector& result,
+                                                        size_t dim) override {
+    downOpDimTest(*this->storage, alpha, result, dim);
+  }
+
+  void upOpDimOneAndOpDimTwoAndOpDimThreeAndOpDimFour(DataVector& alpha, DataVector& result,
+                                                      size_t dim) override {}
+};
+
+/*
+ * Applies the operator once with a single thread (sequential sweeps and reduction)
+ * and once with several threads (task-parallel sweeps and tree reduction over the
+ * per-thread buffers) and compares the results.
+ */
+void compareParallelToSequential(sgpp::base::OperationMatrix& op, size_t gridSize) {
+  // the grid has to be large enough for the sweeps to spawn tasks
+  BOOST_REQUIRE_GE(gridSize, MIN_TASK_GRID_SIZE);
+
+  ExecutionContext& context = ExecutionContext::getInstance();
+  const size_t oldNumberOfThreads = context.getNumberOfThreads();
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  DataVector alpha(gridSize);
+
+  for (size_t i = 0; i < gridSize; i++) {
+    alpha[i] = distribution(generator);
+  }
+
+  DataVector resultSequential(gridSize);
+  DataVector resultParallel(gridSize);
+
+  context.setNumberOfThreads(1);
+  op.mult(alpha, resultSequential);
+  context.setNumberOfThreads(NUMBER_OF_THREADS);
+  op.mult(alpha, resultParallel);
+  context.setNumberOfThreads(oldNumberOfThreads);
+
+  // the summation order differs, hence the results only coincide up to round-off
+  const double tolerance = 1e-12 * std::max(resultSequential.maxNorm(), 1.0);
+  BOOST_CHECK_GT(resultSequential.l2Norm(), 0.0);
+
+  for (size_t i = 0; i < gridSize; i++) {
+    BOOST_CHECK_SMALL(resultParallel[i] - resultSequential[i], tolerance);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE(testUpDownParallel)
+
+BOOST_AUTO_TEST_CASE(testUpDownResultReduction) {
+  // several chunks of the tree reduction, the last one incomplete
+  const size_t size = 40000;
+  const size_t numberOfTasks = 37;
+  DataVector x(size);
+  // the result is added to the existing entries
+  DataVector result(size, 1.0);
+
+  for (size_t k = 0; k < size; k++) {
+    x[k] = static_cast<double>(k);
+  }
+
+  sgpp::pde::UpDownResultReduction reduction(size, NUMBER_OF_THREADS);
+
+#pragma omp parallel shared(x, result, reduction) num_threads(NUMBER_OF_THREADS)
+  {
+#pragma omp single nowait
+    {
+      for (size_t i = 0; i < numberOfTasks; i++) {
+#pragma omp task firstprivate(i) shared(x, reduction)
+        {
+          if (i % 2 == 0) {
+            reduction.axpy(static_cast<double>(i + 1), x);
+          } else {
+            reduction.add(x);
+          }
+        }
+      }
+
+#pragma omp taskwait
+
+      reduction.reduce(result);
+    }
+  }
+
+  double factor = 0.0;
+
+  for (size_t i = 0; i < numberOfTasks; i++) {
+    factor += (i % 2 == 0) ? static_cast<double>(i + 1) : 1.0;
+  }
+
+  // all partial sums are integers, hence exact
+  for (size_t k = 0; k < size; k++) {
+    BOOST_CHECK_EQUAL(result[k], 1.0 + factor * static_cast<double>(k));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLaplaceParallel) {
+  std::unique_ptr<sgpp::base::Grid> grids[] = {
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(3)),
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createModLinearGrid(3)),
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearBoundaryGrid(3))};
+  const size_t levels[] = {8, 8, 7};
+
+  for (size_t i = 0; i < 3; i++) {
+    grids[i]->getGenerator().regular(levels[i]);
+    std::unique_ptr<sgpp::base::OperationMatrix> op(
+        sgpp::op_factory::createOperationLaplace(*grids[i]));
+    compareParallelToSequential(*op, grids[i]->getSize());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLTwoDotProductParallel) {
+  std::unique_ptr<sgpp::base::Grid> grids[] = {
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearGrid(3)),
+      std::unique_ptr<sgpp::base::Grid>(sgpp::base::Grid::createLinearBoundaryGrid(3))};
+  const size_t levels[] = {8, 7};
+
+  for (size_t i = 0; i < 2; i++) {
+    grids[i]->getGenerator().regular(levels[i]);
+    std::unique_ptr<sgpp::base::OperationMatrix> op(
+        sgpp::op_factory::createOperationLTwoDotProduct(*grids[i]));
+    compareParallelToSequential(*op, grids[i]->getSize());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testUpDownTwoOpDimsParallel) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(3));
+  grid->getGenerator().regular(8);
+
+  // non-trivial weights, some of them zero
+  DataMatrix coef(3, 3);
+
+  for (size_t i = 0; i < 3; i++) {
+    for (size_t j = 0; j < 3; j++) {
+      coef.set(i, j, (i == 2 && j == 1) ? 0.0 : 0.5 + static_cast<double>(i + 2 * j));
+    }
+  }
+
+  TestUpDownTwoOpDims op(&grid->getStorage(), coef);
+  compareParallelToSequential(op, grid->getSize());
+}
+
+BOOST_AUTO_TEST_CASE(testUpDownFourOpDimsParallel) {
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(10);
+
+  TestUpDownFourOpDims op(&grid->getStorage());
+  compareParallelToSequential(op, grid->getSize());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
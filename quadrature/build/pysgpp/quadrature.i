@@ -10,6 +10,8 @@
 %include "quadrature/src/sgpp/quadrature/sampling/LatinHypercubeSampleGenerator.hpp"
 %include "quadrature/src/sgpp/quadrature/sampling/StratifiedSampleGenerator.hpp"
 %include "quadrature/src/sgpp/quadrature/sampling/HaltonSampleGenerator.hpp"
+%include "quadrature/src/sgpp/quadrature/sampling/SobolSampleGenerator.hpp"
+%include "quadrature/src/sgpp/quadrature/operation/hash/MonteCarloEstimate.hpp"
 
 %include "OpFactory.i"
 
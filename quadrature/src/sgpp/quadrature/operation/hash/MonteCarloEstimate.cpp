@@ -0,0 +1,86 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/quadrature/operation/hash/MonteCarloEstimate.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+
+namespace sgpp {
+namespace quadrature {
+
+MonteCarloEstimate::MonteCarloEstimate()
+    : numberOfSamples(0), sum(0.0), compensation(0.0), mean(0.0), m2(0.0) {}
+
+void MonteCarloEstimate::add(double value) {
+  // Kahan-Babuska (Neumaier) summation
+  const double t = sum + value;
+
+  if (std::abs(sum) >= std::abs(value)) {
+    compensation += (sum - t) + value;
+  } else {
+    compensation += (value - t) + sum;
+  }
+
+  sum = t;
+
+  // Welford update of the variance
+  numberOfSamples++;
+  const double delta = value - mean;
+  mean += delta / static_cast<double>(numberOfSamples);
+  m2 += delta * (value - mean);
+}
+
+void MonteCarloEstimate::merge(const MonteCarloEstimate& other) {
+  if (other.numberOfSamples == 0) {
+    return;
+  } else if (numberOfSamples == 0) {
+    *this = other;
+    return;
+  }
+
+  const double n1 = static_cast<double>(numberOfSamples);
+  const double n2 = static_cast<double>(other.numberOfSamples);
+  const double delta = other.mean - mean;
+
+  // pairwise update of the variance (Chan et al.)
+  m2 += other.m2 + delta * delta * n1 * n2 / (n1 + n2);
+  mean += delta * n2 / (n1 + n2);
+  numberOfSamples += other.numberOfSamples;
+
+  compensation += other.compensation;
+  const double t = sum + other.sum;
+
+  if (std::abs(sum) >= std::abs(other.sum)) {
+    compensation += (sum - t) + other.sum;
+  } else {
+    compensation += (other.sum - t) + sum;
+  }
+
+  sum = t;
+}
+
+void MonteCarloEstimate::clear() { *this = MonteCarloEstimate(); }
+
+size_t MonteCarloEstimate::getNumberOfSamples() const { return numberOfSamples; }
+
+double MonteCarloEstimate::getSum() const { return sum + compensation; }
+
+double MonteCarloEstimate::getMean() const {
+  return (numberOfSamples == 0) ? 0.0 : getSum() / static_cast<double>(numberOfSamples);
+}
+
+double MonteCarloEstimate::getVariance() const {
+  return (numberOfSamples < 2) ? 0.0 : m2 / static_cast<double>(numberOfSamples - 1);
+}
+
+double MonteCarloEstimate::getStandardError() const {
+  return (numberOfSamples == 0)
+             ? 0.0
+             : std::sqrt(getVariance() / static_cast<double>(numberOfSamples));
+}
+
+}  // namespace quadrature
+}  // namespace sgpp
@@ -0,0 +1,92 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef MONTECARLOESTIMATE_HPP
+#define MONTECARLOESTIMATE_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstddef>
+
+namespace sgpp {
+namespace quadrature {
+
+/**
+ * Accumulates function values of (quasi) Monte Carlo samples and provides the
+ * resulting estimate of the mean together with a running error estimate.
+ * The sum of the values is computed with compensated (Kahan-Babuska) summation,
+ * the variance with Welford's update. Two estimates of disjoint sample sets
+ * can be merged, which allows to accumulate blocks of samples independently
+ * (e.g., in different threads) and combine them afterwards.
+ */
+class MonteCarloEstimate {
+ public:
+  /**
+   * Constructor, creates an empty estimate.
+   */
+  MonteCarloEstimate();
+
+  /**
+   * Adds the function value of one sample.
+   *
+   * @param value function value
+   */
+  void add(double value);
+
+  /**
+   * Merges another estimate of a disjoint set of samples into this one.
+   *
+   * @param other other estimate
+   */
+  void merge(const MonteCarloEstimate& other);
+
+  /**
+   * Resets the estimate to zero samples.
+   */
+  void clear();
+
+  /**
+   * @return number of accumulated samples
+   */
+  size_t getNumberOfSamples() const;
+
+  /**
+   * @return compensated sum of the accumulated values
+   */
+  double getSum() const;
+
+  /**
+   * @return mean of the accumulated values (estimate of the integral)
+   */
+  double getMean() const;
+
+  /**
+   * @return unbiased sample variance of the accumulated values
+   */
+  double getVariance() const;
+
+  /**
+   * @return standard error of the mean, i.e., sqrt(variance / number of samples);
+   *         for quasi Monte Carlo samples, this is a conservative error estimate
+   */
+  double getStandardError() const;
+
+ protected:
+  /// number of samples
+  size_t numberOfSamples;
+  /// sum of the values
+  double sum;
+  /// running compensation of the sum
+  double compensation;
+  /// running mean used for the variance update
+  double mean;
+  /// sum of squared deviations from the mean
+  double m2;
+};
+
+}  // namespace quadrature
+}  // namespace sgpp
+
+#endif /* MONTECARLOESTIMATE_HPP */
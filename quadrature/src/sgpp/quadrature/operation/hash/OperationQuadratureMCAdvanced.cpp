@@ -7,15 +7,19 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/tools/ExecutionContext.hpp>
 #include <sgpp/globaldef.hpp>
 #include <sgpp/quadrature/Random.hpp>
 #include <sgpp/quadrature/sampling/HaltonSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/LatinHypercubeSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/NaiveSampleGenerator.hpp>
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
 #include <sgpp/quadrature/sampling/StratifiedSampleGenerator.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 namespace sgpp {
@@ -24,7 +28,13 @@ namespace quadrature {
 OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(sgpp::base::Grid& grid,
                                                              size_t numberOfSamples,
                                                              std::uint64_t seed)
-    : grid(&grid), numberOfSamples(numberOfSamples), seed(seed) {
+    : grid(&grid),
+      numberOfSamples(numberOfSamples),
+      seed(seed),
+      samplerType(SamplerTypes::Naive),
+      blockSize(0),
+      sampleOffset(0),
+      targetStandardError(0.0) {
   dimensions = grid.getDimension();
   myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
 }
@@ -32,7 +42,14 @@ OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(sgpp::base::Grid& g
 OperationQuadratureMCAdvanced::OperationQuadratureMCAdvanced(size_t dimensions,
                                                              size_t numberOfSamples,
                                                              std::uint64_t seed)
-    : grid(nullptr), numberOfSamples(numberOfSamples), dimensions(dimensions), seed(seed) {
+    : grid(nullptr),
+      numberOfSamples(numberOfSamples),
+      dimensions(dimensions),
+      seed(seed),
+      samplerType(SamplerTypes::Naive),
+      blockSize(0),
+      sampleOffset(0),
+      targetStandardError(0.0) {
   myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
 }
 
@@ -48,6 +65,7 @@ void OperationQuadratureMCAdvanced::useNaiveMonteCarlo() {
   }
 
   myGenerator = new sgpp::quadrature::NaiveSampleGenerator(dimensions, seed);
+  samplerType = SamplerTypes::Naive;
 }
 
 void OperationQuadratureMCAdvanced::useStratifiedMonteCarlo(
@@ -57,6 +75,7 @@ void OperationQuadratureMCAdvanced::useStratifiedMonteCarlo(
   }
 
   myGenerator = new sgpp::quadrature::StratifiedSampleGenerator(strataPerDimension, seed);
+  samplerType = SamplerTypes::Stratified;
 }
 
 void OperationQuadratureMCAdvanced::useLatinHypercubeMonteCarlo() {
@@ -66,6 +85,7 @@ void OperationQuadratureMCAdvanced::useLatinHypercubeMonteCarlo() {
 
   myGenerator =
       new sgpp::quadrature::LatinHypercubeSampleGenerator(dimensions, numberOfSamples, seed);
+  samplerType = SamplerTypes::LatinHypercube;
 }
 
 void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithHaltonSequences() {
@@ -74,62 +94,197 @@ void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithHaltonSequences() {
   }
 
   myGenerator = new sgpp::quadrature::HaltonSampleGenerator(dimensions);
+  samplerType = SamplerTypes::Halton;
 }
 
-double OperationQuadratureMCAdvanced::doQuadrature(sgpp::base::DataVector& alpha) {
-  sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
+void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithSobolSequences() {
+  if (myGenerator != nullptr) {
+    delete myGenerator;
+  }
 
-  myGenerator->getSamples(dm);
+  myGenerator = new sgpp::quadrature::SobolSampleGenerator(dimensions, false, seed);
+  samplerType = SamplerTypes::Sobol;
+}
 
-  sgpp::base::DataVector res = sgpp::base::DataVector(numberOfSamples);
-  sgpp::op_factory::createOperationMultipleEval(*grid, dm)->mult(alpha, res);
-  return res.sum() / static_cast<double>(numberOfSamples);
+void OperationQuadratureMCAdvanced::useQuasiMonteCarloWithScrambledSobolSequences() {
+  if (myGenerator != nullptr) {
+    delete myGenerator;
+  }
+
+  myGenerator = new sgpp::quadrature::SobolSampleGenerator(dimensions, true, seed);
+  samplerType = SamplerTypes::ScrambledSobol;
+}
+
+double OperationQuadratureMCAdvanced::doQuadrature(sgpp::base::DataVector& alpha) {
+  return computeEstimate(Integrand::SparseGrid, nullptr, nullptr, &alpha);
 }
 
 double OperationQuadratureMCAdvanced::doQuadratureFunc(FUNC func, void* clientdata) {
-  // double* p = new double[dimensions];
+  return computeEstimate(Integrand::Function, func, clientdata, nullptr);
+}
+
+double OperationQuadratureMCAdvanced::doQuadratureL2Error(FUNC func, void* clientdata,
+                                                          sgpp::base::DataVector& alpha) {
+  return sqrt(computeEstimate(Integrand::SquaredError, func, clientdata, &alpha));
+}
+
+void OperationQuadratureMCAdvanced::setBlockSize(size_t blockSize) {
+  this->blockSize = blockSize;
+}
+
+size_t OperationQuadratureMCAdvanced::getBlockSize() { return blockSize; }
+
+void OperationQuadratureMCAdvanced::setSampleOffset(size_t sampleOffset) {
+  this->sampleOffset = sampleOffset;
+}
+
+void OperationQuadratureMCAdvanced::setTargetStandardError(double targetStandardError) {
+  this->targetStandardError = targetStandardError;
+}
+
+void OperationQuadratureMCAdvanced::setProgressCallback(
+    std::function<void(const MonteCarloEstimate&)> callback) {
+  progressCallback = callback;
+}
+
+const MonteCarloEstimate& OperationQuadratureMCAdvanced::getEstimate() const { return estimate; }
+
+double OperationQuadratureMCAdvanced::computeEstimate(Integrand integrand, FUNC func,
+                                                      void* clientdata,
+                                                      sgpp::base::DataVector* alpha) {
+  estimate.clear();
+
+  if (blockSize == 0) {
+    // create all samples at once
+    sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
+    myGenerator->getSamples(dm);
+    evaluateSamples(integrand, func, clientdata, alpha, dm, estimate);
+    return estimate.getMean();
+  }
+
+  const size_t numberOfBlocks = (numberOfSamples + blockSize - 1) / blockSize;
+  std::unique_ptr<SampleGenerator> testGenerator(createSubStreamGenerator(sampleOffset));
+
+  if (testGenerator == nullptr) {
+    // the sampler cannot be split into sub-streams (e.g., Latin hypercube sampling needs
+    // the total number of samples), hence draw the blocks sequentially from one stream
+    for (size_t b = 0; b < numberOfBlocks; b++) {
+      const size_t curBlockSize = std::min(blockSize, numberOfSamples - b * blockSize);
+      sgpp::base::DataMatrix dm(curBlockSize, dimensions);
+      myGenerator->getSamples(dm);
+
+      MonteCarloEstimate blockEstimate;
+      evaluateSamples(integrand, func, clientdata, alpha, dm, blockEstimate);
+      estimate.merge(blockEstimate);
 
-  sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
-  myGenerator->getSamples(dm);
+      if (progressCallback) {
+        progressCallback(estimate);
+      }
 
-  // create number of paths (uniformly drawn from [0,1]^d)
-  double res = 0;
+      if ((targetStandardError > 0.0) && (estimate.getNumberOfSamples() > 1) &&
+          (estimate.getStandardError() <= targetStandardError)) {
+        break;
+      }
+    }
 
-  for (size_t i = 0; i < numberOfSamples; i++) {
-    sgpp::base::DataVector dv(dimensions);
-    dm.getRow(i, dv);
-    res += func(static_cast<int>(dimensions), dv.getPointer(), clientdata);
+    return estimate.getMean();
   }
 
-  // delete p;
-  return res / static_cast<double>(numberOfSamples);
+  const size_t blocksPerRound =
+      base::ExecutionContext::getInstance().getNumberOfThreadsForRegion(numberOfBlocks);
+
+  // process the blocks in rounds of one block per thread; the block estimates are merged
+  // in a fixed order after each round, so the result does not depend on the scheduling
+  for (size_t roundStart = 0; roundStart < numberOfBlocks; roundStart += blocksPerRound) {
+    const size_t roundEnd = std::min(roundStart + blocksPerRound, numberOfBlocks);
+    std::vector<MonteCarloEstimate> blockEstimates(roundEnd - roundStart);
+
+#pragma omp parallel for schedule(dynamic) num_threads(blocksPerRound)
+    for (size_t b = roundStart; b < roundEnd; b++) {
+      const size_t firstSample = b * blockSize;
+      const size_t curBlockSize = std::min(blockSize, numberOfSamples - firstSample);
+      std::unique_ptr<SampleGenerator> generator(
+          createSubStreamGenerator(sampleOffset + firstSample));
+      sgpp::base::DataMatrix dm(curBlockSize, dimensions);
+      generator->getSamples(dm);
+      evaluateSamples(integrand, func, clientdata, alpha, dm, blockEstimates[b - roundStart]);
+    }
+
+    for (MonteCarloEstimate& blockEstimate : blockEstimates) {
+      estimate.merge(blockEstimate);
+    }
+
+    if (progressCallback) {
+      progressCallback(estimate);
+    }
+
+    if ((targetStandardError > 0.0) && (estimate.getNumberOfSamples() > 1) &&
+        (estimate.getStandardError() <= targetStandardError)) {
+      break;
+    }
+  }
+
+  return estimate.getMean();
 }
 
-double OperationQuadratureMCAdvanced::doQuadratureL2Error(FUNC func, void* clientdata,
-                                                          sgpp::base::DataVector& alpha) {
-  // create number of paths (uniformly drawn from [0,1]^d)
-  sgpp::base::DataMatrix dm(numberOfSamples, dimensions);
-  myGenerator->getSamples(dm);
+void OperationQuadratureMCAdvanced::evaluateSamples(Integrand integrand, FUNC func,
+                                                    void* clientdata,
+                                                    sgpp::base::DataVector* alpha,
+                                                    sgpp::base::DataMatrix& samples,
+                                                    MonteCarloEstimate& blockEstimate) {
+  const size_t curNumberOfSamples = samples.getNrows();
+  sgpp::base::DataVector gridValues;
 
-  double x;
-  double* p = new double[dimensions];
+  if (integrand != Integrand::Function) {
+    gridValues.resize(curNumberOfSamples);
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opEval(
+        sgpp::op_factory::createOperationMultipleEval(*grid, samples));
+    opEval->mult(*alpha, gridValues);
+  }
 
   sgpp::base::DataVector point(dimensions);
-  std::unique_ptr<sgpp::base::OperationEval> opEval(sgpp::op_factory::createOperationEval(*grid));
-  double res = 0;
-
-  for (size_t i = 0; i < numberOfSamples; i++) {
-    for (size_t d = 0; d < dimensions; d++) {
-      x = dm.get(i, d);
-      p[d] = x;
-      point[d] = x;
+
+  for (size_t i = 0; i < curNumberOfSamples; i++) {
+    if (integrand == Integrand::SparseGrid) {
+      blockEstimate.add(gridValues[i]);
+    } else {
+      samples.getRow(i, point);
+      const double funcValue = func(static_cast<int>(dimensions), point.getPointer(), clientdata);
+
+      if (integrand == Integrand::Function) {
+        blockEstimate.add(funcValue);
+      } else {
+        blockEstimate.add(pow(funcValue - gridValues[i], 2));
+      }
     }
-    res += pow(
-        func(static_cast<int>(dimensions), p, clientdata) - opEval->eval(alpha, point), 2);
   }
+}
 
-  delete[] p;
-  return sqrt(res / static_cast<double>(numberOfSamples));
+SampleGenerator* OperationQuadratureMCAdvanced::createSubStreamGenerator(size_t firstSample) {
+  switch (samplerType) {
+    case SamplerTypes::Naive: {
+      // pseudo random numbers: seed an independent stream for every sub-stream
+      const std::uint64_t streamSeed = seed + 0x9E3779B97F4A7C15ULL * (firstSample + 1);
+      return new sgpp::quadrature::NaiveSampleGenerator(dimensions, streamSeed);
+    }
+
+    case SamplerTypes::Halton: {
+      HaltonSampleGenerator* generator = new sgpp::quadrature::HaltonSampleGenerator(dimensions);
+      generator->skipTo(firstSample);
+      return generator;
+    }
+
+    case SamplerTypes::Sobol:
+    case SamplerTypes::ScrambledSobol: {
+      SobolSampleGenerator* generator = new sgpp::quadrature::SobolSampleGenerator(
+          dimensions, samplerType == SamplerTypes::ScrambledSobol, seed);
+      generator->skipTo(firstSample);
+      return generator;
+    }
+
+    default:
+      return nullptr;
+  }
 }
 
 size_t OperationQuadratureMCAdvanced::getDimensions() { return dimensions; }
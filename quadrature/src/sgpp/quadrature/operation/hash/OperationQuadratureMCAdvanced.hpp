@@ -9,8 +9,11 @@
 #include <sgpp/base/operation/hash/OperationQuadrature.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/globaldef.hpp>
+#include <sgpp/quadrature/operation/hash/MonteCarloEstimate.hpp>
 #include <sgpp/quadrature/sampling/SampleGenerator.hpp>
+#include <sgpp/quadrature/sampling/SamplerTypes.hpp>
 
+#include <functional>
 #include <vector>
 
 namespace sgpp {
@@ -26,6 +29,13 @@ typedef double (*FUNC)(int, double*, void*);
 /**
  * Quadrature on any sparse grid (that has OperationMultipleEval implemented)
  * using various Monte Carlo Methods (Advanced).
+ *
+ * By default, all samples are generated at once and stored in a DataMatrix.
+ * If a block size is set, the samples are generated and evaluated in blocks
+ * (streaming mode), such that the memory consumption does not depend on the
+ * number of samples. For Naive, Halton and Sobol sampling, the blocks are
+ * processed in parallel with OpenMP, each block drawing an independent
+ * (for Halton and Sobol contiguous) sub-stream of the sequence.
  */
 
 class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
@@ -117,6 +127,51 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
    */
   void useQuasiMonteCarloWithScrambledSobolSequences();
 
+  /**
+   * @brief Enables the block-streaming mode.
+   * In streaming mode with parallel sub-streams, FUNC has to be thread-safe.
+   *
+   * @param blockSize number of samples per block (0 disables streaming, which is the default)
+   */
+  void setBlockSize(size_t blockSize);
+
+  /**
+   * @return number of samples per block in streaming mode (0 if disabled)
+   */
+  size_t getBlockSize();
+
+  /**
+   * @brief Sets the index of the first sample to use (default 0). Together with
+   * Halton or Sobol sampling, this allows different processes to work on
+   * disjoint contiguous parts of the same sequence. Only used in streaming mode.
+   *
+   * @param sampleOffset index of the first sample
+   */
+  void setSampleOffset(size_t sampleOffset);
+
+  /**
+   * @brief Sets a target for the standard error of the estimate. In streaming
+   * mode, the quadrature stops early as soon as the running error estimate
+   * falls below this value (0 disables the stopping criterion, which is the default).
+   *
+   * @param targetStandardError target standard error
+   */
+  void setTargetStandardError(double targetStandardError);
+
+  /**
+   * @brief Sets a callback which is called with the running estimate whenever
+   * new blocks of samples have been accumulated in streaming mode.
+   *
+   * @param callback callback function (an empty function disables the callback)
+   */
+  void setProgressCallback(std::function<void(const MonteCarloEstimate&)> callback);
+
+  /**
+   * @return estimate (mean, number of samples, standard error) of the last quadrature;
+   *         for doQuadratureL2Error, the accumulated values are the squared errors
+   */
+  const MonteCarloEstimate& getEstimate() const;
+
   /**
    * @brief Method returns the total number of samples which can be generated
    * according to the sample generator settings (dimensions and subdivision into strata)
@@ -138,6 +193,45 @@ class OperationQuadratureMCAdvanced : public sgpp::base::OperationQuadrature {
 
   // SampleGenerator Instance
   sgpp::quadrature::SampleGenerator* myGenerator;
+  // type of the current sample generator
+  SamplerTypes samplerType;
+
+  // number of samples per block in streaming mode (0 if disabled)
+  size_t blockSize;
+  // index of the first sample in streaming mode
+  size_t sampleOffset;
+  // target standard error for early stopping (0 if disabled)
+  double targetStandardError;
+  // callback for the running estimate
+  std::function<void(const MonteCarloEstimate&)> progressCallback;
+  // estimate of the last quadrature
+  MonteCarloEstimate estimate;
+
+ private:
+  /// integrands supported by the internal quadrature routine
+  enum class Integrand { SparseGrid, Function, SquaredError };
+
+  /**
+   * Computes the estimate of the integral of the given integrand, either in one
+   * go or in streaming mode.
+   */
+  double computeEstimate(Integrand integrand, FUNC func, void* clientdata,
+                         sgpp::base::DataVector* alpha);
+
+  /**
+   * Evaluates the integrand at the given samples and adds the values to the estimate.
+   */
+  void evaluateSamples(Integrand integrand, FUNC func, void* clientdata,
+                       sgpp::base::DataVector* alpha, sgpp::base::DataMatrix& samples,
+                       MonteCarloEstimate& blockEstimate);
+
+  /**
+   * Creates a sample generator for the sub-stream starting at the given sample.
+   *
+   * @return new sample generator, or nullptr if the current sampler does not
+   *         support independent sub-streams
+   */
+  SampleGenerator* createSubStreamGenerator(size_t firstSample);
 };
 
 }  // namespace quadrature
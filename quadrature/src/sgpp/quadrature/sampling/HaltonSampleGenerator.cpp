@@ -50,5 +50,11 @@ void HaltonSampleGenerator::getSample(sgpp::base::DataVector& dv) {
   index++;
 }
 
+void HaltonSampleGenerator::skipTo(size_t index) {
+  // the radical inverse is computed from scratch for every point,
+  // hence jumping only requires to set the counter (which starts at one)
+  this->index = index + 1;
+}
+
 }  // namespace quadrature
 }  // namespace sgpp
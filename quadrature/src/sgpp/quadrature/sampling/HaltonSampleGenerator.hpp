@@ -43,6 +43,14 @@ class HaltonSampleGenerator : public SampleGenerator {
    */
   virtual void getSample(sgpp::base::DataVector& sample);
 
+  /**
+   * Jumps to a given position of the sequence, i.e., the next call of getSample
+   * returns the point with the given index.
+   *
+   * @param index index of the next point (starting with 0)
+   */
+  void skipTo(size_t index);
+
  private:
   size_t index;
   std::vector<size_t> baseVector;
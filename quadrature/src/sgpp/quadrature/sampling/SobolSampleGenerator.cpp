@@ -0,0 +1,188 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/quadrature/sampling/SobolSampleGenerator.hpp>
+#include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <random>
+#include <vector>
+
+namespace sgpp {
+namespace quadrature {
+
+namespace {
+
+/**
+ * Primitive polynomials (degree s, coefficients a) and initial direction numbers m_1, ..., m_s
+ * for the dimensions 2, 3, ... (Joe and Kuo, new-joe-kuo-6.21201).
+ * The first dimension uses m_k = 1 for all k (van der Corput sequence).
+ */
+struct SobolPolynomial {
+  size_t s;
+  std::uint32_t a;
+  std::uint32_t m[7];
+};
+
+const SobolPolynomial sobolPolynomials[] = {
+    {1, 0, {1}},
+    {2, 1, {1, 3}},
+    {3, 1, {1, 3, 1}},
+    {3, 2, {1, 1, 1}},
+    {4, 1, {1, 1, 3, 3}},
+    {4, 4, {1, 3, 5, 13}},
+    {5, 2, {1, 1, 5, 5, 17}},
+    {5, 4, {1, 1, 5, 5, 5}},
+    {5, 7, {1, 1, 7, 11, 19}},
+    {5, 11, {1, 1, 5, 1, 1}},
+    {5, 13, {1, 1, 1, 3, 11}},
+    {5, 14, {1, 3, 5, 5, 31}},
+    {6, 1, {1, 3, 3, 9, 7, 49}},
+    {6, 13, {1, 1, 1, 15, 21, 21}},
+    {6, 16, {1, 3, 1, 13, 27, 49}},
+    {6, 19, {1, 1, 1, 15, 7, 5}},
+    {6, 22, {1, 3, 1, 15, 13, 25}},
+    {6, 25, {1, 1, 5, 5, 19, 61}},
+    {7, 1, {1, 3, 7, 11, 23, 15, 103}},
+    {7, 4, {1, 3, 7, 13, 13, 15, 69}}};
+
+std::uint32_t parity(std::uint32_t x) {
+  x ^= x >> 16;
+  x ^= x >> 8;
+  x ^= x >> 4;
+  x ^= x >> 2;
+  x ^= x >> 1;
+  return x & 1;
+}
+
+}  // namespace
+
+SobolSampleGenerator::SobolSampleGenerator(size_t dimensions, bool scrambled, std::uint64_t seed)
+    : SampleGenerator(dimensions, seed),
+      scrambled(scrambled),
+      index(0),
+      directionNumbers(dimensions * NUM_BITS),
+      shift(dimensions, 0),
+      currentPoint(dimensions, 0) {
+  if (dimensions > MAX_DIMENSIONS) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator: number of dimensions not supported");
+  }
+
+  std::vector<std::uint32_t> m(NUM_BITS + 1);
+
+  for (size_t t = 0; t < dimensions; t++) {
+    // compute the integers m_k with the recurrence relation of the primitive polynomial
+    if (t == 0) {
+      for (size_t k = 1; k <= NUM_BITS; k++) {
+        m[k] = 1;
+      }
+    } else {
+      const SobolPolynomial& p = sobolPolynomials[t - 1];
+
+      for (size_t k = 1; k <= p.s; k++) {
+        m[k] = p.m[k - 1];
+      }
+
+      for (size_t k = p.s + 1; k <= NUM_BITS; k++) {
+        m[k] = (m[k - p.s] << p.s) ^ m[k - p.s];
+
+        for (size_t j = 1; j < p.s; j++) {
+          m[k] ^= ((p.a >> (p.s - 1 - j)) & 1) * (m[k - j] << j);
+        }
+      }
+    }
+
+    for (size_t k = 1; k <= NUM_BITS; k++) {
+      directionNumbers[t * NUM_BITS + k - 1] = m[k] << (NUM_BITS - k);
+    }
+  }
+
+  if (scrambled) {
+    std::uniform_int_distribution<std::uint32_t> distInt;
+
+    for (size_t t = 0; t < dimensions; t++) {
+      // random lower triangular matrix with unit diagonal; the k-th row acts on the
+      // k most significant digits
+      std::vector<std::uint32_t> rows(NUM_BITS);
+
+      for (size_t k = 0; k < NUM_BITS; k++) {
+        const std::uint32_t diagonal = static_cast<std::uint32_t>(1) << (NUM_BITS - 1 - k);
+        const std::uint32_t upper = ~((diagonal << 1) - 1);
+        rows[k] = diagonal | (distInt(rng) & upper);
+      }
+
+      for (size_t k = 0; k < NUM_BITS; k++) {
+        const std::uint32_t v = directionNumbers[t * NUM_BITS + k];
+        std::uint32_t scrambledV = 0;
+
+        for (size_t r = 0; r < NUM_BITS; r++) {
+          scrambledV |= parity(rows[r] & v) << (NUM_BITS - 1 - r);
+        }
+
+        directionNumbers[t * NUM_BITS + k] = scrambledV;
+      }
+
+      shift[t] = distInt(rng);
+    }
+  }
+}
+
+SobolSampleGenerator::~SobolSampleGenerator() {}
+
+void SobolSampleGenerator::getSample(sgpp::base::DataVector& sample) {
+  if (index >= (static_cast<std::uint64_t>(1) << NUM_BITS)) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator::getSample: maximal number of points exceeded");
+  }
+
+  const double scale = 1.0 / static_cast<double>(static_cast<std::uint64_t>(1) << NUM_BITS);
+
+  for (size_t t = 0; t < dimensions; t++) {
+    sample[t] = static_cast<double>(currentPoint[t] ^ shift[t]) * scale;
+  }
+
+  // Gray code update: the next point differs in the direction number of the
+  // rightmost zero bit of the current index
+  size_t c = 0;
+
+  for (std::uint64_t i = index; (i & 1) != 0; i >>= 1) {
+    c++;
+  }
+
+  if (c < NUM_BITS) {
+    for (size_t t = 0; t < dimensions; t++) {
+      currentPoint[t] ^= directionNumbers[t * NUM_BITS + c];
+    }
+  }
+
+  index++;
+}
+
+void SobolSampleGenerator::skipTo(std::uint64_t index) {
+  if (index >= (static_cast<std::uint64_t>(1) << NUM_BITS)) {
+    throw sgpp::base::application_exception(
+        "SobolSampleGenerator::skipTo: index exceeds maximal number of points");
+  }
+
+  const std::uint64_t grayCode = index ^ (index >> 1);
+
+  for (size_t t = 0; t < dimensions; t++) {
+    currentPoint[t] = 0;
+
+    for (size_t k = 0; k < NUM_BITS; k++) {
+      if ((grayCode >> k) & 1) {
+        currentPoint[t] ^= directionNumbers[t * NUM_BITS + k];
+      }
+    }
+  }
+
+  this->index = index;
+}
+
+std::uint64_t SobolSampleGenerator::getIndex() const { return index; }
+
+}  // namespace quadrature
+}  // namespace sgpp
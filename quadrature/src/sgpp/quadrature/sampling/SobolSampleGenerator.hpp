@@ -0,0 +1,90 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SOBOLSAMPLEGENERATOR_HPP
+#define SOBOLSAMPLEGENERATOR_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/globaldef.hpp>
+#include <sgpp/quadrature/sampling/SampleGenerator.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace quadrature {
+
+/**
+ * Quasi Monte Carlo sample generator for Sobol sequences (Gray code ordering,
+ * direction numbers of Joe and Kuo). Optionally, the sequence is scrambled by a
+ * random linear matrix scrambling followed by a random digital shift (seeded
+ * by the given seed), which preserves the low discrepancy of the sequence.
+ *
+ * The generator supports skip-ahead in O(number of bits) via skipTo, such that
+ * different threads or processes can draw independent contiguous sub-streams of
+ * the same sequence. At most 2^32 points can be generated.
+ */
+class SobolSampleGenerator : public SampleGenerator {
+ public:
+  /// maximal number of dimensions supported by the direction number table
+  static const size_t MAX_DIMENSIONS = 21;
+
+  /**
+   * Standard constructor
+   *
+   * @param dimensions number of dimensions used for sample generation (at most MAX_DIMENSIONS)
+   * @param scrambled  whether to scramble the sequence
+   * @param seed       custom seed for the scrambling (defaults to default seed of mt19937_64)
+   */
+  explicit SobolSampleGenerator(size_t dimensions, bool scrambled = false,
+                                std::uint64_t seed = std::mt19937_64::default_seed);
+
+  /**
+   * Destructor
+   */
+  virtual ~SobolSampleGenerator();
+
+  /**
+   * This method generates one sample.
+   * Implementation of the abstract Method getSample from SampleGenerator.
+   *
+   * @param sample DataVector storing the new generated sample vector.
+   */
+  virtual void getSample(sgpp::base::DataVector& sample);
+
+  /**
+   * Jumps to a given position of the sequence, i.e., the next call of getSample
+   * returns the point with the given index.
+   *
+   * @param index index of the next point (starting with 0)
+   */
+  void skipTo(std::uint64_t index);
+
+  /**
+   * @return index of the point which is returned by the next call of getSample
+   */
+  std::uint64_t getIndex() const;
+
+ private:
+  /// number of bits of the direction numbers
+  static const size_t NUM_BITS = 32;
+
+  /// whether the sequence is scrambled
+  bool scrambled;
+  /// index of the next point
+  std::uint64_t index;
+  /// direction numbers (NUM_BITS per dimension)
+  std::vector<std::uint32_t> directionNumbers;
+  /// digital shift per dimension (zero if not scrambled)
+  std::vector<std::uint32_t> shift;
+  /// current point as integer vector (without shift)
+  std::vector<std::uint32_t> currentPoint;
+};
+
+}  // namespace quadrature
+}  // namespace sgpp
+
+#endif /* SOBOLSAMPLEGENERATOR_HPP */
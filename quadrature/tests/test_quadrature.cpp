@@ -40,6 +40,7 @@ using sgpp::quadrature::HaltonSampleGenerator;
 using sgpp::quadrature::LatinHypercubeSampleGenerator;
 using sgpp::quadrature::NaiveSampleGenerator;
 using sgpp::quadrature::SampleGenerator;
+using sgpp::quadrature::SobolSampleGenerator;
 using sgpp::quadrature::StratifiedSampleGenerator;
 
 double f(DataVector x) {
@@ -82,11 +83,54 @@ BOOST_AUTO_TEST_CASE(testSamplers) {
   }
 
   StratifiedSampleGenerator pSSampler(blockSize);
+  SobolSampleGenerator pSobSampler(dim);
+  SobolSampleGenerator pSSobSampler(dim, true, seed);
 
   testSampler(pNSampler, dim, numSamples, analyticResult, 5e-2);
   testSampler(pHSampler, dim, numSamples, analyticResult, 1e-3);
   testSampler(pLHSampler, dim, numSamples, analyticResult, 1e-3);
   testSampler(pSSampler, dim, numSamples, analyticResult, 1e-3);
+  testSampler(pSobSampler, dim, numSamples, analyticResult, 1e-3);
+  testSampler(pSSobSampler, dim, numSamples, analyticResult, 1e-3);
+}
+
+BOOST_AUTO_TEST_CASE(testSobolSkipAhead) {
+  size_t dim = SobolSampleGenerator::MAX_DIMENSIONS;
+  uint64_t seed = 1234567;
+
+  for (bool scrambled : {false, true}) {
+    SobolSampleGenerator sequentialSampler(dim, scrambled, seed);
+    SobolSampleGenerator skippingSampler(dim, scrambled, seed);
+    DataVector sequentialSample(dim);
+    DataVector skippedSample(dim);
+
+    for (size_t i = 0; i < 1000; i++) {
+      sequentialSampler.getSample(sequentialSample);
+
+      if (i % 97 == 0) {
+        skippingSampler.skipTo(i);
+        skippingSampler.getSample(skippedSample);
+
+        for (size_t t = 0; t < dim; t++) {
+          BOOST_CHECK_EQUAL(sequentialSample[t], skippedSample[t]);
+        }
+      }
+    }
+  }
+
+  // the unscrambled sequence contains each dyadic interval exactly once
+  SobolSampleGenerator sampler(dim);
+  DataVector sample(dim);
+  std::vector<size_t> counts(16, 0);
+
+  for (size_t i = 0; i < 16; i++) {
+    sampler.getSample(sample);
+    counts[static_cast<size_t>(sample[dim - 1] * 16.0)]++;
+  }
+
+  for (size_t count : counts) {
+    BOOST_CHECK_EQUAL(count, 1);
+  }
 }
 
 void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
@@ -112,10 +156,28 @@ void testOperationQuadratureMCAdvanced(Grid& grid, DataVector& alpha,
     case sgpp::quadrature::SamplerTypes::Halton:
       opQuad->useQuasiMonteCarloWithHaltonSequences();
       break;
+
+    case sgpp::quadrature::SamplerTypes::Sobol:
+      opQuad->useQuasiMonteCarloWithSobolSequences();
+      break;
+
+    case sgpp::quadrature::SamplerTypes::ScrambledSobol:
+      opQuad->useQuasiMonteCarloWithScrambledSobolSequences();
+      break;
   }
 
   double resMC = opQuad->doQuadrature(alpha);
   BOOST_CHECK_CLOSE(resMC, analyticResult, tol * 1e2);
+
+  // block-streaming mode has to give a result of the same quality
+  opQuad->setBlockSize(numSamples / 7);
+  size_t numUpdates = 0;
+  opQuad->setProgressCallback(
+      [&numUpdates](const sgpp::quadrature::MonteCarloEstimate&) { numUpdates++; });
+  double resMCStreaming = opQuad->doQuadrature(alpha);
+  BOOST_CHECK_CLOSE(resMCStreaming, analyticResult, tol * 1e2);
+  BOOST_CHECK_EQUAL(opQuad->getEstimate().getNumberOfSamples(), numSamples);
+  BOOST_CHECK_GT(numUpdates, 0);
 }
 
 BOOST_AUTO_TEST_CASE(testOperationMCAdvanced) {
@@ -151,4 +213,8 @@ BOOST_AUTO_TEST_CASE(testOperationMCAdvanced) {
                                     dim, numSamples, blockSize, analyticResult, 1e-3, seed);
   testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::Halton, dim,
                                     numSamples, blockSize, analyticResult, 1e-3, seed);
+  testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::Sobol, dim,
+                                    numSamples, blockSize, analyticResult, 1e-3, seed);
+  testOperationQuadratureMCAdvanced(*grid, alpha, sgpp::quadrature::SamplerTypes::ScrambledSobol,
+                                    dim, numSamples, blockSize, analyticResult, 1e-3, seed);
 }
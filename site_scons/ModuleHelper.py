@@ -155,8 +155,9 @@ class Module(object):
                               "python pysgpp/doxy2swig.py -o -c -q $SOURCE $TARGET")
       pydocTargetList.append(doxy2swig)
 
-  def buildExamples(self, exampleFolder="examples", additionalExampleDependencies=[]):
-    """Build the examples.
+  def buildExamples(self, exampleFolder="examples", additionalExampleDependencies=[],
+                    excludedExamples=[]):
+    """Build the examples, except for the files in excludedExamples.
     """
     if not os.path.isdir(exampleFolder): return
 
@@ -168,7 +169,9 @@ class Module(object):
 
     # for each example
     for fileName in os.listdir(exampleFolder):
-      if fnmatch.fnmatch(fileName, "*.cpp"):
+      if fileName in excludedExamples:
+        continue
+      elif fnmatch.fnmatch(fileName, "*.cpp"):
         # source file
         cpp = os.path.join(exampleFolder, fileName)
         self.cpps.append(cpp)
@@ -180,12 +183,13 @@ class Module(object):
         hpp = os.path.join(exampleFolder, fileName)
         self.hpps.append(hpp)
 
-  def runExamples(self, exampleFolder="examples", language="all"):
-    """Run the examples.
+  def runExamples(self, exampleFolder="examples", language="all", excludedExamples=[]):
+    """Run the examples, except for the files in excludedExamples.
     """
     if language == "all":
       for language in ["cpp", "python"]:
-        self.runExamples(exampleFolder=exampleFolder, language=language)
+        self.runExamples(exampleFolder=exampleFolder, language=language,
+                         excludedExamples=excludedExamples)
       return
     elif language == "cpp":
       if not env["RUN_CPP_EXAMPLES"]: return
@@ -199,7 +203,7 @@ class Module(object):
     if not os.path.isdir(exampleFolder): return
 
     for fileName in os.listdir(exampleFolder):
-      if fnmatch.fnmatch(fileName, fileNameFilter):
+      if fileName not in excludedExamples and fnmatch.fnmatch(fileName, fileNameFilter):
         sourcePath = os.path.join(exampleFolder, fileName)
 
         if language == "cpp":
@@ -15,6 +15,7 @@
 %include "solver/src/sgpp/solver/sle/BiCGStab.hpp"
 %include "solver/src/sgpp/solver/ode/Euler.hpp"
 %include "solver/src/sgpp/solver/ode/CrankNicolson.hpp"
+%include "solver/src/sgpp/solver/ode/WarmStartTimestepping.hpp"
 %include "solver/src/sgpp/solver/TypesSolver.hpp"
 %include "solver/src/sgpp/solver/SLESolverTypeParser.hpp"
 
@@ -0,0 +1,172 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/ode/WarmStartTimestepping.hpp>
+#include <sgpp/base/exception/solver_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+WarmStartTimestepping::WarmStartTimestepping(size_t nTimesteps, double timestepSize,
+                                             sgpp::base::ScreenOutput* screen)
+    : ODESolver(nTimesteps, timestepSize), myScreen(screen) {
+  this->residuum = 0.0;
+}
+
+WarmStartTimestepping::~WarmStartTimestepping() {}
+
+void WarmStartTimestepping::solveTimestep(SLESolver& LinearSystemSolver,
+                                          sgpp::solver::OperationParabolicPDESolverSystem& System,
+                                          sgpp::base::DataVector& alphaOld) {
+  // generate right hand side
+  sgpp::base::DataVector* rhs = System.generateRHS();
+  sgpp::base::DataVector* alpha = System.getGridCoefficientsForCG();
+  sgpp::base::DataVector alphaCurrent(*alpha);
+
+  // extrapolate the initial guess linearly from the last two timesteps,
+  // u_{n+1} ~ u_n + (u_n - u_{n-1}) = 2 u_n - u_{n-1}
+  if (alphaOld.getSize() == alpha->getSize()) {
+    alpha->mult(2.0);
+    alpha->sub(alphaOld);
+  }
+
+  // solve the system of the current timestep
+  LinearSystemSolver.solve(System, *alpha, *rhs, true, false, -1.0);
+
+  alphaOld = alphaCurrent;
+}
+
+void WarmStartTimestepping::solve(SLESolver& LinearSystemSolver,
+                                  sgpp::solver::OperationParabolicPDESolverSystem& System,
+                                  bool bIdentifyLastStep, bool verbose) {
+  size_t allIter = 0;
+  sgpp::base::DataVector alphaOld(0);
+
+  for (size_t i = 0; i < this->nMaxIterations; i++) {
+    solveTimestep(LinearSystemSolver, System, alphaOld);
+    allIter += LinearSystemSolver.getNumberIterations();
+
+    if (verbose == true) {
+      if (myScreen == nullptr) {
+        std::cout << "Final residuum " << LinearSystemSolver.getResiduum() << "; with "
+                  << LinearSystemSolver.getNumberIterations()
+                  << " Iterations (Total Iter.: " << allIter << ")" << std::endl;
+      }
+    }
+
+    if (myScreen != nullptr) {
+      std::stringstream soutput;
+      soutput << "Final residuum " << LinearSystemSolver.getResiduum() << "; with "
+              << LinearSystemSolver.getNumberIterations() << " Iterations (Total Iter.: " << allIter
+              << ")";
+
+      if (i < this->nMaxIterations - 1) {
+        myScreen->update(static_cast<size_t>((static_cast<double>(i + 1) * 100.0) /
+            static_cast<double>(this->nMaxIterations)),
+                         soutput.str());
+      } else {
+        myScreen->update(100, soutput.str());
+      }
+    }
+
+    System.finishTimestep();
+
+    const size_t gridSize = System.getGrid()->getSize();
+
+    if (bIdentifyLastStep == false) {
+      System.coarsenAndRefine(false);
+    } else {
+      if (i < (this->nMaxIterations - 1)) {
+        System.coarsenAndRefine(false);
+      } else {
+        System.coarsenAndRefine(true);
+      }
+    }
+
+    // the extrapolation has to start over if the grid has been adapted
+    if (System.getGrid()->getSize() != gridSize) {
+      alphaOld.resize(0);
+    }
+  }
+
+  // write some empty lines to console
+  if (myScreen != nullptr) {
+    myScreen->writeEmptyLines(2);
+  }
+
+  this->nIterations = allIter;
+}
+
+void WarmStartTimestepping::solveBatch(SLESolver& LinearSystemSolver,
+                                       sgpp::solver::OperationParabolicPDESolverSystem& System,
+                                       std::vector<sgpp::base::DataVector*>& alphas,
+                                       bool verbose) {
+  // multistep schemes keep the coefficients of former timesteps in the system,
+  // which cannot be switched between the initial conditions
+  const std::string odeSolver = System.getODESolver();
+
+  if ((odeSolver != "ExEul") && (odeSolver != "ImEul") && (odeSolver != "CrNic")) {
+    throw sgpp::base::solver_exception(
+        "WarmStartTimestepping::solveBatch : Only one-step schemes are supported!");
+  }
+
+  size_t allIter = 0;
+  sgpp::base::DataVector* alphaSystem = System.getGridCoefficients();
+  std::vector<sgpp::base::DataVector> alphasOld(alphas.size(), sgpp::base::DataVector(0));
+
+  for (size_t i = 0; i < this->nMaxIterations; i++) {
+    size_t stepIter = 0;
+
+    for (size_t k = 0; k < alphas.size(); k++) {
+      System.setGridCoefficients(*alphas[k]);
+      solveTimestep(LinearSystemSolver, System, alphasOld[k]);
+      stepIter += LinearSystemSolver.getNumberIterations();
+      System.finishTimestep();
+    }
+
+    allIter += stepIter;
+
+    if (verbose == true) {
+      if (myScreen == nullptr) {
+        std::cout << "Timestep " << (i + 1) << ": " << stepIter << " Iterations for "
+                  << alphas.size() << " initial conditions (Total Iter.: " << allIter << ")"
+                  << std::endl;
+      }
+    }
+
+    if (myScreen != nullptr) {
+      std::stringstream soutput;
+      soutput << stepIter << " Iterations for " << alphas.size()
+              << " initial conditions (Total Iter.: " << allIter << ")";
+
+      if (i < this->nMaxIterations - 1) {
+        myScreen->update(static_cast<size_t>((static_cast<double>(i + 1) * 100.0) /
+            static_cast<double>(this->nMaxIterations)),
+                         soutput.str());
+      } else {
+        myScreen->update(100, soutput.str());
+      }
+    }
+  }
+
+  System.setGridCoefficients(*alphaSystem);
+
+  // write some empty lines to console
+  if (myScreen != nullptr) {
+    myScreen->writeEmptyLines(2);
+  }
+
+  this->nIterations = allIter;
+}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,94 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef WARMSTARTTIMESTEPPING_HPP
+#define WARMSTARTTIMESTEPPING_HPP
+
+#include <sgpp/base/application/ScreenOutput.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/solver/ODESolver.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * This class drives one-step time stepping schemes with a constant timestep
+ * size whose system of linear equations is solved iteratively in every timestep
+ * (e.g. the implicit Euler or the Crank-Nicolson method, as specified by the
+ * operation mode of the OperationParabolicPDESolverSystem).
+ *
+ * In contrast to Euler and CrankNicolson, the iterative solver is not only started
+ * with the solution of the last timestep: the initial guess is extrapolated
+ * linearly from the last two timesteps, which reduces the initial residual and thus
+ * the number of iterations per timestep for smooth solutions.
+ *
+ * In addition, several initial conditions can be advanced with the same system
+ * (solveBatch), so the system's operators (e.g. assembled sparse matrices) are
+ * created only once and shared by all of them.
+ */
+class WarmStartTimestepping : public ODESolver {
+ private:
+  /// Pointer to sgpp::base::ScreenOutput object
+  sgpp::base::ScreenOutput* myScreen;
+
+  /**
+   * Solves one timestep of the system for its current coefficients.
+   *
+   * @param LinearSystemSolver linear system solver
+   * @param System system of the timestepping scheme
+   * @param alphaOld coefficients for CG of the last timestep (empty in the first timestep),
+   * are replaced with the ones of the current timestep
+   */
+  void solveTimestep(SLESolver& LinearSystemSolver,
+                     sgpp::solver::OperationParabolicPDESolverSystem& System,
+                     sgpp::base::DataVector& alphaOld);
+
+ public:
+  /**
+   * Std-Constructer
+   *
+   * @param nTimesteps number of executed timesteps
+   * @param timestepSize the size of one timestep
+   * @param screen possible pointer to a sgpp::base::ScreenOutput object
+   */
+  WarmStartTimestepping(size_t nTimesteps, double timestepSize,
+                        sgpp::base::ScreenOutput* screen = nullptr);
+
+  /**
+   * Std-Destructor
+   */
+  virtual ~WarmStartTimestepping();
+
+  virtual void solve(SLESolver& LinearSystemSolver,
+                     sgpp::solver::OperationParabolicPDESolverSystem& System,
+                     bool bIdentifyLastStep = false, bool verbose = false);
+
+  /**
+   * Advances several initial conditions with the same system. In every timestep,
+   * the system is switched to the coefficients of each initial condition in turn
+   * (see OperationParabolicPDESolverSystem::setGridCoefficients), hence the grid
+   * must not be adapted during the time stepping. After the call, the system works
+   * on its original coefficients again. Only one-step schemes ("ExEul", "ImEul" and
+   * "CrNic") are supported, as multistep schemes keep former coefficients in the system.
+   *
+   * @param LinearSystemSolver reference to an instance of a linear system solver
+   * @param System reference to the system of the timestepping scheme
+   * @param alphas coefficients of the initial conditions (complete grid), are replaced
+   * with the coefficients of the solutions
+   * @param verbose prints information during execution of the solver
+   */
+  void solveBatch(SLESolver& LinearSystemSolver,
+                  sgpp::solver::OperationParabolicPDESolverSystem& System,
+                  std::vector<sgpp::base::DataVector*>& alphas, bool verbose = false);
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* WARMSTARTTIMESTEPPING_HPP */
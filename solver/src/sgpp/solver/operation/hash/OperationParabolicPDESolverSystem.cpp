@@ -26,6 +26,10 @@ sgpp::base::DataVector* OperationParabolicPDESolverSystem::getGridCoefficients()
   return this->alpha_complete;
 }
 
+void OperationParabolicPDESolverSystem::setGridCoefficients(sgpp::base::DataVector& alpha) {
+  this->alpha_complete = &alpha;
+}
+
 sgpp::base::Grid* OperationParabolicPDESolverSystem::getGrid() { return this->BoundGrid; }
 
 void OperationParabolicPDESolverSystem::setODESolver(std::string ode) {
@@ -126,6 +126,15 @@ class OperationParabolicPDESolverSystem : public sgpp::base::OperationMatrix {
    */
   sgpp::base::DataVector* getGridCoefficients();
 
+  /**
+   * replaces the sparse grid's coefficients (with evtl. boundaries) the system works on,
+   * e.g. to advance several initial conditions with the same system and its operators.
+   * The vector is not copied, the system will update it in every timestep.
+   *
+   * @param alpha alpha vector of complete grid
+   */
+  virtual void setGridCoefficients(sgpp::base::DataVector& alpha);
+
   /**
    * defines the used ODE Solver for this instance, this is important because
    * the implementation of mult and generateRHS depends on the used
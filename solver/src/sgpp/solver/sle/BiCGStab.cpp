@@ -5,6 +5,7 @@
 
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 #include <cmath>
 
@@ -17,6 +18,7 @@ BiCGStab::~BiCGStab() {}
 
 void BiCGStab::solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
                      sgpp::base::DataVector& b, bool reuse, bool verbose, double max_threshold) {
+  SGPP_INSTRUMENT_SCOPE("BiCGStab::solve");
   this->nIterations = 1;
   double epsilonSqd = this->myEpsilon * this->myEpsilon;
 
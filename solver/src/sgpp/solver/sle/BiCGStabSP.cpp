@@ -6,6 +6,7 @@
 #include <sgpp/solver/sle/BiCGStabSP.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 #include <cmath>
 
@@ -18,6 +19,7 @@ BiCGStabSP::~BiCGStabSP() {}
 
 void BiCGStabSP::solve(sgpp::base::OperationMatrixSP& SystemMatrix, sgpp::base::DataVectorSP& alpha,
                        sgpp::base::DataVectorSP& b, bool reuse, bool verbose, float max_threshold) {
+  SGPP_INSTRUMENT_SCOPE("BiCGStabSP::solve");
   this->nIterations = 1;
   float epsilonSqd = this->myEpsilon * this->myEpsilon;
 
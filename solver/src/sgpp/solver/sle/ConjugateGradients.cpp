@@ -9,6 +9,7 @@
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 #include <cstdio>
 
@@ -22,6 +23,7 @@ ConjugateGradients::~ConjugateGradients() {}
 void ConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
                                sgpp::base::DataVector& alpha, sgpp::base::DataVector& b, bool reuse,
                                bool verbose, double max_threshold) {
+  SGPP_INSTRUMENT_SCOPE("ConjugateGradients::solve");
   this->starting();
 
   if (verbose == true) {
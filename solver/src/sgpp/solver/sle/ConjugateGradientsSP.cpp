@@ -9,6 +9,7 @@
 #include <sgpp/solver/sle/ConjugateGradientsSP.hpp>
 
 #include <sgpp/globaldef.hpp>
+#include <sgpp/base/tools/Instrumentation.hpp>
 
 namespace sgpp {
 namespace solver {
@@ -21,6 +22,7 @@ ConjugateGradientsSP::~ConjugateGradientsSP() {}
 void ConjugateGradientsSP::solve(sgpp::base::OperationMatrixSP& SystemMatrix,
                                  sgpp::base::DataVectorSP& alpha, sgpp::base::DataVectorSP& b,
                                  bool reuse, bool verbose, float max_threshold) {
+  SGPP_INSTRUMENT_SCOPE("ConjugateGradientsSP::solve");
   if (verbose == true) {
     std::cout << "Starting Conjugated Gradients" << std::endl;
   }
@@ -10,6 +10,7 @@
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/ode/Euler.hpp>
 #include <sgpp/solver/ode/CrankNicolson.hpp>
+#include <sgpp/solver/ode/WarmStartTimestepping.hpp>
 #include <sgpp/solver/ode/AdamsBashforth.hpp>
 #include <sgpp/solver/ode/VarTimestep.hpp>
 #include <sgpp/solver/ode/StepsizeControl.hpp>